@@ -0,0 +1,164 @@
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <limits>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <gvizard/graph/graph.hpp>
+#include <gvizard/passes/bounding_box.hpp>
+#include <gvizard/parallel/parallel_for.hpp>
+#include <gvizard/registry/entt_registry.hpp>
+#include <gvizard/utils.hpp>
+
+#include <gvizard/attrs/pos.hpp>
+
+// computes bounding boxes of a graph of 3000 nodes by default, with 30
+// edges of 4 curved segments from each node to others, by the pass and
+// by a plain loop visiting each point and solving each segment alone,
+// each the best of 5 runs.
+// graphs hold a matrix of their nodes, so nodes are few and edges many.
+
+using namespace gviz;
+
+namespace {
+
+using Graph = graph::Graph<registry::EnTTRegistry, graph::GraphDir::directed>;
+
+// extent of one coordinate of a cubic, solved for one segment at a time.
+void naive_extent(double p0, double p1, double p2, double p3,
+                  double& low, double& high)
+{
+  low  = std::min({ low, p0, p3 });
+  high = std::max({ high, p0, p3 });
+
+  const double a = p3 - p0 + 3. * (p1 - p2);
+  const double b = 2. * (p0 - 2. * p1 + p2);
+  const double c = p1 - p0;
+
+  const auto consider = [&](double t) {
+    if (!(t > 0. && t < 1.))
+      return;
+    const double u = 1. - t;
+    const double value = u * u * u * p0 + 3. * u * u * t * p1
+                       + 3. * u * t * t * p2 + t * t * t * p3;
+    low  = std::min(low, value);
+    high = std::max(high, value);
+  };
+
+  if (std::abs(a) > 1e-12) {
+    const double disc = b * b - 4. * a * c;
+    if (disc >= 0.) {
+      consider((-b + std::sqrt(disc)) / (2. * a));
+      consider((-b - std::sqrt(disc)) / (2. * a));
+    }
+  }
+  else if (b != 0.) {
+    consider(-c / b);
+  }
+}
+
+double naive(const Graph& graph)
+{
+  double area = 0.;
+  for (auto edge : graph.edges_view()) {
+    const auto& pos = graph.get_entity_attr<attrs::Pos>(edge)->get_value();
+    const auto& splines = std::get<attrtypes::SplineType<std::vector>>(*pos);
+
+    double llx = 1e300, lly = 1e300, urx = -1e300, ury = -1e300;
+    for (const auto& spline : splines.splines) {
+      auto previous = attrtypes::Point2D<double>(spline.point);
+      for (const auto& [first, second, third] : spline.triples) {
+        const attrtypes::Point2D<double> points[4] = {
+          previous, attrtypes::Point2D<double>(first),
+          attrtypes::Point2D<double>(second),
+          attrtypes::Point2D<double>(third) };
+        naive_extent(points[0].x, points[1].x, points[2].x, points[3].x,
+                     llx, urx);
+        naive_extent(points[0].y, points[1].y, points[2].y, points[3].y,
+                     lly, ury);
+        previous = points[3];
+      }
+    }
+    area += (urx - llx) * (ury - lly);
+  }
+  return area;
+}
+
+}  // namespace
+
+int main(int argc, char* argv[])
+{
+  const std::size_t count = argc > 1 ? std::stoul(argv[1]) : 3000;
+  const std::size_t degree = argc > 2 ? std::stoul(argv[2]) : 30;
+
+  std::mt19937 random(42);
+  std::uniform_real_distribution<double> place(0., 10000.), bend(-50., 50.);
+
+  Graph graph{};
+  std::vector<Graph::NodeId> nodes{};
+  for (std::size_t i = 0; i < count; ++i) {
+    nodes.push_back(graph.create_node());
+    graph.set_entity_attr<attrs::Pos>(
+      nodes.back(),
+      attrs::PosType(attrtypes::PointType<double>(place(random),
+                                                  place(random))));
+  }
+
+  std::uniform_int_distribution<std::size_t> pick(0, count - 1);
+  for (std::size_t i = 0; i < count * degree; ++i) {
+    const auto edge = graph.create_edge(nodes[i / degree],
+                                        nodes[pick(random)]);
+    if (!edge)
+      continue;
+
+    double x = place(random), y = place(random);
+    attrtypes::Spline<> spline{};
+    spline.set_point(attrtypes::spline_point_type(x, y));
+    for (int s = 0; s < 4; ++s) {
+      std::array<attrtypes::spline_point_type, 3> points{};
+      for (auto& point : points) {
+        x += bend(random);
+        y += bend(random);
+        point = attrtypes::spline_point_type(x, y);
+      }
+      spline.add_triples({ points[0], points[1], points[2] });
+    }
+
+    attrtypes::SplineType<std::vector> splines{};
+    splines.add_spline(spline);
+    graph.set_entity_attr<attrs::Pos>(*edge, attrs::PosType(splines));
+  }
+
+  std::cout << count << " nodes, " << graph.edge_count()
+            << " edges of 4 segments, "
+            << parallel::default_concurrency() << " threads\n";
+
+  // the best of a few runs, so that neither pays alone for a cold
+  // cache or pages touched the first time.
+  const auto run = [&](const char *title, auto&& func) {
+    double best = std::numeric_limits<double>::infinity(), checksum = 0.;
+    for (int i = 0; i < 5; ++i) {
+      const auto start = std::chrono::steady_clock::now();
+      checksum = func();
+      const auto stop  = std::chrono::steady_clock::now();
+      best = std::min(
+        best, std::chrono::duration<double, std::milli>(stop - start).count());
+    }
+    std::cout << title << ": " << best << " ms (" << checksum << ")\n";
+  };
+
+  run("naive edges", [&] { return naive(graph); });
+  for (unsigned threads : { 1u, 0u })
+    run(threads == 1 ? "pass, 1 thread" : "pass, all threads", [&] {
+      const auto boxes = passes::compute_bounding_boxes(graph, threads);
+      double area = 0.;
+      for (const auto& item : boxes.edges)
+        area += item.box.width() * item.box.height();
+      return area;
+    });
+}
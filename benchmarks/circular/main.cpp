@@ -0,0 +1,77 @@
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <gvizard/layout/circular.hpp>
+#include <gvizard/layout/layout_graph.hpp>
+#include <gvizard/parallel/parallel_for.hpp>
+
+// lays out a forest of cycles, each cycle hanging off a node of one
+// before it, 1M nodes in cycles of 8 and 100 components by default, on
+// one thread and on all.
+
+using namespace gviz;
+
+int main(int argc, char* argv[])
+{
+  const std::size_t count  = argc > 1 ? std::stoul(argv[1]) : 1000000;
+  const std::size_t length = argc > 2 ? std::stoul(argv[2]) : 8;
+  const std::size_t trees  = argc > 3 ? std::stoul(argv[3]) : 100;
+
+  std::mt19937 random(42);
+
+  std::vector<layout::LayoutEdge> edges{};
+  const std::size_t cycles = count / length;
+  for (std::size_t cycle = 0; cycle < cycles; ++cycle) {
+    const std::size_t first = cycle * length;
+    for (std::size_t i = 0; i < length; ++i)
+      edges.push_back(layout::LayoutEdge{
+        uint32_t(first + i), uint32_t(first + (i + 1) % length) });
+
+    if (cycle >= trees) {
+      std::uniform_int_distribution<std::size_t> earlier(
+        0, cycle / trees - 1);
+      const std::size_t parent = earlier(random) * trees + cycle % trees;
+      edges.push_back(layout::LayoutEdge{
+        uint32_t(parent * length + cycle % length), uint32_t(first) });
+    }
+  }
+
+  const layout::LayoutGraph graph(
+    std::vector<layout::LayoutNode>(cycles * length), std::move(edges));
+
+  std::cout << graph.node_count() << " nodes, " << graph.edge_count()
+            << " edges, " << parallel::default_concurrency()
+            << " threads\n";
+
+  const auto run = [&](const char *title,
+                       const layout::CircularOptions& options) {
+    const auto start  = std::chrono::steady_clock::now();
+    const auto result = layout::circular(graph, options);
+    const auto stop   = std::chrono::steady_clock::now();
+
+    double width = 0., height = 0.;
+    for (const auto& point : result.positions) {
+      width  = std::max(width, point.x);
+      height = std::max(height, point.y);
+    }
+
+    std::cout << title << ": "
+              << std::chrono::duration<double, std::milli>(stop - start)
+                   .count()
+              << " ms, " << width << "x" << height
+              << " points\n";
+  };
+
+  layout::CircularOptions options{};
+  options.threads = 1;
+  run("1 thread", options);
+
+  options.threads = 0;
+  run("all threads", options);
+}
@@ -0,0 +1,77 @@
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <gvizard/layout/clusters.hpp>
+#include <gvizard/layout/layout_graph.hpp>
+#include <gvizard/layout/osage.hpp>
+#include <gvizard/layout/patchwork.hpp>
+#include <gvizard/parallel/parallel_for.hpp>
+
+// lays out nodes of random areas in clusters by patchwork and by osage,
+// 1M nodes in 1000 clusters by default, on one thread and on all.
+
+using namespace gviz;
+
+int main(int argc, char* argv[])
+{
+  const std::size_t count    = argc > 1 ? std::stoul(argv[1]) : 1000000;
+  const std::size_t clusters = argc > 2 ? std::stoul(argv[2]) : 1000;
+
+  std::mt19937 random(42);
+  std::uniform_real_distribution<double> area(.1, 4.);
+  std::uniform_int_distribution<uint32_t> cluster(0, uint32_t(clusters));
+
+  std::vector<uint32_t> cluster_of(count);
+  for (auto& number : cluster_of)
+    number = cluster(random);
+
+  const layout::LayoutGraph graph(std::vector<layout::LayoutNode>(count),
+                                  {});
+  const layout::Clusters groups(std::move(cluster_of), clusters);
+
+  layout::PatchworkOptions patchwork{};
+  for (std::size_t node = 0; node < count; ++node)
+    patchwork.areas.push_back(area(random));
+
+  std::cout << graph.node_count() << " nodes, " << groups.count()
+            << " clusters, " << parallel::default_concurrency()
+            << " threads\n";
+
+  const auto run = [&](const char *title, auto&& engine) {
+    const auto start  = std::chrono::steady_clock::now();
+    const auto result = engine();
+    const auto stop   = std::chrono::steady_clock::now();
+
+    double width = 0., height = 0.;
+    for (const auto& box : result.clusters) {
+      width  = std::max(width, box.urx);
+      height = std::max(height, box.ury);
+    }
+
+    std::cout << title << ": "
+              << std::chrono::duration<double, std::milli>(stop - start)
+                   .count()
+              << " ms, " << width << "x" << height << " points\n";
+  };
+
+  for (unsigned threads : { 1u, 0u }) {
+    const char *suffix = threads == 1 ? ", 1 thread" : ", all threads";
+
+    patchwork.threads = threads;
+    run((std::string("patchwork") + suffix).c_str(), [&] {
+      return layout::patchwork(graph, groups, patchwork);
+    });
+
+    layout::OsageOptions osage{};
+    osage.threads = threads;
+    run((std::string("osage") + suffix).c_str(), [&] {
+      return layout::osage(graph, groups, osage);
+    });
+  }
+}
@@ -0,0 +1,63 @@
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <gvizard/layout/coarsening.hpp>
+#include <gvizard/layout/layout_graph.hpp>
+#include <gvizard/parallel/parallel_for.hpp>
+
+// coarsens a random graph of a ring of nodes, each linked to a few others
+// nearby along it, 1M nodes by default, by either scheme on one thread
+// and on all.
+
+using namespace gviz;
+
+int main(int argc, char* argv[])
+{
+  const std::size_t count  = argc > 1 ? std::stoul(argv[1]) : 1000000;
+  const std::size_t degree = argc > 2 ? std::stoul(argv[2]) : 2;
+
+  std::mt19937 random(42);
+  std::uniform_int_distribution<uint32_t> span(1, 20);
+
+  std::vector<layout::LayoutEdge> edges{};
+  for (std::size_t node = 0; node < count; ++node)
+    for (std::size_t i = 0; i < degree; ++i)
+      edges.push_back(layout::LayoutEdge{
+        uint32_t(node), uint32_t((node + span(random)) % count) });
+
+  const layout::LayoutGraph graph(std::vector<layout::LayoutNode>(count),
+                                  std::move(edges));
+
+  std::cout << graph.node_count() << " nodes, " << graph.edge_count()
+            << " edges, " << parallel::default_concurrency()
+            << " threads\n";
+
+  const auto run = [&](const char *title,
+                       const layout::CoarseningOptions& options) {
+    const auto start  = std::chrono::steady_clock::now();
+    const auto levels = layout::coarsen(graph, options);
+    const auto stop   = std::chrono::steady_clock::now();
+
+    std::cout << title << ": "
+              << std::chrono::duration<double, std::milli>(stop - start)
+                   .count()
+              << " ms, " << levels.size() << " levels to "
+              << (levels.empty() ? count : levels.back().graph.node_count())
+              << " nodes\n";
+  };
+
+  layout::CoarseningOptions options{};
+  options.threads = 1;
+  run("matching, 1 thread", options);
+
+  options.threads = 0;
+  run("matching, all threads", options);
+
+  options.scheme = layout::CoarseningScheme::independent_set;
+  run("independent set, all threads", options);
+}
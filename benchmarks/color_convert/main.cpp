@@ -0,0 +1,85 @@
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <gvizard/utils.hpp>
+#include <gvizard/colors/batch.hpp>
+#include <gvizard/colors/hsv.hpp>
+#include <gvizard/colors/rgb.hpp>
+#include <gvizard/colors/rgba.hpp>
+
+// compares converting colors one at a time through utils::Converter
+// against colors::batch::convert, on a heatmap-like HSV gradient and
+// on RGB colors spread over the cube.
+//
+// build with e.g. -march=native (or -mavx2), without AVX2 the batch
+// conversions fall back to the scalar ones.
+
+using namespace gviz;
+
+template <typename F>
+double time_ms(std::size_t rounds, F&& func)
+{
+  const auto start = std::chrono::steady_clock::now();
+  for (std::size_t round = 0; round < rounds; ++round)
+    func();
+  const auto stop = std::chrono::steady_clock::now();
+
+  return std::chrono::duration<double, std::milli>(stop - start).count();
+}
+
+template <typename To, typename From>
+void run(const char *title, const std::vector<From>& colors,
+         std::size_t rounds)
+{
+  std::vector<To> scalar{};
+  std::vector<To> batched{};
+
+  const auto scalar_ms = time_ms(rounds, [&]() {
+    scalar.clear();
+    scalar.reserve(colors.size());
+    for (const auto& color : colors)
+      scalar.push_back(utils::Converter<From, To>::convert(color));
+  });
+
+  const auto batch_ms = time_ms(rounds, [&]() {
+    batched = colors::batch::convert<To>(colors);
+  });
+
+  const auto mcolors = double(colors.size() * rounds) / 1e6;
+
+  std::cout << title << ":\n"
+            << "  scalar: " << mcolors / (scalar_ms / 1e3) << " Mcolors/s\n"
+            << "  batch:  " << mcolors / (batch_ms / 1e3) << " Mcolors/s\n"
+            << "  identical: " << (scalar == batched ? "yes" : "no") << '\n';
+}
+
+int main(int argc, char* argv[])
+{
+  const std::size_t count  = argc > 1 ? std::stoul(argv[1]) : 1 << 20;
+  const std::size_t rounds = argc > 2 ? std::stoul(argv[2]) : 20;
+
+  std::vector<colors::HSV> gradient{};
+  gradient.reserve(count);
+  for (std::size_t i = 0; i < count; ++i) {
+    const double t = double(i) / double(count);
+    gradient.emplace_back(t, 0.5 + 0.5 * t, 1. - 0.5 * t);
+  }
+
+  std::vector<colors::RGB> cube{};
+  cube.reserve(count);
+  for (std::size_t i = 0; i < count; ++i) {
+    const auto bits = uint32_t(i * 2654435761u);
+    cube.emplace_back(uint8_t(bits), uint8_t(bits >> 8), uint8_t(bits >> 16));
+  }
+
+  std::cout << count << " colors x " << rounds << " rounds\n";
+
+  run<colors::RGBA>("HSV -> RGBA", gradient, rounds);
+  run<colors::HSV>("RGB -> HSV", cube, rounds);
+
+  return 0;
+}
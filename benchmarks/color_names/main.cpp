@@ -0,0 +1,84 @@
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <iterator>
+#include <optional>
+#include <random>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <gvizard/utils.hpp>
+#include <gvizard/colors/names.hpp>
+#include <gvizard/colors/x11.hpp>
+
+// compares name to color lookups over X11 color names:
+//  - perfect hash of gvizard/colors/names.hpp,
+//  - magic_enum's enum_cast (through utils::EnumHelper),
+//  - a plain linear scan over X11Color::list.
+
+using namespace gviz;
+
+template <typename F>
+void run(const char *title, const std::vector<std::string>& queries,
+         std::size_t rounds, F&& lookup)
+{
+  std::size_t checksum = 0;
+
+  const auto start = std::chrono::steady_clock::now();
+  for (std::size_t round = 0; round < rounds; ++round)
+    for (const auto& query : queries)
+      checksum += lookup(std::string_view(query)).value_or(0);
+  const auto stop = std::chrono::steady_clock::now();
+
+  const auto ns =
+    std::chrono::duration<double, std::nano>(stop - start).count();
+
+  std::cout << title << ": "
+            << ns / double(rounds * queries.size()) << " ns/lookup"
+            << " (checksum " << checksum << ")\n";
+}
+
+int main(int argc, char* argv[])
+{
+  const std::size_t rounds = argc > 1 ? std::stoul(argv[1]) : 200;
+
+  // all names, plus a miss for every fourth one, in random order.
+  std::vector<std::string> queries{};
+  for (const auto& color : colors::X11Color::list) {
+    queries.emplace_back(color.name);
+    if (queries.size() % 4 == 0)
+      queries.emplace_back(std::string(color.name) + "x");
+  }
+
+  std::shuffle(queries.begin(), queries.end(), std::mt19937(42));
+
+  std::cout << queries.size() << " queries x " << rounds << " rounds\n";
+
+  const auto to_index = [](auto opt_enum) -> std::optional<std::size_t> {
+    if (!opt_enum) return std::nullopt;
+    return std::size_t(*opt_enum) + 1;
+  };
+
+  run("perfect hash", queries, rounds, [&](std::string_view name) {
+    return to_index(colors::find_x11_color(name));
+  });
+
+  run("magic_enum  ", queries, rounds, [&](std::string_view name) {
+    return to_index(utils::EnumHelper<colors::X11ColorEnum>::from_str(name));
+  });
+
+  run("linear scan ", queries, rounds, [&](std::string_view name) {
+    std::optional<std::size_t> ret{};
+    for (std::size_t i = 0; i < std::size(colors::X11Color::list); ++i)
+      if (colors::X11Color::list[i].name == name) {
+        ret = i + 1;
+        break;
+      }
+    return ret;
+  });
+
+  return 0;
+}
@@ -0,0 +1,81 @@
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <iterator>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <gvizard/colors/general.hpp>
+#include <gvizard/colors/nearest.hpp>
+#include <gvizard/colors/rgb.hpp>
+#include <gvizard/colors/x11.hpp>
+
+// compares nearest named color lookups over the X11 table:
+//  - k-d tree of gvizard/colors/nearest.hpp,
+//  - a plain linear scan over X11Color::list, by the same distance.
+
+using namespace gviz;
+
+template <typename F>
+void run(const char *title, const std::vector<colors::RGB>& queries,
+         std::size_t rounds, F&& lookup)
+{
+  std::size_t checksum = 0;
+
+  const auto start = std::chrono::steady_clock::now();
+  for (std::size_t round = 0; round < rounds; ++round)
+    for (const auto& query : queries)
+      checksum += lookup(query);
+  const auto stop = std::chrono::steady_clock::now();
+
+  const auto ns =
+    std::chrono::duration<double, std::nano>(stop - start).count();
+
+  std::cout << title << ": "
+            << ns / double(rounds * queries.size()) << " ns/lookup"
+            << " (checksum " << checksum << ")\n";
+}
+
+int main(int argc, char* argv[])
+{
+  const std::size_t count  = argc > 1 ? std::stoul(argv[1]) : 10000;
+  const std::size_t rounds = argc > 2 ? std::stoul(argv[2]) : 20;
+
+  // random colors, plus every named one for exact hits.
+  std::mt19937 rng(42);
+  std::uniform_int_distribution<int> octet(0, 255);
+
+  std::vector<colors::RGB> queries{};
+  for (std::size_t i = 0; i < count; ++i)
+    queries.emplace_back(uint8_t(octet(rng)), uint8_t(octet(rng)),
+                         uint8_t(octet(rng)));
+
+  for (const auto& color : colors::X11Color::list)
+    queries.push_back(color.color);
+
+  std::cout << queries.size() << " queries x " << rounds << " rounds\n";
+
+  run("k-d tree", queries, rounds, [](const colors::RGB& color) {
+    return std::size_t(
+      colors::nearest_named(color, colors::SchemeEnum::X11).color.r);
+  });
+
+  run("linear scan", queries, rounds, [](const colors::RGB& color) {
+    const auto& list = colors::X11Color::list;
+
+    std::size_t best = 0;
+    int32_t best_distance = colors::color_distance(color, list[0].color);
+
+    for (std::size_t i = 1; i < std::size(list); ++i) {
+      const auto distance = colors::color_distance(color, list[i].color);
+      if (distance < best_distance) {
+        best = i;
+        best_distance = distance;
+      }
+    }
+
+    return std::size_t(list[best].color.r);
+  });
+}
@@ -0,0 +1,82 @@
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <gvizard/layout/components.hpp>
+#include <gvizard/layout/layout_graph.hpp>
+#include <gvizard/layout/packing.hpp>
+#include <gvizard/layout/stress.hpp>
+#include <gvizard/parallel/parallel_for.hpp>
+
+// lays out a forest of random trees of up to 60 nodes by stress, 2000
+// trees by default, packing them in each mode, on one thread and on all.
+
+using namespace gviz;
+
+int main(int argc, char* argv[])
+{
+  const std::size_t trees = argc > 1 ? std::stoul(argv[1]) : 2000;
+
+  std::mt19937 random(42);
+  std::uniform_int_distribution<std::size_t> size(1, 60);
+
+  std::size_t count = 0;
+  std::vector<layout::LayoutEdge> edges{};
+  for (std::size_t tree = 0; tree < trees; ++tree) {
+    const std::size_t first = count;
+    count += size(random);
+    for (std::size_t node = first + 1; node < count; ++node) {
+      std::uniform_int_distribution<std::size_t> parent(first, node - 1);
+      edges.push_back(layout::LayoutEdge{ uint32_t(parent(random)),
+                                          uint32_t(node) });
+    }
+  }
+
+  const layout::LayoutGraph graph(std::vector<layout::LayoutNode>(count),
+                                  std::move(edges));
+
+  std::cout << graph.node_count() << " nodes, " << trees << " trees, "
+            << parallel::default_concurrency() << " threads\n";
+
+  const auto engine = [](const layout::LayoutGraph& part,
+                         unsigned threads) {
+    layout::StressOptions options{};
+    options.threads = threads;
+    return layout::stress(part, options);
+  };
+
+  const auto run = [&](const char *title, const layout::PackOptions& options) {
+    const auto start  = std::chrono::steady_clock::now();
+    const auto result = layout::layout_components(graph, engine, options);
+    const auto stop   = std::chrono::steady_clock::now();
+
+    double width = 0., height = 0.;
+    for (const auto& point : result.positions) {
+      width  = std::max(width, point.x);
+      height = std::max(height, point.y);
+    }
+
+    std::cout << title << ": "
+              << std::chrono::duration<double, std::milli>(stop - start)
+                   .count()
+              << " ms, " << width << "x" << height << " points\n";
+  };
+
+  layout::PackOptions options{};
+  options.threads = 1;
+  run("nodes, 1 thread", options);
+
+  options.threads = 0;
+  run("nodes, all threads", options);
+
+  options.packmode = attrtypes::PackMode{ attrtypes::PackModeEnum::graph };
+  run("graph, all threads", options);
+
+  options.packmode = attrtypes::PackMode{ attrtypes::PackModeEnum::array };
+  run("array, all threads", options);
+}
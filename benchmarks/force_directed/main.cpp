@@ -0,0 +1,71 @@
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <gvizard/layout/force_directed.hpp>
+#include <gvizard/layout/layout_graph.hpp>
+#include <gvizard/parallel/parallel_for.hpp>
+
+// lays out a random graph of a ring of nodes, each linked to a few others
+// nearby along it, 1M edges by default:
+//  - 50 iterations on one thread and on all, to compare iteration costs,
+//  - until it settles on all threads, in 2 and 3 dimensions.
+
+using namespace gviz;
+
+int main(int argc, char* argv[])
+{
+  const std::size_t count  = argc > 1 ? std::stoul(argv[1]) : 500000;
+  const std::size_t degree = argc > 2 ? std::stoul(argv[2]) : 2;
+
+  std::mt19937 random(42);
+  std::uniform_int_distribution<uint32_t> span(1, 20);
+
+  std::vector<layout::LayoutEdge> edges{};
+  for (std::size_t node = 0; node < count; ++node)
+    for (std::size_t i = 0; i < degree; ++i)
+      edges.push_back(layout::LayoutEdge{
+        uint32_t(node), uint32_t((node + span(random)) % count) });
+
+  const layout::LayoutGraph graph(std::vector<layout::LayoutNode>(count),
+                                  std::move(edges));
+
+  std::cout << graph.node_count() << " nodes, " << graph.edge_count()
+            << " edges, " << parallel::default_concurrency()
+            << " threads\n";
+
+  const auto run = [&](const char *title, layout::ForceOptions options) {
+    const auto start  = std::chrono::steady_clock::now();
+    const auto result = layout::force_directed(graph, options);
+    const auto stop   = std::chrono::steady_clock::now();
+
+    double width = 0., height = 0.;
+    for (const auto& point : result.positions) {
+      width  = std::max(width, point.x);
+      height = std::max(height, point.y);
+    }
+
+    std::cout << title << ": "
+              << std::chrono::duration<double, std::milli>(stop - start)
+                   .count()
+              << " ms, " << width << "x" << height << " points\n";
+  };
+
+  layout::ForceOptions options{};
+  options.maxiter = 50;
+  options.threads = 1;
+  run("50 iterations, 1 thread", options);
+
+  options.threads = 0;
+  run("50 iterations, all threads", options);
+
+  options.maxiter = std::nullopt;
+  run("all threads", options);
+
+  options.dim = 3;
+  run("3 dimensions", options);
+}
@@ -0,0 +1,104 @@
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <gvizard/colors/converter.hpp>
+#include <gvizard/colors/general.hpp>
+#include <gvizard/colors/gradient.hpp>
+#include <gvizard/colors/hsv.hpp>
+#include <gvizard/colors/rgba.hpp>
+
+// compares sampling a 4 color gradient at evenly spaced positions:
+//  - Gradient::sample, several positions at a time,
+//  - Gradient::at, one position at a time,
+//  - a naive per sample lerp in doubles, converting HSV by Converter.
+
+using namespace gviz;
+
+template <typename F>
+void run(const char *title, std::size_t count, std::size_t rounds, F&& fill)
+{
+  std::vector<uint32_t> out(count);
+  uint64_t checksum = 0;
+
+  const auto start = std::chrono::steady_clock::now();
+  for (std::size_t round = 0; round < rounds; ++round) {
+    fill(out.data());
+    checksum += out[round % count];
+  }
+  const auto stop = std::chrono::steady_clock::now();
+
+  const auto ns =
+    std::chrono::duration<double, std::nano>(stop - start).count();
+
+  std::cout << title << ": " << ns / double(rounds * count)
+            << " ns/sample (checksum " << checksum << ")\n";
+}
+
+int main(int argc, char* argv[])
+{
+  const std::size_t count  = argc > 1 ? std::stoul(argv[1]) : 4096;
+  const std::size_t rounds = argc > 2 ? std::stoul(argv[2]) : 2000;
+
+  const std::vector<colors::WeightedColor<colors::RGBA>> list = {
+    { colors::RGBA{ 255, 0, 0, 255 }, 0. },
+    { colors::RGBA{ 255, 255, 0, 255 }, 0. },
+    { colors::RGBA{ 0, 128, 255, 192 }, 0. },
+    { colors::RGBA{ 64, 0, 128, 255 }, 0. },
+  };
+
+  std::cout << count << " samples x " << rounds << " rounds\n";
+
+  for (const auto space : { colors::GradientSpace::RGB,
+                            colors::GradientSpace::HSV }) {
+    const bool hsv = space == colors::GradientSpace::HSV;
+    std::cout << (hsv ? "HSV\n" : "RGB\n");
+
+    const colors::Gradient gradient(list, space);
+
+    run("  sample", count, rounds, [&](uint32_t *out) {
+      gradient.sample(count, out);
+    });
+
+    run("  at", count, rounds, [&](uint32_t *out) {
+      for (std::size_t i = 0; i < count; ++i)
+        out[i] = gradient.at(i / float(count - 1));
+    });
+
+    run("  naive", count, rounds, [&](uint32_t *out) {
+      using utils::Converter;
+
+      for (std::size_t i = 0; i < count; ++i) {
+        const double pos = double(i) / double(count - 1) * 3.;
+        const auto   seg = std::size_t(pos < 3. ? pos : 2.);
+        const double u   = pos - double(seg);
+
+        const auto lo = list[seg].get_color();
+        const auto hi = list[seg + 1].get_color();
+
+        const auto lerp = [&](double a, double b) { return a + u * (b - a); };
+        const auto alpha = uint8_t(lerp(lo.a, hi.a) + .5);
+
+        colors::RGBA color{ 0, 0, 0, alpha };
+        if (hsv) {
+          const auto l = Converter<colors::RGBA, colors::HSV>::convert(lo);
+          const auto h = Converter<colors::RGBA, colors::HSV>::convert(hi);
+          color = Converter<colors::HSV, colors::RGBA>::convert(colors::HSV(
+            lerp(l.hue(), h.hue()), lerp(l.saturation(), h.saturation()),
+            lerp(l.value(), h.value())));
+          color.a = alpha;
+        }
+        else {
+          color = colors::RGBA{ uint8_t(lerp(lo.r, hi.r) + .5),
+                                uint8_t(lerp(lo.g, hi.g) + .5),
+                                uint8_t(lerp(lo.b, hi.b) + .5), alpha };
+        }
+
+        out[i] = color.to_binary();
+      }
+    });
+  }
+}
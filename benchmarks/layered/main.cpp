@@ -0,0 +1,72 @@
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <gvizard/layout/layered.hpp>
+#include <gvizard/layout/layout_graph.hpp>
+#include <gvizard/parallel/parallel_for.hpp>
+
+// lays out a random DAG whose edges mostly link nodes created close to
+// each other, like call graphs or build dependencies do:
+//  - on one thread and on all,
+//  - with crossing minimization limited by mclimit 0.25.
+// the graph is built as a `LayoutGraph`, as `Graph` keeps an adjacency
+// matrix which doesn't scale to that many nodes.
+
+using namespace gviz;
+
+int main(int argc, char* argv[])
+{
+  const std::size_t count  = argc > 1 ? std::stoul(argv[1]) : 50000;
+  const std::size_t degree = argc > 2 ? std::stoul(argv[2]) : 2;
+
+  std::mt19937 random(42);
+  std::uniform_int_distribution<uint32_t> span(1, 40);
+
+  std::vector<layout::LayoutEdge> edges{};
+  for (std::size_t node = 0; node < count; ++node)
+    for (std::size_t i = 0; i < degree; ++i) {
+      const std::size_t target = node + span(random);
+      if (target < count)
+        edges.push_back(
+          layout::LayoutEdge{ uint32_t(node), uint32_t(target) });
+    }
+
+  const layout::LayoutGraph graph(std::vector<layout::LayoutNode>(count),
+                                  std::move(edges));
+
+  std::cout << graph.node_count() << " nodes, " << graph.edge_count()
+            << " edges, " << parallel::default_concurrency()
+            << " threads\n";
+
+  const auto run = [&](const char *title, layout::LayeredOptions options) {
+    const auto start  = std::chrono::steady_clock::now();
+    const auto result = layout::layered(graph, options);
+    const auto stop   = std::chrono::steady_clock::now();
+
+    double width = 0., height = 0.;
+    for (const auto& point : result.positions) {
+      width  = std::max(width, point.x);
+      height = std::max(height, point.y);
+    }
+
+    std::cout << title << ": "
+              << std::chrono::duration<double, std::milli>(stop - start)
+                   .count()
+              << " ms, " << width << "x" << height << " points\n";
+  };
+
+  layout::LayeredOptions options{};
+  options.threads = 1;
+  run("1 thread", options);
+
+  options.threads = 0;
+  run("all threads", options);
+
+  options.mclimit = .25;
+  run("mclimit 0.25", options);
+}
@@ -0,0 +1,81 @@
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <gvizard/layout/layout_graph.hpp>
+#include <gvizard/layout/overlap.hpp>
+#include <gvizard/parallel/parallel_for.hpp>
+
+// removes overlaps of 100k nodes by default, placed as a layout of a
+// grid graph would place them, jittered and closer than their sizes, by
+// each mode on one thread and on all.
+
+using namespace gviz;
+
+int main(int argc, char* argv[])
+{
+  const std::size_t count   = argc > 1 ? std::stoul(argv[1]) : 100000;
+  const double      spacing = argc > 2 ? std::stod(argv[2]) : 30.;
+
+  const auto side = std::size_t(std::ceil(std::sqrt(double(count))));
+
+  std::mt19937 random(42);
+  std::uniform_real_distribution<double> jitter(-spacing / 2.,
+                                                spacing / 2.);
+
+  std::vector<layout::LayoutEdge> edges{};
+  layout::Layout placed{};
+  for (std::size_t i = 0; i < count; ++i) {
+    if (i % side + 1 < side && i + 1 < count)
+      edges.push_back(layout::LayoutEdge{ uint32_t(i), uint32_t(i + 1) });
+    if (i + side < count)
+      edges.push_back(layout::LayoutEdge{ uint32_t(i), uint32_t(i + side) });
+
+    placed.positions.push_back(layout::Point{
+      spacing * double(i % side) + jitter(random),
+      spacing * double(i / side) + jitter(random) });
+  }
+
+  const layout::LayoutGraph graph(std::vector<layout::LayoutNode>(count),
+                                  std::move(edges));
+
+  std::cout << graph.node_count() << " nodes, " << graph.edge_count()
+            << " edges, " << parallel::default_concurrency()
+            << " threads\n";
+
+  const auto run = [&](const char *title,
+                       const layout::OverlapOptions& options) {
+    const auto start  = std::chrono::steady_clock::now();
+    const auto result = layout::remove_overlaps(graph, placed, options);
+    const auto stop   = std::chrono::steady_clock::now();
+
+    double width = 0., height = 0.;
+    for (const auto& point : result.positions) {
+      width  = std::max(width, point.x);
+      height = std::max(height, point.y);
+    }
+
+    std::cout << title << ": "
+              << std::chrono::duration<double, std::milli>(stop - start)
+                   .count()
+              << " ms, " << width << "x" << height
+              << " points\n";
+  };
+
+  for (const char *mode : { "prism", "scale", "scalexy" }) {
+    layout::OverlapOptions options{};
+    options.overlap = std::string(mode);
+
+    options.threads = 1;
+    run((std::string(mode) + ", 1 thread").c_str(), options);
+
+    options.threads = 0;
+    run((std::string(mode) + ", all threads").c_str(), options);
+  }
+}
@@ -0,0 +1,65 @@
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <gvizard/layout/layout_graph.hpp>
+#include <gvizard/layout/radial.hpp>
+#include <gvizard/parallel/parallel_for.hpp>
+
+// lays out a forest of random trees, each node linked to one before it,
+// 1M nodes in 100 trees by default, on one thread and on all.
+
+using namespace gviz;
+
+int main(int argc, char* argv[])
+{
+  const std::size_t count = argc > 1 ? std::stoul(argv[1]) : 1000000;
+  const std::size_t trees = argc > 2 ? std::stoul(argv[2]) : 100;
+
+  std::mt19937 random(42);
+
+  std::vector<layout::LayoutEdge> edges{};
+  for (std::size_t node = trees; node < count; ++node) {
+    std::uniform_int_distribution<std::size_t> earlier(0, node / trees - 1);
+    edges.push_back(layout::LayoutEdge{
+      uint32_t(earlier(random) * trees + node % trees), uint32_t(node) });
+  }
+
+  const layout::LayoutGraph graph(std::vector<layout::LayoutNode>(count),
+                                  std::move(edges));
+
+  std::cout << graph.node_count() << " nodes, " << graph.edge_count()
+            << " edges, " << parallel::default_concurrency()
+            << " threads\n";
+
+  const auto run = [&](const char *title,
+                       const layout::RadialOptions& options) {
+    const auto start  = std::chrono::steady_clock::now();
+    const auto result = layout::radial(graph, options);
+    const auto stop   = std::chrono::steady_clock::now();
+
+    double width = 0., height = 0.;
+    for (const auto& point : result.positions) {
+      width  = std::max(width, point.x);
+      height = std::max(height, point.y);
+    }
+
+    std::cout << title << ": "
+              << std::chrono::duration<double, std::milli>(stop - start)
+                   .count()
+              << " ms, " << width << "x" << height
+              << " points\n";
+  };
+
+  layout::RadialOptions options{};
+  options.threads = 1;
+  run("1 thread", options);
+
+  options.threads = 0;
+  run("all threads", options);
+}
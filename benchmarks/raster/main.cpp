@@ -0,0 +1,115 @@
+#include <chrono>
+#include <cstddef>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <gvizard/attrtypes/spline.hpp>
+#include <gvizard/parallel/parallel_for.hpp>
+#include <gvizard/render/image.hpp>
+#include <gvizard/render/raster.hpp>
+#include <gvizard/render/visuals.hpp>
+
+// rasterizes a grid of filled nodes, each linked to its right neighbour:
+//  - into a 2048 pixels wide thumbnail, on one thread and on all,
+//  - into a full size crop of the grid's middle,
+//  - and writes the thumbnail as PNG.
+// nodes are drawn from resolved visuals, as `Graph` keeps an adjacency
+// matrix which doesn't scale to that many nodes.
+
+using namespace gviz;
+
+int main(int argc, char* argv[])
+{
+  const std::size_t count  = argc > 1 ? std::stoul(argv[1]) : 100000;
+  const std::size_t rounds = argc > 2 ? std::stoul(argv[2]) : 5;
+
+  const std::size_t columns = 300;
+  const double      spacing = 100.;
+
+  std::vector<render::NodeVisual> nodes(count);
+  std::vector<render::EdgeVisual> edges{};
+  std::vector<render::EdgeVisual::splines_type> splines{};
+  splines.reserve(count);
+
+  render::Box drawing{};
+
+  for (std::size_t i = 0; i < count; ++i) {
+    auto& node = nodes[i];
+    node.center = render::Point{ double(i % columns) * spacing,
+                                 double(i / columns) * spacing };
+    node.fill.emplace_back(colors::RGBA{ 211, 211, 211, 255 }, 0.);
+    drawing.expand(node.bounds());
+
+    if (i % columns + 1 == columns)
+      continue;
+
+    attrtypes::Spline<> spline{};
+    spline.set_point({ node.center.x + 27., node.center.y })
+          .add_triples({ { node.center.x + 40., node.center.y + 5. },
+                         { node.center.x + 55., node.center.y + 5. },
+                         { node.center.x + 63., node.center.y } })
+          .set_endp({ node.center.x + 73., node.center.y });
+
+    splines.push_back(attrtypes::SplineType<>{}.add_spline(spline));
+    edges.emplace_back().splines = &splines.back();
+  }
+
+  std::cout << nodes.size() << " nodes, " << edges.size() << " edges x "
+            << rounds << " rounds, "
+            << parallel::default_concurrency() << " threads\n";
+
+  render::Image thumbnail{};
+
+  const auto run = [&](const char *title, const render::Box& view,
+                       std::size_t width, unsigned threads) {
+    const auto height = std::size_t(view.height() / view.width()
+                                    * double(width));
+    std::size_t paths = 0;
+
+    const auto start = std::chrono::steady_clock::now();
+    for (std::size_t round = 0; round < rounds; ++round) {
+      render::RasterCanvas canvas(view, width, height);
+
+      for (const auto& edge : edges)
+        if (edge.bounds().intersects(view))
+          canvas.draw_edge(edge);
+
+      for (const auto& node : nodes)
+        if (node.bounds().intersects(view))
+          canvas.draw_node(node);
+
+      render::Image image(width, height);
+      canvas.render(image, 64, threads);
+
+      paths = canvas.path_count();
+      thumbnail = std::move(image);
+    }
+    const auto stop = std::chrono::steady_clock::now();
+
+    const auto ms =
+      std::chrono::duration<double, std::milli>(stop - start).count();
+
+    std::cout << title << ": " << ms / double(rounds) << " ms/image, "
+              << width << "x" << height << ", " << paths << " paths\n";
+  };
+
+  run("crop", render::Box::around(
+                render::Point{ (drawing.llx + drawing.urx) / 2.,
+                               (drawing.lly + drawing.ury) / 2. },
+                1000., 1000.),
+      2000, 0);
+  run("thumbnail, 1 thread", drawing, 2048, 1);
+  run("thumbnail", drawing, 2048, 0);
+
+  const auto start = std::chrono::steady_clock::now();
+  std::ostringstream out{};
+  render::write_png(out, thumbnail);
+  const auto stop = std::chrono::steady_clock::now();
+
+  std::cout << "png: "
+            << std::chrono::duration<double, std::milli>(stop - start).count()
+            << " ms, " << out.str().size() << " bytes"
+            << (render::has_png_compression ? "" : " (stored)") << "\n";
+}
@@ -0,0 +1,82 @@
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <gvizard/layout/layout_graph.hpp>
+#include <gvizard/layout/routing.hpp>
+#include <gvizard/parallel/parallel_for.hpp>
+
+// routes edges among 20k nodes by default, on a jittered grid, each
+// joined to its neighbours and to nodes a few cells away, across others,
+// by each mode on one thread and on all.
+
+using namespace gviz;
+
+int main(int argc, char* argv[])
+{
+  const std::size_t count   = argc > 1 ? std::stoul(argv[1]) : 20000;
+  const double      spacing = argc > 2 ? std::stod(argv[2]) : 100.;
+
+  const auto side = std::size_t(std::ceil(std::sqrt(double(count))));
+
+  std::mt19937 random(42);
+  std::uniform_real_distribution<double> jitter(-spacing / 8.,
+                                                spacing / 8.);
+  std::uniform_int_distribution<std::size_t> reach(0, 4);
+
+  std::vector<layout::LayoutEdge> edges{};
+  layout::Layout placed{};
+  for (std::size_t i = 0; i < count; ++i) {
+    if (i % side + 1 < side && i + 1 < count)
+      edges.push_back(layout::LayoutEdge{ uint32_t(i), uint32_t(i + 1) });
+    if (i + side < count)
+      edges.push_back(layout::LayoutEdge{ uint32_t(i), uint32_t(i + side) });
+
+    const auto across = i + reach(random) + reach(random) * side;
+    if (across < count)
+      edges.push_back(layout::LayoutEdge{ uint32_t(i), uint32_t(across) });
+
+    placed.positions.push_back(layout::Point{
+      spacing * double(i % side) + jitter(random),
+      spacing * double(i / side) + jitter(random) });
+  }
+
+  const layout::LayoutGraph graph(std::vector<layout::LayoutNode>(count),
+                                  std::move(edges));
+
+  std::cout << graph.node_count() << " nodes, " << graph.edge_count()
+            << " edges, " << parallel::default_concurrency()
+            << " threads\n";
+
+  const auto run = [&](const char *title,
+                       const layout::RouteOptions& options) {
+    const auto start  = std::chrono::steady_clock::now();
+    const auto result = layout::route_edges(graph, placed, options);
+    const auto stop   = std::chrono::steady_clock::now();
+
+    std::size_t segments = 0;
+    for (const auto& splines : result.splines)
+      segments += splines.splines[0].triples.size();
+
+    std::cout << title << ": "
+              << std::chrono::duration<double, std::milli>(stop - start)
+                   .count()
+              << " ms, " << segments << " Bézier segments\n";
+  };
+
+  for (const char *mode : { "line", "polyline", "spline", "ortho" }) {
+    layout::RouteOptions options{};
+    options.splines = std::string(mode);
+
+    options.threads = 1;
+    run((std::string(mode) + ", 1 thread").c_str(), options);
+
+    options.threads = 0;
+    run((std::string(mode) + ", all threads").c_str(), options);
+  }
+}
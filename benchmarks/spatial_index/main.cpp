@@ -0,0 +1,114 @@
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <gvizard/layout/layout_graph.hpp>
+#include <gvizard/layout/spatial_index.hpp>
+#include <gvizard/parallel/parallel_for.hpp>
+
+// indexes 500k nodes by default, spread as a layout would spread them,
+// and a straight spline per edge between neighbours, then times point,
+// viewport and nearest queries, and moving nodes.
+
+using namespace gviz;
+
+namespace {
+
+template <typename F>
+double time_ms(F&& func)
+{
+  const auto start = std::chrono::steady_clock::now();
+  func();
+  const auto stop  = std::chrono::steady_clock::now();
+  return std::chrono::duration<double, std::milli>(stop - start).count();
+}
+
+}  // namespace
+
+int main(int argc, char* argv[])
+{
+  const std::size_t count   = argc > 1 ? std::stoul(argv[1]) : 500000;
+  const std::size_t queries = argc > 2 ? std::stoul(argv[2]) : 100000;
+
+  constexpr double spacing = 90.;
+  const auto side = std::size_t(std::ceil(std::sqrt(double(count))));
+
+  std::mt19937 random(42);
+  std::uniform_real_distribution<double> jitter(-spacing / 4.,
+                                                spacing / 4.);
+  std::uniform_real_distribution<double> anywhere(0., spacing
+                                                        * double(side));
+
+  std::vector<layout::LayoutEdge> edges{};
+  layout::Layout placed{};
+  for (std::size_t i = 0; i < count; ++i)
+    placed.positions.push_back(layout::Point{
+      spacing * double(i % side) + jitter(random),
+      spacing * double(i / side) + jitter(random) });
+
+  for (std::size_t i = 0; i + 1 < count; ++i) {
+    if (i % side + 1 == side)
+      continue;
+    edges.push_back(layout::LayoutEdge{ uint32_t(i), uint32_t(i + 1) });
+
+    const auto& from = placed.positions[i];
+    const auto& to   = placed.positions[i + 1];
+    attrtypes::Spline<> spline{};
+    spline.set_point(attrtypes::spline_point_type(from.x, from.y));
+    spline.add_triples({ attrtypes::spline_point_type(from.x + 10., from.y),
+                         attrtypes::spline_point_type(to.x - 10., to.y),
+                         attrtypes::spline_point_type(to.x, to.y) });
+    placed.splines.emplace_back();
+    placed.splines.back().add_spline(spline);
+  }
+
+  const layout::LayoutGraph graph(std::vector<layout::LayoutNode>(count),
+                                  std::move(edges));
+
+  std::cout << graph.node_count() << " nodes, " << graph.edge_count()
+            << " edges, " << parallel::default_concurrency()
+            << " threads\n";
+
+  layout::SpatialIndex index{};
+  std::cout << "build: "
+            << time_ms([&] { index = layout::SpatialIndex(graph, placed); })
+            << " ms\n";
+
+  std::size_t found = 0;
+  std::cout << queries << " point queries: " << time_ms([&] {
+    for (std::size_t i = 0; i < queries; ++i)
+      found += index.at(layout::Point{ anywhere(random),
+                                       anywhere(random) }).size();
+  }) << " ms, " << found << " found\n";
+
+  found = 0;
+  std::cout << queries / 100 << " viewport queries: " << time_ms([&] {
+    for (std::size_t i = 0; i < queries / 100; ++i) {
+      const double x = anywhere(random), y = anywhere(random);
+      found += index.in(layout::Box{ x, y, x + 1920., y + 1080. }).size();
+    }
+  }) << " ms, " << found << " found\n";
+
+  std::cout << queries << " nearest 10 queries: " << time_ms([&] {
+    for (std::size_t i = 0; i < queries; ++i)
+      found += index.nearest(layout::Point{ anywhere(random),
+                                            anywhere(random) }, 10).size();
+  }) << " ms\n";
+
+  std::cout << queries << " nodes moved: " << time_ms([&] {
+    for (std::size_t i = 0; i < queries; ++i) {
+      const auto node = uint32_t(i * 7919 % count);
+      const double x = anywhere(random), y = anywhere(random);
+      index.update(
+        layout::SpatialItem{ layout::SpatialItem::Kind::node, node },
+        layout::Box{ x - 27., y - 18., x + 27., y + 18. });
+    }
+  }) << " ms\n";
+
+  std::cout << "rebuild: " << time_ms([&] { index.rebuild(); }) << " ms\n";
+}
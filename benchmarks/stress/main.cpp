@@ -0,0 +1,70 @@
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <gvizard/layout/layout_graph.hpp>
+#include <gvizard/layout/stress.hpp>
+#include <gvizard/parallel/parallel_for.hpp>
+
+// lays out square grids, whose ideal layout is known:
+//  - one of 900 nodes by all pairs, on one thread and on all,
+//  - one of side * side nodes by sparse stress, 450 * 450 by default.
+
+using namespace gviz;
+
+namespace {
+
+layout::LayoutGraph make_grid(std::size_t side)
+{
+  std::vector<layout::LayoutEdge> edges{};
+  for (std::size_t row = 0; row < side; ++row)
+    for (std::size_t col = 0; col < side; ++col) {
+      const auto node = uint32_t(row * side + col);
+      if (col + 1 < side)
+        edges.push_back(layout::LayoutEdge{ node, node + 1 });
+      if (row + 1 < side)
+        edges.push_back(layout::LayoutEdge{ node, uint32_t(node + side) });
+    }
+  return layout::LayoutGraph(
+    std::vector<layout::LayoutNode>(side * side), std::move(edges));
+}
+
+}  // namespace
+
+int main(int argc, char* argv[])
+{
+  const std::size_t side = argc > 1 ? std::stoul(argv[1]) : 450;
+
+  std::cout << parallel::default_concurrency() << " threads\n";
+
+  const auto run = [](const char *title, const layout::LayoutGraph& graph,
+                      const layout::StressOptions& options) {
+    const auto start  = std::chrono::steady_clock::now();
+    const auto result = layout::stress(graph, options);
+    const auto stop   = std::chrono::steady_clock::now();
+
+    double width = 0., height = 0.;
+    for (const auto& point : result.positions) {
+      width  = std::max(width, point.x);
+      height = std::max(height, point.y);
+    }
+
+    std::cout << title << ", " << graph.node_count() << " nodes: "
+              << std::chrono::duration<double, std::milli>(stop - start)
+                   .count()
+              << " ms, " << width << "x" << height << " points\n";
+  };
+
+  const auto small = make_grid(30);
+  layout::StressOptions options{};
+  options.threads = 1;
+  run("all pairs, 1 thread", small, options);
+
+  options.threads = 0;
+  run("all pairs, all threads", small, options);
+
+  run("sparse", make_grid(side), options);
+}
@@ -0,0 +1,97 @@
+#include <chrono>
+#include <cstddef>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <gvizard/attrtypes/spline.hpp>
+#include <gvizard/render/svg.hpp>
+#include <gvizard/render/visuals.hpp>
+
+// writes a grid of nodes, each linked to its right neighbour, as SVG:
+//  - render::SvgWriter into an in-memory stream,
+//  - the same with a 5x zoomed viewport culling most of the grid.
+// nodes are written from resolved visuals, as `Graph` keeps an adjacency
+// matrix which doesn't scale to that many nodes.
+
+using namespace gviz;
+
+int main(int argc, char* argv[])
+{
+  const std::size_t count  = argc > 1 ? std::stoul(argv[1]) : 100000;
+  const std::size_t rounds = argc > 2 ? std::stoul(argv[2]) : 5;
+
+  const std::size_t columns = 300;
+  const double      spacing = 100.;
+
+  std::vector<render::NodeVisual> nodes(count);
+  std::vector<render::EdgeVisual> edges{};
+  std::vector<render::EdgeVisual::splines_type> splines{};
+  splines.reserve(count);
+
+  render::Box drawing{};
+
+  for (std::size_t i = 0; i < count; ++i) {
+    auto& node = nodes[i];
+    node.center = render::Point{ double(i % columns) * spacing,
+                                 double(i / columns) * spacing };
+    node.label  = "node";
+    drawing.expand(node.bounds());
+
+    if (i % columns + 1 == columns)
+      continue;
+
+    attrtypes::Spline<> spline{};
+    spline.set_point({ node.center.x + 27., node.center.y })
+          .add_triples({ { node.center.x + 40., node.center.y + 5. },
+                         { node.center.x + 55., node.center.y + 5. },
+                         { node.center.x + 63., node.center.y } })
+          .set_endp({ node.center.x + 73., node.center.y });
+
+    splines.push_back(attrtypes::SplineType<>{}.add_spline(spline));
+    edges.emplace_back().splines = &splines.back();
+  }
+
+  std::cout << nodes.size() << " nodes, " << edges.size() << " edges x "
+            << rounds << " rounds\n";
+
+  const auto run = [&](const char *title, const render::Box& view) {
+    std::size_t bytes = 0;
+
+    const auto start = std::chrono::steady_clock::now();
+    for (std::size_t round = 0; round < rounds; ++round) {
+      std::ostringstream out{};
+      {
+        render::SvgWriter writer(out);
+        writer.begin(view, view.width(), view.height());
+
+        for (const auto& edge : edges)
+          if (edge.bounds().intersects(view))
+            writer.write_edge(edge);
+
+        for (const auto& node : nodes)
+          if (node.bounds().intersects(view))
+            writer.write_node(node);
+
+        writer.end();
+      }
+      bytes = out.str().size();
+    }
+    const auto stop = std::chrono::steady_clock::now();
+
+    const auto ms =
+      std::chrono::duration<double, std::milli>(stop - start).count();
+
+    std::cout << title << ": " << ms / double(rounds) << " ms/document, "
+              << bytes << " bytes\n";
+  };
+
+  run("full", drawing);
+
+  const render::Point center{ (drawing.llx + drawing.urx) / 2.,
+                              (drawing.lly + drawing.ury) / 2. };
+  run("viewport", render::Box::around(center, drawing.width() / 10.,
+                                      drawing.height() / 10.));
+}
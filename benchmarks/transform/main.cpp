@@ -0,0 +1,161 @@
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <gvizard/graph/graph.hpp>
+#include <gvizard/passes/transform.hpp>
+#include <gvizard/parallel/parallel_for.hpp>
+#include <gvizard/registry/entt_registry.hpp>
+
+#include <gvizard/attrs/pos.hpp>
+
+// turns, scales and moves a layout of 3000 nodes by default, with 30
+// edges of 4 curved segments from each node to others, step by step
+// visiting each point of `pos`, by `transform_layout`, and by mapping
+// an already gathered `GeometryBuffer`, as writers reading it would.
+
+using namespace gviz;
+
+namespace {
+
+using Graph = graph::Graph<registry::EnTTRegistry, graph::GraphDir::directed>;
+
+// calls `func` with each point of `pos` of nodes and edges.
+template <typename F>
+void visit_points(Graph& graph, F&& func)
+{
+  for (auto node : graph.nodes_view()) {
+    auto& pos = graph.get_entity_attr<attrs::Pos>(node)->get_value();
+    func(std::get<attrtypes::PointType<double>>(*pos));
+  }
+  for (auto edge : graph.edges_view()) {
+    auto& pos = graph.get_entity_attr<attrs::Pos>(edge)->get_value();
+    auto& splines = std::get<attrtypes::SplineType<std::vector>>(*pos);
+    for (auto& spline : splines.splines) {
+      func(spline.point);
+      for (auto& [first, second, third] : spline.triples) {
+        func(first);
+        func(second);
+        func(third);
+      }
+    }
+  }
+}
+
+// the steps of `transform_layout` one at a time, each visiting every
+// point: the box, turned, the box again, scaled, the box again and
+// moved. points of this benchmark are 2D.
+double naive(Graph& graph)
+{
+  double llx = 0., lly = 0.;
+  const auto box = [&] {
+    llx = lly = 1e300;
+    visit_points(graph, [&](attrtypes::PointType<double>& point) {
+      const auto at = attrtypes::Point2D<double>(point);
+      llx = std::min(llx, at.x);
+      lly = std::min(lly, at.y);
+    });
+  };
+  const auto step = [&](const passes::Affine& map) {
+    visit_points(graph, [&](attrtypes::PointType<double>& point) {
+      const auto at = attrtypes::Point2D<double>(point);
+      const auto [x, y] = map(at.x, at.y);
+      point = attrtypes::PointType<double>(x, y);
+    });
+  };
+
+  box();
+  step(passes::Affine::rotation(90.));
+  box();
+  step(passes::Affine::scaling(.5, .5));
+  box();
+  step(passes::Affine::translation(4. - llx, 4. - lly));
+  return llx;
+}
+
+}  // namespace
+
+int main(int argc, char* argv[])
+{
+  const std::size_t count = argc > 1 ? std::stoul(argv[1]) : 3000;
+  const std::size_t degree = argc > 2 ? std::stoul(argv[2]) : 30;
+
+  std::mt19937 random(42);
+  std::uniform_real_distribution<double> place(0., 10000.), bend(-50., 50.);
+
+  Graph graph{};
+  std::vector<Graph::NodeId> nodes{};
+  for (std::size_t i = 0; i < count; ++i) {
+    nodes.push_back(graph.create_node());
+    graph.set_entity_attr<attrs::Pos>(
+      nodes.back(),
+      attrs::PosType(attrtypes::PointType<double>(place(random),
+                                                  place(random))));
+  }
+
+  std::uniform_int_distribution<std::size_t> pick(0, count - 1);
+  for (std::size_t i = 0; i < count * degree; ++i) {
+    const auto edge = graph.create_edge(nodes[i / degree],
+                                        nodes[pick(random)]);
+    if (!edge)
+      continue;
+
+    double x = place(random), y = place(random);
+    attrtypes::Spline<> spline{};
+    spline.set_point(attrtypes::spline_point_type(x, y));
+    for (int s = 0; s < 4; ++s) {
+      std::array<attrtypes::spline_point_type, 3> points{};
+      for (auto& point : points) {
+        x += bend(random);
+        y += bend(random);
+        point = attrtypes::spline_point_type(x, y);
+      }
+      spline.add_triples({ points[0], points[1], points[2] });
+    }
+
+    attrtypes::SplineType<std::vector> splines{};
+    splines.add_spline(spline);
+    graph.set_entity_attr<attrs::Pos>(*edge, attrs::PosType(splines));
+  }
+
+  std::cout << count << " nodes, " << graph.edge_count()
+            << " edges of 4 segments, "
+            << parallel::default_concurrency() << " threads\n";
+
+  const auto run = [&](const char *title, auto&& func) {
+    const auto start = std::chrono::steady_clock::now();
+    const auto checksum = func();
+    const auto stop  = std::chrono::steady_clock::now();
+    std::cout << title << ": "
+              << std::chrono::duration<double, std::milli>(stop - start)
+                   .count()
+              << " ms (" << checksum << ")\n";
+  };
+
+  run("naive steps", [&] { return naive(graph); });
+
+  passes::TransformOptions options{};
+  options.ratio = attrs::RatioType(1.);
+  options.landscape = true;
+  for (unsigned threads : { 1u, 0u }) {
+    options.threads = threads;
+    run(threads == 1 ? "pass, 1 thread" : "pass, all threads", [&] {
+      return passes::transform_layout(graph, options).dx;
+    });
+  }
+
+  auto buffer = passes::gather_geometry(graph);
+  run("mapping a gathered buffer", [&] {
+    buffer.apply(passes::Affine::rotation(90.)
+                   .then(passes::Affine::scaling(.5, .5)));
+    double sum = 0.;
+    for (double x : buffer.xs)
+      sum += x;
+    return sum;
+  });
+}
@@ -1,16 +1,12 @@
 #include <iostream>
 #include <sstream>
 #include <string>
+#include <string_view>
 #include <vector>
 
 #include <gvizard/gvizgraph.hpp>
 #include <gvizard/attrs/label_related.hpp>
-
-// dot language requires an identifier name for each node,
-// as a renderer/generator we define our own attr...
-// to use this renderer, the graph's registry must support this type.
-// the default registry (EnTTRegistry) accepts and holds any type.
-struct NodeName { std::string str; };
+#include <gvizard/passes/expand_labels.hpp>
 
 // a renderer/generator is a bit complex, making a class is always
 // a wise choice.
@@ -37,23 +33,31 @@ class DotGenerator final {
     // first line: "graph|digraph {", no id or strict for simplicity reasons...
     strstream << (graph.is_undirected() ? "graph" : "digraph") << " {\n";
 
+    // labels are EscStrings, which may refer to the node's name by "\N",
+    // the graph's name by "\G", etc... expand_labels substitutes them
+    // for all labels of the graph at once (and in parallel).
+    // it only needs to know how to get the name of a node.
+    const auto labels = gviz::passes::expand_labels(
+      graph.graph,
+      [&graph](auto node_id) { return *graph.get_node_name(node_id); }
+    );
+
     // write definition of each node which is its name and its attributes.
     // (in this case only Label if it's set)
     for (auto node_id : graph.graph.nodes_view()) {
-      auto node_name =
-          graph.graph.template get_entity_attr<NodeName>(node_id);
-      if (!node_name) continue; // without node's name we can't define it
+      auto node_name = *graph.get_node_name(node_id);
+      if (node_name.empty()) continue; // without node's name we can't define it
 
       strstream << str_indent;
-      strstream << node_name->str;
+      strstream << node_name;
 
       // having an attribute is always optional and graph doesn't enforce
       // such semantics.
       //
       // if it is set, then add desired string at the end of node definition.
-      auto opt_label = graph.get_node_label(node_id);
+      auto opt_label = labels.find(node_id, gviz::passes::LabelKind::label);
       if (opt_label)
-        strstream << " [" << node_attr_to_string(*opt_label) << "]";
+        strstream << " [" << label_to_string(*opt_label) << "]";
 
       strstream << ";\n";
     }
@@ -65,18 +69,16 @@ class DotGenerator final {
       auto [node_a_id, node_b_id] = *graph.graph.get_edge_nodes(edge_id);
 
       // both nodes must have name to define them in dot language.
-      auto node_a_name =
-          graph.graph.template get_entity_attr<NodeName>(node_a_id);
-      if (!node_a_name) continue;
+      auto node_a_name = *graph.get_node_name(node_a_id);
+      if (node_a_name.empty()) continue;
 
-      auto node_b_name =
-          graph.graph.template get_entity_attr<NodeName>(node_b_id);
-      if (!node_b_name) continue;
+      auto node_b_name = *graph.get_node_name(node_b_id);
+      if (node_b_name.empty()) continue;
 
       // result format: "   {node_a_name} {-- or ->} {node_b_name}\n"
-      strstream << str_indent << node_a_name->str << ' '
+      strstream << str_indent << node_a_name << ' '
                 << (graph.is_undirected() ? "--" : "->")
-                << ' ' << node_b_name->str << ";\n";
+                << ' ' << node_b_name << ";\n";
     }
 
     strstream << "}"; // close the graph definition...
@@ -86,16 +88,12 @@ class DotGenerator final {
 
  private:
   // an attribute is defined as "{attr_name}={attr_value}" ...
-  // using function overloading can 
-  std::string node_attr_to_string(const gviz::attrs::Label& attr) const
+  std::string label_to_string(std::string_view expanded_label) const
   {
-    // label's underlying type is EscString which gets node name, edge name, etc..
-    // and applies to the given format.
-    // here we're not gonna do that due complexity of it.
     return
-      std::string(attr.get_name())
+      std::string(gviz::attrs::Label::name)
       + "="
-      + "\"" + attr.get_value().get_format() + "\"";
+      + "\"" + std::string(expanded_label) + "\"";
   }
 };
 
@@ -110,16 +108,17 @@ auto create_complete_graph(std::size_t n) {
 
   // create vertices and store them to later connect them together.
   for (std::size_t i = 0; i < n; ++i) {
-    auto node_id = g.graph.create_node();
-    // this line is required by DotGenerator. names a vertex as "v{i}".
-    g.graph.set_entity_attr<NodeName>(node_id,
-                                      std::string("v") + std::to_string(i));
+    // dot language requires an identifier name for each node,
+    // names a vertex as "v{i}". names are interned into the graph's
+    // string pool and indexed, so `g.find_node("v3")` finds it later.
+    auto node_id = g.graph.get_or_create_node("v" + std::to_string(i));
 
-    // label each even numbered node to "Node #{i}".
+    // label each even numbered node to "Node #{i} (v{i})".
     // only labeling is just to show that it's optional
     // and doesn't have to be set.
     if (i % 2 == 0)
-      g.set_node_label(node_id, std::string("Node #") + std::to_string(i));
+      g.set_node_label_view(node_id,
+                            "Node #" + std::to_string(i) + " (\\N)");
 
     nodes.push_back(node_id);
   }
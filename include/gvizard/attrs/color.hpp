@@ -17,16 +17,24 @@ namespace gviz::attrs {
 template <typename ColorT>
 using ColorValType = std::variant<ColorT, attrtypes::ColorList<ColorT>>;
 
-struct Color final
-  : public AttributeBase<Color, ColorValType<attrtypes::ColorType>>
+/** color attribute, generic over how its colors are stored.
+ *
+ * `Color` holds `colors::Color`s, `PackedColor` holds
+ * `colors::PackedColor`s, which take a fraction of the memory and
+ * compare as integers.
+ */
+template <typename ColorT>
+struct BasicColor final
+  : public AttributeBase<BasicColor<ColorT>, ColorValType<ColorT>>
 {
-  using value_type = ColorValType<attrtypes::ColorType>;
+  using base_type  = AttributeBase<BasicColor<ColorT>, ColorValType<ColorT>>;
+  using value_type = ColorValType<ColorT>;
 
   constexpr static const char * const name = "color";
 
-  explicit Color() noexcept : AttributeBase() {}
-  explicit Color(const value_type& value) : AttributeBase(value) {}
-  explicit Color(value_type&& value) : AttributeBase(std::move(value)) {}
+  explicit BasicColor() noexcept : base_type() {}
+  explicit BasicColor(const value_type& value) : base_type(value) {}
+  explicit BasicColor(value_type&& value) : base_type(std::move(value)) {}
 
   static value_type get_default_value() noexcept
   {
@@ -41,14 +49,15 @@ struct Color final
   static bool constraint(const value_type&) noexcept { return true; }
 
  private:
-  static attrtypes::ColorType get_default_color() noexcept
+  static ColorT get_default_color() noexcept
   {
-    return attrtypes::ColorType(
-      colors::X11Color(colors::X11ColorEnum::black)
-    );
+    return ColorT(colors::X11Color(colors::X11ColorEnum::black));
   }
 };
 
+using Color       = BasicColor<attrtypes::ColorType>;
+using PackedColor = BasicColor<attrtypes::PackedColorType>;
+
 }  // namespace gviz::attrs
 
 #endif  // GVIZARD_ATTRS_COLOR_HPP_
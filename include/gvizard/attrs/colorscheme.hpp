@@ -3,10 +3,9 @@
 
 #include <string>
 
-#include "gvizard/utils.hpp"
-
 #include "gvizard/attribute.hpp"
 #include "gvizard/colors/general.hpp"
+#include "gvizard/colors/names.hpp"
 
 namespace gviz::attrs {
 
@@ -37,9 +36,7 @@ struct ColorScheme final
 
   operator std::string() const
   {
-    return std::string(
-      utils::EnumHelper<colors::SchemeEnum>::to_str(value_)
-    );
+    return std::string(colors::scheme_name(value_));
   }
 };
 
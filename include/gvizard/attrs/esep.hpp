@@ -28,7 +28,7 @@ struct Esep final : public AttributeBase<Esep, EsepType> {
 
   constexpr static value_type get_default_value() noexcept
   {
-    return +attrtypes::AddDouble::make(3.0);
+    return attrtypes::AddDouble(3., attrtypes::AddibleSign::addible);
   }
 
   constexpr static bool is_default(const value_type& value) noexcept
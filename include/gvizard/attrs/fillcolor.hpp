@@ -7,27 +7,36 @@
 
 namespace gviz::attrs {
 
-using FillColorType =
-  std::variant<
-    attrtypes::ColorType,
-    attrtypes::ColorList<attrtypes::ColorType>>;
-
-struct FillColor final : public AttributeBase<FillColor, FillColorType> {
-  using value_type = FillColorType;
+template <typename ColorT>
+using BasicFillColorType =
+  std::variant<ColorT, attrtypes::ColorList<ColorT>>;
+
+using FillColorType = BasicFillColorType<attrtypes::ColorType>;
+
+/** fillcolor attribute, generic over how its colors are stored.
+ *
+ * `FillColor` holds `colors::Color`s, `PackedFillColor` holds
+ * `colors::PackedColor`s.
+ */
+template <typename ColorT>
+struct BasicFillColor final
+  : public AttributeBase<BasicFillColor<ColorT>, BasicFillColorType<ColorT>>
+{
+  using base_type  =
+    AttributeBase<BasicFillColor<ColorT>, BasicFillColorType<ColorT>>;
+  using value_type = BasicFillColorType<ColorT>;
 
   constexpr static const char * const name = "fillcolor";
 
-  explicit FillColor() noexcept : AttributeBase() {}
-  explicit FillColor(const value_type& value) : AttributeBase(value) {}
-  explicit FillColor(value_type&& value)
-    : AttributeBase(std::move(value))
+  explicit BasicFillColor() noexcept : base_type() {}
+  explicit BasicFillColor(const value_type& value) : base_type(value) {}
+  explicit BasicFillColor(value_type&& value)
+    : base_type(std::move(value))
   {}
 
   static value_type get_default_value() noexcept
   {
-    return attrtypes::ColorType(
-      colors::X11Color{colors::X11ColorEnum::lightgrey}
-    );
+    return ColorT(colors::X11Color{colors::X11ColorEnum::lightgrey});
   }
 
   static bool is_default(const value_type& value) noexcept
@@ -38,6 +47,9 @@ struct FillColor final : public AttributeBase<FillColor, FillColorType> {
   static bool constraint(const value_type&) noexcept { return true; }
 };
 
+using FillColor       = BasicFillColor<attrtypes::ColorType>;
+using PackedFillColor = BasicFillColor<attrtypes::PackedColorType>;
+
 }  // namespace gviz::attrs
 
 #endif  // GVIZARD_ATTRS_FILLCOLOR_HPP_
@@ -9,19 +9,26 @@
 
 namespace gviz::attrs {
 
-struct FontColor final
-  : public AttributeBase<FontColor, attrtypes::ColorType>
+/** fontcolor attribute, generic over how its color is stored.
+ *
+ * `FontColor` holds a `colors::Color`, `PackedFontColor` holds a
+ * `colors::PackedColor`.
+ */
+template <typename ColorT>
+struct BasicFontColor final
+  : public AttributeBase<BasicFontColor<ColorT>, ColorT>
 {
-  using value_type = attrtypes::ColorType;
+  using base_type  = AttributeBase<BasicFontColor<ColorT>, ColorT>;
+  using value_type = ColorT;
 
   constexpr static const char * const name = "fontcolor";
 
-  constexpr explicit FontColor() noexcept : AttributeBase() {}
-  constexpr explicit FontColor(value_type value) : AttributeBase(value) {}
+  constexpr explicit BasicFontColor() noexcept : base_type() {}
+  constexpr explicit BasicFontColor(value_type value) : base_type(value) {}
 
   constexpr static value_type get_default_value() noexcept
   {
-    return {colors::X11ColorEnum::black};
+    return value_type(colors::X11ColorEnum::black);
   }
 
   constexpr static bool is_default(value_type value) noexcept
@@ -35,6 +42,9 @@ struct FontColor final
   }
 };
 
+using FontColor       = BasicFontColor<attrtypes::ColorType>;
+using PackedFontColor = BasicFontColor<attrtypes::PackedColorType>;
+
 
 struct FontName final : public AttributeBase<FontName, std::string> {
   using value_type = std::string;
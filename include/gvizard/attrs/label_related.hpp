@@ -12,16 +12,23 @@
 
 namespace gviz::attrs {
 
-struct Label final
-  : public AttributeBase<Label, attrtypes::Label<std::string>>
+/** label attribute, generic over the string type of its format.
+ *
+ * `Label` owns its format, `LabelView` refers to a format living
+ * elsewhere, e.g. interned in the graph's string pool.
+ */
+template <typename StrT>
+struct BasicLabel final
+  : public AttributeBase<BasicLabel<StrT>, attrtypes::Label<StrT>>
 {
-  using value_type = attrtypes::Label<std::string>;
+  using base_type  = AttributeBase<BasicLabel<StrT>, attrtypes::Label<StrT>>;
+  using value_type = attrtypes::Label<StrT>;
 
   constexpr static const char * const name = "label";
 
-  explicit Label() noexcept : AttributeBase() {}
-  explicit Label(const value_type& value) : AttributeBase(value) {}
-  explicit Label(value_type&& value) : AttributeBase(std::move(value)) {}
+  explicit BasicLabel() noexcept : base_type() {}
+  explicit BasicLabel(const value_type& value) : base_type(value) {}
+  explicit BasicLabel(value_type&& value) : base_type(std::move(value)) {}
 
   static value_type get_default_value() noexcept { return value_type(); }
 
@@ -33,6 +40,9 @@ struct Label final
   static bool constraint(const value_type&) noexcept { return true; }
 };
 
+using Label     = BasicLabel<std::string>;
+using LabelView = BasicLabel<std::string_view>;
+
 
 struct LabelScheme final : public AttributeBase<LabelScheme, int> {
   using value_type = int;
@@ -7,19 +7,26 @@
 
 namespace gviz::attrs {
 
-struct PenColor final
-  : public AttributeBase<PenColor, attrtypes::ColorType>
+/** pencolor attribute, generic over how its color is stored.
+ *
+ * `PenColor` holds a `colors::Color`, `PackedPenColor` holds a
+ * `colors::PackedColor`.
+ */
+template <typename ColorT>
+struct BasicPenColor final
+  : public AttributeBase<BasicPenColor<ColorT>, ColorT>
 {
-  using value_type = attrtypes::ColorType;
+  using base_type  = AttributeBase<BasicPenColor<ColorT>, ColorT>;
+  using value_type = ColorT;
 
   constexpr static const char * const name = "pencolor";
 
-  constexpr explicit PenColor() noexcept : AttributeBase() {}
-  constexpr explicit PenColor(value_type value) : AttributeBase(value) {}
+  constexpr explicit BasicPenColor() noexcept : base_type() {}
+  constexpr explicit BasicPenColor(value_type value) : base_type(value) {}
 
   constexpr static value_type get_default_value() noexcept
   {
-    return {colors::X11ColorEnum::black};
+    return value_type(colors::X11ColorEnum::black);
   }
 
   constexpr static bool is_default(value_type value) noexcept
@@ -33,6 +40,9 @@ struct PenColor final
   }
 };
 
+using PenColor       = BasicPenColor<attrtypes::ColorType>;
+using PackedPenColor = BasicPenColor<attrtypes::PackedColorType>;
+
 }  // namespace gviz::attrs
 
 #endif  // GVIZARD_ATTRS_PENCOLOR_HPP_
@@ -28,7 +28,7 @@ struct Sep final : public AttributeBase<Sep, SepType> {
 
   constexpr static value_type get_default_value() noexcept
   {
-    return +attrtypes::AddDouble::make(4.);
+    return attrtypes::AddDouble(4., attrtypes::AddibleSign::addible);
   }
 
   constexpr static bool is_default(const value_type& value) noexcept
@@ -73,7 +73,7 @@ struct TailHref final
 
   static value_type get_default_value() noexcept { return value_type({}); }
 
-  constexpr static bool is_default(const value_type& value) noexcept
+  static bool is_default(const value_type& value) noexcept
   {
     return value.get_format_ref().empty();
   }
@@ -86,7 +86,7 @@ struct TailHref final
 
 
 struct TailLabel final
-  : public AttributeBase<TailHref, attrtypes::Label<std::string>>
+  : public AttributeBase<TailLabel, attrtypes::Label<std::string>>
 {
   using value_type = attrtypes::Label<std::string>;
 
@@ -100,7 +100,7 @@ struct TailLabel final
 
   static value_type get_default_value() noexcept { return value_type({}); }
 
-  constexpr static bool is_default(const value_type& value) noexcept
+  static bool is_default(const value_type& value) noexcept
   {
     return value.get_format_ref().empty();
   }
@@ -127,7 +127,7 @@ struct TailPort final
 
   static value_type get_default_value() noexcept { return {}; }
 
-  constexpr static bool is_default(const value_type& value) noexcept
+  static bool is_default(const value_type& value) noexcept
   {
     return value == get_default_value();
   }
@@ -154,7 +154,7 @@ struct TailTarget final
 
   static value_type get_default_value() noexcept { return value_type({}); }
 
-  constexpr static bool is_default(const value_type& value) noexcept
+  static bool is_default(const value_type& value) noexcept
   {
     return value.get_format_ref().empty();
   }
@@ -181,7 +181,7 @@ struct TailTooltip final
 
   static value_type get_default_value() noexcept { return value_type({}); }
 
-  constexpr static bool is_default(const value_type& value) noexcept
+  static bool is_default(const value_type& value) noexcept
   {
     return value.get_format_ref().empty();
   }
@@ -206,7 +206,7 @@ struct TailURL final
 
   static value_type get_default_value() noexcept { return value_type({}); }
 
-  constexpr static bool is_default(const value_type& value) noexcept
+  static bool is_default(const value_type& value) noexcept
   {
     return value.get_format_ref().empty();
   }
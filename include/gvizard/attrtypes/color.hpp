@@ -2,11 +2,15 @@
 #define GVIZARD_ATTRTYPES_COLOR_HPP_
 
 #include "gvizard/colors.hpp"
+#include "gvizard/colors/packed.hpp"
 
 namespace gviz::attrtypes {
 
 using ColorType = colors::Color;
 
+/** compact storage of a color, see `colors::PackedColor`. */
+using PackedColorType = colors::PackedColor;
+
 template <typename ColorT = colors::RGB,
           template <typename, typename...> typename Vec = std::vector,
           typename ...VecArgs>
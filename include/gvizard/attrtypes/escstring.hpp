@@ -1,6 +1,8 @@
 #ifndef GVIZARD_ATTRTYPES_ESCSTRING_HPP_
 #define GVIZARD_ATTRTYPES_ESCSTRING_HPP_
 
+#include <algorithm>
+#include <cstddef>
 #include <string>
 #include <string_view>
 #include <type_traits>
@@ -143,14 +145,19 @@ class EscString final {
 
   constexpr bool operator==(const EscString& other) const
   {
-    return occurences_ == other.occurences && format_ == other.format_;
+    return occurences_ == other.occurences_ && format_ == other.format_;
   }
 
   constexpr bool operator!=(const EscString& other) const
   {
-    return occurences_ != other.occurences || format_ != other.format_;
+    return occurences_ != other.occurences_ || format_ != other.format_;
   }
 
+  /** size of `apply(nameset)`'s output.
+   *
+   * escaped backslashes aren't counted as shortening the output,
+   * thus this is an upper bound that is exact in their absence.
+   */
   constexpr std::size_t apply_size(const EscNameSetRef& nameset) const
   {
     return format_.size() - 2 * occurences_.sum()
@@ -162,57 +169,113 @@ class EscString final {
            + nameset.tail.size()  * occurences_.tail;
   }
 
-  std::string apply(const EscNameSetRef& nameset = {}) const
+  /** writes format with escapes substituted by `nameset` into `out`.
+   *
+   * literal runs between escapes are copied in bulk, so writing into a
+   * raw `char*` buffer of at least `apply_size(nameset)` bytes performs
+   * no allocation at all.
+   *
+   * @param out output iterator to write characters to.
+   * @param nameset names to substitute escapes with.
+   * @returns output iterator past the last written character.
+   */
+  template <typename OutputIt>
+  OutputIt apply_to(OutputIt out, const EscNameSetRef& nameset = {}) const
   {
-    const auto outsize = apply_size(nameset);
+    for_each_chunk(nameset, [&out](const char *str, std::size_t size) {
+      out = std::copy(str, str + size, out);
+    });
 
-    std::string output{};
-    output.reserve(outsize);
-
-    char last = '\0';
-    for (const char cur : format_) {
-      if (last == '\\') {
-        switch (cur) {
-          case 'G':  output += nameset.graph;     break;
-          case 'N':  output += nameset.node;      break;
-          case 'E':  output += nameset.edge;      break;
-          case 'L':  output += nameset.label;     break;
-          case 'H':  output += nameset.head;      break;
-          case 'T':  output += nameset.tail;      break;
-          case '\\': output += '\\';              break;
-          default:
-            output += '\\';
-            output += cur;
-        }
-      }
-      else if (cur != '\\')
-        output += cur;
+    return out;
+  }
 
-      last = cur;
-    }
+  /** appends format with escapes substituted by `nameset` to `buffer`.
+   *
+   * reusing the same buffer across calls avoids allocating
+   * a new string for each application.
+   *
+   * @param buffer string to append the result to.
+   * @param nameset names to substitute escapes with.
+   * @returns count of appended characters.
+   */
+  std::size_t apply_to(std::string& buffer,
+                       const EscNameSetRef& nameset = {}) const
+  {
+    const auto oldsize = buffer.size();
 
+    buffer.reserve(oldsize + apply_size(nameset));
+    for_each_chunk(nameset, [&buffer](const char *str, std::size_t size) {
+      buffer.append(str, size);
+    });
+
+    return buffer.size() - oldsize;
+  }
+
+  std::string apply(const EscNameSetRef& nameset = {}) const
+  {
+    std::string output{};
+    apply_to(output, nameset);
     return output;
   }
 
  private:
+  /* string_view::find is backed by memchr, which is vectorized
+   * by the standard library, so only escapes are visited one by one. */
+  template <typename F>
+  constexpr void for_each_chunk(const EscNameSetRef& nameset, F&& func) const
+  {
+    const std::string_view format(format_.data(), format_.size());
+
+    std::size_t pos = 0;
+    while (pos < format.size()) {
+      const auto esc = format.find('\\', pos);
+
+      // a trailing backslash escapes nothing, so it's kept as is.
+      if (esc == std::string_view::npos || esc + 1 == format.size()) {
+        func(format.data() + pos, format.size() - pos);
+        return;
+      }
+
+      if (esc != pos)
+        func(format.data() + pos, esc - pos);
+
+      const auto emit = [&func](std::string_view str) {
+        func(str.data(), str.size());
+      };
+
+      switch (format[esc + 1]) {
+        case 'G':  emit(nameset.graph);   break;
+        case 'N':  emit(nameset.node);    break;
+        case 'E':  emit(nameset.edge);    break;
+        case 'L':  emit(nameset.label);   break;
+        case 'H':  emit(nameset.head);    break;
+        case 'T':  emit(nameset.tail);    break;
+        case '\\': func(format.data() + esc + 1, 1); break;
+        default:   func(format.data() + esc, 2);
+      }
+
+      pos = esc + 2;
+    }
+  }
+
   constexpr static EscOccurences count_occurences(const StringT& format) noexcept
   {
     EscOccurences ret{};
 
-    char last = '\0';
-    for (const char cur : format) {
-      if (last == '\\') {
-        switch (cur) {
-          case 'G': ++ret.graph; break;
-          case 'N': ++ret.node;  break;
-          case 'E': ++ret.edge;  break;
-          case 'L': ++ret.label; break;
-          case 'H': ++ret.head;  break;
-          case 'T': ++ret.tail;  break;
-        }
+    const std::string_view view(format.data(), format.size());
+
+    for (auto esc = view.find('\\');
+         esc != std::string_view::npos && esc + 1 < view.size();
+         esc = view.find('\\', esc + 2))
+    {
+      switch (view[esc + 1]) {
+        case 'G': ++ret.graph; break;
+        case 'N': ++ret.node;  break;
+        case 'E': ++ret.edge;  break;
+        case 'L': ++ret.label; break;
+        case 'H': ++ret.head;  break;
+        case 'T': ++ret.tail;  break;
       }
-
-      last = cur;
     }
 
     return ret;
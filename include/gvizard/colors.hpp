@@ -6,9 +6,15 @@
 #include "gvizard/colors/hsv.hpp"
 #include "gvizard/colors/x11.hpp"
 #include "gvizard/colors/svg.hpp"
+#include "gvizard/colors/brewer.hpp"
 
 #include "gvizard/colors/color.hpp"
 #include "gvizard/colors/general.hpp"
+#include "gvizard/colors/gradient.hpp"
 #include "gvizard/colors/converter.hpp"
+#include "gvizard/colors/format.hpp"
+#include "gvizard/colors/names.hpp"
+#include "gvizard/colors/nearest.hpp"
+#include "gvizard/colors/packed.hpp"
 
 #endif  // GVIZARD_COLORS_HPP_
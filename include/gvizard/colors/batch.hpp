@@ -0,0 +1,264 @@
+#ifndef GVIZARD_COLORS_BATCH_HPP_
+#define GVIZARD_COLORS_BATCH_HPP_
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "gvizard/utils.hpp"
+#include "gvizard/simd/vec.hpp"
+
+#include "gvizard/colors/converter.hpp"
+#include "gvizard/colors/hsv.hpp"
+#include "gvizard/colors/rgb.hpp"
+#include "gvizard/colors/rgba.hpp"
+
+namespace gviz::colors::batch {
+
+namespace detail {
+
+constexpr std::size_t lanes = 8;
+
+using i32v = simd::Vec<int32_t, lanes>;
+using f32v = simd::Vec<float,   lanes>;
+using f64v = simd::Vec<double,  lanes>;
+
+// kernels only pay off if a whole block of ints fits a register.
+constexpr bool use_kernels =
+  simd::has_native_vectors && simd::full_vector_bytes >= sizeof(i32v);
+
+template <typename T>
+constexpr bool is_rgb_like_v =
+  std::is_same_v<T, RGB> || std::is_same_v<T, RGBA>;
+
+// h / 43 for h in [0, 255] as a multiply and shift.
+constexpr int32_t div43_mul = 1525;
+
+constexpr bool is_div43_exact() noexcept
+{
+  for (int32_t h = 0; h < 256; ++h)
+    if (((h * div43_mul) >> 16) != h / 43)
+      return false;
+
+  return true;
+}
+
+static_assert(is_div43_exact());
+
+inline i32v splat(int32_t value) noexcept { return i32v::broadcast(value); }
+
+template <typename T, std::size_t... Is>
+std::array<T, sizeof...(Is)> filled(const T& value, std::index_sequence<Is...>)
+{
+  return { { (static_cast<void>(Is), value)... } };
+}
+
+/** array of `N` copies of `value`, which needn't be default constructible. */
+template <std::size_t N, typename T>
+std::array<T, N> filled(const T& value)
+{
+  return filled(value, std::make_index_sequence<N>{});
+}
+
+/** `octet / 255.` of every octet, the division is correctly rounded at
+ *  compile time just like at run time, so lookups are exact.
+ */
+constexpr auto octet_units = []() {
+  std::array<double, 256> units{};
+  for (std::size_t i = 0; i < units.size(); ++i)
+    units[i] = double(i) / 255.;
+  return units;
+}();
+
+/** same as Converter<RGB, HSV> on `lanes` colors of `src`, of which
+ *  the first `count` are written to `out`.
+ */
+template <typename ColorT, typename OutputIt>
+OutputIt rgb_to_hsv_block(const ColorT *src, std::size_t count, OutputIt out)
+{
+  const auto load = [&](auto member) {
+    return i32v::generate([&](std::size_t i) {
+      return int32_t(src[i].*member);
+    });
+  };
+
+  const i32v r = load(&ColorT::r);
+  const i32v g = load(&ColorT::g);
+  const i32v b = load(&ColorT::b);
+
+  const i32v max   = simd::max(simd::max(r, g), b);
+  const i32v min   = simd::min(simd::min(r, g), b);
+  const i32v delta = max - min;
+
+  const auto is_r = (max == r);
+  const auto is_g = ~is_r & (max == g);
+  const auto is_gray = (delta == splat(0));
+
+  const i32v num  = simd::select(is_r, g - b, simd::select(is_g, b - r, r - g));
+  const i32v base = simd::select(is_r, splat(0),
+                                 simd::select(is_g, splat(85), splat(171)));
+
+  // |43 * num| <= 10965 and the quotient is never within float's error
+  // of an integer unless it is one, so truncating is exact division.
+  const i32v safe_delta = simd::select(is_gray, splat(1), delta);
+  const i32v quot =
+    ((splat(43) * num).as<float>() / safe_delta.as<float>()).as<int32_t>();
+
+  const i32v h = simd::select(is_gray, splat(0), (base + quot) & splat(0xff));
+
+  const i32v safe_max = simd::select(max == splat(0), splat(1), max);
+
+  const f64v sat = delta.as<double>() / safe_max.as<double>();
+
+  for (std::size_t i = 0; i < count; ++i)
+    *out++ = HSV(octet_units[h[i]], sat[i], octet_units[max[i]]);
+
+  return out;
+}
+
+struct RGBLanes {
+  i32v r;
+  i32v g;
+  i32v b;
+};
+
+/** the integer part of Converter<HSV, RGB>, on octets of hue,
+ *  saturation and value, lanes of `is_gray` are set to value.
+ */
+inline RGBLanes hsv_octets_to_rgb(const i32v& h, const i32v& s, const i32v& v,
+                                  const i32v& is_gray) noexcept
+{
+  const i32v region    = (h * splat(div43_mul)) >> 16;
+  const i32v remainder = (h - region * splat(43)) * splat(6);
+
+  const i32v full = splat(255);
+
+  const i32v p = (v * (full - s)) >> 8;
+  const i32v q = (v * (full - ((s * remainder) >> 8))) >> 8;
+  const i32v t = (v * (full - ((s * (full - remainder)) >> 8))) >> 8;
+
+  const auto in = [&](int32_t value) { return region == splat(value); };
+
+  // region:  0  1  2  3  4  5
+  //      r:  v  q  p  p  t  v
+  //      g:  t  v  v  q  p  p
+  //      b:  p  p  t  v  v  q
+  const i32v r = simd::select(in(0) | in(5), v,
+                   simd::select(in(1), q, simd::select(in(4), t, p)));
+  const i32v g = simd::select(in(1) | in(2), v,
+                   simd::select(in(0), t, simd::select(in(3), q, p)));
+  const i32v b = simd::select(in(3) | in(4), v,
+                   simd::select(in(2), t, simd::select(in(5), q, p)));
+
+  return RGBLanes{ simd::select(is_gray, v, r),
+                   simd::select(is_gray, v, g),
+                   simd::select(is_gray, v, b) };
+}
+
+/** same as Converter<HSV, RGB> on `lanes` colors of `src`, of which
+ *  the first `count` are written to `out`.
+ */
+template <typename ColorT, typename OutputIt>
+OutputIt hsv_to_rgb_block(const HSV *src, std::size_t count, OutputIt out)
+{
+  const auto load = [&](auto getter) {
+    return f64v::generate([&](std::size_t i) { return getter(src[i]); });
+  };
+
+  // lambdas rather than member pointers, which gcc doesn't always inline.
+  const f64v hue = load([](const HSV& color) { return color.hue(); });
+  const f64v sat = load([](const HSV& color) { return color.saturation(); });
+  const f64v val = load([](const HSV& color) { return color.value(); });
+
+  const f64v scale = f64v::broadcast(255.);
+
+  const i32v h = (hue * scale).as<int32_t>();
+  const i32v s = (sat * scale).as<int32_t>();
+  const i32v v = (val * scale).as<int32_t>();
+
+  const auto is_gray = (sat == f64v::broadcast(0.)).as<int32_t>();
+  const RGBLanes rgb = hsv_octets_to_rgb(h, s, v, is_gray);
+
+  for (std::size_t i = 0; i < count; ++i)
+    *out++ = ColorT{ uint8_t(rgb.r[i]), uint8_t(rgb.g[i]), uint8_t(rgb.b[i]) };
+
+  return out;
+}
+
+}  // namespace detail
+
+/** converts colors of [first, last) to `To`, writing them to `out`.
+ *
+ * RGB/RGBA to HSV and HSV to RGB/RGBA are converted several colors
+ * at a time using SIMD lanes (see `simd::Vec`) if the target has wide
+ * enough vectors (e.g. built with -mavx2), other pairs and targets fall
+ * back to `utils::Converter`. results are identical to its ones.
+ *
+ * @param first pointer to the first color to convert.
+ * @param last  pointer past the last color to convert.
+ * @param out   output iterator accepting `To`.
+ * @returns output iterator past the last written color.
+ */
+template <typename To, typename From, typename OutputIt>
+OutputIt convert(const From *first, const From *last, OutputIt out)
+{
+  constexpr std::size_t lanes = detail::lanes;
+
+  constexpr bool rgb_to_hsv = detail::use_kernels
+    && detail::is_rgb_like_v<From> && std::is_same_v<To, HSV>;
+  constexpr bool hsv_to_rgb = detail::use_kernels
+    && std::is_same_v<From, HSV> && detail::is_rgb_like_v<To>;
+
+  const auto block = [&](const From *src, std::size_t count) {
+    if constexpr (rgb_to_hsv)
+      out = detail::rgb_to_hsv_block(src, count, out);
+    else if constexpr (hsv_to_rgb)
+      out = detail::hsv_to_rgb_block<To>(src, count, out);
+  };
+
+  if constexpr (rgb_to_hsv || hsv_to_rgb) {
+    for (; std::size_t(last - first) >= lanes; first += lanes)
+      block(first, lanes);
+
+    // the tail is padded to a whole block, so kernels never check bounds.
+    if (first != last) {
+      const auto count = std::size_t(last - first);
+
+      auto tail = detail::filled<lanes>(*first);
+      for (std::size_t i = 0; i < count; ++i)
+        tail[i] = first[i];
+
+      block(tail.data(), count);
+    }
+  }
+  else {
+    for (; first != last; ++first)
+      *out++ = utils::Converter<From, To>::convert(*first);
+  }
+
+  return out;
+}
+
+/** converts all `colors` to `To`.
+ *
+ * @see convert
+ */
+template <typename To, typename From>
+std::vector<To> convert(const std::vector<From>& colors)
+{
+  std::vector<To> ret{};
+  ret.reserve(colors.size());
+
+  convert<To>(colors.data(), colors.data() + colors.size(),
+              std::back_inserter(ret));
+
+  return ret;
+}
+
+}  // namespace gviz::colors::batch
+
+#endif  // GVIZARD_COLORS_BATCH_HPP_
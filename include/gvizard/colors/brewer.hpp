@@ -0,0 +1,2068 @@
+#ifndef GVIZARD_COLORS_BREWER_HPP_
+#define GVIZARD_COLORS_BREWER_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <optional>
+#include <stdexcept>
+#include <string_view>
+
+#include "gvizard/colors/general.hpp"
+#include "gvizard/colors/rgb.hpp"
+
+namespace gviz::colors {
+
+constexpr SchemeEnum first_brewer_scheme = SchemeEnum::accent3;
+constexpr SchemeEnum last_brewer_scheme  = SchemeEnum::ylorrd9;
+
+constexpr bool is_brewer_scheme(SchemeEnum scheme) noexcept
+{
+  return uint16_t(first_brewer_scheme) <= uint16_t(scheme)
+      && uint16_t(scheme) <= uint16_t(last_brewer_scheme);
+}
+
+/** a brewer scheme's colors within `BrewerColor::list`. */
+struct BrewerScheme final {
+  const char *name;
+  uint16_t    offset;  // index of scheme's first color
+  uint8_t     size;
+};
+
+/** a color of one of the ColorBrewer schemes (colorbrewer2.org, by
+ *  Cynthia A. Brewer), which graphviz refers to by scheme and 1-based
+ *  index, e.g. color "3" of colorscheme "blues9".
+ */
+class BrewerColor final {
+  SchemeEnum       scheme_;
+  uint8_t          index_;
+  SchemeColor<RGB> color_;
+
+  constexpr static SchemeColor<RGB> checked(SchemeEnum scheme, uint8_t index)
+  {
+    const auto color = find(scheme, index);
+    if (!color)
+      throw std::invalid_argument("no such color in brewer scheme");
+
+    return *color;
+  }
+
+ public:
+  /** @throws std::invalid_argument if scheme isn't a brewer one or
+   *          index isn't within [1, scheme's size].
+   */
+  constexpr BrewerColor(SchemeEnum scheme, uint8_t index)
+    : scheme_(scheme), index_(index), color_(checked(scheme, index))
+  {}
+
+  constexpr SchemeEnum       get_scheme() const noexcept { return scheme_; }
+  constexpr uint8_t          get_index()  const noexcept { return index_; }
+  constexpr SchemeColor<RGB> get_color()  const noexcept { return color_; }
+  constexpr std::string_view get_name()   const noexcept { return color_.name; }
+
+  constexpr operator SchemeColor<RGB>() const noexcept { return color_; }
+
+  constexpr bool operator==(const BrewerColor& other) const noexcept
+  {
+    return scheme_ == other.scheme_ && index_ == other.index_;
+  }
+
+  constexpr bool operator!=(const BrewerColor& other) const noexcept
+  {
+    return scheme_ != other.scheme_ || index_ != other.index_;
+  }
+
+  /** scheme's entry of `schemes`, or nullptr if it isn't a brewer one. */
+  constexpr static const BrewerScheme *get_scheme_info(SchemeEnum scheme)
+    noexcept
+  {
+    if (!is_brewer_scheme(scheme))
+      return nullptr;
+
+    return &schemes[uint16_t(scheme) - uint16_t(first_brewer_scheme)];
+  }
+
+  /** looks up a scheme's color by its 1-based index in O(1).
+   *
+   * @returns an optional containing the color if scheme is a brewer one
+   *          and has such an index, otherwise std::nullopt.
+   */
+  constexpr static auto find(SchemeEnum scheme, std::size_t index) noexcept
+    -> std::optional<SchemeColor<RGB>>
+  {
+    const auto *info = get_scheme_info(scheme);
+    if (!info || index < 1 || index > info->size)
+      return std::nullopt;
+
+    return list[info->offset + index - 1];
+  }
+
+  /** schemes in `SchemeEnum` order, starting at `first_brewer_scheme`. */
+  constexpr static BrewerScheme schemes[] = {
+    { "accent3"   ,    0,  3 },
+    { "accent4"   ,    3,  4 },
+    { "accent5"   ,    7,  5 },
+    { "accent6"   ,   12,  6 },
+    { "accent7"   ,   18,  7 },
+    { "accent8"   ,   25,  8 },
+    { "blues3"    ,   33,  3 },
+    { "blues4"    ,   36,  4 },
+    { "blues5"    ,   40,  5 },
+    { "blues6"    ,   45,  6 },
+    { "blues7"    ,   51,  7 },
+    { "blues8"    ,   58,  8 },
+    { "blues9"    ,   66,  9 },
+    { "brbg3"     ,   75,  3 },
+    { "brbg4"     ,   78,  4 },
+    { "brbg5"     ,   82,  5 },
+    { "brbg6"     ,   87,  6 },
+    { "brbg7"     ,   93,  7 },
+    { "brbg8"     ,  100,  8 },
+    { "brbg9"     ,  108,  9 },
+    { "brbg10"    ,  117, 10 },
+    { "brbg11"    ,  127, 11 },
+    { "bugn3"     ,  138,  3 },
+    { "bugn4"     ,  141,  4 },
+    { "bugn5"     ,  145,  5 },
+    { "bugn6"     ,  150,  6 },
+    { "bugn7"     ,  156,  7 },
+    { "bugn8"     ,  163,  8 },
+    { "bugn9"     ,  171,  9 },
+    { "bupu3"     ,  180,  3 },
+    { "bupu4"     ,  183,  4 },
+    { "bupu5"     ,  187,  5 },
+    { "bupu6"     ,  192,  6 },
+    { "bupu7"     ,  198,  7 },
+    { "bupu8"     ,  205,  8 },
+    { "bupu9"     ,  213,  9 },
+    { "dark23"    ,  222,  3 },
+    { "dark24"    ,  225,  4 },
+    { "dark25"    ,  229,  5 },
+    { "dark26"    ,  234,  6 },
+    { "dark27"    ,  240,  7 },
+    { "dark28"    ,  247,  8 },
+    { "gnbu3"     ,  255,  3 },
+    { "gnbu4"     ,  258,  4 },
+    { "gnbu5"     ,  262,  5 },
+    { "gnbu6"     ,  267,  6 },
+    { "gnbu7"     ,  273,  7 },
+    { "gnbu8"     ,  280,  8 },
+    { "gnbu9"     ,  288,  9 },
+    { "greens3"   ,  297,  3 },
+    { "greens4"   ,  300,  4 },
+    { "greens5"   ,  304,  5 },
+    { "greens6"   ,  309,  6 },
+    { "greens7"   ,  315,  7 },
+    { "greens8"   ,  322,  8 },
+    { "greens9"   ,  330,  9 },
+    { "greys3"    ,  339,  3 },
+    { "greys4"    ,  342,  4 },
+    { "greys5"    ,  346,  5 },
+    { "greys6"    ,  351,  6 },
+    { "greys7"    ,  357,  7 },
+    { "greys8"    ,  364,  8 },
+    { "greys9"    ,  372,  9 },
+    { "oranges3"  ,  381,  3 },
+    { "oranges4"  ,  384,  4 },
+    { "oranges5"  ,  388,  5 },
+    { "oranges6"  ,  393,  6 },
+    { "oranges7"  ,  399,  7 },
+    { "oranges8"  ,  406,  8 },
+    { "oranges9"  ,  414,  9 },
+    { "orrd3"     ,  423,  3 },
+    { "orrd4"     ,  426,  4 },
+    { "orrd5"     ,  430,  5 },
+    { "orrd6"     ,  435,  6 },
+    { "orrd7"     ,  441,  7 },
+    { "orrd8"     ,  448,  8 },
+    { "orrd9"     ,  456,  9 },
+    { "paired3"   ,  465,  3 },
+    { "paired4"   ,  468,  4 },
+    { "paired5"   ,  472,  5 },
+    { "paired6"   ,  477,  6 },
+    { "paired7"   ,  483,  7 },
+    { "paired8"   ,  490,  8 },
+    { "paired9"   ,  498,  9 },
+    { "paired10"  ,  507, 10 },
+    { "paired11"  ,  517, 11 },
+    { "paired12"  ,  528, 12 },
+    { "pastel13"  ,  540,  3 },
+    { "pastel14"  ,  543,  4 },
+    { "pastel15"  ,  547,  5 },
+    { "pastel16"  ,  552,  6 },
+    { "pastel17"  ,  558,  7 },
+    { "pastel18"  ,  565,  8 },
+    { "pastel19"  ,  573,  9 },
+    { "pastel23"  ,  582,  3 },
+    { "pastel24"  ,  585,  4 },
+    { "pastel25"  ,  589,  5 },
+    { "pastel26"  ,  594,  6 },
+    { "pastel27"  ,  600,  7 },
+    { "pastel28"  ,  607,  8 },
+    { "piyg3"     ,  615,  3 },
+    { "piyg4"     ,  618,  4 },
+    { "piyg5"     ,  622,  5 },
+    { "piyg6"     ,  627,  6 },
+    { "piyg7"     ,  633,  7 },
+    { "piyg8"     ,  640,  8 },
+    { "piyg9"     ,  648,  9 },
+    { "piyg10"    ,  657, 10 },
+    { "piyg11"    ,  667, 11 },
+    { "prgn3"     ,  678,  3 },
+    { "prgn4"     ,  681,  4 },
+    { "prgn5"     ,  685,  5 },
+    { "prgn6"     ,  690,  6 },
+    { "prgn7"     ,  696,  7 },
+    { "prgn8"     ,  703,  8 },
+    { "prgn9"     ,  711,  9 },
+    { "prgn10"    ,  720, 10 },
+    { "prgn11"    ,  730, 11 },
+    { "pubu3"     ,  741,  3 },
+    { "pubu4"     ,  744,  4 },
+    { "pubu5"     ,  748,  5 },
+    { "pubu6"     ,  753,  6 },
+    { "pubu7"     ,  759,  7 },
+    { "pubu8"     ,  766,  8 },
+    { "pubu9"     ,  774,  9 },
+    { "pubugn3"   ,  783,  3 },
+    { "pubugn4"   ,  786,  4 },
+    { "pubugn5"   ,  790,  5 },
+    { "pubugn6"   ,  795,  6 },
+    { "pubugn7"   ,  801,  7 },
+    { "pubugn8"   ,  808,  8 },
+    { "pubugn9"   ,  816,  9 },
+    { "puor3"     ,  825,  3 },
+    { "puor4"     ,  828,  4 },
+    { "puor5"     ,  832,  5 },
+    { "puor6"     ,  837,  6 },
+    { "puor7"     ,  843,  7 },
+    { "puor8"     ,  850,  8 },
+    { "puor9"     ,  858,  9 },
+    { "puor10"    ,  867, 10 },
+    { "puor11"    ,  877, 11 },
+    { "purd3"     ,  888,  3 },
+    { "purd4"     ,  891,  4 },
+    { "purd5"     ,  895,  5 },
+    { "purd6"     ,  900,  6 },
+    { "purd7"     ,  906,  7 },
+    { "purd8"     ,  913,  8 },
+    { "purd9"     ,  921,  9 },
+    { "purples3"  ,  930,  3 },
+    { "purples4"  ,  933,  4 },
+    { "purples5"  ,  937,  5 },
+    { "purples6"  ,  942,  6 },
+    { "purples7"  ,  948,  7 },
+    { "purples8"  ,  955,  8 },
+    { "purples9"  ,  963,  9 },
+    { "rdbu3"     ,  972,  3 },
+    { "rdbu4"     ,  975,  4 },
+    { "rdbu5"     ,  979,  5 },
+    { "rdbu6"     ,  984,  6 },
+    { "rdbu7"     ,  990,  7 },
+    { "rdbu8"     ,  997,  8 },
+    { "rdbu9"     , 1005,  9 },
+    { "rdbu10"    , 1014, 10 },
+    { "rdbu11"    , 1024, 11 },
+    { "rdgy3"     , 1035,  3 },
+    { "rdgy4"     , 1038,  4 },
+    { "rdgy5"     , 1042,  5 },
+    { "rdgy6"     , 1047,  6 },
+    { "rdgy7"     , 1053,  7 },
+    { "rdgy8"     , 1060,  8 },
+    { "rdgy9"     , 1068,  9 },
+    { "rdgy10"    , 1077, 10 },
+    { "rdgy11"    , 1087, 11 },
+    { "rdpu3"     , 1098,  3 },
+    { "rdpu4"     , 1101,  4 },
+    { "rdpu5"     , 1105,  5 },
+    { "rdpu6"     , 1110,  6 },
+    { "rdpu7"     , 1116,  7 },
+    { "rdpu8"     , 1123,  8 },
+    { "rdpu9"     , 1131,  9 },
+    { "rdylbu3"   , 1140,  3 },
+    { "rdylbu4"   , 1143,  4 },
+    { "rdylbu5"   , 1147,  5 },
+    { "rdylbu6"   , 1152,  6 },
+    { "rdylbu7"   , 1158,  7 },
+    { "rdylbu8"   , 1165,  8 },
+    { "rdylbu9"   , 1173,  9 },
+    { "rdylbu10"  , 1182, 10 },
+    { "rdylbu11"  , 1192, 11 },
+    { "rdylgn3"   , 1203,  3 },
+    { "rdylgn4"   , 1206,  4 },
+    { "rdylgn5"   , 1210,  5 },
+    { "rdylgn6"   , 1215,  6 },
+    { "rdylgn7"   , 1221,  7 },
+    { "rdylgn8"   , 1228,  8 },
+    { "rdylgn9"   , 1236,  9 },
+    { "rdylgn10"  , 1245, 10 },
+    { "rdylgn11"  , 1255, 11 },
+    { "reds3"     , 1266,  3 },
+    { "reds4"     , 1269,  4 },
+    { "reds5"     , 1273,  5 },
+    { "reds6"     , 1278,  6 },
+    { "reds7"     , 1284,  7 },
+    { "reds8"     , 1291,  8 },
+    { "reds9"     , 1299,  9 },
+    { "set13"     , 1308,  3 },
+    { "set14"     , 1311,  4 },
+    { "set15"     , 1315,  5 },
+    { "set16"     , 1320,  6 },
+    { "set17"     , 1326,  7 },
+    { "set18"     , 1333,  8 },
+    { "set19"     , 1341,  9 },
+    { "set23"     , 1350,  3 },
+    { "set24"     , 1353,  4 },
+    { "set25"     , 1357,  5 },
+    { "set26"     , 1362,  6 },
+    { "set27"     , 1368,  7 },
+    { "set28"     , 1375,  8 },
+    { "set33"     , 1383,  3 },
+    { "set34"     , 1386,  4 },
+    { "set35"     , 1390,  5 },
+    { "set36"     , 1395,  6 },
+    { "set37"     , 1401,  7 },
+    { "set38"     , 1408,  8 },
+    { "set39"     , 1416,  9 },
+    { "set310"    , 1425, 10 },
+    { "set311"    , 1435, 11 },
+    { "set312"    , 1446, 12 },
+    { "spectral3" , 1458,  3 },
+    { "spectral4" , 1461,  4 },
+    { "spectral5" , 1465,  5 },
+    { "spectral6" , 1470,  6 },
+    { "spectral7" , 1476,  7 },
+    { "spectral8" , 1483,  8 },
+    { "spectral9" , 1491,  9 },
+    { "spectral10", 1500, 10 },
+    { "spectral11", 1510, 11 },
+    { "ylgn3"     , 1521,  3 },
+    { "ylgn4"     , 1524,  4 },
+    { "ylgn5"     , 1528,  5 },
+    { "ylgn6"     , 1533,  6 },
+    { "ylgn7"     , 1539,  7 },
+    { "ylgn8"     , 1546,  8 },
+    { "ylgn9"     , 1554,  9 },
+    { "ylgnbu3"   , 1563,  3 },
+    { "ylgnbu4"   , 1566,  4 },
+    { "ylgnbu5"   , 1570,  5 },
+    { "ylgnbu6"   , 1575,  6 },
+    { "ylgnbu7"   , 1581,  7 },
+    { "ylgnbu8"   , 1588,  8 },
+    { "ylgnbu9"   , 1596,  9 },
+    { "ylorbr3"   , 1605,  3 },
+    { "ylorbr4"   , 1608,  4 },
+    { "ylorbr5"   , 1612,  5 },
+    { "ylorbr6"   , 1617,  6 },
+    { "ylorbr7"   , 1623,  7 },
+    { "ylorbr8"   , 1630,  8 },
+    { "ylorbr9"   , 1638,  9 },
+    { "ylorrd3"   , 1647,  3 },
+    { "ylorrd4"   , 1650,  4 },
+    { "ylorrd5"   , 1654,  5 },
+    { "ylorrd6"   , 1659,  6 },
+    { "ylorrd7"   , 1665,  7 },
+    { "ylorrd8"   , 1672,  8 },
+    { "ylorrd9"   , 1680,  9 }
+  };
+
+  /** colors of all schemes, named by their index within scheme. */
+  constexpr static SchemeColor<RGB> list[] = {
+    { "1" , RGB{ 127,201,127 }, SchemeEnum::accent3 },
+    { "2" , RGB{ 190,174,212 }, SchemeEnum::accent3 },
+    { "3" , RGB{ 253,192,134 }, SchemeEnum::accent3 },
+    { "1" , RGB{ 127,201,127 }, SchemeEnum::accent4 },
+    { "2" , RGB{ 190,174,212 }, SchemeEnum::accent4 },
+    { "3" , RGB{ 253,192,134 }, SchemeEnum::accent4 },
+    { "4" , RGB{ 255,255,153 }, SchemeEnum::accent4 },
+    { "1" , RGB{ 127,201,127 }, SchemeEnum::accent5 },
+    { "2" , RGB{ 190,174,212 }, SchemeEnum::accent5 },
+    { "3" , RGB{ 253,192,134 }, SchemeEnum::accent5 },
+    { "4" , RGB{ 255,255,153 }, SchemeEnum::accent5 },
+    { "5" , RGB{ 56 ,108,176 }, SchemeEnum::accent5 },
+    { "1" , RGB{ 127,201,127 }, SchemeEnum::accent6 },
+    { "2" , RGB{ 190,174,212 }, SchemeEnum::accent6 },
+    { "3" , RGB{ 253,192,134 }, SchemeEnum::accent6 },
+    { "4" , RGB{ 255,255,153 }, SchemeEnum::accent6 },
+    { "5" , RGB{ 56 ,108,176 }, SchemeEnum::accent6 },
+    { "6" , RGB{ 240,2  ,127 }, SchemeEnum::accent6 },
+    { "1" , RGB{ 127,201,127 }, SchemeEnum::accent7 },
+    { "2" , RGB{ 190,174,212 }, SchemeEnum::accent7 },
+    { "3" , RGB{ 253,192,134 }, SchemeEnum::accent7 },
+    { "4" , RGB{ 255,255,153 }, SchemeEnum::accent7 },
+    { "5" , RGB{ 56 ,108,176 }, SchemeEnum::accent7 },
+    { "6" , RGB{ 240,2  ,127 }, SchemeEnum::accent7 },
+    { "7" , RGB{ 191,91 ,23  }, SchemeEnum::accent7 },
+    { "1" , RGB{ 127,201,127 }, SchemeEnum::accent8 },
+    { "2" , RGB{ 190,174,212 }, SchemeEnum::accent8 },
+    { "3" , RGB{ 253,192,134 }, SchemeEnum::accent8 },
+    { "4" , RGB{ 255,255,153 }, SchemeEnum::accent8 },
+    { "5" , RGB{ 56 ,108,176 }, SchemeEnum::accent8 },
+    { "6" , RGB{ 240,2  ,127 }, SchemeEnum::accent8 },
+    { "7" , RGB{ 191,91 ,23  }, SchemeEnum::accent8 },
+    { "8" , RGB{ 102,102,102 }, SchemeEnum::accent8 },
+    { "1" , RGB{ 222,235,247 }, SchemeEnum::blues3 },
+    { "2" , RGB{ 158,202,225 }, SchemeEnum::blues3 },
+    { "3" , RGB{ 49 ,130,189 }, SchemeEnum::blues3 },
+    { "1" , RGB{ 239,243,255 }, SchemeEnum::blues4 },
+    { "2" , RGB{ 189,215,231 }, SchemeEnum::blues4 },
+    { "3" , RGB{ 107,174,214 }, SchemeEnum::blues4 },
+    { "4" , RGB{ 33 ,113,181 }, SchemeEnum::blues4 },
+    { "1" , RGB{ 239,243,255 }, SchemeEnum::blues5 },
+    { "2" , RGB{ 189,215,231 }, SchemeEnum::blues5 },
+    { "3" , RGB{ 107,174,214 }, SchemeEnum::blues5 },
+    { "4" , RGB{ 49 ,130,189 }, SchemeEnum::blues5 },
+    { "5" , RGB{ 8  ,81 ,156 }, SchemeEnum::blues5 },
+    { "1" , RGB{ 239,243,255 }, SchemeEnum::blues6 },
+    { "2" , RGB{ 198,219,239 }, SchemeEnum::blues6 },
+    { "3" , RGB{ 158,202,225 }, SchemeEnum::blues6 },
+    { "4" , RGB{ 107,174,214 }, SchemeEnum::blues6 },
+    { "5" , RGB{ 49 ,130,189 }, SchemeEnum::blues6 },
+    { "6" , RGB{ 8  ,81 ,156 }, SchemeEnum::blues6 },
+    { "1" , RGB{ 239,243,255 }, SchemeEnum::blues7 },
+    { "2" , RGB{ 198,219,239 }, SchemeEnum::blues7 },
+    { "3" , RGB{ 158,202,225 }, SchemeEnum::blues7 },
+    { "4" , RGB{ 107,174,214 }, SchemeEnum::blues7 },
+    { "5" , RGB{ 66 ,146,198 }, SchemeEnum::blues7 },
+    { "6" , RGB{ 33 ,113,181 }, SchemeEnum::blues7 },
+    { "7" , RGB{ 8  ,69 ,148 }, SchemeEnum::blues7 },
+    { "1" , RGB{ 247,251,255 }, SchemeEnum::blues8 },
+    { "2" , RGB{ 222,235,247 }, SchemeEnum::blues8 },
+    { "3" , RGB{ 198,219,239 }, SchemeEnum::blues8 },
+    { "4" , RGB{ 158,202,225 }, SchemeEnum::blues8 },
+    { "5" , RGB{ 107,174,214 }, SchemeEnum::blues8 },
+    { "6" , RGB{ 66 ,146,198 }, SchemeEnum::blues8 },
+    { "7" , RGB{ 33 ,113,181 }, SchemeEnum::blues8 },
+    { "8" , RGB{ 8  ,69 ,148 }, SchemeEnum::blues8 },
+    { "1" , RGB{ 247,251,255 }, SchemeEnum::blues9 },
+    { "2" , RGB{ 222,235,247 }, SchemeEnum::blues9 },
+    { "3" , RGB{ 198,219,239 }, SchemeEnum::blues9 },
+    { "4" , RGB{ 158,202,225 }, SchemeEnum::blues9 },
+    { "5" , RGB{ 107,174,214 }, SchemeEnum::blues9 },
+    { "6" , RGB{ 66 ,146,198 }, SchemeEnum::blues9 },
+    { "7" , RGB{ 33 ,113,181 }, SchemeEnum::blues9 },
+    { "8" , RGB{ 8  ,81 ,156 }, SchemeEnum::blues9 },
+    { "9" , RGB{ 8  ,48 ,107 }, SchemeEnum::blues9 },
+    { "1" , RGB{ 216,179,101 }, SchemeEnum::brbg3 },
+    { "2" , RGB{ 245,245,245 }, SchemeEnum::brbg3 },
+    { "3" , RGB{ 90 ,180,172 }, SchemeEnum::brbg3 },
+    { "1" , RGB{ 166,97 ,26  }, SchemeEnum::brbg4 },
+    { "2" , RGB{ 223,194,125 }, SchemeEnum::brbg4 },
+    { "3" , RGB{ 128,205,193 }, SchemeEnum::brbg4 },
+    { "4" , RGB{ 1  ,133,113 }, SchemeEnum::brbg4 },
+    { "1" , RGB{ 166,97 ,26  }, SchemeEnum::brbg5 },
+    { "2" , RGB{ 223,194,125 }, SchemeEnum::brbg5 },
+    { "3" , RGB{ 245,245,245 }, SchemeEnum::brbg5 },
+    { "4" , RGB{ 128,205,193 }, SchemeEnum::brbg5 },
+    { "5" , RGB{ 1  ,133,113 }, SchemeEnum::brbg5 },
+    { "1" , RGB{ 140,81 ,10  }, SchemeEnum::brbg6 },
+    { "2" , RGB{ 216,179,101 }, SchemeEnum::brbg6 },
+    { "3" , RGB{ 246,232,195 }, SchemeEnum::brbg6 },
+    { "4" , RGB{ 199,234,229 }, SchemeEnum::brbg6 },
+    { "5" , RGB{ 90 ,180,172 }, SchemeEnum::brbg6 },
+    { "6" , RGB{ 1  ,102,94  }, SchemeEnum::brbg6 },
+    { "1" , RGB{ 140,81 ,10  }, SchemeEnum::brbg7 },
+    { "2" , RGB{ 216,179,101 }, SchemeEnum::brbg7 },
+    { "3" , RGB{ 246,232,195 }, SchemeEnum::brbg7 },
+    { "4" , RGB{ 245,245,245 }, SchemeEnum::brbg7 },
+    { "5" , RGB{ 199,234,229 }, SchemeEnum::brbg7 },
+    { "6" , RGB{ 90 ,180,172 }, SchemeEnum::brbg7 },
+    { "7" , RGB{ 1  ,102,94  }, SchemeEnum::brbg7 },
+    { "1" , RGB{ 140,81 ,10  }, SchemeEnum::brbg8 },
+    { "2" , RGB{ 191,129,45  }, SchemeEnum::brbg8 },
+    { "3" , RGB{ 223,194,125 }, SchemeEnum::brbg8 },
+    { "4" , RGB{ 246,232,195 }, SchemeEnum::brbg8 },
+    { "5" , RGB{ 199,234,229 }, SchemeEnum::brbg8 },
+    { "6" , RGB{ 128,205,193 }, SchemeEnum::brbg8 },
+    { "7" , RGB{ 53 ,151,143 }, SchemeEnum::brbg8 },
+    { "8" , RGB{ 1  ,102,94  }, SchemeEnum::brbg8 },
+    { "1" , RGB{ 140,81 ,10  }, SchemeEnum::brbg9 },
+    { "2" , RGB{ 191,129,45  }, SchemeEnum::brbg9 },
+    { "3" , RGB{ 223,194,125 }, SchemeEnum::brbg9 },
+    { "4" , RGB{ 246,232,195 }, SchemeEnum::brbg9 },
+    { "5" , RGB{ 245,245,245 }, SchemeEnum::brbg9 },
+    { "6" , RGB{ 199,234,229 }, SchemeEnum::brbg9 },
+    { "7" , RGB{ 128,205,193 }, SchemeEnum::brbg9 },
+    { "8" , RGB{ 53 ,151,143 }, SchemeEnum::brbg9 },
+    { "9" , RGB{ 1  ,102,94  }, SchemeEnum::brbg9 },
+    { "1" , RGB{ 84 ,48 ,5   }, SchemeEnum::brbg10 },
+    { "2" , RGB{ 140,81 ,10  }, SchemeEnum::brbg10 },
+    { "3" , RGB{ 191,129,45  }, SchemeEnum::brbg10 },
+    { "4" , RGB{ 223,194,125 }, SchemeEnum::brbg10 },
+    { "5" , RGB{ 246,232,195 }, SchemeEnum::brbg10 },
+    { "6" , RGB{ 199,234,229 }, SchemeEnum::brbg10 },
+    { "7" , RGB{ 128,205,193 }, SchemeEnum::brbg10 },
+    { "8" , RGB{ 53 ,151,143 }, SchemeEnum::brbg10 },
+    { "9" , RGB{ 1  ,102,94  }, SchemeEnum::brbg10 },
+    { "10", RGB{ 0  ,60 ,48  }, SchemeEnum::brbg10 },
+    { "1" , RGB{ 84 ,48 ,5   }, SchemeEnum::brbg11 },
+    { "2" , RGB{ 140,81 ,10  }, SchemeEnum::brbg11 },
+    { "3" , RGB{ 191,129,45  }, SchemeEnum::brbg11 },
+    { "4" , RGB{ 223,194,125 }, SchemeEnum::brbg11 },
+    { "5" , RGB{ 246,232,195 }, SchemeEnum::brbg11 },
+    { "6" , RGB{ 245,245,245 }, SchemeEnum::brbg11 },
+    { "7" , RGB{ 199,234,229 }, SchemeEnum::brbg11 },
+    { "8" , RGB{ 128,205,193 }, SchemeEnum::brbg11 },
+    { "9" , RGB{ 53 ,151,143 }, SchemeEnum::brbg11 },
+    { "10", RGB{ 1  ,102,94  }, SchemeEnum::brbg11 },
+    { "11", RGB{ 0  ,60 ,48  }, SchemeEnum::brbg11 },
+    { "1" , RGB{ 229,245,249 }, SchemeEnum::bugn3 },
+    { "2" , RGB{ 153,216,201 }, SchemeEnum::bugn3 },
+    { "3" , RGB{ 44 ,162,95  }, SchemeEnum::bugn3 },
+    { "1" , RGB{ 237,248,251 }, SchemeEnum::bugn4 },
+    { "2" , RGB{ 178,226,226 }, SchemeEnum::bugn4 },
+    { "3" , RGB{ 102,194,164 }, SchemeEnum::bugn4 },
+    { "4" , RGB{ 35 ,139,69  }, SchemeEnum::bugn4 },
+    { "1" , RGB{ 237,248,251 }, SchemeEnum::bugn5 },
+    { "2" , RGB{ 178,226,226 }, SchemeEnum::bugn5 },
+    { "3" , RGB{ 102,194,164 }, SchemeEnum::bugn5 },
+    { "4" , RGB{ 44 ,162,95  }, SchemeEnum::bugn5 },
+    { "5" , RGB{ 0  ,109,44  }, SchemeEnum::bugn5 },
+    { "1" , RGB{ 237,248,251 }, SchemeEnum::bugn6 },
+    { "2" , RGB{ 204,236,230 }, SchemeEnum::bugn6 },
+    { "3" , RGB{ 153,216,201 }, SchemeEnum::bugn6 },
+    { "4" , RGB{ 102,194,164 }, SchemeEnum::bugn6 },
+    { "5" , RGB{ 44 ,162,95  }, SchemeEnum::bugn6 },
+    { "6" , RGB{ 0  ,109,44  }, SchemeEnum::bugn6 },
+    { "1" , RGB{ 237,248,251 }, SchemeEnum::bugn7 },
+    { "2" , RGB{ 204,236,230 }, SchemeEnum::bugn7 },
+    { "3" , RGB{ 153,216,201 }, SchemeEnum::bugn7 },
+    { "4" , RGB{ 102,194,164 }, SchemeEnum::bugn7 },
+    { "5" , RGB{ 65 ,174,118 }, SchemeEnum::bugn7 },
+    { "6" , RGB{ 35 ,139,69  }, SchemeEnum::bugn7 },
+    { "7" , RGB{ 0  ,88 ,36  }, SchemeEnum::bugn7 },
+    { "1" , RGB{ 247,252,253 }, SchemeEnum::bugn8 },
+    { "2" , RGB{ 229,245,249 }, SchemeEnum::bugn8 },
+    { "3" , RGB{ 204,236,230 }, SchemeEnum::bugn8 },
+    { "4" , RGB{ 153,216,201 }, SchemeEnum::bugn8 },
+    { "5" , RGB{ 102,194,164 }, SchemeEnum::bugn8 },
+    { "6" , RGB{ 65 ,174,118 }, SchemeEnum::bugn8 },
+    { "7" , RGB{ 35 ,139,69  }, SchemeEnum::bugn8 },
+    { "8" , RGB{ 0  ,88 ,36  }, SchemeEnum::bugn8 },
+    { "1" , RGB{ 247,252,253 }, SchemeEnum::bugn9 },
+    { "2" , RGB{ 229,245,249 }, SchemeEnum::bugn9 },
+    { "3" , RGB{ 204,236,230 }, SchemeEnum::bugn9 },
+    { "4" , RGB{ 153,216,201 }, SchemeEnum::bugn9 },
+    { "5" , RGB{ 102,194,164 }, SchemeEnum::bugn9 },
+    { "6" , RGB{ 65 ,174,118 }, SchemeEnum::bugn9 },
+    { "7" , RGB{ 35 ,139,69  }, SchemeEnum::bugn9 },
+    { "8" , RGB{ 0  ,109,44  }, SchemeEnum::bugn9 },
+    { "9" , RGB{ 0  ,68 ,27  }, SchemeEnum::bugn9 },
+    { "1" , RGB{ 224,236,244 }, SchemeEnum::bupu3 },
+    { "2" , RGB{ 158,188,218 }, SchemeEnum::bupu3 },
+    { "3" , RGB{ 136,86 ,167 }, SchemeEnum::bupu3 },
+    { "1" , RGB{ 237,248,251 }, SchemeEnum::bupu4 },
+    { "2" , RGB{ 179,205,227 }, SchemeEnum::bupu4 },
+    { "3" , RGB{ 140,150,198 }, SchemeEnum::bupu4 },
+    { "4" , RGB{ 136,65 ,157 }, SchemeEnum::bupu4 },
+    { "1" , RGB{ 237,248,251 }, SchemeEnum::bupu5 },
+    { "2" , RGB{ 179,205,227 }, SchemeEnum::bupu5 },
+    { "3" , RGB{ 140,150,198 }, SchemeEnum::bupu5 },
+    { "4" , RGB{ 136,86 ,167 }, SchemeEnum::bupu5 },
+    { "5" , RGB{ 129,15 ,124 }, SchemeEnum::bupu5 },
+    { "1" , RGB{ 237,248,251 }, SchemeEnum::bupu6 },
+    { "2" , RGB{ 191,211,230 }, SchemeEnum::bupu6 },
+    { "3" , RGB{ 158,188,218 }, SchemeEnum::bupu6 },
+    { "4" , RGB{ 140,150,198 }, SchemeEnum::bupu6 },
+    { "5" , RGB{ 136,86 ,167 }, SchemeEnum::bupu6 },
+    { "6" , RGB{ 129,15 ,124 }, SchemeEnum::bupu6 },
+    { "1" , RGB{ 237,248,251 }, SchemeEnum::bupu7 },
+    { "2" , RGB{ 191,211,230 }, SchemeEnum::bupu7 },
+    { "3" , RGB{ 158,188,218 }, SchemeEnum::bupu7 },
+    { "4" , RGB{ 140,150,198 }, SchemeEnum::bupu7 },
+    { "5" , RGB{ 140,107,177 }, SchemeEnum::bupu7 },
+    { "6" , RGB{ 136,65 ,157 }, SchemeEnum::bupu7 },
+    { "7" , RGB{ 110,1  ,107 }, SchemeEnum::bupu7 },
+    { "1" , RGB{ 247,252,253 }, SchemeEnum::bupu8 },
+    { "2" , RGB{ 224,236,244 }, SchemeEnum::bupu8 },
+    { "3" , RGB{ 191,211,230 }, SchemeEnum::bupu8 },
+    { "4" , RGB{ 158,188,218 }, SchemeEnum::bupu8 },
+    { "5" , RGB{ 140,150,198 }, SchemeEnum::bupu8 },
+    { "6" , RGB{ 140,107,177 }, SchemeEnum::bupu8 },
+    { "7" , RGB{ 136,65 ,157 }, SchemeEnum::bupu8 },
+    { "8" , RGB{ 110,1  ,107 }, SchemeEnum::bupu8 },
+    { "1" , RGB{ 247,252,253 }, SchemeEnum::bupu9 },
+    { "2" , RGB{ 224,236,244 }, SchemeEnum::bupu9 },
+    { "3" , RGB{ 191,211,230 }, SchemeEnum::bupu9 },
+    { "4" , RGB{ 158,188,218 }, SchemeEnum::bupu9 },
+    { "5" , RGB{ 140,150,198 }, SchemeEnum::bupu9 },
+    { "6" , RGB{ 140,107,177 }, SchemeEnum::bupu9 },
+    { "7" , RGB{ 136,65 ,157 }, SchemeEnum::bupu9 },
+    { "8" , RGB{ 129,15 ,124 }, SchemeEnum::bupu9 },
+    { "9" , RGB{ 77 ,0  ,75  }, SchemeEnum::bupu9 },
+    { "1" , RGB{ 27 ,158,119 }, SchemeEnum::dark23 },
+    { "2" , RGB{ 217,95 ,2   }, SchemeEnum::dark23 },
+    { "3" , RGB{ 117,112,179 }, SchemeEnum::dark23 },
+    { "1" , RGB{ 27 ,158,119 }, SchemeEnum::dark24 },
+    { "2" , RGB{ 217,95 ,2   }, SchemeEnum::dark24 },
+    { "3" , RGB{ 117,112,179 }, SchemeEnum::dark24 },
+    { "4" , RGB{ 231,41 ,138 }, SchemeEnum::dark24 },
+    { "1" , RGB{ 27 ,158,119 }, SchemeEnum::dark25 },
+    { "2" , RGB{ 217,95 ,2   }, SchemeEnum::dark25 },
+    { "3" , RGB{ 117,112,179 }, SchemeEnum::dark25 },
+    { "4" , RGB{ 231,41 ,138 }, SchemeEnum::dark25 },
+    { "5" , RGB{ 102,166,30  }, SchemeEnum::dark25 },
+    { "1" , RGB{ 27 ,158,119 }, SchemeEnum::dark26 },
+    { "2" , RGB{ 217,95 ,2   }, SchemeEnum::dark26 },
+    { "3" , RGB{ 117,112,179 }, SchemeEnum::dark26 },
+    { "4" , RGB{ 231,41 ,138 }, SchemeEnum::dark26 },
+    { "5" , RGB{ 102,166,30  }, SchemeEnum::dark26 },
+    { "6" , RGB{ 230,171,2   }, SchemeEnum::dark26 },
+    { "1" , RGB{ 27 ,158,119 }, SchemeEnum::dark27 },
+    { "2" , RGB{ 217,95 ,2   }, SchemeEnum::dark27 },
+    { "3" , RGB{ 117,112,179 }, SchemeEnum::dark27 },
+    { "4" , RGB{ 231,41 ,138 }, SchemeEnum::dark27 },
+    { "5" , RGB{ 102,166,30  }, SchemeEnum::dark27 },
+    { "6" , RGB{ 230,171,2   }, SchemeEnum::dark27 },
+    { "7" , RGB{ 166,118,29  }, SchemeEnum::dark27 },
+    { "1" , RGB{ 27 ,158,119 }, SchemeEnum::dark28 },
+    { "2" , RGB{ 217,95 ,2   }, SchemeEnum::dark28 },
+    { "3" , RGB{ 117,112,179 }, SchemeEnum::dark28 },
+    { "4" , RGB{ 231,41 ,138 }, SchemeEnum::dark28 },
+    { "5" , RGB{ 102,166,30  }, SchemeEnum::dark28 },
+    { "6" , RGB{ 230,171,2   }, SchemeEnum::dark28 },
+    { "7" , RGB{ 166,118,29  }, SchemeEnum::dark28 },
+    { "8" , RGB{ 102,102,102 }, SchemeEnum::dark28 },
+    { "1" , RGB{ 224,243,219 }, SchemeEnum::gnbu3 },
+    { "2" , RGB{ 168,221,181 }, SchemeEnum::gnbu3 },
+    { "3" , RGB{ 67 ,162,202 }, SchemeEnum::gnbu3 },
+    { "1" , RGB{ 240,249,232 }, SchemeEnum::gnbu4 },
+    { "2" , RGB{ 186,228,188 }, SchemeEnum::gnbu4 },
+    { "3" , RGB{ 123,204,196 }, SchemeEnum::gnbu4 },
+    { "4" , RGB{ 43 ,140,190 }, SchemeEnum::gnbu4 },
+    { "1" , RGB{ 240,249,232 }, SchemeEnum::gnbu5 },
+    { "2" , RGB{ 186,228,188 }, SchemeEnum::gnbu5 },
+    { "3" , RGB{ 123,204,196 }, SchemeEnum::gnbu5 },
+    { "4" , RGB{ 67 ,162,202 }, SchemeEnum::gnbu5 },
+    { "5" , RGB{ 8  ,104,172 }, SchemeEnum::gnbu5 },
+    { "1" , RGB{ 240,249,232 }, SchemeEnum::gnbu6 },
+    { "2" , RGB{ 204,235,197 }, SchemeEnum::gnbu6 },
+    { "3" , RGB{ 168,221,181 }, SchemeEnum::gnbu6 },
+    { "4" , RGB{ 123,204,196 }, SchemeEnum::gnbu6 },
+    { "5" , RGB{ 67 ,162,202 }, SchemeEnum::gnbu6 },
+    { "6" , RGB{ 8  ,104,172 }, SchemeEnum::gnbu6 },
+    { "1" , RGB{ 240,249,232 }, SchemeEnum::gnbu7 },
+    { "2" , RGB{ 204,235,197 }, SchemeEnum::gnbu7 },
+    { "3" , RGB{ 168,221,181 }, SchemeEnum::gnbu7 },
+    { "4" , RGB{ 123,204,196 }, SchemeEnum::gnbu7 },
+    { "5" , RGB{ 78 ,179,211 }, SchemeEnum::gnbu7 },
+    { "6" , RGB{ 43 ,140,190 }, SchemeEnum::gnbu7 },
+    { "7" , RGB{ 8  ,88 ,158 }, SchemeEnum::gnbu7 },
+    { "1" , RGB{ 247,252,240 }, SchemeEnum::gnbu8 },
+    { "2" , RGB{ 224,243,219 }, SchemeEnum::gnbu8 },
+    { "3" , RGB{ 204,235,197 }, SchemeEnum::gnbu8 },
+    { "4" , RGB{ 168,221,181 }, SchemeEnum::gnbu8 },
+    { "5" , RGB{ 123,204,196 }, SchemeEnum::gnbu8 },
+    { "6" , RGB{ 78 ,179,211 }, SchemeEnum::gnbu8 },
+    { "7" , RGB{ 43 ,140,190 }, SchemeEnum::gnbu8 },
+    { "8" , RGB{ 8  ,88 ,158 }, SchemeEnum::gnbu8 },
+    { "1" , RGB{ 247,252,240 }, SchemeEnum::gnbu9 },
+    { "2" , RGB{ 224,243,219 }, SchemeEnum::gnbu9 },
+    { "3" , RGB{ 204,235,197 }, SchemeEnum::gnbu9 },
+    { "4" , RGB{ 168,221,181 }, SchemeEnum::gnbu9 },
+    { "5" , RGB{ 123,204,196 }, SchemeEnum::gnbu9 },
+    { "6" , RGB{ 78 ,179,211 }, SchemeEnum::gnbu9 },
+    { "7" , RGB{ 43 ,140,190 }, SchemeEnum::gnbu9 },
+    { "8" , RGB{ 8  ,104,172 }, SchemeEnum::gnbu9 },
+    { "9" , RGB{ 8  ,64 ,129 }, SchemeEnum::gnbu9 },
+    { "1" , RGB{ 229,245,224 }, SchemeEnum::greens3 },
+    { "2" , RGB{ 161,217,155 }, SchemeEnum::greens3 },
+    { "3" , RGB{ 49 ,163,84  }, SchemeEnum::greens3 },
+    { "1" , RGB{ 237,248,233 }, SchemeEnum::greens4 },
+    { "2" , RGB{ 186,228,179 }, SchemeEnum::greens4 },
+    { "3" , RGB{ 116,196,118 }, SchemeEnum::greens4 },
+    { "4" , RGB{ 35 ,139,69  }, SchemeEnum::greens4 },
+    { "1" , RGB{ 237,248,233 }, SchemeEnum::greens5 },
+    { "2" , RGB{ 186,228,179 }, SchemeEnum::greens5 },
+    { "3" , RGB{ 116,196,118 }, SchemeEnum::greens5 },
+    { "4" , RGB{ 49 ,163,84  }, SchemeEnum::greens5 },
+    { "5" , RGB{ 0  ,109,44  }, SchemeEnum::greens5 },
+    { "1" , RGB{ 237,248,233 }, SchemeEnum::greens6 },
+    { "2" , RGB{ 199,233,192 }, SchemeEnum::greens6 },
+    { "3" , RGB{ 161,217,155 }, SchemeEnum::greens6 },
+    { "4" , RGB{ 116,196,118 }, SchemeEnum::greens6 },
+    { "5" , RGB{ 49 ,163,84  }, SchemeEnum::greens6 },
+    { "6" , RGB{ 0  ,109,44  }, SchemeEnum::greens6 },
+    { "1" , RGB{ 237,248,233 }, SchemeEnum::greens7 },
+    { "2" , RGB{ 199,233,192 }, SchemeEnum::greens7 },
+    { "3" , RGB{ 161,217,155 }, SchemeEnum::greens7 },
+    { "4" , RGB{ 116,196,118 }, SchemeEnum::greens7 },
+    { "5" , RGB{ 65 ,171,93  }, SchemeEnum::greens7 },
+    { "6" , RGB{ 35 ,139,69  }, SchemeEnum::greens7 },
+    { "7" , RGB{ 0  ,90 ,50  }, SchemeEnum::greens7 },
+    { "1" , RGB{ 247,252,245 }, SchemeEnum::greens8 },
+    { "2" , RGB{ 229,245,224 }, SchemeEnum::greens8 },
+    { "3" , RGB{ 199,233,192 }, SchemeEnum::greens8 },
+    { "4" , RGB{ 161,217,155 }, SchemeEnum::greens8 },
+    { "5" , RGB{ 116,196,118 }, SchemeEnum::greens8 },
+    { "6" , RGB{ 65 ,171,93  }, SchemeEnum::greens8 },
+    { "7" , RGB{ 35 ,139,69  }, SchemeEnum::greens8 },
+    { "8" , RGB{ 0  ,90 ,50  }, SchemeEnum::greens8 },
+    { "1" , RGB{ 247,252,245 }, SchemeEnum::greens9 },
+    { "2" , RGB{ 229,245,224 }, SchemeEnum::greens9 },
+    { "3" , RGB{ 199,233,192 }, SchemeEnum::greens9 },
+    { "4" , RGB{ 161,217,155 }, SchemeEnum::greens9 },
+    { "5" , RGB{ 116,196,118 }, SchemeEnum::greens9 },
+    { "6" , RGB{ 65 ,171,93  }, SchemeEnum::greens9 },
+    { "7" , RGB{ 35 ,139,69  }, SchemeEnum::greens9 },
+    { "8" , RGB{ 0  ,109,44  }, SchemeEnum::greens9 },
+    { "9" , RGB{ 0  ,68 ,27  }, SchemeEnum::greens9 },
+    { "1" , RGB{ 240,240,240 }, SchemeEnum::greys3 },
+    { "2" , RGB{ 189,189,189 }, SchemeEnum::greys3 },
+    { "3" , RGB{ 99 ,99 ,99  }, SchemeEnum::greys3 },
+    { "1" , RGB{ 247,247,247 }, SchemeEnum::greys4 },
+    { "2" , RGB{ 204,204,204 }, SchemeEnum::greys4 },
+    { "3" , RGB{ 150,150,150 }, SchemeEnum::greys4 },
+    { "4" , RGB{ 82 ,82 ,82  }, SchemeEnum::greys4 },
+    { "1" , RGB{ 247,247,247 }, SchemeEnum::greys5 },
+    { "2" , RGB{ 204,204,204 }, SchemeEnum::greys5 },
+    { "3" , RGB{ 150,150,150 }, SchemeEnum::greys5 },
+    { "4" , RGB{ 99 ,99 ,99  }, SchemeEnum::greys5 },
+    { "5" , RGB{ 37 ,37 ,37  }, SchemeEnum::greys5 },
+    { "1" , RGB{ 247,247,247 }, SchemeEnum::greys6 },
+    { "2" , RGB{ 217,217,217 }, SchemeEnum::greys6 },
+    { "3" , RGB{ 189,189,189 }, SchemeEnum::greys6 },
+    { "4" , RGB{ 150,150,150 }, SchemeEnum::greys6 },
+    { "5" , RGB{ 99 ,99 ,99  }, SchemeEnum::greys6 },
+    { "6" , RGB{ 37 ,37 ,37  }, SchemeEnum::greys6 },
+    { "1" , RGB{ 247,247,247 }, SchemeEnum::greys7 },
+    { "2" , RGB{ 217,217,217 }, SchemeEnum::greys7 },
+    { "3" , RGB{ 189,189,189 }, SchemeEnum::greys7 },
+    { "4" , RGB{ 150,150,150 }, SchemeEnum::greys7 },
+    { "5" , RGB{ 115,115,115 }, SchemeEnum::greys7 },
+    { "6" , RGB{ 82 ,82 ,82  }, SchemeEnum::greys7 },
+    { "7" , RGB{ 37 ,37 ,37  }, SchemeEnum::greys7 },
+    { "1" , RGB{ 255,255,255 }, SchemeEnum::greys8 },
+    { "2" , RGB{ 240,240,240 }, SchemeEnum::greys8 },
+    { "3" , RGB{ 217,217,217 }, SchemeEnum::greys8 },
+    { "4" , RGB{ 189,189,189 }, SchemeEnum::greys8 },
+    { "5" , RGB{ 150,150,150 }, SchemeEnum::greys8 },
+    { "6" , RGB{ 115,115,115 }, SchemeEnum::greys8 },
+    { "7" , RGB{ 82 ,82 ,82  }, SchemeEnum::greys8 },
+    { "8" , RGB{ 37 ,37 ,37  }, SchemeEnum::greys8 },
+    { "1" , RGB{ 255,255,255 }, SchemeEnum::greys9 },
+    { "2" , RGB{ 240,240,240 }, SchemeEnum::greys9 },
+    { "3" , RGB{ 217,217,217 }, SchemeEnum::greys9 },
+    { "4" , RGB{ 189,189,189 }, SchemeEnum::greys9 },
+    { "5" , RGB{ 150,150,150 }, SchemeEnum::greys9 },
+    { "6" , RGB{ 115,115,115 }, SchemeEnum::greys9 },
+    { "7" , RGB{ 82 ,82 ,82  }, SchemeEnum::greys9 },
+    { "8" , RGB{ 37 ,37 ,37  }, SchemeEnum::greys9 },
+    { "9" , RGB{ 0  ,0  ,0   }, SchemeEnum::greys9 },
+    { "1" , RGB{ 254,230,206 }, SchemeEnum::oranges3 },
+    { "2" , RGB{ 253,174,107 }, SchemeEnum::oranges3 },
+    { "3" , RGB{ 230,85 ,13  }, SchemeEnum::oranges3 },
+    { "1" , RGB{ 254,237,222 }, SchemeEnum::oranges4 },
+    { "2" , RGB{ 253,190,133 }, SchemeEnum::oranges4 },
+    { "3" , RGB{ 253,141,60  }, SchemeEnum::oranges4 },
+    { "4" , RGB{ 217,71 ,1   }, SchemeEnum::oranges4 },
+    { "1" , RGB{ 254,237,222 }, SchemeEnum::oranges5 },
+    { "2" , RGB{ 253,190,133 }, SchemeEnum::oranges5 },
+    { "3" , RGB{ 253,141,60  }, SchemeEnum::oranges5 },
+    { "4" , RGB{ 230,85 ,13  }, SchemeEnum::oranges5 },
+    { "5" , RGB{ 166,54 ,3   }, SchemeEnum::oranges5 },
+    { "1" , RGB{ 254,237,222 }, SchemeEnum::oranges6 },
+    { "2" , RGB{ 253,208,162 }, SchemeEnum::oranges6 },
+    { "3" , RGB{ 253,174,107 }, SchemeEnum::oranges6 },
+    { "4" , RGB{ 253,141,60  }, SchemeEnum::oranges6 },
+    { "5" , RGB{ 230,85 ,13  }, SchemeEnum::oranges6 },
+    { "6" , RGB{ 166,54 ,3   }, SchemeEnum::oranges6 },
+    { "1" , RGB{ 254,237,222 }, SchemeEnum::oranges7 },
+    { "2" , RGB{ 253,208,162 }, SchemeEnum::oranges7 },
+    { "3" , RGB{ 253,174,107 }, SchemeEnum::oranges7 },
+    { "4" , RGB{ 253,141,60  }, SchemeEnum::oranges7 },
+    { "5" , RGB{ 241,105,19  }, SchemeEnum::oranges7 },
+    { "6" , RGB{ 217,72 ,1   }, SchemeEnum::oranges7 },
+    { "7" , RGB{ 140,45 ,4   }, SchemeEnum::oranges7 },
+    { "1" , RGB{ 255,245,235 }, SchemeEnum::oranges8 },
+    { "2" , RGB{ 254,230,206 }, SchemeEnum::oranges8 },
+    { "3" , RGB{ 253,208,162 }, SchemeEnum::oranges8 },
+    { "4" , RGB{ 253,174,107 }, SchemeEnum::oranges8 },
+    { "5" , RGB{ 253,141,60  }, SchemeEnum::oranges8 },
+    { "6" , RGB{ 241,105,19  }, SchemeEnum::oranges8 },
+    { "7" , RGB{ 217,72 ,1   }, SchemeEnum::oranges8 },
+    { "8" , RGB{ 140,45 ,4   }, SchemeEnum::oranges8 },
+    { "1" , RGB{ 255,245,235 }, SchemeEnum::oranges9 },
+    { "2" , RGB{ 254,230,206 }, SchemeEnum::oranges9 },
+    { "3" , RGB{ 253,208,162 }, SchemeEnum::oranges9 },
+    { "4" , RGB{ 253,174,107 }, SchemeEnum::oranges9 },
+    { "5" , RGB{ 253,141,60  }, SchemeEnum::oranges9 },
+    { "6" , RGB{ 241,105,19  }, SchemeEnum::oranges9 },
+    { "7" , RGB{ 217,72 ,1   }, SchemeEnum::oranges9 },
+    { "8" , RGB{ 166,54 ,3   }, SchemeEnum::oranges9 },
+    { "9" , RGB{ 127,39 ,4   }, SchemeEnum::oranges9 },
+    { "1" , RGB{ 254,232,200 }, SchemeEnum::orrd3 },
+    { "2" , RGB{ 253,187,132 }, SchemeEnum::orrd3 },
+    { "3" , RGB{ 227,74 ,51  }, SchemeEnum::orrd3 },
+    { "1" , RGB{ 254,240,217 }, SchemeEnum::orrd4 },
+    { "2" , RGB{ 253,204,138 }, SchemeEnum::orrd4 },
+    { "3" , RGB{ 252,141,89  }, SchemeEnum::orrd4 },
+    { "4" , RGB{ 215,48 ,31  }, SchemeEnum::orrd4 },
+    { "1" , RGB{ 254,240,217 }, SchemeEnum::orrd5 },
+    { "2" , RGB{ 253,204,138 }, SchemeEnum::orrd5 },
+    { "3" , RGB{ 252,141,89  }, SchemeEnum::orrd5 },
+    { "4" , RGB{ 227,74 ,51  }, SchemeEnum::orrd5 },
+    { "5" , RGB{ 179,0  ,0   }, SchemeEnum::orrd5 },
+    { "1" , RGB{ 254,240,217 }, SchemeEnum::orrd6 },
+    { "2" , RGB{ 253,212,158 }, SchemeEnum::orrd6 },
+    { "3" , RGB{ 253,187,132 }, SchemeEnum::orrd6 },
+    { "4" , RGB{ 252,141,89  }, SchemeEnum::orrd6 },
+    { "5" , RGB{ 227,74 ,51  }, SchemeEnum::orrd6 },
+    { "6" , RGB{ 179,0  ,0   }, SchemeEnum::orrd6 },
+    { "1" , RGB{ 254,240,217 }, SchemeEnum::orrd7 },
+    { "2" , RGB{ 253,212,158 }, SchemeEnum::orrd7 },
+    { "3" , RGB{ 253,187,132 }, SchemeEnum::orrd7 },
+    { "4" , RGB{ 252,141,89  }, SchemeEnum::orrd7 },
+    { "5" , RGB{ 239,101,72  }, SchemeEnum::orrd7 },
+    { "6" , RGB{ 215,48 ,31  }, SchemeEnum::orrd7 },
+    { "7" , RGB{ 153,0  ,0   }, SchemeEnum::orrd7 },
+    { "1" , RGB{ 255,247,236 }, SchemeEnum::orrd8 },
+    { "2" , RGB{ 254,232,200 }, SchemeEnum::orrd8 },
+    { "3" , RGB{ 253,212,158 }, SchemeEnum::orrd8 },
+    { "4" , RGB{ 253,187,132 }, SchemeEnum::orrd8 },
+    { "5" , RGB{ 252,141,89  }, SchemeEnum::orrd8 },
+    { "6" , RGB{ 239,101,72  }, SchemeEnum::orrd8 },
+    { "7" , RGB{ 215,48 ,31  }, SchemeEnum::orrd8 },
+    { "8" , RGB{ 153,0  ,0   }, SchemeEnum::orrd8 },
+    { "1" , RGB{ 255,247,236 }, SchemeEnum::orrd9 },
+    { "2" , RGB{ 254,232,200 }, SchemeEnum::orrd9 },
+    { "3" , RGB{ 253,212,158 }, SchemeEnum::orrd9 },
+    { "4" , RGB{ 253,187,132 }, SchemeEnum::orrd9 },
+    { "5" , RGB{ 252,141,89  }, SchemeEnum::orrd9 },
+    { "6" , RGB{ 239,101,72  }, SchemeEnum::orrd9 },
+    { "7" , RGB{ 215,48 ,31  }, SchemeEnum::orrd9 },
+    { "8" , RGB{ 179,0  ,0   }, SchemeEnum::orrd9 },
+    { "9" , RGB{ 127,0  ,0   }, SchemeEnum::orrd9 },
+    { "1" , RGB{ 166,206,227 }, SchemeEnum::paired3 },
+    { "2" , RGB{ 31 ,120,180 }, SchemeEnum::paired3 },
+    { "3" , RGB{ 178,223,138 }, SchemeEnum::paired3 },
+    { "1" , RGB{ 166,206,227 }, SchemeEnum::paired4 },
+    { "2" , RGB{ 31 ,120,180 }, SchemeEnum::paired4 },
+    { "3" , RGB{ 178,223,138 }, SchemeEnum::paired4 },
+    { "4" , RGB{ 51 ,160,44  }, SchemeEnum::paired4 },
+    { "1" , RGB{ 166,206,227 }, SchemeEnum::paired5 },
+    { "2" , RGB{ 31 ,120,180 }, SchemeEnum::paired5 },
+    { "3" , RGB{ 178,223,138 }, SchemeEnum::paired5 },
+    { "4" , RGB{ 51 ,160,44  }, SchemeEnum::paired5 },
+    { "5" , RGB{ 251,154,153 }, SchemeEnum::paired5 },
+    { "1" , RGB{ 166,206,227 }, SchemeEnum::paired6 },
+    { "2" , RGB{ 31 ,120,180 }, SchemeEnum::paired6 },
+    { "3" , RGB{ 178,223,138 }, SchemeEnum::paired6 },
+    { "4" , RGB{ 51 ,160,44  }, SchemeEnum::paired6 },
+    { "5" , RGB{ 251,154,153 }, SchemeEnum::paired6 },
+    { "6" , RGB{ 227,26 ,28  }, SchemeEnum::paired6 },
+    { "1" , RGB{ 166,206,227 }, SchemeEnum::paired7 },
+    { "2" , RGB{ 31 ,120,180 }, SchemeEnum::paired7 },
+    { "3" , RGB{ 178,223,138 }, SchemeEnum::paired7 },
+    { "4" , RGB{ 51 ,160,44  }, SchemeEnum::paired7 },
+    { "5" , RGB{ 251,154,153 }, SchemeEnum::paired7 },
+    { "6" , RGB{ 227,26 ,28  }, SchemeEnum::paired7 },
+    { "7" , RGB{ 253,191,111 }, SchemeEnum::paired7 },
+    { "1" , RGB{ 166,206,227 }, SchemeEnum::paired8 },
+    { "2" , RGB{ 31 ,120,180 }, SchemeEnum::paired8 },
+    { "3" , RGB{ 178,223,138 }, SchemeEnum::paired8 },
+    { "4" , RGB{ 51 ,160,44  }, SchemeEnum::paired8 },
+    { "5" , RGB{ 251,154,153 }, SchemeEnum::paired8 },
+    { "6" , RGB{ 227,26 ,28  }, SchemeEnum::paired8 },
+    { "7" , RGB{ 253,191,111 }, SchemeEnum::paired8 },
+    { "8" , RGB{ 255,127,0   }, SchemeEnum::paired8 },
+    { "1" , RGB{ 166,206,227 }, SchemeEnum::paired9 },
+    { "2" , RGB{ 31 ,120,180 }, SchemeEnum::paired9 },
+    { "3" , RGB{ 178,223,138 }, SchemeEnum::paired9 },
+    { "4" , RGB{ 51 ,160,44  }, SchemeEnum::paired9 },
+    { "5" , RGB{ 251,154,153 }, SchemeEnum::paired9 },
+    { "6" , RGB{ 227,26 ,28  }, SchemeEnum::paired9 },
+    { "7" , RGB{ 253,191,111 }, SchemeEnum::paired9 },
+    { "8" , RGB{ 255,127,0   }, SchemeEnum::paired9 },
+    { "9" , RGB{ 202,178,214 }, SchemeEnum::paired9 },
+    { "1" , RGB{ 166,206,227 }, SchemeEnum::paired10 },
+    { "2" , RGB{ 31 ,120,180 }, SchemeEnum::paired10 },
+    { "3" , RGB{ 178,223,138 }, SchemeEnum::paired10 },
+    { "4" , RGB{ 51 ,160,44  }, SchemeEnum::paired10 },
+    { "5" , RGB{ 251,154,153 }, SchemeEnum::paired10 },
+    { "6" , RGB{ 227,26 ,28  }, SchemeEnum::paired10 },
+    { "7" , RGB{ 253,191,111 }, SchemeEnum::paired10 },
+    { "8" , RGB{ 255,127,0   }, SchemeEnum::paired10 },
+    { "9" , RGB{ 202,178,214 }, SchemeEnum::paired10 },
+    { "10", RGB{ 106,61 ,154 }, SchemeEnum::paired10 },
+    { "1" , RGB{ 166,206,227 }, SchemeEnum::paired11 },
+    { "2" , RGB{ 31 ,120,180 }, SchemeEnum::paired11 },
+    { "3" , RGB{ 178,223,138 }, SchemeEnum::paired11 },
+    { "4" , RGB{ 51 ,160,44  }, SchemeEnum::paired11 },
+    { "5" , RGB{ 251,154,153 }, SchemeEnum::paired11 },
+    { "6" , RGB{ 227,26 ,28  }, SchemeEnum::paired11 },
+    { "7" , RGB{ 253,191,111 }, SchemeEnum::paired11 },
+    { "8" , RGB{ 255,127,0   }, SchemeEnum::paired11 },
+    { "9" , RGB{ 202,178,214 }, SchemeEnum::paired11 },
+    { "10", RGB{ 106,61 ,154 }, SchemeEnum::paired11 },
+    { "11", RGB{ 255,255,153 }, SchemeEnum::paired11 },
+    { "1" , RGB{ 166,206,227 }, SchemeEnum::paired12 },
+    { "2" , RGB{ 31 ,120,180 }, SchemeEnum::paired12 },
+    { "3" , RGB{ 178,223,138 }, SchemeEnum::paired12 },
+    { "4" , RGB{ 51 ,160,44  }, SchemeEnum::paired12 },
+    { "5" , RGB{ 251,154,153 }, SchemeEnum::paired12 },
+    { "6" , RGB{ 227,26 ,28  }, SchemeEnum::paired12 },
+    { "7" , RGB{ 253,191,111 }, SchemeEnum::paired12 },
+    { "8" , RGB{ 255,127,0   }, SchemeEnum::paired12 },
+    { "9" , RGB{ 202,178,214 }, SchemeEnum::paired12 },
+    { "10", RGB{ 106,61 ,154 }, SchemeEnum::paired12 },
+    { "11", RGB{ 255,255,153 }, SchemeEnum::paired12 },
+    { "12", RGB{ 177,89 ,40  }, SchemeEnum::paired12 },
+    { "1" , RGB{ 251,180,174 }, SchemeEnum::pastel13 },
+    { "2" , RGB{ 179,205,227 }, SchemeEnum::pastel13 },
+    { "3" , RGB{ 204,235,197 }, SchemeEnum::pastel13 },
+    { "1" , RGB{ 251,180,174 }, SchemeEnum::pastel14 },
+    { "2" , RGB{ 179,205,227 }, SchemeEnum::pastel14 },
+    { "3" , RGB{ 204,235,197 }, SchemeEnum::pastel14 },
+    { "4" , RGB{ 222,203,228 }, SchemeEnum::pastel14 },
+    { "1" , RGB{ 251,180,174 }, SchemeEnum::pastel15 },
+    { "2" , RGB{ 179,205,227 }, SchemeEnum::pastel15 },
+    { "3" , RGB{ 204,235,197 }, SchemeEnum::pastel15 },
+    { "4" , RGB{ 222,203,228 }, SchemeEnum::pastel15 },
+    { "5" , RGB{ 254,217,166 }, SchemeEnum::pastel15 },
+    { "1" , RGB{ 251,180,174 }, SchemeEnum::pastel16 },
+    { "2" , RGB{ 179,205,227 }, SchemeEnum::pastel16 },
+    { "3" , RGB{ 204,235,197 }, SchemeEnum::pastel16 },
+    { "4" , RGB{ 222,203,228 }, SchemeEnum::pastel16 },
+    { "5" , RGB{ 254,217,166 }, SchemeEnum::pastel16 },
+    { "6" , RGB{ 255,255,204 }, SchemeEnum::pastel16 },
+    { "1" , RGB{ 251,180,174 }, SchemeEnum::pastel17 },
+    { "2" , RGB{ 179,205,227 }, SchemeEnum::pastel17 },
+    { "3" , RGB{ 204,235,197 }, SchemeEnum::pastel17 },
+    { "4" , RGB{ 222,203,228 }, SchemeEnum::pastel17 },
+    { "5" , RGB{ 254,217,166 }, SchemeEnum::pastel17 },
+    { "6" , RGB{ 255,255,204 }, SchemeEnum::pastel17 },
+    { "7" , RGB{ 229,216,189 }, SchemeEnum::pastel17 },
+    { "1" , RGB{ 251,180,174 }, SchemeEnum::pastel18 },
+    { "2" , RGB{ 179,205,227 }, SchemeEnum::pastel18 },
+    { "3" , RGB{ 204,235,197 }, SchemeEnum::pastel18 },
+    { "4" , RGB{ 222,203,228 }, SchemeEnum::pastel18 },
+    { "5" , RGB{ 254,217,166 }, SchemeEnum::pastel18 },
+    { "6" , RGB{ 255,255,204 }, SchemeEnum::pastel18 },
+    { "7" , RGB{ 229,216,189 }, SchemeEnum::pastel18 },
+    { "8" , RGB{ 253,218,236 }, SchemeEnum::pastel18 },
+    { "1" , RGB{ 251,180,174 }, SchemeEnum::pastel19 },
+    { "2" , RGB{ 179,205,227 }, SchemeEnum::pastel19 },
+    { "3" , RGB{ 204,235,197 }, SchemeEnum::pastel19 },
+    { "4" , RGB{ 222,203,228 }, SchemeEnum::pastel19 },
+    { "5" , RGB{ 254,217,166 }, SchemeEnum::pastel19 },
+    { "6" , RGB{ 255,255,204 }, SchemeEnum::pastel19 },
+    { "7" , RGB{ 229,216,189 }, SchemeEnum::pastel19 },
+    { "8" , RGB{ 253,218,236 }, SchemeEnum::pastel19 },
+    { "9" , RGB{ 242,242,242 }, SchemeEnum::pastel19 },
+    { "1" , RGB{ 179,226,205 }, SchemeEnum::pastel23 },
+    { "2" , RGB{ 253,205,172 }, SchemeEnum::pastel23 },
+    { "3" , RGB{ 203,213,232 }, SchemeEnum::pastel23 },
+    { "1" , RGB{ 179,226,205 }, SchemeEnum::pastel24 },
+    { "2" , RGB{ 253,205,172 }, SchemeEnum::pastel24 },
+    { "3" , RGB{ 203,213,232 }, SchemeEnum::pastel24 },
+    { "4" , RGB{ 244,202,228 }, SchemeEnum::pastel24 },
+    { "1" , RGB{ 179,226,205 }, SchemeEnum::pastel25 },
+    { "2" , RGB{ 253,205,172 }, SchemeEnum::pastel25 },
+    { "3" , RGB{ 203,213,232 }, SchemeEnum::pastel25 },
+    { "4" , RGB{ 244,202,228 }, SchemeEnum::pastel25 },
+    { "5" , RGB{ 230,245,201 }, SchemeEnum::pastel25 },
+    { "1" , RGB{ 179,226,205 }, SchemeEnum::pastel26 },
+    { "2" , RGB{ 253,205,172 }, SchemeEnum::pastel26 },
+    { "3" , RGB{ 203,213,232 }, SchemeEnum::pastel26 },
+    { "4" , RGB{ 244,202,228 }, SchemeEnum::pastel26 },
+    { "5" , RGB{ 230,245,201 }, SchemeEnum::pastel26 },
+    { "6" , RGB{ 255,242,174 }, SchemeEnum::pastel26 },
+    { "1" , RGB{ 179,226,205 }, SchemeEnum::pastel27 },
+    { "2" , RGB{ 253,205,172 }, SchemeEnum::pastel27 },
+    { "3" , RGB{ 203,213,232 }, SchemeEnum::pastel27 },
+    { "4" , RGB{ 244,202,228 }, SchemeEnum::pastel27 },
+    { "5" , RGB{ 230,245,201 }, SchemeEnum::pastel27 },
+    { "6" , RGB{ 255,242,174 }, SchemeEnum::pastel27 },
+    { "7" , RGB{ 241,226,204 }, SchemeEnum::pastel27 },
+    { "1" , RGB{ 179,226,205 }, SchemeEnum::pastel28 },
+    { "2" , RGB{ 253,205,172 }, SchemeEnum::pastel28 },
+    { "3" , RGB{ 203,213,232 }, SchemeEnum::pastel28 },
+    { "4" , RGB{ 244,202,228 }, SchemeEnum::pastel28 },
+    { "5" , RGB{ 230,245,201 }, SchemeEnum::pastel28 },
+    { "6" , RGB{ 255,242,174 }, SchemeEnum::pastel28 },
+    { "7" , RGB{ 241,226,204 }, SchemeEnum::pastel28 },
+    { "8" , RGB{ 204,204,204 }, SchemeEnum::pastel28 },
+    { "1" , RGB{ 233,163,201 }, SchemeEnum::piyg3 },
+    { "2" , RGB{ 247,247,247 }, SchemeEnum::piyg3 },
+    { "3" , RGB{ 161,215,106 }, SchemeEnum::piyg3 },
+    { "1" , RGB{ 208,28 ,139 }, SchemeEnum::piyg4 },
+    { "2" , RGB{ 241,182,218 }, SchemeEnum::piyg4 },
+    { "3" , RGB{ 184,225,134 }, SchemeEnum::piyg4 },
+    { "4" , RGB{ 77 ,172,38  }, SchemeEnum::piyg4 },
+    { "1" , RGB{ 208,28 ,139 }, SchemeEnum::piyg5 },
+    { "2" , RGB{ 241,182,218 }, SchemeEnum::piyg5 },
+    { "3" , RGB{ 247,247,247 }, SchemeEnum::piyg5 },
+    { "4" , RGB{ 184,225,134 }, SchemeEnum::piyg5 },
+    { "5" , RGB{ 77 ,172,38  }, SchemeEnum::piyg5 },
+    { "1" , RGB{ 197,27 ,125 }, SchemeEnum::piyg6 },
+    { "2" , RGB{ 233,163,201 }, SchemeEnum::piyg6 },
+    { "3" , RGB{ 253,224,239 }, SchemeEnum::piyg6 },
+    { "4" , RGB{ 230,245,208 }, SchemeEnum::piyg6 },
+    { "5" , RGB{ 161,215,106 }, SchemeEnum::piyg6 },
+    { "6" , RGB{ 77 ,146,33  }, SchemeEnum::piyg6 },
+    { "1" , RGB{ 197,27 ,125 }, SchemeEnum::piyg7 },
+    { "2" , RGB{ 233,163,201 }, SchemeEnum::piyg7 },
+    { "3" , RGB{ 253,224,239 }, SchemeEnum::piyg7 },
+    { "4" , RGB{ 247,247,247 }, SchemeEnum::piyg7 },
+    { "5" , RGB{ 230,245,208 }, SchemeEnum::piyg7 },
+    { "6" , RGB{ 161,215,106 }, SchemeEnum::piyg7 },
+    { "7" , RGB{ 77 ,146,33  }, SchemeEnum::piyg7 },
+    { "1" , RGB{ 197,27 ,125 }, SchemeEnum::piyg8 },
+    { "2" , RGB{ 222,119,174 }, SchemeEnum::piyg8 },
+    { "3" , RGB{ 241,182,218 }, SchemeEnum::piyg8 },
+    { "4" , RGB{ 253,224,239 }, SchemeEnum::piyg8 },
+    { "5" , RGB{ 230,245,208 }, SchemeEnum::piyg8 },
+    { "6" , RGB{ 184,225,134 }, SchemeEnum::piyg8 },
+    { "7" , RGB{ 127,188,65  }, SchemeEnum::piyg8 },
+    { "8" , RGB{ 77 ,146,33  }, SchemeEnum::piyg8 },
+    { "1" , RGB{ 197,27 ,125 }, SchemeEnum::piyg9 },
+    { "2" , RGB{ 222,119,174 }, SchemeEnum::piyg9 },
+    { "3" , RGB{ 241,182,218 }, SchemeEnum::piyg9 },
+    { "4" , RGB{ 253,224,239 }, SchemeEnum::piyg9 },
+    { "5" , RGB{ 247,247,247 }, SchemeEnum::piyg9 },
+    { "6" , RGB{ 230,245,208 }, SchemeEnum::piyg9 },
+    { "7" , RGB{ 184,225,134 }, SchemeEnum::piyg9 },
+    { "8" , RGB{ 127,188,65  }, SchemeEnum::piyg9 },
+    { "9" , RGB{ 77 ,146,33  }, SchemeEnum::piyg9 },
+    { "1" , RGB{ 142,1  ,82  }, SchemeEnum::piyg10 },
+    { "2" , RGB{ 197,27 ,125 }, SchemeEnum::piyg10 },
+    { "3" , RGB{ 222,119,174 }, SchemeEnum::piyg10 },
+    { "4" , RGB{ 241,182,218 }, SchemeEnum::piyg10 },
+    { "5" , RGB{ 253,224,239 }, SchemeEnum::piyg10 },
+    { "6" , RGB{ 230,245,208 }, SchemeEnum::piyg10 },
+    { "7" , RGB{ 184,225,134 }, SchemeEnum::piyg10 },
+    { "8" , RGB{ 127,188,65  }, SchemeEnum::piyg10 },
+    { "9" , RGB{ 77 ,146,33  }, SchemeEnum::piyg10 },
+    { "10", RGB{ 39 ,100,25  }, SchemeEnum::piyg10 },
+    { "1" , RGB{ 142,1  ,82  }, SchemeEnum::piyg11 },
+    { "2" , RGB{ 197,27 ,125 }, SchemeEnum::piyg11 },
+    { "3" , RGB{ 222,119,174 }, SchemeEnum::piyg11 },
+    { "4" , RGB{ 241,182,218 }, SchemeEnum::piyg11 },
+    { "5" , RGB{ 253,224,239 }, SchemeEnum::piyg11 },
+    { "6" , RGB{ 247,247,247 }, SchemeEnum::piyg11 },
+    { "7" , RGB{ 230,245,208 }, SchemeEnum::piyg11 },
+    { "8" , RGB{ 184,225,134 }, SchemeEnum::piyg11 },
+    { "9" , RGB{ 127,188,65  }, SchemeEnum::piyg11 },
+    { "10", RGB{ 77 ,146,33  }, SchemeEnum::piyg11 },
+    { "11", RGB{ 39 ,100,25  }, SchemeEnum::piyg11 },
+    { "1" , RGB{ 175,141,195 }, SchemeEnum::prgn3 },
+    { "2" , RGB{ 247,247,247 }, SchemeEnum::prgn3 },
+    { "3" , RGB{ 127,191,123 }, SchemeEnum::prgn3 },
+    { "1" , RGB{ 123,50 ,148 }, SchemeEnum::prgn4 },
+    { "2" , RGB{ 194,165,207 }, SchemeEnum::prgn4 },
+    { "3" , RGB{ 166,219,160 }, SchemeEnum::prgn4 },
+    { "4" , RGB{ 0  ,136,55  }, SchemeEnum::prgn4 },
+    { "1" , RGB{ 123,50 ,148 }, SchemeEnum::prgn5 },
+    { "2" , RGB{ 194,165,207 }, SchemeEnum::prgn5 },
+    { "3" , RGB{ 247,247,247 }, SchemeEnum::prgn5 },
+    { "4" , RGB{ 166,219,160 }, SchemeEnum::prgn5 },
+    { "5" , RGB{ 0  ,136,55  }, SchemeEnum::prgn5 },
+    { "1" , RGB{ 118,42 ,131 }, SchemeEnum::prgn6 },
+    { "2" , RGB{ 175,141,195 }, SchemeEnum::prgn6 },
+    { "3" , RGB{ 231,212,232 }, SchemeEnum::prgn6 },
+    { "4" , RGB{ 217,240,211 }, SchemeEnum::prgn6 },
+    { "5" , RGB{ 127,191,123 }, SchemeEnum::prgn6 },
+    { "6" , RGB{ 27 ,120,55  }, SchemeEnum::prgn6 },
+    { "1" , RGB{ 118,42 ,131 }, SchemeEnum::prgn7 },
+    { "2" , RGB{ 175,141,195 }, SchemeEnum::prgn7 },
+    { "3" , RGB{ 231,212,232 }, SchemeEnum::prgn7 },
+    { "4" , RGB{ 247,247,247 }, SchemeEnum::prgn7 },
+    { "5" , RGB{ 217,240,211 }, SchemeEnum::prgn7 },
+    { "6" , RGB{ 127,191,123 }, SchemeEnum::prgn7 },
+    { "7" , RGB{ 27 ,120,55  }, SchemeEnum::prgn7 },
+    { "1" , RGB{ 118,42 ,131 }, SchemeEnum::prgn8 },
+    { "2" , RGB{ 153,112,171 }, SchemeEnum::prgn8 },
+    { "3" , RGB{ 194,165,207 }, SchemeEnum::prgn8 },
+    { "4" , RGB{ 231,212,232 }, SchemeEnum::prgn8 },
+    { "5" , RGB{ 217,240,211 }, SchemeEnum::prgn8 },
+    { "6" , RGB{ 166,219,160 }, SchemeEnum::prgn8 },
+    { "7" , RGB{ 90 ,174,97  }, SchemeEnum::prgn8 },
+    { "8" , RGB{ 27 ,120,55  }, SchemeEnum::prgn8 },
+    { "1" , RGB{ 118,42 ,131 }, SchemeEnum::prgn9 },
+    { "2" , RGB{ 153,112,171 }, SchemeEnum::prgn9 },
+    { "3" , RGB{ 194,165,207 }, SchemeEnum::prgn9 },
+    { "4" , RGB{ 231,212,232 }, SchemeEnum::prgn9 },
+    { "5" , RGB{ 247,247,247 }, SchemeEnum::prgn9 },
+    { "6" , RGB{ 217,240,211 }, SchemeEnum::prgn9 },
+    { "7" , RGB{ 166,219,160 }, SchemeEnum::prgn9 },
+    { "8" , RGB{ 90 ,174,97  }, SchemeEnum::prgn9 },
+    { "9" , RGB{ 27 ,120,55  }, SchemeEnum::prgn9 },
+    { "1" , RGB{ 64 ,0  ,75  }, SchemeEnum::prgn10 },
+    { "2" , RGB{ 118,42 ,131 }, SchemeEnum::prgn10 },
+    { "3" , RGB{ 153,112,171 }, SchemeEnum::prgn10 },
+    { "4" , RGB{ 194,165,207 }, SchemeEnum::prgn10 },
+    { "5" , RGB{ 231,212,232 }, SchemeEnum::prgn10 },
+    { "6" , RGB{ 217,240,211 }, SchemeEnum::prgn10 },
+    { "7" , RGB{ 166,219,160 }, SchemeEnum::prgn10 },
+    { "8" , RGB{ 90 ,174,97  }, SchemeEnum::prgn10 },
+    { "9" , RGB{ 27 ,120,55  }, SchemeEnum::prgn10 },
+    { "10", RGB{ 0  ,68 ,27  }, SchemeEnum::prgn10 },
+    { "1" , RGB{ 64 ,0  ,75  }, SchemeEnum::prgn11 },
+    { "2" , RGB{ 118,42 ,131 }, SchemeEnum::prgn11 },
+    { "3" , RGB{ 153,112,171 }, SchemeEnum::prgn11 },
+    { "4" , RGB{ 194,165,207 }, SchemeEnum::prgn11 },
+    { "5" , RGB{ 231,212,232 }, SchemeEnum::prgn11 },
+    { "6" , RGB{ 247,247,247 }, SchemeEnum::prgn11 },
+    { "7" , RGB{ 217,240,211 }, SchemeEnum::prgn11 },
+    { "8" , RGB{ 166,219,160 }, SchemeEnum::prgn11 },
+    { "9" , RGB{ 90 ,174,97  }, SchemeEnum::prgn11 },
+    { "10", RGB{ 27 ,120,55  }, SchemeEnum::prgn11 },
+    { "11", RGB{ 0  ,68 ,27  }, SchemeEnum::prgn11 },
+    { "1" , RGB{ 236,231,242 }, SchemeEnum::pubu3 },
+    { "2" , RGB{ 166,189,219 }, SchemeEnum::pubu3 },
+    { "3" , RGB{ 43 ,140,190 }, SchemeEnum::pubu3 },
+    { "1" , RGB{ 241,238,246 }, SchemeEnum::pubu4 },
+    { "2" , RGB{ 189,201,225 }, SchemeEnum::pubu4 },
+    { "3" , RGB{ 116,169,207 }, SchemeEnum::pubu4 },
+    { "4" , RGB{ 5  ,112,176 }, SchemeEnum::pubu4 },
+    { "1" , RGB{ 241,238,246 }, SchemeEnum::pubu5 },
+    { "2" , RGB{ 189,201,225 }, SchemeEnum::pubu5 },
+    { "3" , RGB{ 116,169,207 }, SchemeEnum::pubu5 },
+    { "4" , RGB{ 43 ,140,190 }, SchemeEnum::pubu5 },
+    { "5" , RGB{ 4  ,90 ,141 }, SchemeEnum::pubu5 },
+    { "1" , RGB{ 241,238,246 }, SchemeEnum::pubu6 },
+    { "2" , RGB{ 208,209,230 }, SchemeEnum::pubu6 },
+    { "3" , RGB{ 166,189,219 }, SchemeEnum::pubu6 },
+    { "4" , RGB{ 116,169,207 }, SchemeEnum::pubu6 },
+    { "5" , RGB{ 43 ,140,190 }, SchemeEnum::pubu6 },
+    { "6" , RGB{ 4  ,90 ,141 }, SchemeEnum::pubu6 },
+    { "1" , RGB{ 241,238,246 }, SchemeEnum::pubu7 },
+    { "2" , RGB{ 208,209,230 }, SchemeEnum::pubu7 },
+    { "3" , RGB{ 166,189,219 }, SchemeEnum::pubu7 },
+    { "4" , RGB{ 116,169,207 }, SchemeEnum::pubu7 },
+    { "5" , RGB{ 54 ,144,192 }, SchemeEnum::pubu7 },
+    { "6" , RGB{ 5  ,112,176 }, SchemeEnum::pubu7 },
+    { "7" , RGB{ 3  ,78 ,123 }, SchemeEnum::pubu7 },
+    { "1" , RGB{ 255,247,251 }, SchemeEnum::pubu8 },
+    { "2" , RGB{ 236,231,242 }, SchemeEnum::pubu8 },
+    { "3" , RGB{ 208,209,230 }, SchemeEnum::pubu8 },
+    { "4" , RGB{ 166,189,219 }, SchemeEnum::pubu8 },
+    { "5" , RGB{ 116,169,207 }, SchemeEnum::pubu8 },
+    { "6" , RGB{ 54 ,144,192 }, SchemeEnum::pubu8 },
+    { "7" , RGB{ 5  ,112,176 }, SchemeEnum::pubu8 },
+    { "8" , RGB{ 3  ,78 ,123 }, SchemeEnum::pubu8 },
+    { "1" , RGB{ 255,247,251 }, SchemeEnum::pubu9 },
+    { "2" , RGB{ 236,231,242 }, SchemeEnum::pubu9 },
+    { "3" , RGB{ 208,209,230 }, SchemeEnum::pubu9 },
+    { "4" , RGB{ 166,189,219 }, SchemeEnum::pubu9 },
+    { "5" , RGB{ 116,169,207 }, SchemeEnum::pubu9 },
+    { "6" , RGB{ 54 ,144,192 }, SchemeEnum::pubu9 },
+    { "7" , RGB{ 5  ,112,176 }, SchemeEnum::pubu9 },
+    { "8" , RGB{ 4  ,90 ,141 }, SchemeEnum::pubu9 },
+    { "9" , RGB{ 2  ,56 ,88  }, SchemeEnum::pubu9 },
+    { "1" , RGB{ 236,226,240 }, SchemeEnum::pubugn3 },
+    { "2" , RGB{ 166,189,219 }, SchemeEnum::pubugn3 },
+    { "3" , RGB{ 28 ,144,153 }, SchemeEnum::pubugn3 },
+    { "1" , RGB{ 246,239,247 }, SchemeEnum::pubugn4 },
+    { "2" , RGB{ 189,201,225 }, SchemeEnum::pubugn4 },
+    { "3" , RGB{ 103,169,207 }, SchemeEnum::pubugn4 },
+    { "4" , RGB{ 2  ,129,138 }, SchemeEnum::pubugn4 },
+    { "1" , RGB{ 246,239,247 }, SchemeEnum::pubugn5 },
+    { "2" , RGB{ 189,201,225 }, SchemeEnum::pubugn5 },
+    { "3" , RGB{ 103,169,207 }, SchemeEnum::pubugn5 },
+    { "4" , RGB{ 28 ,144,153 }, SchemeEnum::pubugn5 },
+    { "5" , RGB{ 1  ,108,89  }, SchemeEnum::pubugn5 },
+    { "1" , RGB{ 246,239,247 }, SchemeEnum::pubugn6 },
+    { "2" , RGB{ 208,209,230 }, SchemeEnum::pubugn6 },
+    { "3" , RGB{ 166,189,219 }, SchemeEnum::pubugn6 },
+    { "4" , RGB{ 103,169,207 }, SchemeEnum::pubugn6 },
+    { "5" , RGB{ 28 ,144,153 }, SchemeEnum::pubugn6 },
+    { "6" , RGB{ 1  ,108,89  }, SchemeEnum::pubugn6 },
+    { "1" , RGB{ 246,239,247 }, SchemeEnum::pubugn7 },
+    { "2" , RGB{ 208,209,230 }, SchemeEnum::pubugn7 },
+    { "3" , RGB{ 166,189,219 }, SchemeEnum::pubugn7 },
+    { "4" , RGB{ 103,169,207 }, SchemeEnum::pubugn7 },
+    { "5" , RGB{ 54 ,144,192 }, SchemeEnum::pubugn7 },
+    { "6" , RGB{ 2  ,129,138 }, SchemeEnum::pubugn7 },
+    { "7" , RGB{ 1  ,100,80  }, SchemeEnum::pubugn7 },
+    { "1" , RGB{ 255,247,251 }, SchemeEnum::pubugn8 },
+    { "2" , RGB{ 236,226,240 }, SchemeEnum::pubugn8 },
+    { "3" , RGB{ 208,209,230 }, SchemeEnum::pubugn8 },
+    { "4" , RGB{ 166,189,219 }, SchemeEnum::pubugn8 },
+    { "5" , RGB{ 103,169,207 }, SchemeEnum::pubugn8 },
+    { "6" , RGB{ 54 ,144,192 }, SchemeEnum::pubugn8 },
+    { "7" , RGB{ 2  ,129,138 }, SchemeEnum::pubugn8 },
+    { "8" , RGB{ 1  ,100,80  }, SchemeEnum::pubugn8 },
+    { "1" , RGB{ 255,247,251 }, SchemeEnum::pubugn9 },
+    { "2" , RGB{ 236,226,240 }, SchemeEnum::pubugn9 },
+    { "3" , RGB{ 208,209,230 }, SchemeEnum::pubugn9 },
+    { "4" , RGB{ 166,189,219 }, SchemeEnum::pubugn9 },
+    { "5" , RGB{ 103,169,207 }, SchemeEnum::pubugn9 },
+    { "6" , RGB{ 54 ,144,192 }, SchemeEnum::pubugn9 },
+    { "7" , RGB{ 2  ,129,138 }, SchemeEnum::pubugn9 },
+    { "8" , RGB{ 1  ,108,89  }, SchemeEnum::pubugn9 },
+    { "9" , RGB{ 1  ,70 ,54  }, SchemeEnum::pubugn9 },
+    { "1" , RGB{ 241,163,64  }, SchemeEnum::puor3 },
+    { "2" , RGB{ 247,247,247 }, SchemeEnum::puor3 },
+    { "3" , RGB{ 153,142,195 }, SchemeEnum::puor3 },
+    { "1" , RGB{ 230,97 ,1   }, SchemeEnum::puor4 },
+    { "2" , RGB{ 253,184,99  }, SchemeEnum::puor4 },
+    { "3" , RGB{ 178,171,210 }, SchemeEnum::puor4 },
+    { "4" , RGB{ 94 ,60 ,153 }, SchemeEnum::puor4 },
+    { "1" , RGB{ 230,97 ,1   }, SchemeEnum::puor5 },
+    { "2" , RGB{ 253,184,99  }, SchemeEnum::puor5 },
+    { "3" , RGB{ 247,247,247 }, SchemeEnum::puor5 },
+    { "4" , RGB{ 178,171,210 }, SchemeEnum::puor5 },
+    { "5" , RGB{ 94 ,60 ,153 }, SchemeEnum::puor5 },
+    { "1" , RGB{ 179,88 ,6   }, SchemeEnum::puor6 },
+    { "2" , RGB{ 241,163,64  }, SchemeEnum::puor6 },
+    { "3" , RGB{ 254,224,182 }, SchemeEnum::puor6 },
+    { "4" , RGB{ 216,218,235 }, SchemeEnum::puor6 },
+    { "5" , RGB{ 153,142,195 }, SchemeEnum::puor6 },
+    { "6" , RGB{ 84 ,39 ,136 }, SchemeEnum::puor6 },
+    { "1" , RGB{ 179,88 ,6   }, SchemeEnum::puor7 },
+    { "2" , RGB{ 241,163,64  }, SchemeEnum::puor7 },
+    { "3" , RGB{ 254,224,182 }, SchemeEnum::puor7 },
+    { "4" , RGB{ 247,247,247 }, SchemeEnum::puor7 },
+    { "5" , RGB{ 216,218,235 }, SchemeEnum::puor7 },
+    { "6" , RGB{ 153,142,195 }, SchemeEnum::puor7 },
+    { "7" , RGB{ 84 ,39 ,136 }, SchemeEnum::puor7 },
+    { "1" , RGB{ 179,88 ,6   }, SchemeEnum::puor8 },
+    { "2" , RGB{ 224,130,20  }, SchemeEnum::puor8 },
+    { "3" , RGB{ 253,184,99  }, SchemeEnum::puor8 },
+    { "4" , RGB{ 254,224,182 }, SchemeEnum::puor8 },
+    { "5" , RGB{ 216,218,235 }, SchemeEnum::puor8 },
+    { "6" , RGB{ 178,171,210 }, SchemeEnum::puor8 },
+    { "7" , RGB{ 128,115,172 }, SchemeEnum::puor8 },
+    { "8" , RGB{ 84 ,39 ,136 }, SchemeEnum::puor8 },
+    { "1" , RGB{ 179,88 ,6   }, SchemeEnum::puor9 },
+    { "2" , RGB{ 224,130,20  }, SchemeEnum::puor9 },
+    { "3" , RGB{ 253,184,99  }, SchemeEnum::puor9 },
+    { "4" , RGB{ 254,224,182 }, SchemeEnum::puor9 },
+    { "5" , RGB{ 247,247,247 }, SchemeEnum::puor9 },
+    { "6" , RGB{ 216,218,235 }, SchemeEnum::puor9 },
+    { "7" , RGB{ 178,171,210 }, SchemeEnum::puor9 },
+    { "8" , RGB{ 128,115,172 }, SchemeEnum::puor9 },
+    { "9" , RGB{ 84 ,39 ,136 }, SchemeEnum::puor9 },
+    { "1" , RGB{ 127,59 ,8   }, SchemeEnum::puor10 },
+    { "2" , RGB{ 179,88 ,6   }, SchemeEnum::puor10 },
+    { "3" , RGB{ 224,130,20  }, SchemeEnum::puor10 },
+    { "4" , RGB{ 253,184,99  }, SchemeEnum::puor10 },
+    { "5" , RGB{ 254,224,182 }, SchemeEnum::puor10 },
+    { "6" , RGB{ 216,218,235 }, SchemeEnum::puor10 },
+    { "7" , RGB{ 178,171,210 }, SchemeEnum::puor10 },
+    { "8" , RGB{ 128,115,172 }, SchemeEnum::puor10 },
+    { "9" , RGB{ 84 ,39 ,136 }, SchemeEnum::puor10 },
+    { "10", RGB{ 45 ,0  ,75  }, SchemeEnum::puor10 },
+    { "1" , RGB{ 127,59 ,8   }, SchemeEnum::puor11 },
+    { "2" , RGB{ 179,88 ,6   }, SchemeEnum::puor11 },
+    { "3" , RGB{ 224,130,20  }, SchemeEnum::puor11 },
+    { "4" , RGB{ 253,184,99  }, SchemeEnum::puor11 },
+    { "5" , RGB{ 254,224,182 }, SchemeEnum::puor11 },
+    { "6" , RGB{ 247,247,247 }, SchemeEnum::puor11 },
+    { "7" , RGB{ 216,218,235 }, SchemeEnum::puor11 },
+    { "8" , RGB{ 178,171,210 }, SchemeEnum::puor11 },
+    { "9" , RGB{ 128,115,172 }, SchemeEnum::puor11 },
+    { "10", RGB{ 84 ,39 ,136 }, SchemeEnum::puor11 },
+    { "11", RGB{ 45 ,0  ,75  }, SchemeEnum::puor11 },
+    { "1" , RGB{ 231,225,239 }, SchemeEnum::purd3 },
+    { "2" , RGB{ 201,148,199 }, SchemeEnum::purd3 },
+    { "3" , RGB{ 221,28 ,119 }, SchemeEnum::purd3 },
+    { "1" , RGB{ 241,238,246 }, SchemeEnum::purd4 },
+    { "2" , RGB{ 215,181,216 }, SchemeEnum::purd4 },
+    { "3" , RGB{ 223,101,176 }, SchemeEnum::purd4 },
+    { "4" , RGB{ 206,18 ,86  }, SchemeEnum::purd4 },
+    { "1" , RGB{ 241,238,246 }, SchemeEnum::purd5 },
+    { "2" , RGB{ 215,181,216 }, SchemeEnum::purd5 },
+    { "3" , RGB{ 223,101,176 }, SchemeEnum::purd5 },
+    { "4" , RGB{ 221,28 ,119 }, SchemeEnum::purd5 },
+    { "5" , RGB{ 152,0  ,67  }, SchemeEnum::purd5 },
+    { "1" , RGB{ 241,238,246 }, SchemeEnum::purd6 },
+    { "2" , RGB{ 212,185,218 }, SchemeEnum::purd6 },
+    { "3" , RGB{ 201,148,199 }, SchemeEnum::purd6 },
+    { "4" , RGB{ 223,101,176 }, SchemeEnum::purd6 },
+    { "5" , RGB{ 221,28 ,119 }, SchemeEnum::purd6 },
+    { "6" , RGB{ 152,0  ,67  }, SchemeEnum::purd6 },
+    { "1" , RGB{ 241,238,246 }, SchemeEnum::purd7 },
+    { "2" , RGB{ 212,185,218 }, SchemeEnum::purd7 },
+    { "3" , RGB{ 201,148,199 }, SchemeEnum::purd7 },
+    { "4" , RGB{ 223,101,176 }, SchemeEnum::purd7 },
+    { "5" , RGB{ 231,41 ,138 }, SchemeEnum::purd7 },
+    { "6" , RGB{ 206,18 ,86  }, SchemeEnum::purd7 },
+    { "7" , RGB{ 145,0  ,63  }, SchemeEnum::purd7 },
+    { "1" , RGB{ 247,244,249 }, SchemeEnum::purd8 },
+    { "2" , RGB{ 231,225,239 }, SchemeEnum::purd8 },
+    { "3" , RGB{ 212,185,218 }, SchemeEnum::purd8 },
+    { "4" , RGB{ 201,148,199 }, SchemeEnum::purd8 },
+    { "5" , RGB{ 223,101,176 }, SchemeEnum::purd8 },
+    { "6" , RGB{ 231,41 ,138 }, SchemeEnum::purd8 },
+    { "7" , RGB{ 206,18 ,86  }, SchemeEnum::purd8 },
+    { "8" , RGB{ 145,0  ,63  }, SchemeEnum::purd8 },
+    { "1" , RGB{ 247,244,249 }, SchemeEnum::purd9 },
+    { "2" , RGB{ 231,225,239 }, SchemeEnum::purd9 },
+    { "3" , RGB{ 212,185,218 }, SchemeEnum::purd9 },
+    { "4" , RGB{ 201,148,199 }, SchemeEnum::purd9 },
+    { "5" , RGB{ 223,101,176 }, SchemeEnum::purd9 },
+    { "6" , RGB{ 231,41 ,138 }, SchemeEnum::purd9 },
+    { "7" , RGB{ 206,18 ,86  }, SchemeEnum::purd9 },
+    { "8" , RGB{ 152,0  ,67  }, SchemeEnum::purd9 },
+    { "9" , RGB{ 103,0  ,31  }, SchemeEnum::purd9 },
+    { "1" , RGB{ 239,237,245 }, SchemeEnum::purples3 },
+    { "2" , RGB{ 188,189,220 }, SchemeEnum::purples3 },
+    { "3" , RGB{ 117,107,177 }, SchemeEnum::purples3 },
+    { "1" , RGB{ 242,240,247 }, SchemeEnum::purples4 },
+    { "2" , RGB{ 203,201,226 }, SchemeEnum::purples4 },
+    { "3" , RGB{ 158,154,200 }, SchemeEnum::purples4 },
+    { "4" , RGB{ 106,81 ,163 }, SchemeEnum::purples4 },
+    { "1" , RGB{ 242,240,247 }, SchemeEnum::purples5 },
+    { "2" , RGB{ 203,201,226 }, SchemeEnum::purples5 },
+    { "3" , RGB{ 158,154,200 }, SchemeEnum::purples5 },
+    { "4" , RGB{ 117,107,177 }, SchemeEnum::purples5 },
+    { "5" , RGB{ 84 ,39 ,143 }, SchemeEnum::purples5 },
+    { "1" , RGB{ 242,240,247 }, SchemeEnum::purples6 },
+    { "2" , RGB{ 218,218,235 }, SchemeEnum::purples6 },
+    { "3" , RGB{ 188,189,220 }, SchemeEnum::purples6 },
+    { "4" , RGB{ 158,154,200 }, SchemeEnum::purples6 },
+    { "5" , RGB{ 117,107,177 }, SchemeEnum::purples6 },
+    { "6" , RGB{ 84 ,39 ,143 }, SchemeEnum::purples6 },
+    { "1" , RGB{ 242,240,247 }, SchemeEnum::purples7 },
+    { "2" , RGB{ 218,218,235 }, SchemeEnum::purples7 },
+    { "3" , RGB{ 188,189,220 }, SchemeEnum::purples7 },
+    { "4" , RGB{ 158,154,200 }, SchemeEnum::purples7 },
+    { "5" , RGB{ 128,125,186 }, SchemeEnum::purples7 },
+    { "6" , RGB{ 106,81 ,163 }, SchemeEnum::purples7 },
+    { "7" , RGB{ 74 ,20 ,134 }, SchemeEnum::purples7 },
+    { "1" , RGB{ 252,251,253 }, SchemeEnum::purples8 },
+    { "2" , RGB{ 239,237,245 }, SchemeEnum::purples8 },
+    { "3" , RGB{ 218,218,235 }, SchemeEnum::purples8 },
+    { "4" , RGB{ 188,189,220 }, SchemeEnum::purples8 },
+    { "5" , RGB{ 158,154,200 }, SchemeEnum::purples8 },
+    { "6" , RGB{ 128,125,186 }, SchemeEnum::purples8 },
+    { "7" , RGB{ 106,81 ,163 }, SchemeEnum::purples8 },
+    { "8" , RGB{ 74 ,20 ,134 }, SchemeEnum::purples8 },
+    { "1" , RGB{ 252,251,253 }, SchemeEnum::purples9 },
+    { "2" , RGB{ 239,237,245 }, SchemeEnum::purples9 },
+    { "3" , RGB{ 218,218,235 }, SchemeEnum::purples9 },
+    { "4" , RGB{ 188,189,220 }, SchemeEnum::purples9 },
+    { "5" , RGB{ 158,154,200 }, SchemeEnum::purples9 },
+    { "6" , RGB{ 128,125,186 }, SchemeEnum::purples9 },
+    { "7" , RGB{ 106,81 ,163 }, SchemeEnum::purples9 },
+    { "8" , RGB{ 84 ,39 ,143 }, SchemeEnum::purples9 },
+    { "9" , RGB{ 63 ,0  ,125 }, SchemeEnum::purples9 },
+    { "1" , RGB{ 239,138,98  }, SchemeEnum::rdbu3 },
+    { "2" , RGB{ 247,247,247 }, SchemeEnum::rdbu3 },
+    { "3" , RGB{ 103,169,207 }, SchemeEnum::rdbu3 },
+    { "1" , RGB{ 202,0  ,32  }, SchemeEnum::rdbu4 },
+    { "2" , RGB{ 244,165,130 }, SchemeEnum::rdbu4 },
+    { "3" , RGB{ 146,197,222 }, SchemeEnum::rdbu4 },
+    { "4" , RGB{ 5  ,113,176 }, SchemeEnum::rdbu4 },
+    { "1" , RGB{ 202,0  ,32  }, SchemeEnum::rdbu5 },
+    { "2" , RGB{ 244,165,130 }, SchemeEnum::rdbu5 },
+    { "3" , RGB{ 247,247,247 }, SchemeEnum::rdbu5 },
+    { "4" , RGB{ 146,197,222 }, SchemeEnum::rdbu5 },
+    { "5" , RGB{ 5  ,113,176 }, SchemeEnum::rdbu5 },
+    { "1" , RGB{ 178,24 ,43  }, SchemeEnum::rdbu6 },
+    { "2" , RGB{ 239,138,98  }, SchemeEnum::rdbu6 },
+    { "3" , RGB{ 253,219,199 }, SchemeEnum::rdbu6 },
+    { "4" , RGB{ 209,229,240 }, SchemeEnum::rdbu6 },
+    { "5" , RGB{ 103,169,207 }, SchemeEnum::rdbu6 },
+    { "6" , RGB{ 33 ,102,172 }, SchemeEnum::rdbu6 },
+    { "1" , RGB{ 178,24 ,43  }, SchemeEnum::rdbu7 },
+    { "2" , RGB{ 239,138,98  }, SchemeEnum::rdbu7 },
+    { "3" , RGB{ 253,219,199 }, SchemeEnum::rdbu7 },
+    { "4" , RGB{ 247,247,247 }, SchemeEnum::rdbu7 },
+    { "5" , RGB{ 209,229,240 }, SchemeEnum::rdbu7 },
+    { "6" , RGB{ 103,169,207 }, SchemeEnum::rdbu7 },
+    { "7" , RGB{ 33 ,102,172 }, SchemeEnum::rdbu7 },
+    { "1" , RGB{ 178,24 ,43  }, SchemeEnum::rdbu8 },
+    { "2" , RGB{ 214,96 ,77  }, SchemeEnum::rdbu8 },
+    { "3" , RGB{ 244,165,130 }, SchemeEnum::rdbu8 },
+    { "4" , RGB{ 253,219,199 }, SchemeEnum::rdbu8 },
+    { "5" , RGB{ 209,229,240 }, SchemeEnum::rdbu8 },
+    { "6" , RGB{ 146,197,222 }, SchemeEnum::rdbu8 },
+    { "7" , RGB{ 67 ,147,195 }, SchemeEnum::rdbu8 },
+    { "8" , RGB{ 33 ,102,172 }, SchemeEnum::rdbu8 },
+    { "1" , RGB{ 178,24 ,43  }, SchemeEnum::rdbu9 },
+    { "2" , RGB{ 214,96 ,77  }, SchemeEnum::rdbu9 },
+    { "3" , RGB{ 244,165,130 }, SchemeEnum::rdbu9 },
+    { "4" , RGB{ 253,219,199 }, SchemeEnum::rdbu9 },
+    { "5" , RGB{ 247,247,247 }, SchemeEnum::rdbu9 },
+    { "6" , RGB{ 209,229,240 }, SchemeEnum::rdbu9 },
+    { "7" , RGB{ 146,197,222 }, SchemeEnum::rdbu9 },
+    { "8" , RGB{ 67 ,147,195 }, SchemeEnum::rdbu9 },
+    { "9" , RGB{ 33 ,102,172 }, SchemeEnum::rdbu9 },
+    { "1" , RGB{ 103,0  ,31  }, SchemeEnum::rdbu10 },
+    { "2" , RGB{ 178,24 ,43  }, SchemeEnum::rdbu10 },
+    { "3" , RGB{ 214,96 ,77  }, SchemeEnum::rdbu10 },
+    { "4" , RGB{ 244,165,130 }, SchemeEnum::rdbu10 },
+    { "5" , RGB{ 253,219,199 }, SchemeEnum::rdbu10 },
+    { "6" , RGB{ 209,229,240 }, SchemeEnum::rdbu10 },
+    { "7" , RGB{ 146,197,222 }, SchemeEnum::rdbu10 },
+    { "8" , RGB{ 67 ,147,195 }, SchemeEnum::rdbu10 },
+    { "9" , RGB{ 33 ,102,172 }, SchemeEnum::rdbu10 },
+    { "10", RGB{ 5  ,48 ,97  }, SchemeEnum::rdbu10 },
+    { "1" , RGB{ 103,0  ,31  }, SchemeEnum::rdbu11 },
+    { "2" , RGB{ 178,24 ,43  }, SchemeEnum::rdbu11 },
+    { "3" , RGB{ 214,96 ,77  }, SchemeEnum::rdbu11 },
+    { "4" , RGB{ 244,165,130 }, SchemeEnum::rdbu11 },
+    { "5" , RGB{ 253,219,199 }, SchemeEnum::rdbu11 },
+    { "6" , RGB{ 247,247,247 }, SchemeEnum::rdbu11 },
+    { "7" , RGB{ 209,229,240 }, SchemeEnum::rdbu11 },
+    { "8" , RGB{ 146,197,222 }, SchemeEnum::rdbu11 },
+    { "9" , RGB{ 67 ,147,195 }, SchemeEnum::rdbu11 },
+    { "10", RGB{ 33 ,102,172 }, SchemeEnum::rdbu11 },
+    { "11", RGB{ 5  ,48 ,97  }, SchemeEnum::rdbu11 },
+    { "1" , RGB{ 239,138,98  }, SchemeEnum::rdgy3 },
+    { "2" , RGB{ 255,255,255 }, SchemeEnum::rdgy3 },
+    { "3" , RGB{ 153,153,153 }, SchemeEnum::rdgy3 },
+    { "1" , RGB{ 202,0  ,32  }, SchemeEnum::rdgy4 },
+    { "2" , RGB{ 244,165,130 }, SchemeEnum::rdgy4 },
+    { "3" , RGB{ 186,186,186 }, SchemeEnum::rdgy4 },
+    { "4" , RGB{ 64 ,64 ,64  }, SchemeEnum::rdgy4 },
+    { "1" , RGB{ 202,0  ,32  }, SchemeEnum::rdgy5 },
+    { "2" , RGB{ 244,165,130 }, SchemeEnum::rdgy5 },
+    { "3" , RGB{ 255,255,255 }, SchemeEnum::rdgy5 },
+    { "4" , RGB{ 186,186,186 }, SchemeEnum::rdgy5 },
+    { "5" , RGB{ 64 ,64 ,64  }, SchemeEnum::rdgy5 },
+    { "1" , RGB{ 178,24 ,43  }, SchemeEnum::rdgy6 },
+    { "2" , RGB{ 239,138,98  }, SchemeEnum::rdgy6 },
+    { "3" , RGB{ 253,219,199 }, SchemeEnum::rdgy6 },
+    { "4" , RGB{ 224,224,224 }, SchemeEnum::rdgy6 },
+    { "5" , RGB{ 153,153,153 }, SchemeEnum::rdgy6 },
+    { "6" , RGB{ 77 ,77 ,77  }, SchemeEnum::rdgy6 },
+    { "1" , RGB{ 178,24 ,43  }, SchemeEnum::rdgy7 },
+    { "2" , RGB{ 239,138,98  }, SchemeEnum::rdgy7 },
+    { "3" , RGB{ 253,219,199 }, SchemeEnum::rdgy7 },
+    { "4" , RGB{ 255,255,255 }, SchemeEnum::rdgy7 },
+    { "5" , RGB{ 224,224,224 }, SchemeEnum::rdgy7 },
+    { "6" , RGB{ 153,153,153 }, SchemeEnum::rdgy7 },
+    { "7" , RGB{ 77 ,77 ,77  }, SchemeEnum::rdgy7 },
+    { "1" , RGB{ 178,24 ,43  }, SchemeEnum::rdgy8 },
+    { "2" , RGB{ 214,96 ,77  }, SchemeEnum::rdgy8 },
+    { "3" , RGB{ 244,165,130 }, SchemeEnum::rdgy8 },
+    { "4" , RGB{ 253,219,199 }, SchemeEnum::rdgy8 },
+    { "5" , RGB{ 224,224,224 }, SchemeEnum::rdgy8 },
+    { "6" , RGB{ 186,186,186 }, SchemeEnum::rdgy8 },
+    { "7" , RGB{ 135,135,135 }, SchemeEnum::rdgy8 },
+    { "8" , RGB{ 77 ,77 ,77  }, SchemeEnum::rdgy8 },
+    { "1" , RGB{ 178,24 ,43  }, SchemeEnum::rdgy9 },
+    { "2" , RGB{ 214,96 ,77  }, SchemeEnum::rdgy9 },
+    { "3" , RGB{ 244,165,130 }, SchemeEnum::rdgy9 },
+    { "4" , RGB{ 253,219,199 }, SchemeEnum::rdgy9 },
+    { "5" , RGB{ 255,255,255 }, SchemeEnum::rdgy9 },
+    { "6" , RGB{ 224,224,224 }, SchemeEnum::rdgy9 },
+    { "7" , RGB{ 186,186,186 }, SchemeEnum::rdgy9 },
+    { "8" , RGB{ 135,135,135 }, SchemeEnum::rdgy9 },
+    { "9" , RGB{ 77 ,77 ,77  }, SchemeEnum::rdgy9 },
+    { "1" , RGB{ 103,0  ,31  }, SchemeEnum::rdgy10 },
+    { "2" , RGB{ 178,24 ,43  }, SchemeEnum::rdgy10 },
+    { "3" , RGB{ 214,96 ,77  }, SchemeEnum::rdgy10 },
+    { "4" , RGB{ 244,165,130 }, SchemeEnum::rdgy10 },
+    { "5" , RGB{ 253,219,199 }, SchemeEnum::rdgy10 },
+    { "6" , RGB{ 224,224,224 }, SchemeEnum::rdgy10 },
+    { "7" , RGB{ 186,186,186 }, SchemeEnum::rdgy10 },
+    { "8" , RGB{ 135,135,135 }, SchemeEnum::rdgy10 },
+    { "9" , RGB{ 77 ,77 ,77  }, SchemeEnum::rdgy10 },
+    { "10", RGB{ 26 ,26 ,26  }, SchemeEnum::rdgy10 },
+    { "1" , RGB{ 103,0  ,31  }, SchemeEnum::rdgy11 },
+    { "2" , RGB{ 178,24 ,43  }, SchemeEnum::rdgy11 },
+    { "3" , RGB{ 214,96 ,77  }, SchemeEnum::rdgy11 },
+    { "4" , RGB{ 244,165,130 }, SchemeEnum::rdgy11 },
+    { "5" , RGB{ 253,219,199 }, SchemeEnum::rdgy11 },
+    { "6" , RGB{ 255,255,255 }, SchemeEnum::rdgy11 },
+    { "7" , RGB{ 224,224,224 }, SchemeEnum::rdgy11 },
+    { "8" , RGB{ 186,186,186 }, SchemeEnum::rdgy11 },
+    { "9" , RGB{ 135,135,135 }, SchemeEnum::rdgy11 },
+    { "10", RGB{ 77 ,77 ,77  }, SchemeEnum::rdgy11 },
+    { "11", RGB{ 26 ,26 ,26  }, SchemeEnum::rdgy11 },
+    { "1" , RGB{ 253,224,221 }, SchemeEnum::rdpu3 },
+    { "2" , RGB{ 250,159,181 }, SchemeEnum::rdpu3 },
+    { "3" , RGB{ 197,27 ,138 }, SchemeEnum::rdpu3 },
+    { "1" , RGB{ 254,235,226 }, SchemeEnum::rdpu4 },
+    { "2" , RGB{ 251,180,185 }, SchemeEnum::rdpu4 },
+    { "3" , RGB{ 247,104,161 }, SchemeEnum::rdpu4 },
+    { "4" , RGB{ 174,1  ,126 }, SchemeEnum::rdpu4 },
+    { "1" , RGB{ 254,235,226 }, SchemeEnum::rdpu5 },
+    { "2" , RGB{ 251,180,185 }, SchemeEnum::rdpu5 },
+    { "3" , RGB{ 247,104,161 }, SchemeEnum::rdpu5 },
+    { "4" , RGB{ 197,27 ,138 }, SchemeEnum::rdpu5 },
+    { "5" , RGB{ 122,1  ,119 }, SchemeEnum::rdpu5 },
+    { "1" , RGB{ 254,235,226 }, SchemeEnum::rdpu6 },
+    { "2" , RGB{ 252,197,192 }, SchemeEnum::rdpu6 },
+    { "3" , RGB{ 250,159,181 }, SchemeEnum::rdpu6 },
+    { "4" , RGB{ 247,104,161 }, SchemeEnum::rdpu6 },
+    { "5" , RGB{ 197,27 ,138 }, SchemeEnum::rdpu6 },
+    { "6" , RGB{ 122,1  ,119 }, SchemeEnum::rdpu6 },
+    { "1" , RGB{ 254,235,226 }, SchemeEnum::rdpu7 },
+    { "2" , RGB{ 252,197,192 }, SchemeEnum::rdpu7 },
+    { "3" , RGB{ 250,159,181 }, SchemeEnum::rdpu7 },
+    { "4" , RGB{ 247,104,161 }, SchemeEnum::rdpu7 },
+    { "5" , RGB{ 221,52 ,151 }, SchemeEnum::rdpu7 },
+    { "6" , RGB{ 174,1  ,126 }, SchemeEnum::rdpu7 },
+    { "7" , RGB{ 122,1  ,119 }, SchemeEnum::rdpu7 },
+    { "1" , RGB{ 255,247,243 }, SchemeEnum::rdpu8 },
+    { "2" , RGB{ 253,224,221 }, SchemeEnum::rdpu8 },
+    { "3" , RGB{ 252,197,192 }, SchemeEnum::rdpu8 },
+    { "4" , RGB{ 250,159,181 }, SchemeEnum::rdpu8 },
+    { "5" , RGB{ 247,104,161 }, SchemeEnum::rdpu8 },
+    { "6" , RGB{ 221,52 ,151 }, SchemeEnum::rdpu8 },
+    { "7" , RGB{ 174,1  ,126 }, SchemeEnum::rdpu8 },
+    { "8" , RGB{ 122,1  ,119 }, SchemeEnum::rdpu8 },
+    { "1" , RGB{ 255,247,243 }, SchemeEnum::rdpu9 },
+    { "2" , RGB{ 253,224,221 }, SchemeEnum::rdpu9 },
+    { "3" , RGB{ 252,197,192 }, SchemeEnum::rdpu9 },
+    { "4" , RGB{ 250,159,181 }, SchemeEnum::rdpu9 },
+    { "5" , RGB{ 247,104,161 }, SchemeEnum::rdpu9 },
+    { "6" , RGB{ 221,52 ,151 }, SchemeEnum::rdpu9 },
+    { "7" , RGB{ 174,1  ,126 }, SchemeEnum::rdpu9 },
+    { "8" , RGB{ 122,1  ,119 }, SchemeEnum::rdpu9 },
+    { "9" , RGB{ 73 ,0  ,106 }, SchemeEnum::rdpu9 },
+    { "1" , RGB{ 252,141,89  }, SchemeEnum::rdylbu3 },
+    { "2" , RGB{ 255,255,191 }, SchemeEnum::rdylbu3 },
+    { "3" , RGB{ 145,191,219 }, SchemeEnum::rdylbu3 },
+    { "1" , RGB{ 215,25 ,28  }, SchemeEnum::rdylbu4 },
+    { "2" , RGB{ 253,174,97  }, SchemeEnum::rdylbu4 },
+    { "3" , RGB{ 171,217,233 }, SchemeEnum::rdylbu4 },
+    { "4" , RGB{ 44 ,123,182 }, SchemeEnum::rdylbu4 },
+    { "1" , RGB{ 215,25 ,28  }, SchemeEnum::rdylbu5 },
+    { "2" , RGB{ 253,174,97  }, SchemeEnum::rdylbu5 },
+    { "3" , RGB{ 255,255,191 }, SchemeEnum::rdylbu5 },
+    { "4" , RGB{ 171,217,233 }, SchemeEnum::rdylbu5 },
+    { "5" , RGB{ 44 ,123,182 }, SchemeEnum::rdylbu5 },
+    { "1" , RGB{ 215,48 ,39  }, SchemeEnum::rdylbu6 },
+    { "2" , RGB{ 252,141,89  }, SchemeEnum::rdylbu6 },
+    { "3" , RGB{ 254,224,144 }, SchemeEnum::rdylbu6 },
+    { "4" , RGB{ 224,243,248 }, SchemeEnum::rdylbu6 },
+    { "5" , RGB{ 145,191,219 }, SchemeEnum::rdylbu6 },
+    { "6" , RGB{ 69 ,117,180 }, SchemeEnum::rdylbu6 },
+    { "1" , RGB{ 215,48 ,39  }, SchemeEnum::rdylbu7 },
+    { "2" , RGB{ 252,141,89  }, SchemeEnum::rdylbu7 },
+    { "3" , RGB{ 254,224,144 }, SchemeEnum::rdylbu7 },
+    { "4" , RGB{ 255,255,191 }, SchemeEnum::rdylbu7 },
+    { "5" , RGB{ 224,243,248 }, SchemeEnum::rdylbu7 },
+    { "6" , RGB{ 145,191,219 }, SchemeEnum::rdylbu7 },
+    { "7" , RGB{ 69 ,117,180 }, SchemeEnum::rdylbu7 },
+    { "1" , RGB{ 215,48 ,39  }, SchemeEnum::rdylbu8 },
+    { "2" , RGB{ 244,109,67  }, SchemeEnum::rdylbu8 },
+    { "3" , RGB{ 253,174,97  }, SchemeEnum::rdylbu8 },
+    { "4" , RGB{ 254,224,144 }, SchemeEnum::rdylbu8 },
+    { "5" , RGB{ 224,243,248 }, SchemeEnum::rdylbu8 },
+    { "6" , RGB{ 171,217,233 }, SchemeEnum::rdylbu8 },
+    { "7" , RGB{ 116,173,209 }, SchemeEnum::rdylbu8 },
+    { "8" , RGB{ 69 ,117,180 }, SchemeEnum::rdylbu8 },
+    { "1" , RGB{ 215,48 ,39  }, SchemeEnum::rdylbu9 },
+    { "2" , RGB{ 244,109,67  }, SchemeEnum::rdylbu9 },
+    { "3" , RGB{ 253,174,97  }, SchemeEnum::rdylbu9 },
+    { "4" , RGB{ 254,224,144 }, SchemeEnum::rdylbu9 },
+    { "5" , RGB{ 255,255,191 }, SchemeEnum::rdylbu9 },
+    { "6" , RGB{ 224,243,248 }, SchemeEnum::rdylbu9 },
+    { "7" , RGB{ 171,217,233 }, SchemeEnum::rdylbu9 },
+    { "8" , RGB{ 116,173,209 }, SchemeEnum::rdylbu9 },
+    { "9" , RGB{ 69 ,117,180 }, SchemeEnum::rdylbu9 },
+    { "1" , RGB{ 165,0  ,38  }, SchemeEnum::rdylbu10 },
+    { "2" , RGB{ 215,48 ,39  }, SchemeEnum::rdylbu10 },
+    { "3" , RGB{ 244,109,67  }, SchemeEnum::rdylbu10 },
+    { "4" , RGB{ 253,174,97  }, SchemeEnum::rdylbu10 },
+    { "5" , RGB{ 254,224,144 }, SchemeEnum::rdylbu10 },
+    { "6" , RGB{ 224,243,248 }, SchemeEnum::rdylbu10 },
+    { "7" , RGB{ 171,217,233 }, SchemeEnum::rdylbu10 },
+    { "8" , RGB{ 116,173,209 }, SchemeEnum::rdylbu10 },
+    { "9" , RGB{ 69 ,117,180 }, SchemeEnum::rdylbu10 },
+    { "10", RGB{ 49 ,54 ,149 }, SchemeEnum::rdylbu10 },
+    { "1" , RGB{ 165,0  ,38  }, SchemeEnum::rdylbu11 },
+    { "2" , RGB{ 215,48 ,39  }, SchemeEnum::rdylbu11 },
+    { "3" , RGB{ 244,109,67  }, SchemeEnum::rdylbu11 },
+    { "4" , RGB{ 253,174,97  }, SchemeEnum::rdylbu11 },
+    { "5" , RGB{ 254,224,144 }, SchemeEnum::rdylbu11 },
+    { "6" , RGB{ 255,255,191 }, SchemeEnum::rdylbu11 },
+    { "7" , RGB{ 224,243,248 }, SchemeEnum::rdylbu11 },
+    { "8" , RGB{ 171,217,233 }, SchemeEnum::rdylbu11 },
+    { "9" , RGB{ 116,173,209 }, SchemeEnum::rdylbu11 },
+    { "10", RGB{ 69 ,117,180 }, SchemeEnum::rdylbu11 },
+    { "11", RGB{ 49 ,54 ,149 }, SchemeEnum::rdylbu11 },
+    { "1" , RGB{ 252,141,89  }, SchemeEnum::rdylgn3 },
+    { "2" , RGB{ 255,255,191 }, SchemeEnum::rdylgn3 },
+    { "3" , RGB{ 145,207,96  }, SchemeEnum::rdylgn3 },
+    { "1" , RGB{ 215,25 ,28  }, SchemeEnum::rdylgn4 },
+    { "2" , RGB{ 253,174,97  }, SchemeEnum::rdylgn4 },
+    { "3" , RGB{ 166,217,106 }, SchemeEnum::rdylgn4 },
+    { "4" , RGB{ 26 ,150,65  }, SchemeEnum::rdylgn4 },
+    { "1" , RGB{ 215,25 ,28  }, SchemeEnum::rdylgn5 },
+    { "2" , RGB{ 253,174,97  }, SchemeEnum::rdylgn5 },
+    { "3" , RGB{ 255,255,191 }, SchemeEnum::rdylgn5 },
+    { "4" , RGB{ 166,217,106 }, SchemeEnum::rdylgn5 },
+    { "5" , RGB{ 26 ,150,65  }, SchemeEnum::rdylgn5 },
+    { "1" , RGB{ 215,48 ,39  }, SchemeEnum::rdylgn6 },
+    { "2" , RGB{ 252,141,89  }, SchemeEnum::rdylgn6 },
+    { "3" , RGB{ 254,224,139 }, SchemeEnum::rdylgn6 },
+    { "4" , RGB{ 217,239,139 }, SchemeEnum::rdylgn6 },
+    { "5" , RGB{ 145,207,96  }, SchemeEnum::rdylgn6 },
+    { "6" , RGB{ 26 ,152,80  }, SchemeEnum::rdylgn6 },
+    { "1" , RGB{ 215,48 ,39  }, SchemeEnum::rdylgn7 },
+    { "2" , RGB{ 252,141,89  }, SchemeEnum::rdylgn7 },
+    { "3" , RGB{ 254,224,139 }, SchemeEnum::rdylgn7 },
+    { "4" , RGB{ 255,255,191 }, SchemeEnum::rdylgn7 },
+    { "5" , RGB{ 217,239,139 }, SchemeEnum::rdylgn7 },
+    { "6" , RGB{ 145,207,96  }, SchemeEnum::rdylgn7 },
+    { "7" , RGB{ 26 ,152,80  }, SchemeEnum::rdylgn7 },
+    { "1" , RGB{ 215,48 ,39  }, SchemeEnum::rdylgn8 },
+    { "2" , RGB{ 244,109,67  }, SchemeEnum::rdylgn8 },
+    { "3" , RGB{ 253,174,97  }, SchemeEnum::rdylgn8 },
+    { "4" , RGB{ 254,224,139 }, SchemeEnum::rdylgn8 },
+    { "5" , RGB{ 217,239,139 }, SchemeEnum::rdylgn8 },
+    { "6" , RGB{ 166,217,106 }, SchemeEnum::rdylgn8 },
+    { "7" , RGB{ 102,189,99  }, SchemeEnum::rdylgn8 },
+    { "8" , RGB{ 26 ,152,80  }, SchemeEnum::rdylgn8 },
+    { "1" , RGB{ 215,48 ,39  }, SchemeEnum::rdylgn9 },
+    { "2" , RGB{ 244,109,67  }, SchemeEnum::rdylgn9 },
+    { "3" , RGB{ 253,174,97  }, SchemeEnum::rdylgn9 },
+    { "4" , RGB{ 254,224,139 }, SchemeEnum::rdylgn9 },
+    { "5" , RGB{ 255,255,191 }, SchemeEnum::rdylgn9 },
+    { "6" , RGB{ 217,239,139 }, SchemeEnum::rdylgn9 },
+    { "7" , RGB{ 166,217,106 }, SchemeEnum::rdylgn9 },
+    { "8" , RGB{ 102,189,99  }, SchemeEnum::rdylgn9 },
+    { "9" , RGB{ 26 ,152,80  }, SchemeEnum::rdylgn9 },
+    { "1" , RGB{ 165,0  ,38  }, SchemeEnum::rdylgn10 },
+    { "2" , RGB{ 215,48 ,39  }, SchemeEnum::rdylgn10 },
+    { "3" , RGB{ 244,109,67  }, SchemeEnum::rdylgn10 },
+    { "4" , RGB{ 253,174,97  }, SchemeEnum::rdylgn10 },
+    { "5" , RGB{ 254,224,139 }, SchemeEnum::rdylgn10 },
+    { "6" , RGB{ 217,239,139 }, SchemeEnum::rdylgn10 },
+    { "7" , RGB{ 166,217,106 }, SchemeEnum::rdylgn10 },
+    { "8" , RGB{ 102,189,99  }, SchemeEnum::rdylgn10 },
+    { "9" , RGB{ 26 ,152,80  }, SchemeEnum::rdylgn10 },
+    { "10", RGB{ 0  ,104,55  }, SchemeEnum::rdylgn10 },
+    { "1" , RGB{ 165,0  ,38  }, SchemeEnum::rdylgn11 },
+    { "2" , RGB{ 215,48 ,39  }, SchemeEnum::rdylgn11 },
+    { "3" , RGB{ 244,109,67  }, SchemeEnum::rdylgn11 },
+    { "4" , RGB{ 253,174,97  }, SchemeEnum::rdylgn11 },
+    { "5" , RGB{ 254,224,139 }, SchemeEnum::rdylgn11 },
+    { "6" , RGB{ 255,255,191 }, SchemeEnum::rdylgn11 },
+    { "7" , RGB{ 217,239,139 }, SchemeEnum::rdylgn11 },
+    { "8" , RGB{ 166,217,106 }, SchemeEnum::rdylgn11 },
+    { "9" , RGB{ 102,189,99  }, SchemeEnum::rdylgn11 },
+    { "10", RGB{ 26 ,152,80  }, SchemeEnum::rdylgn11 },
+    { "11", RGB{ 0  ,104,55  }, SchemeEnum::rdylgn11 },
+    { "1" , RGB{ 254,224,210 }, SchemeEnum::reds3 },
+    { "2" , RGB{ 252,146,114 }, SchemeEnum::reds3 },
+    { "3" , RGB{ 222,45 ,38  }, SchemeEnum::reds3 },
+    { "1" , RGB{ 254,229,217 }, SchemeEnum::reds4 },
+    { "2" , RGB{ 252,174,145 }, SchemeEnum::reds4 },
+    { "3" , RGB{ 251,106,74  }, SchemeEnum::reds4 },
+    { "4" , RGB{ 203,24 ,29  }, SchemeEnum::reds4 },
+    { "1" , RGB{ 254,229,217 }, SchemeEnum::reds5 },
+    { "2" , RGB{ 252,174,145 }, SchemeEnum::reds5 },
+    { "3" , RGB{ 251,106,74  }, SchemeEnum::reds5 },
+    { "4" , RGB{ 222,45 ,38  }, SchemeEnum::reds5 },
+    { "5" , RGB{ 165,15 ,21  }, SchemeEnum::reds5 },
+    { "1" , RGB{ 254,229,217 }, SchemeEnum::reds6 },
+    { "2" , RGB{ 252,187,161 }, SchemeEnum::reds6 },
+    { "3" , RGB{ 252,146,114 }, SchemeEnum::reds6 },
+    { "4" , RGB{ 251,106,74  }, SchemeEnum::reds6 },
+    { "5" , RGB{ 222,45 ,38  }, SchemeEnum::reds6 },
+    { "6" , RGB{ 165,15 ,21  }, SchemeEnum::reds6 },
+    { "1" , RGB{ 254,229,217 }, SchemeEnum::reds7 },
+    { "2" , RGB{ 252,187,161 }, SchemeEnum::reds7 },
+    { "3" , RGB{ 252,146,114 }, SchemeEnum::reds7 },
+    { "4" , RGB{ 251,106,74  }, SchemeEnum::reds7 },
+    { "5" , RGB{ 239,59 ,44  }, SchemeEnum::reds7 },
+    { "6" , RGB{ 203,24 ,29  }, SchemeEnum::reds7 },
+    { "7" , RGB{ 153,0  ,13  }, SchemeEnum::reds7 },
+    { "1" , RGB{ 255,245,240 }, SchemeEnum::reds8 },
+    { "2" , RGB{ 254,224,210 }, SchemeEnum::reds8 },
+    { "3" , RGB{ 252,187,161 }, SchemeEnum::reds8 },
+    { "4" , RGB{ 252,146,114 }, SchemeEnum::reds8 },
+    { "5" , RGB{ 251,106,74  }, SchemeEnum::reds8 },
+    { "6" , RGB{ 239,59 ,44  }, SchemeEnum::reds8 },
+    { "7" , RGB{ 203,24 ,29  }, SchemeEnum::reds8 },
+    { "8" , RGB{ 153,0  ,13  }, SchemeEnum::reds8 },
+    { "1" , RGB{ 255,245,240 }, SchemeEnum::reds9 },
+    { "2" , RGB{ 254,224,210 }, SchemeEnum::reds9 },
+    { "3" , RGB{ 252,187,161 }, SchemeEnum::reds9 },
+    { "4" , RGB{ 252,146,114 }, SchemeEnum::reds9 },
+    { "5" , RGB{ 251,106,74  }, SchemeEnum::reds9 },
+    { "6" , RGB{ 239,59 ,44  }, SchemeEnum::reds9 },
+    { "7" , RGB{ 203,24 ,29  }, SchemeEnum::reds9 },
+    { "8" , RGB{ 165,15 ,21  }, SchemeEnum::reds9 },
+    { "9" , RGB{ 103,0  ,13  }, SchemeEnum::reds9 },
+    { "1" , RGB{ 228,26 ,28  }, SchemeEnum::set13 },
+    { "2" , RGB{ 55 ,126,184 }, SchemeEnum::set13 },
+    { "3" , RGB{ 77 ,175,74  }, SchemeEnum::set13 },
+    { "1" , RGB{ 228,26 ,28  }, SchemeEnum::set14 },
+    { "2" , RGB{ 55 ,126,184 }, SchemeEnum::set14 },
+    { "3" , RGB{ 77 ,175,74  }, SchemeEnum::set14 },
+    { "4" , RGB{ 152,78 ,163 }, SchemeEnum::set14 },
+    { "1" , RGB{ 228,26 ,28  }, SchemeEnum::set15 },
+    { "2" , RGB{ 55 ,126,184 }, SchemeEnum::set15 },
+    { "3" , RGB{ 77 ,175,74  }, SchemeEnum::set15 },
+    { "4" , RGB{ 152,78 ,163 }, SchemeEnum::set15 },
+    { "5" , RGB{ 255,127,0   }, SchemeEnum::set15 },
+    { "1" , RGB{ 228,26 ,28  }, SchemeEnum::set16 },
+    { "2" , RGB{ 55 ,126,184 }, SchemeEnum::set16 },
+    { "3" , RGB{ 77 ,175,74  }, SchemeEnum::set16 },
+    { "4" , RGB{ 152,78 ,163 }, SchemeEnum::set16 },
+    { "5" , RGB{ 255,127,0   }, SchemeEnum::set16 },
+    { "6" , RGB{ 255,255,51  }, SchemeEnum::set16 },
+    { "1" , RGB{ 228,26 ,28  }, SchemeEnum::set17 },
+    { "2" , RGB{ 55 ,126,184 }, SchemeEnum::set17 },
+    { "3" , RGB{ 77 ,175,74  }, SchemeEnum::set17 },
+    { "4" , RGB{ 152,78 ,163 }, SchemeEnum::set17 },
+    { "5" , RGB{ 255,127,0   }, SchemeEnum::set17 },
+    { "6" , RGB{ 255,255,51  }, SchemeEnum::set17 },
+    { "7" , RGB{ 166,86 ,40  }, SchemeEnum::set17 },
+    { "1" , RGB{ 228,26 ,28  }, SchemeEnum::set18 },
+    { "2" , RGB{ 55 ,126,184 }, SchemeEnum::set18 },
+    { "3" , RGB{ 77 ,175,74  }, SchemeEnum::set18 },
+    { "4" , RGB{ 152,78 ,163 }, SchemeEnum::set18 },
+    { "5" , RGB{ 255,127,0   }, SchemeEnum::set18 },
+    { "6" , RGB{ 255,255,51  }, SchemeEnum::set18 },
+    { "7" , RGB{ 166,86 ,40  }, SchemeEnum::set18 },
+    { "8" , RGB{ 247,129,191 }, SchemeEnum::set18 },
+    { "1" , RGB{ 228,26 ,28  }, SchemeEnum::set19 },
+    { "2" , RGB{ 55 ,126,184 }, SchemeEnum::set19 },
+    { "3" , RGB{ 77 ,175,74  }, SchemeEnum::set19 },
+    { "4" , RGB{ 152,78 ,163 }, SchemeEnum::set19 },
+    { "5" , RGB{ 255,127,0   }, SchemeEnum::set19 },
+    { "6" , RGB{ 255,255,51  }, SchemeEnum::set19 },
+    { "7" , RGB{ 166,86 ,40  }, SchemeEnum::set19 },
+    { "8" , RGB{ 247,129,191 }, SchemeEnum::set19 },
+    { "9" , RGB{ 153,153,153 }, SchemeEnum::set19 },
+    { "1" , RGB{ 102,194,165 }, SchemeEnum::set23 },
+    { "2" , RGB{ 252,141,98  }, SchemeEnum::set23 },
+    { "3" , RGB{ 141,160,203 }, SchemeEnum::set23 },
+    { "1" , RGB{ 102,194,165 }, SchemeEnum::set24 },
+    { "2" , RGB{ 252,141,98  }, SchemeEnum::set24 },
+    { "3" , RGB{ 141,160,203 }, SchemeEnum::set24 },
+    { "4" , RGB{ 231,138,195 }, SchemeEnum::set24 },
+    { "1" , RGB{ 102,194,165 }, SchemeEnum::set25 },
+    { "2" , RGB{ 252,141,98  }, SchemeEnum::set25 },
+    { "3" , RGB{ 141,160,203 }, SchemeEnum::set25 },
+    { "4" , RGB{ 231,138,195 }, SchemeEnum::set25 },
+    { "5" , RGB{ 166,216,84  }, SchemeEnum::set25 },
+    { "1" , RGB{ 102,194,165 }, SchemeEnum::set26 },
+    { "2" , RGB{ 252,141,98  }, SchemeEnum::set26 },
+    { "3" , RGB{ 141,160,203 }, SchemeEnum::set26 },
+    { "4" , RGB{ 231,138,195 }, SchemeEnum::set26 },
+    { "5" , RGB{ 166,216,84  }, SchemeEnum::set26 },
+    { "6" , RGB{ 255,217,47  }, SchemeEnum::set26 },
+    { "1" , RGB{ 102,194,165 }, SchemeEnum::set27 },
+    { "2" , RGB{ 252,141,98  }, SchemeEnum::set27 },
+    { "3" , RGB{ 141,160,203 }, SchemeEnum::set27 },
+    { "4" , RGB{ 231,138,195 }, SchemeEnum::set27 },
+    { "5" , RGB{ 166,216,84  }, SchemeEnum::set27 },
+    { "6" , RGB{ 255,217,47  }, SchemeEnum::set27 },
+    { "7" , RGB{ 229,196,148 }, SchemeEnum::set27 },
+    { "1" , RGB{ 102,194,165 }, SchemeEnum::set28 },
+    { "2" , RGB{ 252,141,98  }, SchemeEnum::set28 },
+    { "3" , RGB{ 141,160,203 }, SchemeEnum::set28 },
+    { "4" , RGB{ 231,138,195 }, SchemeEnum::set28 },
+    { "5" , RGB{ 166,216,84  }, SchemeEnum::set28 },
+    { "6" , RGB{ 255,217,47  }, SchemeEnum::set28 },
+    { "7" , RGB{ 229,196,148 }, SchemeEnum::set28 },
+    { "8" , RGB{ 179,179,179 }, SchemeEnum::set28 },
+    { "1" , RGB{ 141,211,199 }, SchemeEnum::set33 },
+    { "2" , RGB{ 255,255,179 }, SchemeEnum::set33 },
+    { "3" , RGB{ 190,186,218 }, SchemeEnum::set33 },
+    { "1" , RGB{ 141,211,199 }, SchemeEnum::set34 },
+    { "2" , RGB{ 255,255,179 }, SchemeEnum::set34 },
+    { "3" , RGB{ 190,186,218 }, SchemeEnum::set34 },
+    { "4" , RGB{ 251,128,114 }, SchemeEnum::set34 },
+    { "1" , RGB{ 141,211,199 }, SchemeEnum::set35 },
+    { "2" , RGB{ 255,255,179 }, SchemeEnum::set35 },
+    { "3" , RGB{ 190,186,218 }, SchemeEnum::set35 },
+    { "4" , RGB{ 251,128,114 }, SchemeEnum::set35 },
+    { "5" , RGB{ 128,177,211 }, SchemeEnum::set35 },
+    { "1" , RGB{ 141,211,199 }, SchemeEnum::set36 },
+    { "2" , RGB{ 255,255,179 }, SchemeEnum::set36 },
+    { "3" , RGB{ 190,186,218 }, SchemeEnum::set36 },
+    { "4" , RGB{ 251,128,114 }, SchemeEnum::set36 },
+    { "5" , RGB{ 128,177,211 }, SchemeEnum::set36 },
+    { "6" , RGB{ 253,180,98  }, SchemeEnum::set36 },
+    { "1" , RGB{ 141,211,199 }, SchemeEnum::set37 },
+    { "2" , RGB{ 255,255,179 }, SchemeEnum::set37 },
+    { "3" , RGB{ 190,186,218 }, SchemeEnum::set37 },
+    { "4" , RGB{ 251,128,114 }, SchemeEnum::set37 },
+    { "5" , RGB{ 128,177,211 }, SchemeEnum::set37 },
+    { "6" , RGB{ 253,180,98  }, SchemeEnum::set37 },
+    { "7" , RGB{ 179,222,105 }, SchemeEnum::set37 },
+    { "1" , RGB{ 141,211,199 }, SchemeEnum::set38 },
+    { "2" , RGB{ 255,255,179 }, SchemeEnum::set38 },
+    { "3" , RGB{ 190,186,218 }, SchemeEnum::set38 },
+    { "4" , RGB{ 251,128,114 }, SchemeEnum::set38 },
+    { "5" , RGB{ 128,177,211 }, SchemeEnum::set38 },
+    { "6" , RGB{ 253,180,98  }, SchemeEnum::set38 },
+    { "7" , RGB{ 179,222,105 }, SchemeEnum::set38 },
+    { "8" , RGB{ 252,205,229 }, SchemeEnum::set38 },
+    { "1" , RGB{ 141,211,199 }, SchemeEnum::set39 },
+    { "2" , RGB{ 255,255,179 }, SchemeEnum::set39 },
+    { "3" , RGB{ 190,186,218 }, SchemeEnum::set39 },
+    { "4" , RGB{ 251,128,114 }, SchemeEnum::set39 },
+    { "5" , RGB{ 128,177,211 }, SchemeEnum::set39 },
+    { "6" , RGB{ 253,180,98  }, SchemeEnum::set39 },
+    { "7" , RGB{ 179,222,105 }, SchemeEnum::set39 },
+    { "8" , RGB{ 252,205,229 }, SchemeEnum::set39 },
+    { "9" , RGB{ 217,217,217 }, SchemeEnum::set39 },
+    { "1" , RGB{ 141,211,199 }, SchemeEnum::set310 },
+    { "2" , RGB{ 255,255,179 }, SchemeEnum::set310 },
+    { "3" , RGB{ 190,186,218 }, SchemeEnum::set310 },
+    { "4" , RGB{ 251,128,114 }, SchemeEnum::set310 },
+    { "5" , RGB{ 128,177,211 }, SchemeEnum::set310 },
+    { "6" , RGB{ 253,180,98  }, SchemeEnum::set310 },
+    { "7" , RGB{ 179,222,105 }, SchemeEnum::set310 },
+    { "8" , RGB{ 252,205,229 }, SchemeEnum::set310 },
+    { "9" , RGB{ 217,217,217 }, SchemeEnum::set310 },
+    { "10", RGB{ 188,128,189 }, SchemeEnum::set310 },
+    { "1" , RGB{ 141,211,199 }, SchemeEnum::set311 },
+    { "2" , RGB{ 255,255,179 }, SchemeEnum::set311 },
+    { "3" , RGB{ 190,186,218 }, SchemeEnum::set311 },
+    { "4" , RGB{ 251,128,114 }, SchemeEnum::set311 },
+    { "5" , RGB{ 128,177,211 }, SchemeEnum::set311 },
+    { "6" , RGB{ 253,180,98  }, SchemeEnum::set311 },
+    { "7" , RGB{ 179,222,105 }, SchemeEnum::set311 },
+    { "8" , RGB{ 252,205,229 }, SchemeEnum::set311 },
+    { "9" , RGB{ 217,217,217 }, SchemeEnum::set311 },
+    { "10", RGB{ 188,128,189 }, SchemeEnum::set311 },
+    { "11", RGB{ 204,235,197 }, SchemeEnum::set311 },
+    { "1" , RGB{ 141,211,199 }, SchemeEnum::set312 },
+    { "2" , RGB{ 255,255,179 }, SchemeEnum::set312 },
+    { "3" , RGB{ 190,186,218 }, SchemeEnum::set312 },
+    { "4" , RGB{ 251,128,114 }, SchemeEnum::set312 },
+    { "5" , RGB{ 128,177,211 }, SchemeEnum::set312 },
+    { "6" , RGB{ 253,180,98  }, SchemeEnum::set312 },
+    { "7" , RGB{ 179,222,105 }, SchemeEnum::set312 },
+    { "8" , RGB{ 252,205,229 }, SchemeEnum::set312 },
+    { "9" , RGB{ 217,217,217 }, SchemeEnum::set312 },
+    { "10", RGB{ 188,128,189 }, SchemeEnum::set312 },
+    { "11", RGB{ 204,235,197 }, SchemeEnum::set312 },
+    { "12", RGB{ 255,237,111 }, SchemeEnum::set312 },
+    { "1" , RGB{ 252,141,89  }, SchemeEnum::spectral3 },
+    { "2" , RGB{ 255,255,191 }, SchemeEnum::spectral3 },
+    { "3" , RGB{ 153,213,148 }, SchemeEnum::spectral3 },
+    { "1" , RGB{ 215,25 ,28  }, SchemeEnum::spectral4 },
+    { "2" , RGB{ 253,174,97  }, SchemeEnum::spectral4 },
+    { "3" , RGB{ 171,221,164 }, SchemeEnum::spectral4 },
+    { "4" , RGB{ 43 ,131,186 }, SchemeEnum::spectral4 },
+    { "1" , RGB{ 215,25 ,28  }, SchemeEnum::spectral5 },
+    { "2" , RGB{ 253,174,97  }, SchemeEnum::spectral5 },
+    { "3" , RGB{ 255,255,191 }, SchemeEnum::spectral5 },
+    { "4" , RGB{ 171,221,164 }, SchemeEnum::spectral5 },
+    { "5" , RGB{ 43 ,131,186 }, SchemeEnum::spectral5 },
+    { "1" , RGB{ 213,62 ,79  }, SchemeEnum::spectral6 },
+    { "2" , RGB{ 252,141,89  }, SchemeEnum::spectral6 },
+    { "3" , RGB{ 254,224,139 }, SchemeEnum::spectral6 },
+    { "4" , RGB{ 230,245,152 }, SchemeEnum::spectral6 },
+    { "5" , RGB{ 153,213,148 }, SchemeEnum::spectral6 },
+    { "6" , RGB{ 50 ,136,189 }, SchemeEnum::spectral6 },
+    { "1" , RGB{ 213,62 ,79  }, SchemeEnum::spectral7 },
+    { "2" , RGB{ 252,141,89  }, SchemeEnum::spectral7 },
+    { "3" , RGB{ 254,224,139 }, SchemeEnum::spectral7 },
+    { "4" , RGB{ 255,255,191 }, SchemeEnum::spectral7 },
+    { "5" , RGB{ 230,245,152 }, SchemeEnum::spectral7 },
+    { "6" , RGB{ 153,213,148 }, SchemeEnum::spectral7 },
+    { "7" , RGB{ 50 ,136,189 }, SchemeEnum::spectral7 },
+    { "1" , RGB{ 213,62 ,79  }, SchemeEnum::spectral8 },
+    { "2" , RGB{ 244,109,67  }, SchemeEnum::spectral8 },
+    { "3" , RGB{ 253,174,97  }, SchemeEnum::spectral8 },
+    { "4" , RGB{ 254,224,139 }, SchemeEnum::spectral8 },
+    { "5" , RGB{ 230,245,152 }, SchemeEnum::spectral8 },
+    { "6" , RGB{ 171,221,164 }, SchemeEnum::spectral8 },
+    { "7" , RGB{ 102,194,165 }, SchemeEnum::spectral8 },
+    { "8" , RGB{ 50 ,136,189 }, SchemeEnum::spectral8 },
+    { "1" , RGB{ 213,62 ,79  }, SchemeEnum::spectral9 },
+    { "2" , RGB{ 244,109,67  }, SchemeEnum::spectral9 },
+    { "3" , RGB{ 253,174,97  }, SchemeEnum::spectral9 },
+    { "4" , RGB{ 254,224,139 }, SchemeEnum::spectral9 },
+    { "5" , RGB{ 255,255,191 }, SchemeEnum::spectral9 },
+    { "6" , RGB{ 230,245,152 }, SchemeEnum::spectral9 },
+    { "7" , RGB{ 171,221,164 }, SchemeEnum::spectral9 },
+    { "8" , RGB{ 102,194,165 }, SchemeEnum::spectral9 },
+    { "9" , RGB{ 50 ,136,189 }, SchemeEnum::spectral9 },
+    { "1" , RGB{ 158,1  ,66  }, SchemeEnum::spectral10 },
+    { "2" , RGB{ 213,62 ,79  }, SchemeEnum::spectral10 },
+    { "3" , RGB{ 244,109,67  }, SchemeEnum::spectral10 },
+    { "4" , RGB{ 253,174,97  }, SchemeEnum::spectral10 },
+    { "5" , RGB{ 254,224,139 }, SchemeEnum::spectral10 },
+    { "6" , RGB{ 230,245,152 }, SchemeEnum::spectral10 },
+    { "7" , RGB{ 171,221,164 }, SchemeEnum::spectral10 },
+    { "8" , RGB{ 102,194,165 }, SchemeEnum::spectral10 },
+    { "9" , RGB{ 50 ,136,189 }, SchemeEnum::spectral10 },
+    { "10", RGB{ 94 ,79 ,162 }, SchemeEnum::spectral10 },
+    { "1" , RGB{ 158,1  ,66  }, SchemeEnum::spectral11 },
+    { "2" , RGB{ 213,62 ,79  }, SchemeEnum::spectral11 },
+    { "3" , RGB{ 244,109,67  }, SchemeEnum::spectral11 },
+    { "4" , RGB{ 253,174,97  }, SchemeEnum::spectral11 },
+    { "5" , RGB{ 254,224,139 }, SchemeEnum::spectral11 },
+    { "6" , RGB{ 255,255,191 }, SchemeEnum::spectral11 },
+    { "7" , RGB{ 230,245,152 }, SchemeEnum::spectral11 },
+    { "8" , RGB{ 171,221,164 }, SchemeEnum::spectral11 },
+    { "9" , RGB{ 102,194,165 }, SchemeEnum::spectral11 },
+    { "10", RGB{ 50 ,136,189 }, SchemeEnum::spectral11 },
+    { "11", RGB{ 94 ,79 ,162 }, SchemeEnum::spectral11 },
+    { "1" , RGB{ 247,252,185 }, SchemeEnum::ylgn3 },
+    { "2" , RGB{ 173,221,142 }, SchemeEnum::ylgn3 },
+    { "3" , RGB{ 49 ,163,84  }, SchemeEnum::ylgn3 },
+    { "1" , RGB{ 255,255,204 }, SchemeEnum::ylgn4 },
+    { "2" , RGB{ 194,230,153 }, SchemeEnum::ylgn4 },
+    { "3" , RGB{ 120,198,121 }, SchemeEnum::ylgn4 },
+    { "4" , RGB{ 35 ,132,67  }, SchemeEnum::ylgn4 },
+    { "1" , RGB{ 255,255,204 }, SchemeEnum::ylgn5 },
+    { "2" , RGB{ 194,230,153 }, SchemeEnum::ylgn5 },
+    { "3" , RGB{ 120,198,121 }, SchemeEnum::ylgn5 },
+    { "4" , RGB{ 49 ,163,84  }, SchemeEnum::ylgn5 },
+    { "5" , RGB{ 0  ,104,55  }, SchemeEnum::ylgn5 },
+    { "1" , RGB{ 255,255,204 }, SchemeEnum::ylgn6 },
+    { "2" , RGB{ 217,240,163 }, SchemeEnum::ylgn6 },
+    { "3" , RGB{ 173,221,142 }, SchemeEnum::ylgn6 },
+    { "4" , RGB{ 120,198,121 }, SchemeEnum::ylgn6 },
+    { "5" , RGB{ 49 ,163,84  }, SchemeEnum::ylgn6 },
+    { "6" , RGB{ 0  ,104,55  }, SchemeEnum::ylgn6 },
+    { "1" , RGB{ 255,255,204 }, SchemeEnum::ylgn7 },
+    { "2" , RGB{ 217,240,163 }, SchemeEnum::ylgn7 },
+    { "3" , RGB{ 173,221,142 }, SchemeEnum::ylgn7 },
+    { "4" , RGB{ 120,198,121 }, SchemeEnum::ylgn7 },
+    { "5" , RGB{ 65 ,171,93  }, SchemeEnum::ylgn7 },
+    { "6" , RGB{ 35 ,132,67  }, SchemeEnum::ylgn7 },
+    { "7" , RGB{ 0  ,90 ,50  }, SchemeEnum::ylgn7 },
+    { "1" , RGB{ 255,255,229 }, SchemeEnum::ylgn8 },
+    { "2" , RGB{ 247,252,185 }, SchemeEnum::ylgn8 },
+    { "3" , RGB{ 217,240,163 }, SchemeEnum::ylgn8 },
+    { "4" , RGB{ 173,221,142 }, SchemeEnum::ylgn8 },
+    { "5" , RGB{ 120,198,121 }, SchemeEnum::ylgn8 },
+    { "6" , RGB{ 65 ,171,93  }, SchemeEnum::ylgn8 },
+    { "7" , RGB{ 35 ,132,67  }, SchemeEnum::ylgn8 },
+    { "8" , RGB{ 0  ,90 ,50  }, SchemeEnum::ylgn8 },
+    { "1" , RGB{ 255,255,229 }, SchemeEnum::ylgn9 },
+    { "2" , RGB{ 247,252,185 }, SchemeEnum::ylgn9 },
+    { "3" , RGB{ 217,240,163 }, SchemeEnum::ylgn9 },
+    { "4" , RGB{ 173,221,142 }, SchemeEnum::ylgn9 },
+    { "5" , RGB{ 120,198,121 }, SchemeEnum::ylgn9 },
+    { "6" , RGB{ 65 ,171,93  }, SchemeEnum::ylgn9 },
+    { "7" , RGB{ 35 ,132,67  }, SchemeEnum::ylgn9 },
+    { "8" , RGB{ 0  ,104,55  }, SchemeEnum::ylgn9 },
+    { "9" , RGB{ 0  ,69 ,41  }, SchemeEnum::ylgn9 },
+    { "1" , RGB{ 237,248,177 }, SchemeEnum::ylgnbu3 },
+    { "2" , RGB{ 127,205,187 }, SchemeEnum::ylgnbu3 },
+    { "3" , RGB{ 44 ,127,184 }, SchemeEnum::ylgnbu3 },
+    { "1" , RGB{ 255,255,204 }, SchemeEnum::ylgnbu4 },
+    { "2" , RGB{ 161,218,180 }, SchemeEnum::ylgnbu4 },
+    { "3" , RGB{ 65 ,182,196 }, SchemeEnum::ylgnbu4 },
+    { "4" , RGB{ 34 ,94 ,168 }, SchemeEnum::ylgnbu4 },
+    { "1" , RGB{ 255,255,204 }, SchemeEnum::ylgnbu5 },
+    { "2" , RGB{ 161,218,180 }, SchemeEnum::ylgnbu5 },
+    { "3" , RGB{ 65 ,182,196 }, SchemeEnum::ylgnbu5 },
+    { "4" , RGB{ 44 ,127,184 }, SchemeEnum::ylgnbu5 },
+    { "5" , RGB{ 37 ,52 ,148 }, SchemeEnum::ylgnbu5 },
+    { "1" , RGB{ 255,255,204 }, SchemeEnum::ylgnbu6 },
+    { "2" , RGB{ 199,233,180 }, SchemeEnum::ylgnbu6 },
+    { "3" , RGB{ 127,205,187 }, SchemeEnum::ylgnbu6 },
+    { "4" , RGB{ 65 ,182,196 }, SchemeEnum::ylgnbu6 },
+    { "5" , RGB{ 44 ,127,184 }, SchemeEnum::ylgnbu6 },
+    { "6" , RGB{ 37 ,52 ,148 }, SchemeEnum::ylgnbu6 },
+    { "1" , RGB{ 255,255,204 }, SchemeEnum::ylgnbu7 },
+    { "2" , RGB{ 199,233,180 }, SchemeEnum::ylgnbu7 },
+    { "3" , RGB{ 127,205,187 }, SchemeEnum::ylgnbu7 },
+    { "4" , RGB{ 65 ,182,196 }, SchemeEnum::ylgnbu7 },
+    { "5" , RGB{ 29 ,145,192 }, SchemeEnum::ylgnbu7 },
+    { "6" , RGB{ 34 ,94 ,168 }, SchemeEnum::ylgnbu7 },
+    { "7" , RGB{ 12 ,44 ,132 }, SchemeEnum::ylgnbu7 },
+    { "1" , RGB{ 255,255,217 }, SchemeEnum::ylgnbu8 },
+    { "2" , RGB{ 237,248,177 }, SchemeEnum::ylgnbu8 },
+    { "3" , RGB{ 199,233,180 }, SchemeEnum::ylgnbu8 },
+    { "4" , RGB{ 127,205,187 }, SchemeEnum::ylgnbu8 },
+    { "5" , RGB{ 65 ,182,196 }, SchemeEnum::ylgnbu8 },
+    { "6" , RGB{ 29 ,145,192 }, SchemeEnum::ylgnbu8 },
+    { "7" , RGB{ 34 ,94 ,168 }, SchemeEnum::ylgnbu8 },
+    { "8" , RGB{ 12 ,44 ,132 }, SchemeEnum::ylgnbu8 },
+    { "1" , RGB{ 255,255,217 }, SchemeEnum::ylgnbu9 },
+    { "2" , RGB{ 237,248,177 }, SchemeEnum::ylgnbu9 },
+    { "3" , RGB{ 199,233,180 }, SchemeEnum::ylgnbu9 },
+    { "4" , RGB{ 127,205,187 }, SchemeEnum::ylgnbu9 },
+    { "5" , RGB{ 65 ,182,196 }, SchemeEnum::ylgnbu9 },
+    { "6" , RGB{ 29 ,145,192 }, SchemeEnum::ylgnbu9 },
+    { "7" , RGB{ 34 ,94 ,168 }, SchemeEnum::ylgnbu9 },
+    { "8" , RGB{ 37 ,52 ,148 }, SchemeEnum::ylgnbu9 },
+    { "9" , RGB{ 8  ,29 ,88  }, SchemeEnum::ylgnbu9 },
+    { "1" , RGB{ 255,247,188 }, SchemeEnum::ylorbr3 },
+    { "2" , RGB{ 254,196,79  }, SchemeEnum::ylorbr3 },
+    { "3" , RGB{ 217,95 ,14  }, SchemeEnum::ylorbr3 },
+    { "1" , RGB{ 255,255,212 }, SchemeEnum::ylorbr4 },
+    { "2" , RGB{ 254,217,142 }, SchemeEnum::ylorbr4 },
+    { "3" , RGB{ 254,153,41  }, SchemeEnum::ylorbr4 },
+    { "4" , RGB{ 204,76 ,2   }, SchemeEnum::ylorbr4 },
+    { "1" , RGB{ 255,255,212 }, SchemeEnum::ylorbr5 },
+    { "2" , RGB{ 254,217,142 }, SchemeEnum::ylorbr5 },
+    { "3" , RGB{ 254,153,41  }, SchemeEnum::ylorbr5 },
+    { "4" , RGB{ 217,95 ,14  }, SchemeEnum::ylorbr5 },
+    { "5" , RGB{ 153,52 ,4   }, SchemeEnum::ylorbr5 },
+    { "1" , RGB{ 255,255,212 }, SchemeEnum::ylorbr6 },
+    { "2" , RGB{ 254,227,145 }, SchemeEnum::ylorbr6 },
+    { "3" , RGB{ 254,196,79  }, SchemeEnum::ylorbr6 },
+    { "4" , RGB{ 254,153,41  }, SchemeEnum::ylorbr6 },
+    { "5" , RGB{ 217,95 ,14  }, SchemeEnum::ylorbr6 },
+    { "6" , RGB{ 153,52 ,4   }, SchemeEnum::ylorbr6 },
+    { "1" , RGB{ 255,255,212 }, SchemeEnum::ylorbr7 },
+    { "2" , RGB{ 254,227,145 }, SchemeEnum::ylorbr7 },
+    { "3" , RGB{ 254,196,79  }, SchemeEnum::ylorbr7 },
+    { "4" , RGB{ 254,153,41  }, SchemeEnum::ylorbr7 },
+    { "5" , RGB{ 236,112,20  }, SchemeEnum::ylorbr7 },
+    { "6" , RGB{ 204,76 ,2   }, SchemeEnum::ylorbr7 },
+    { "7" , RGB{ 140,45 ,4   }, SchemeEnum::ylorbr7 },
+    { "1" , RGB{ 255,255,229 }, SchemeEnum::ylorbr8 },
+    { "2" , RGB{ 255,247,188 }, SchemeEnum::ylorbr8 },
+    { "3" , RGB{ 254,227,145 }, SchemeEnum::ylorbr8 },
+    { "4" , RGB{ 254,196,79  }, SchemeEnum::ylorbr8 },
+    { "5" , RGB{ 254,153,41  }, SchemeEnum::ylorbr8 },
+    { "6" , RGB{ 236,112,20  }, SchemeEnum::ylorbr8 },
+    { "7" , RGB{ 204,76 ,2   }, SchemeEnum::ylorbr8 },
+    { "8" , RGB{ 140,45 ,4   }, SchemeEnum::ylorbr8 },
+    { "1" , RGB{ 255,255,229 }, SchemeEnum::ylorbr9 },
+    { "2" , RGB{ 255,247,188 }, SchemeEnum::ylorbr9 },
+    { "3" , RGB{ 254,227,145 }, SchemeEnum::ylorbr9 },
+    { "4" , RGB{ 254,196,79  }, SchemeEnum::ylorbr9 },
+    { "5" , RGB{ 254,153,41  }, SchemeEnum::ylorbr9 },
+    { "6" , RGB{ 236,112,20  }, SchemeEnum::ylorbr9 },
+    { "7" , RGB{ 204,76 ,2   }, SchemeEnum::ylorbr9 },
+    { "8" , RGB{ 153,52 ,4   }, SchemeEnum::ylorbr9 },
+    { "9" , RGB{ 102,37 ,6   }, SchemeEnum::ylorbr9 },
+    { "1" , RGB{ 255,237,160 }, SchemeEnum::ylorrd3 },
+    { "2" , RGB{ 254,178,76  }, SchemeEnum::ylorrd3 },
+    { "3" , RGB{ 240,59 ,32  }, SchemeEnum::ylorrd3 },
+    { "1" , RGB{ 255,255,178 }, SchemeEnum::ylorrd4 },
+    { "2" , RGB{ 254,204,92  }, SchemeEnum::ylorrd4 },
+    { "3" , RGB{ 253,141,60  }, SchemeEnum::ylorrd4 },
+    { "4" , RGB{ 227,26 ,28  }, SchemeEnum::ylorrd4 },
+    { "1" , RGB{ 255,255,178 }, SchemeEnum::ylorrd5 },
+    { "2" , RGB{ 254,204,92  }, SchemeEnum::ylorrd5 },
+    { "3" , RGB{ 253,141,60  }, SchemeEnum::ylorrd5 },
+    { "4" , RGB{ 240,59 ,32  }, SchemeEnum::ylorrd5 },
+    { "5" , RGB{ 189,0  ,38  }, SchemeEnum::ylorrd5 },
+    { "1" , RGB{ 255,255,178 }, SchemeEnum::ylorrd6 },
+    { "2" , RGB{ 254,217,118 }, SchemeEnum::ylorrd6 },
+    { "3" , RGB{ 254,178,76  }, SchemeEnum::ylorrd6 },
+    { "4" , RGB{ 253,141,60  }, SchemeEnum::ylorrd6 },
+    { "5" , RGB{ 240,59 ,32  }, SchemeEnum::ylorrd6 },
+    { "6" , RGB{ 189,0  ,38  }, SchemeEnum::ylorrd6 },
+    { "1" , RGB{ 255,255,178 }, SchemeEnum::ylorrd7 },
+    { "2" , RGB{ 254,217,118 }, SchemeEnum::ylorrd7 },
+    { "3" , RGB{ 254,178,76  }, SchemeEnum::ylorrd7 },
+    { "4" , RGB{ 253,141,60  }, SchemeEnum::ylorrd7 },
+    { "5" , RGB{ 252,78 ,42  }, SchemeEnum::ylorrd7 },
+    { "6" , RGB{ 227,26 ,28  }, SchemeEnum::ylorrd7 },
+    { "7" , RGB{ 177,0  ,38  }, SchemeEnum::ylorrd7 },
+    { "1" , RGB{ 255,255,204 }, SchemeEnum::ylorrd8 },
+    { "2" , RGB{ 255,237,160 }, SchemeEnum::ylorrd8 },
+    { "3" , RGB{ 254,217,118 }, SchemeEnum::ylorrd8 },
+    { "4" , RGB{ 254,178,76  }, SchemeEnum::ylorrd8 },
+    { "5" , RGB{ 253,141,60  }, SchemeEnum::ylorrd8 },
+    { "6" , RGB{ 252,78 ,42  }, SchemeEnum::ylorrd8 },
+    { "7" , RGB{ 227,26 ,28  }, SchemeEnum::ylorrd8 },
+    { "8" , RGB{ 177,0  ,38  }, SchemeEnum::ylorrd8 },
+    { "1" , RGB{ 255,255,204 }, SchemeEnum::ylorrd9 },
+    { "2" , RGB{ 255,237,160 }, SchemeEnum::ylorrd9 },
+    { "3" , RGB{ 254,217,118 }, SchemeEnum::ylorrd9 },
+    { "4" , RGB{ 254,178,76  }, SchemeEnum::ylorrd9 },
+    { "5" , RGB{ 253,141,60  }, SchemeEnum::ylorrd9 },
+    { "6" , RGB{ 252,78 ,42  }, SchemeEnum::ylorrd9 },
+    { "7" , RGB{ 227,26 ,28  }, SchemeEnum::ylorrd9 },
+    { "8" , RGB{ 189,0  ,38  }, SchemeEnum::ylorrd9 },
+    { "9" , RGB{ 128,0  ,38  }, SchemeEnum::ylorrd9 }
+  };
+};  // class BrewerColor
+
+static_assert(std::size(BrewerColor::schemes)
+              == uint16_t(last_brewer_scheme) - uint16_t(first_brewer_scheme) + 1);
+
+}  // namespace gviz::colors
+
+#endif  // GVIZARD_COLORS_BREWER_HPP_
@@ -11,6 +11,7 @@
 #include "gvizard/colors/hsv.hpp"
 #include "gvizard/colors/x11.hpp"
 #include "gvizard/colors/svg.hpp"
+#include "gvizard/colors/brewer.hpp"
 
 #include "gvizard/colors/general.hpp"
 #include "gvizard/colors/converter.hpp"
@@ -57,6 +58,9 @@ struct Color {
   constexpr Color(const X11Color& clr) : color(clr) {}
   constexpr Color(X11Color&& clr) : color(std::move(clr)) {}
 
+  // brewer colors are held as the scheme color they stand for.
+  constexpr Color(const BrewerColor& clr) : color(clr.get_color()) {}
+
   template <typename ColorT>
   constexpr Color(const SchemeColor<ColorT>& clr) : color(clr) {}
 
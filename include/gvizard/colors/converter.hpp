@@ -11,6 +11,7 @@
 #include "gvizard/colors/hsv.hpp"
 #include "gvizard/colors/x11.hpp"
 #include "gvizard/colors/svg.hpp"
+#include "gvizard/colors/brewer.hpp"
 
 #include "gvizard/colors/general.hpp"
 
@@ -31,33 +32,35 @@ struct Converter<colors::RGB, colors::HSV> final {
   constexpr static auto convert(const colors::RGB& rgb) noexcept
     -> colors::HSV
   {
-    uint8_t min = rgb.min();
-    uint8_t max = rgb.max();
+    const int min = rgb.min();
+    const int max = rgb.max();
 
     if (max == 0)
       return hsv_zero_default;
 
-    double v = double(max) / 255.;
+    const int delta = max - min;
 
-    double s = double(max - min) / max;
-    if (s == 0.)
-      return hsv_zero_default;
+    double v = double(max) / 255.;
+    if (delta == 0)
+      return colors::HSV::make(0., 0., v).value();
 
-    // NOTE this will underflow if b > g, but won't be negative,
-    //      not sure if abs would be better.
-    uint8_t gb_diff = rgb.g - rgb.b;
+    double s = double(delta) / max;
 
-    double h = 0;
+    // hue in 1/255 turns, 43 per sextant of the color wheel.
+    int h = 0;
     if (max == rgb.r)
-      h = double(  0.f + 43.f * gb_diff / (max - min)) / 255.;
+      h =   0 + 43 * (rgb.g - rgb.b) / delta;
 
     else if (max == rgb.g)
-      h = double( 83.f + 43.f * gb_diff / (max - min)) / 255.;
+      h =  85 + 43 * (rgb.b - rgb.r) / delta;
 
     else // max == rgb.b
-      h = double(171.f + 43.f * gb_diff / (max - min)) / 255.;
+      h = 171 + 43 * (rgb.r - rgb.g) / delta;
+
+    // reds leaning to blue have negative hue, wrap them around the wheel.
+    h &= 0xff;
 
-    return colors::HSV::make(h, s, v).value();
+    return colors::HSV::make(double(h) / 255., s, v).value();
   }
 };
 
@@ -66,13 +69,13 @@ struct Converter<colors::HSV, colors::RGB> final {
   constexpr static auto convert(const colors::HSV& hsv) noexcept
     -> colors::RGB
   {
-    if (hsv.saturation() == 0.)
-      return colors::RGB{0, 0, 0};
-
     uint8_t h = hsv.hue() * 255;
     uint8_t s = hsv.saturation() * 255;
     uint8_t v = hsv.value() * 255;
 
+    if (hsv.saturation() == 0.)
+      return colors::RGB{v, v, v};
+
     uint8_t region = h / 43;
     uint8_t remainder = (h - (region * 43)) * 6;
 
@@ -159,7 +162,7 @@ struct Converter<colors::SchemeColor<T>, U,
   }
 };
 
-// -- SVG and X11 colors
+// -- SVG, X11 and brewer colors
 
 template <typename To>
 struct Converter<colors::X11Color, To,
@@ -181,6 +184,16 @@ struct Converter<colors::SVGColor, To,
   }
 };
 
+template <typename To>
+struct Converter<colors::BrewerColor, To,
+                 detail::avoid_same_t<colors::BrewerColor, To>> final
+{
+  constexpr static auto convert(const colors::BrewerColor& color) -> To
+  {
+    return Converter<colors::RGB, To>::convert(color.get_color());
+  }
+};
+
 // -- SVG and X11 color enums
 
 template <typename To>
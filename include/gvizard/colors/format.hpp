@@ -0,0 +1,283 @@
+#ifndef GVIZARD_COLORS_FORMAT_HPP_
+#define GVIZARD_COLORS_FORMAT_HPP_
+
+#include <array>
+#include <charconv>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <system_error>
+#include <type_traits>
+#include <variant>
+#include <vector>
+
+#include "gvizard/colors/brewer.hpp"
+#include "gvizard/colors/color.hpp"
+#include "gvizard/colors/general.hpp"
+#include "gvizard/colors/hsv.hpp"
+#include "gvizard/colors/names.hpp"
+#include "gvizard/colors/packed.hpp"
+#include "gvizard/colors/rgb.hpp"
+#include "gvizard/colors/rgba.hpp"
+#include "gvizard/colors/svg.hpp"
+#include "gvizard/colors/x11.hpp"
+
+namespace gviz::colors {
+
+/** buffer size which fits any single color written by `format_to`,
+ *  i.e. the longest color name with a scheme prefix.
+ */
+constexpr std::size_t max_color_length = 32;
+
+namespace detail {
+
+/** lowercase hex digits of every octet, two chars each. */
+constexpr auto hex_pairs = []() {
+  constexpr char digits[] = "0123456789abcdef";
+
+  std::array<char, 512> pairs{};
+  for (std::size_t i = 0; i < 256; ++i) {
+    pairs[2 * i]     = digits[i >> 4];
+    pairs[2 * i + 1] = digits[i & 0xf];
+  }
+  return pairs;
+}();
+
+/** sequential writer to [first, last), which fails once out of space. */
+class ColorWriter final {
+  char *ptr_;
+  char *last_;
+  bool  ok_ = true;
+
+ public:
+  constexpr ColorWriter(char *first, char *last) noexcept
+    : ptr_(first), last_(last)
+  {}
+
+  constexpr bool reserve(std::size_t count) noexcept
+  {
+    ok_ = ok_ && std::size_t(last_ - ptr_) >= count;
+    return ok_;
+  }
+
+  constexpr void put(char chr) noexcept
+  {
+    if (reserve(1))
+      *ptr_++ = chr;
+  }
+
+  constexpr void put(std::string_view str) noexcept
+  {
+    if (reserve(str.size()))
+      for (const auto chr : str)
+        *ptr_++ = chr;
+  }
+
+  constexpr void put_hex(uint8_t octet) noexcept
+  {
+    if (reserve(2)) {
+      *ptr_++ = hex_pairs[2 * octet];
+      *ptr_++ = hex_pairs[2 * octet + 1];
+    }
+  }
+
+  /** writes `value` of [0, 1] with 3 decimals, as graphviz does,
+   *  optionally without trailing zeros.
+   */
+  constexpr void put_unit(double value, bool trim) noexcept
+  {
+    value = value < 0. ? 0. : (value > 1. ? 1. : value);
+    auto thousandths = unsigned(value * 1000. + .5);
+
+    put(char('0' + thousandths / 1000));
+    thousandths %= 1000;
+
+    if (trim && thousandths == 0)
+      return;
+
+    char frac[] = { '.',
+                    char('0' + thousandths / 100),
+                    char('0' + thousandths / 10 % 10),
+                    char('0' + thousandths % 10) };
+
+    std::size_t len = 4;
+    while (trim && frac[len - 1] == '0')
+      --len;
+
+    put(std::string_view(frac, len));
+  }
+
+  constexpr std::to_chars_result result() const noexcept
+  {
+    if (!ok_)
+      return { last_, std::errc::value_too_large };
+
+    return { ptr_, std::errc{} };
+  }
+};
+
+constexpr void write_name(ColorWriter& writer, std::string_view name,
+                          SchemeEnum scheme, SchemeEnum default_scheme)
+  noexcept
+{
+  if (scheme != default_scheme) {
+    writer.put('/');
+    writer.put(scheme_name(scheme));
+    writer.put('/');
+  }
+
+  writer.put(name);
+}
+
+constexpr void write_color(ColorWriter& writer, const RGB& color,
+                           SchemeEnum) noexcept
+{
+  if (writer.reserve(7)) {
+    writer.put('#');
+    writer.put_hex(color.r);
+    writer.put_hex(color.g);
+    writer.put_hex(color.b);
+  }
+}
+
+constexpr void write_color(ColorWriter& writer, const RGBA& color,
+                           SchemeEnum) noexcept
+{
+  if (writer.reserve(9)) {
+    writer.put('#');
+    writer.put_hex(color.r);
+    writer.put_hex(color.g);
+    writer.put_hex(color.b);
+    writer.put_hex(color.a);
+  }
+}
+
+constexpr void write_color(ColorWriter& writer, const HSV& color,
+                           SchemeEnum) noexcept
+{
+  writer.put_unit(color.hue(), false);
+  writer.put(',');
+  writer.put_unit(color.saturation(), false);
+  writer.put(',');
+  writer.put_unit(color.value(), false);
+}
+
+constexpr void write_color(ColorWriter& writer, const X11Color& color,
+                           SchemeEnum default_scheme) noexcept
+{
+  write_name(writer, color.get_name(), SchemeEnum::X11, default_scheme);
+}
+
+constexpr void write_color(ColorWriter& writer, const SVGColor& color,
+                           SchemeEnum default_scheme) noexcept
+{
+  write_name(writer, color.get_name(), SchemeEnum::SVG, default_scheme);
+}
+
+constexpr void write_color(ColorWriter& writer, const BrewerColor& color,
+                           SchemeEnum default_scheme) noexcept
+{
+  write_name(writer, color.get_name(), color.get_scheme(), default_scheme);
+}
+
+constexpr void write_color(ColorWriter& writer, X11ColorEnum color,
+                           SchemeEnum default_scheme) noexcept
+{
+  write_color(writer, X11Color(color), default_scheme);
+}
+
+constexpr void write_color(ColorWriter& writer, SVGColorEnum color,
+                           SchemeEnum default_scheme) noexcept
+{
+  write_color(writer, SVGColor(color), default_scheme);
+}
+
+template <typename ColorT>
+constexpr void write_color(ColorWriter& writer,
+                           const SchemeColor<ColorT>& color,
+                           SchemeEnum default_scheme) noexcept
+{
+  if (color.name)
+    write_name(writer, color.name, color.scheme, default_scheme);
+  else
+    write_color(writer, color.color, default_scheme);
+}
+
+constexpr void write_color(ColorWriter& writer, const PackedColor& color,
+                           SchemeEnum default_scheme) noexcept
+{
+  if (const auto scheme = color.get_scheme())
+    write_name(writer, color.get_name(), *scheme, default_scheme);
+  else if (color.rgba().a == 255)
+    write_color(writer, color.rgb(), default_scheme);
+  else
+    write_color(writer, color.rgba(), default_scheme);
+}
+
+inline void write_color(ColorWriter& writer, const Color& color,
+                        SchemeEnum default_scheme) noexcept
+{
+  std::visit(
+    [&](const auto& alt) { write_color(writer, alt, default_scheme); },
+    color.color
+  );
+}
+
+template <typename ColorT>
+constexpr void write_color(ColorWriter& writer,
+                           const WeightedColor<ColorT>& color,
+                           SchemeEnum default_scheme) noexcept
+{
+  write_color(writer, color.get_color(), default_scheme);
+  writer.put(';');
+  writer.put_unit(color.get_weight(), true);
+}
+
+template <typename ColorT>
+void write_color(ColorWriter& writer,
+                 const std::vector<WeightedColor<ColorT>>& colors,
+                 SchemeEnum default_scheme) noexcept
+{
+  for (std::size_t i = 0; i < colors.size(); ++i) {
+    if (i != 0)
+      writer.put(':');
+
+    write_color(writer, colors[i], default_scheme);
+  }
+}
+
+}  // namespace detail
+
+/** writes a color the way graphviz reads it, without allocating.
+ *
+ * RGB is written as "#rrggbb", RGBA as "#rrggbbaa", HSV as "h,s,v" with
+ * 3 decimals and named colors (including brewer ones, named by their
+ * index) as their name, prefixed by "/scheme/" if their scheme isn't
+ * `default_scheme`. a `WeightedColor` is written as "color;weight" and
+ * a list of them as "color;weight:color;weight...".
+ *
+ * like `std::to_chars`, nothing is null terminated.
+ *
+ * @param first          begin of caller's buffer.
+ * @param last           end of caller's buffer, a single color always
+ *                       fits `max_color_length` chars.
+ * @param color          any alternative of `Color`, `Color` itself,
+ *                       `PackedColor`, `WeightedColor` or a vector of those.
+ * @param default_scheme current `colorscheme`.
+ * @returns `ptr` past the last written char and no error, or `last`
+ *          and `std::errc::value_too_large` if buffer is too small.
+ */
+template <typename ColorT>
+std::to_chars_result format_to(char *first, char *last, const ColorT& color,
+                               SchemeEnum default_scheme = SchemeEnum::X11)
+  noexcept
+{
+  detail::ColorWriter writer{ first, last };
+  detail::write_color(writer, color, default_scheme);
+
+  return writer.result();
+}
+
+}  // namespace gviz::colors
+
+#endif  // GVIZARD_COLORS_FORMAT_HPP_
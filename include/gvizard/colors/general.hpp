@@ -7,9 +7,279 @@
 
 namespace gviz::colors {
 
-enum class SchemeEnum : uint8_t {
+/** color schemes of the `colorscheme` attribute, X11 and SVG name their
+ *  colors, brewer schemes (from "accent3" to "ylorrd9") number them.
+ *
+ * @see BrewerColor
+ */
+enum class SchemeEnum : uint16_t {
   X11,
-  SVG
+  SVG,
+  accent3,
+  accent4,
+  accent5,
+  accent6,
+  accent7,
+  accent8,
+  blues3,
+  blues4,
+  blues5,
+  blues6,
+  blues7,
+  blues8,
+  blues9,
+  brbg3,
+  brbg4,
+  brbg5,
+  brbg6,
+  brbg7,
+  brbg8,
+  brbg9,
+  brbg10,
+  brbg11,
+  bugn3,
+  bugn4,
+  bugn5,
+  bugn6,
+  bugn7,
+  bugn8,
+  bugn9,
+  bupu3,
+  bupu4,
+  bupu5,
+  bupu6,
+  bupu7,
+  bupu8,
+  bupu9,
+  dark23,
+  dark24,
+  dark25,
+  dark26,
+  dark27,
+  dark28,
+  gnbu3,
+  gnbu4,
+  gnbu5,
+  gnbu6,
+  gnbu7,
+  gnbu8,
+  gnbu9,
+  greens3,
+  greens4,
+  greens5,
+  greens6,
+  greens7,
+  greens8,
+  greens9,
+  greys3,
+  greys4,
+  greys5,
+  greys6,
+  greys7,
+  greys8,
+  greys9,
+  oranges3,
+  oranges4,
+  oranges5,
+  oranges6,
+  oranges7,
+  oranges8,
+  oranges9,
+  orrd3,
+  orrd4,
+  orrd5,
+  orrd6,
+  orrd7,
+  orrd8,
+  orrd9,
+  paired3,
+  paired4,
+  paired5,
+  paired6,
+  paired7,
+  paired8,
+  paired9,
+  paired10,
+  paired11,
+  paired12,
+  pastel13,
+  pastel14,
+  pastel15,
+  pastel16,
+  pastel17,
+  pastel18,
+  pastel19,
+  pastel23,
+  pastel24,
+  pastel25,
+  pastel26,
+  pastel27,
+  pastel28,
+  piyg3,
+  piyg4,
+  piyg5,
+  piyg6,
+  piyg7,
+  piyg8,
+  piyg9,
+  piyg10,
+  piyg11,
+  prgn3,
+  prgn4,
+  prgn5,
+  prgn6,
+  prgn7,
+  prgn8,
+  prgn9,
+  prgn10,
+  prgn11,
+  pubu3,
+  pubu4,
+  pubu5,
+  pubu6,
+  pubu7,
+  pubu8,
+  pubu9,
+  pubugn3,
+  pubugn4,
+  pubugn5,
+  pubugn6,
+  pubugn7,
+  pubugn8,
+  pubugn9,
+  puor3,
+  puor4,
+  puor5,
+  puor6,
+  puor7,
+  puor8,
+  puor9,
+  puor10,
+  puor11,
+  purd3,
+  purd4,
+  purd5,
+  purd6,
+  purd7,
+  purd8,
+  purd9,
+  purples3,
+  purples4,
+  purples5,
+  purples6,
+  purples7,
+  purples8,
+  purples9,
+  rdbu3,
+  rdbu4,
+  rdbu5,
+  rdbu6,
+  rdbu7,
+  rdbu8,
+  rdbu9,
+  rdbu10,
+  rdbu11,
+  rdgy3,
+  rdgy4,
+  rdgy5,
+  rdgy6,
+  rdgy7,
+  rdgy8,
+  rdgy9,
+  rdgy10,
+  rdgy11,
+  rdpu3,
+  rdpu4,
+  rdpu5,
+  rdpu6,
+  rdpu7,
+  rdpu8,
+  rdpu9,
+  rdylbu3,
+  rdylbu4,
+  rdylbu5,
+  rdylbu6,
+  rdylbu7,
+  rdylbu8,
+  rdylbu9,
+  rdylbu10,
+  rdylbu11,
+  rdylgn3,
+  rdylgn4,
+  rdylgn5,
+  rdylgn6,
+  rdylgn7,
+  rdylgn8,
+  rdylgn9,
+  rdylgn10,
+  rdylgn11,
+  reds3,
+  reds4,
+  reds5,
+  reds6,
+  reds7,
+  reds8,
+  reds9,
+  set13,
+  set14,
+  set15,
+  set16,
+  set17,
+  set18,
+  set19,
+  set23,
+  set24,
+  set25,
+  set26,
+  set27,
+  set28,
+  set33,
+  set34,
+  set35,
+  set36,
+  set37,
+  set38,
+  set39,
+  set310,
+  set311,
+  set312,
+  spectral3,
+  spectral4,
+  spectral5,
+  spectral6,
+  spectral7,
+  spectral8,
+  spectral9,
+  spectral10,
+  spectral11,
+  ylgn3,
+  ylgn4,
+  ylgn5,
+  ylgn6,
+  ylgn7,
+  ylgn8,
+  ylgn9,
+  ylgnbu3,
+  ylgnbu4,
+  ylgnbu5,
+  ylgnbu6,
+  ylgnbu7,
+  ylgnbu8,
+  ylgnbu9,
+  ylorbr3,
+  ylorbr4,
+  ylorbr5,
+  ylorbr6,
+  ylorbr7,
+  ylorbr8,
+  ylorbr9,
+  ylorrd3,
+  ylorrd4,
+  ylorrd5,
+  ylorrd6,
+  ylorrd7,
+  ylorrd8,
+  ylorrd9
 };
 
 template <typename ColorT>
@@ -54,7 +324,8 @@ class WeightedColor final {
       throw std::invalid_argument("given weight is out of range. (0, 1)");
   }
 
-  constexpr double get_color() const noexcept(noexcept(color_type(color_)))
+  constexpr color_type get_color() const
+    noexcept(noexcept(color_type(color_)))
   {
     return color_;
   }
@@ -64,6 +335,7 @@ class WeightedColor final {
   constexpr WeightedColor& set_color(const color_type& color)
   {
     color_ = color;
+    return *this;
   }
 
   constexpr WeightedColor& set_weight(double weight)
@@ -72,6 +344,7 @@ class WeightedColor final {
       throw std::invalid_argument("given weight is out of range. (0, 1)");
 
     weight_ = weight;
+    return *this;
   }
 
   constexpr bool operator==(const WeightedColor& other) const noexcept
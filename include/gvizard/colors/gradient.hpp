@@ -0,0 +1,271 @@
+#ifndef GVIZARD_COLORS_GRADIENT_HPP_
+#define GVIZARD_COLORS_GRADIENT_HPP_
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+
+#include "gvizard/utils.hpp"
+#include "gvizard/simd/vec.hpp"
+
+#include "gvizard/colors/batch.hpp"
+#include "gvizard/colors/converter.hpp"
+#include "gvizard/colors/hsv.hpp"
+#include "gvizard/colors/rgba.hpp"
+
+namespace gviz::colors {
+
+/** color space in which a `Gradient` interpolates between its colors. */
+enum class GradientSpace : uint8_t {
+  RGB,
+  HSV  // hue takes the shorter way around the color wheel
+};
+
+/** evaluates a list of weighted colors (see `attrtypes::ColorList`),
+ *  either as bands (for striped and wedged styles) or as a gradient.
+ *
+ * each color gets a band of its weight's share of [0, 1], colors of
+ * zero weight share whatever the others leave, as in graphviz.
+ * as a gradient, each color is placed at the middle of its band, those
+ * positions stretched so that the first color is at 0 and the last at 1,
+ * so evenly weighted colors are evenly spaced.
+ *
+ * colors are sampled as RGBA in `RGBA::to_binary` layout, see `PackedColor`.
+ */
+class Gradient final {
+  using f32v = batch::detail::f32v;
+  using i32v = batch::detail::i32v;
+
+  constexpr static std::size_t lanes = batch::detail::lanes;
+
+  // RGB: r, g, b, a as octets, HSV: h, s, v within [0, 1] and a as octet.
+  using channels_t = std::array<float, 4>;
+
+  std::vector<float>      bounds_{};     // cumulative weights, one more
+  std::vector<float>      positions_{};  // of each color, within [0, 1]
+  std::vector<channels_t> channels_{};
+  GradientSpace           space_;
+
+  static channels_t channels_of(const RGBA& rgba, GradientSpace space)
+  {
+    if (space == GradientSpace::HSV) {
+      const auto hsv = utils::Converter<RGBA, HSV>::convert(rgba);
+      return { float(hsv.hue()), float(hsv.saturation()),
+               float(hsv.value()), float(rgba.a) };
+    }
+
+    return { float(rgba.r), float(rgba.g), float(rgba.b), float(rgba.a) };
+  }
+
+  /** shades lanes of `pos`, which all are between the colors `seg`
+   *  and `seg + 1`, to packed RGBA.
+   */
+  i32v shade(const f32v& pos, std::size_t seg) const noexcept
+  {
+    const std::size_t next = seg + 1 < channels_.size() ? seg + 1 : seg;
+
+    const float span = positions_[next] - positions_[seg];
+    const f32v  u    = (pos - f32v::broadcast(positions_[seg]))
+                     * f32v::broadcast(span > 0.f ? 1.f / span : 0.f);
+
+    const auto& lo = channels_[seg];
+    const auto& hi = channels_[next];
+
+    const auto lerp = [&](std::size_t channel, float delta) {
+      return f32v::broadcast(lo[channel]) + u * f32v::broadcast(delta);
+    };
+
+    const f32v half = f32v::broadcast(.5f);
+    const i32v alpha = (lerp(3, hi[3] - lo[3]) + half).as<int32_t>();
+
+    i32v r, g, b;
+
+    if (space_ == GradientSpace::HSV) {
+      float hue_delta = hi[0] - lo[0];
+      hue_delta -= hue_delta >  .5f ? 1.f : 0.f;
+      hue_delta += hue_delta < -.5f ? 1.f : 0.f;
+
+      // masks are -1 where set, which wraps hue back into [0, 1).
+      const f32v zero = f32v::broadcast(0.f);
+      const f32v one  = f32v::broadcast(1.f);
+      f32v hue = lerp(0, hue_delta);
+      hue = hue - (hue < zero).as<float>() + (~(hue < one)).as<float>();
+
+      const f32v scale = f32v::broadcast(255.f);
+      const i32v h = (hue * scale).as<int32_t>();
+      const i32v s = (lerp(1, hi[1] - lo[1]) * scale).as<int32_t>();
+      const i32v v = (lerp(2, hi[2] - lo[2]) * scale).as<int32_t>();
+
+      const auto rgb = batch::detail::hsv_octets_to_rgb(
+          h, s, v, s == batch::detail::splat(0));
+
+      r = rgb.r;
+      g = rgb.g;
+      b = rgb.b;
+    }
+    else {
+      r = (lerp(0, hi[0] - lo[0]) + half).as<int32_t>();
+      g = (lerp(1, hi[1] - lo[1]) + half).as<int32_t>();
+      b = (lerp(2, hi[2] - lo[2]) + half).as<int32_t>();
+    }
+
+    return (alpha << 24) | (r << 16) | (g << 8) | b;
+  }
+
+ public:
+  /** precomputes bands and gradient stops of `list`.
+   *
+   * @param list  range of `WeightedColor`s of any color kind.
+   * @param space color space to interpolate in.
+   * @throws std::invalid_argument if list is empty.
+   */
+  template <typename ListT>
+  explicit Gradient(const ListT& list,
+                    GradientSpace space = GradientSpace::RGB)
+    : space_(space)
+  {
+    if (std::begin(list) == std::end(list))
+      throw std::invalid_argument("gradient of empty color list");
+
+    double      given     = 0.;
+    std::size_t unweighed = 0;
+
+    for (const auto& color : list) {
+      using color_type =
+        typename std::decay_t<decltype(color)>::color_type;
+
+      given     += color.get_weight();
+      unweighed += color.get_weight() == 0.;
+
+      channels_.push_back(channels_of(
+        utils::Converter<color_type, RGBA>::convert(color.get_color()),
+        space));
+    }
+
+    const double share = unweighed != 0 && given < 1.
+                       ? (1. - given) / double(unweighed)
+                       : 0.;
+    const double total = given + share * double(unweighed);
+
+    // computed in double, so positions of even weights are exact floats.
+    std::vector<double> bounds{ 0. };
+
+    for (const auto& color : list) {
+      const double weight =
+        color.get_weight() == 0. ? share : color.get_weight();
+
+      bounds.push_back(bounds.back()
+        + (total > 0. ? weight / total : 1. / double(channels_.size())));
+    }
+
+    bounds.back() = 1.;
+
+    const auto center = [&](std::size_t idx) {
+      return (bounds[idx] + bounds[idx + 1]) / 2.;
+    };
+
+    const double first = center(0);
+    const double range = center(channels_.size() - 1) - first;
+
+    for (std::size_t i = 0; i < channels_.size(); ++i) {
+      bounds_.push_back(float(bounds[i]));
+      positions_.push_back(
+        range > 0. ? float((center(i) - first) / range) : 0.f);
+    }
+
+    bounds_.push_back(1.f);
+    positions_.back() = channels_.size() > 1 ? 1.f : 0.f;
+  }
+
+  std::size_t size() const noexcept { return channels_.size(); }
+
+  GradientSpace get_space() const noexcept { return space_; }
+
+  /** position of color `index` within [0, 1] as gradient stop. */
+  float stop_position(std::size_t index) const noexcept
+  {
+    return positions_[index];
+  }
+
+  /** index of the color whose band covers `pos` of [0, 1]. */
+  std::size_t band_at(float pos) const noexcept
+  {
+    const auto it = std::upper_bound(bounds_.begin() + 1, bounds_.end() - 1,
+                                     pos);
+    return std::size_t(it - (bounds_.begin() + 1));
+  }
+
+  /** gradient's color at `pos` of [0, 1], as packed RGBA. */
+  uint32_t at(float pos) const noexcept
+  {
+    pos = std::clamp(pos, 0.f, 1.f);
+
+    const auto it = std::upper_bound(positions_.begin() + 1,
+                                     positions_.end() - (size() > 1), pos);
+    const auto seg = std::size_t(it - positions_.begin()) - 1;
+
+    return uint32_t(shade(f32v::broadcast(pos), seg)[0]);
+  }
+
+  /** samples gradient at `count` evenly spaced positions from 0 to 1,
+   *  several of them at a time using SIMD lanes.
+   *
+   * results are identical to those of `at(i / float(count - 1))`.
+   *
+   * @param count count of samples.
+   * @param out   buffer of at least `count` packed RGBA colors.
+   */
+  void sample(std::size_t count, uint32_t *out) const noexcept
+  {
+    if (count == 0)
+      return;
+
+    // a single sample is taken at 0.
+    const float denom = count > 1 ? float(count - 1) : 1.f;
+
+    const auto position = [&](std::size_t idx) {
+      return float(idx) / denom;
+    };
+
+    std::size_t idx = 0;
+    const std::size_t last_seg = size() > 1 ? size() - 2 : 0;
+
+    for (std::size_t seg = 0; seg <= last_seg; ++seg) {
+      // samples up to the segment's end, found as `at` would.
+      std::size_t end = count;
+      if (seg != last_seg) {
+        const float bound = positions_[seg + 1];
+
+        end = std::min(count, std::size_t(bound * denom));
+        while (end > idx && position(end - 1) >= bound)
+          --end;
+        while (end < count && position(end) < bound)
+          ++end;
+      }
+
+      for (; idx < end; idx += lanes) {
+        const f32v pos =
+          f32v::generate([&](std::size_t lane) { return float(idx + lane); })
+          / f32v::broadcast(denom);
+
+        const i32v packed = shade(pos, seg);
+
+        const std::size_t todo = std::min(lanes, end - idx);
+        for (std::size_t lane = 0; lane < todo; ++lane)
+          out[idx + lane] = uint32_t(packed[lane]);
+
+        if (todo < lanes) {
+          idx += todo;
+          break;
+        }
+      }
+    }
+  }
+};
+
+}  // namespace gviz::colors
+
+#endif  // GVIZARD_COLORS_GRADIENT_HPP_
@@ -0,0 +1,337 @@
+#ifndef GVIZARD_COLORS_NAMES_HPP_
+#define GVIZARD_COLORS_NAMES_HPP_
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <optional>
+#include <string_view>
+
+#include "gvizard/strings/hash.hpp"
+
+#include "gvizard/colors/brewer.hpp"
+#include "gvizard/colors/general.hpp"
+#include "gvizard/colors/rgb.hpp"
+#include "gvizard/colors/svg.hpp"
+#include "gvizard/colors/x11.hpp"
+
+namespace gviz::colors {
+
+namespace detail {
+
+constexpr char ascii_lower(char chr) noexcept
+{
+  return ('A' <= chr && chr <= 'Z') ? char(chr - 'A' + 'a') : chr;
+}
+
+constexpr bool iequals(std::string_view lhs, std::string_view rhs) noexcept
+{
+  if (lhs.size() != rhs.size())
+    return false;
+
+  for (std::size_t i = 0; i < lhs.size(); ++i)
+    if (ascii_lower(lhs[i]) != ascii_lower(rhs[i]))
+      return false;
+
+  return true;
+}
+
+/** a minimal perfect hash of a static table's names, built at compile time
+ *  using hash-and-displace.
+ *
+ * names are first hashed into `BucketsV` buckets, then each bucket
+ * (largest first) is given a seed which places all of its names into
+ * free slots of a `SlotsV`-sized table. a lookup hashes the name once,
+ * remixes the hash by its bucket's seed, and compares a single name.
+ *
+ * names are matched case-insensitively.
+ */
+template <std::size_t SlotsV, std::size_t BucketsV>
+class NamePerfectHash final {
+  static_assert((SlotsV & (SlotsV - 1)) == 0, "SlotsV must be power of two");
+  static_assert((BucketsV & (BucketsV - 1)) == 0,
+                "BucketsV must be power of two");
+
+ public:
+  constexpr static uint16_t empty_slot = 0xffff;
+
+ private:
+  std::array<uint16_t, BucketsV> seeds_{};
+  std::array<uint16_t, SlotsV>   slots_{};
+
+  constexpr static std::size_t bucket_of(uint64_t hash) noexcept
+  {
+    return std::size_t(hash) & (BucketsV - 1);
+  }
+
+  // names are hashed once, the seed only remixes that hash.
+  constexpr static std::size_t slot_of(uint64_t hash, uint16_t seed) noexcept
+  {
+    hash ^= (uint64_t(seed) + 1) * 0x9e3779b97f4a7c15ull;
+    hash ^= hash >> 33;
+    hash *= 0xff51afd7ed558ccdull;
+    hash ^= hash >> 33;
+
+    return std::size_t(hash) & (SlotsV - 1);
+  }
+
+ public:
+  /** builds hash of `count` names given by `names(index)`.
+   *
+   * construction fails (at compile time if used in a constant expression)
+   * if there are more names than slots or no seed fits a bucket.
+   */
+  template <typename NameF>
+  constexpr NamePerfectHash(std::size_t count, NameF names)
+  {
+    for (auto& slot : slots_)
+      slot = empty_slot;
+
+    if (count > SlotsV || count >= empty_slot)
+      throw "too many names for NamePerfectHash";
+
+    std::array<uint64_t, SlotsV> hashes{};
+    for (std::size_t i = 0; i < count; ++i)
+      hashes[i] = strings::fnv1a_icase(names(i));
+
+    // count of names of each bucket.
+    std::array<uint16_t, BucketsV> sizes{};
+    std::size_t max_size = 0;
+    for (std::size_t i = 0; i < count; ++i) {
+      auto& size = sizes[bucket_of(hashes[i])];
+      ++size;
+      max_size = size > max_size ? size : max_size;
+    }
+
+    // place buckets, largest first, as those are hardest to place.
+    std::array<uint16_t, SlotsV> placed{};
+    for (std::size_t size = max_size; size > 0; --size) {
+      for (std::size_t bucket = 0; bucket < BucketsV; ++bucket) {
+        if (sizes[bucket] != size)
+          continue;
+
+        for (uint16_t seed = 0; ; ++seed) {
+          if (seed == empty_slot)
+            throw "no seed found for NamePerfectHash bucket";
+
+          std::size_t placed_count = 0;
+          bool fits = true;
+
+          for (std::size_t i = 0; i < count && fits; ++i) {
+            if (bucket_of(hashes[i]) != bucket)
+              continue;
+
+            const auto slot = slot_of(hashes[i], seed);
+            if (slots_[slot] != empty_slot)
+              fits = false;
+
+            // names of this bucket must not collide with each other.
+            for (std::size_t j = 0; j < placed_count && fits; ++j)
+              if (placed[j] == slot)
+                fits = false;
+
+            placed[placed_count++] = uint16_t(slot);
+          }
+
+          if (!fits)
+            continue;
+
+          seeds_[bucket] = seed;
+          for (std::size_t i = 0; i < count; ++i)
+            if (bucket_of(hashes[i]) == bucket)
+              slots_[slot_of(hashes[i], seed)] = uint16_t(i);
+
+          break;
+        }
+      }
+    }
+  }
+
+  /** index of the name which `name` would be if it was in table.
+   *
+   * @returns an index which must be compared against table's name,
+   *          or `empty_slot` if `name` certainly isn't in table.
+   */
+  constexpr uint16_t candidate(std::string_view name) const noexcept
+  {
+    const auto hash = strings::fnv1a_icase(name);
+    return slots_[slot_of(hash, seeds_[bucket_of(hash)])];
+  }
+};
+
+template <typename EnumT, std::size_t SlotsV, std::size_t BucketsV,
+          std::size_t SizeV>
+constexpr auto find_in_scheme(
+    const NamePerfectHash<SlotsV, BucketsV>& hash,
+    const SchemeColor<RGB> (&list)[SizeV],
+    std::string_view name) noexcept -> std::optional<EnumT>
+{
+  const auto idx = hash.candidate(name);
+  if (idx >= SizeV || !iequals(list[idx].name, name))
+    return std::nullopt;
+
+  return EnumT(idx);
+}
+
+constexpr auto x11_name_hash = NamePerfectHash<1024, 256>(
+  std::size(X11Color::list),
+  [](std::size_t idx) { return std::string_view(X11Color::list[idx].name); }
+);
+
+constexpr auto svg_name_hash = NamePerfectHash<256, 64>(
+  std::size(SVGColor::list),
+  [](std::size_t idx) { return std::string_view(SVGColor::list[idx].name); }
+);
+
+constexpr auto brewer_scheme_hash = NamePerfectHash<512, 128>(
+  std::size(BrewerColor::schemes),
+  [](std::size_t idx) {
+    return std::string_view(BrewerColor::schemes[idx].name);
+  }
+);
+
+/** parses a brewer color's name, its index within scheme. */
+constexpr std::size_t parse_index(std::string_view name) noexcept
+{
+  if (name.empty() || name.size() > 2)
+    return 0;
+
+  std::size_t index = 0;
+  for (const auto chr : name) {
+    if (chr < '0' || '9' < chr)
+      return 0;
+
+    index = index * 10 + std::size_t(chr - '0');
+  }
+
+  return index;
+}
+
+}  // namespace detail
+
+/** looks up an X11 color by its name, case-insensitively, in O(1).
+ *
+ * @param name color's name without scheme, e.g. "LightGoldenrodYellow".
+ * @returns an optional containing color's enum if name is known,
+ *          otherwise std::nullopt.
+ */
+constexpr auto find_x11_color(std::string_view name) noexcept
+  -> std::optional<X11ColorEnum>
+{
+  return detail::find_in_scheme<X11ColorEnum>(
+      detail::x11_name_hash, X11Color::list, name);
+}
+
+/** looks up an SVG color by its name, case-insensitively, in O(1).
+ *
+ * @param name color's name without scheme, e.g. "aliceblue".
+ * @returns an optional containing color's enum if name is known,
+ *          otherwise std::nullopt.
+ */
+constexpr auto find_svg_color(std::string_view name) noexcept
+  -> std::optional<SVGColorEnum>
+{
+  return detail::find_in_scheme<SVGColorEnum>(
+      detail::svg_name_hash, SVGColor::list, name);
+}
+
+/** looks up a named color of given scheme, colors of brewer schemes
+ *  are named by their 1-based index, e.g. "3".
+ *
+ * @returns an optional containing the color of the scheme's table if
+ *          name is known, otherwise std::nullopt.
+ */
+constexpr auto find_named_color(std::string_view name,
+                                SchemeEnum scheme) noexcept
+  -> std::optional<SchemeColor<RGB>>
+{
+  if (scheme == SchemeEnum::X11) {
+    if (auto color = find_x11_color(name))
+      return X11Color::list[uint16_t(*color)];
+  }
+  else if (scheme == SchemeEnum::SVG) {
+    if (auto color = find_svg_color(name))
+      return SVGColor::list[uint16_t(*color)];
+  }
+  else {
+    return BrewerColor::find(scheme, detail::parse_index(name));
+  }
+
+  return std::nullopt;
+}
+
+/** name of a color scheme as used by `colorscheme` attribute,
+ *  e.g. "x11" or "blues9".
+ */
+constexpr std::string_view scheme_name(SchemeEnum scheme) noexcept
+{
+  if (scheme == SchemeEnum::X11)
+    return "x11";
+
+  if (scheme == SchemeEnum::SVG)
+    return "svg";
+
+  if (const auto *info = BrewerColor::get_scheme_info(scheme))
+    return info->name;
+
+  return std::string_view{};
+}
+
+/** parses a color scheme's name as used by `colorscheme` attribute
+ *  and in "/scheme/name" colors, an empty name means X11.
+ *
+ * @returns an optional containing scheme if it is known,
+ *          otherwise std::nullopt.
+ */
+constexpr auto parse_scheme(std::string_view scheme) noexcept
+  -> std::optional<SchemeEnum>
+{
+  if (scheme.empty() || detail::iequals(scheme, "x11"))
+    return SchemeEnum::X11;
+
+  if (detail::iequals(scheme, "svg"))
+    return SchemeEnum::SVG;
+
+  const auto idx = detail::brewer_scheme_hash.candidate(scheme);
+  if (idx < std::size(BrewerColor::schemes)
+      && detail::iequals(BrewerColor::schemes[idx].name, scheme))
+    return SchemeEnum(uint16_t(first_brewer_scheme) + idx);
+
+  return std::nullopt;
+}
+
+/** resolves a color name the way graphviz does.
+ *
+ * "name" is looked up in `default_scheme`, while "/scheme/name"
+ * (or "//name" for X11) names its scheme explicitly.
+ *
+ * @param color          color's name, optionally prefixed by its scheme.
+ * @param default_scheme scheme of names without a scheme prefix,
+ *                       i.e. the current `colorscheme`.
+ * @returns an optional containing the named color if both scheme and
+ *          name are known, otherwise std::nullopt.
+ */
+constexpr auto resolve_color_name(std::string_view color,
+                                  SchemeEnum default_scheme = SchemeEnum::X11)
+  noexcept -> std::optional<SchemeColor<RGB>>
+{
+  if (color.empty() || color.front() != '/')
+    return find_named_color(color, default_scheme);
+
+  color.remove_prefix(1);
+
+  const auto sep = color.find('/');
+  if (sep == std::string_view::npos)
+    return find_named_color(color, default_scheme);
+
+  const auto scheme = parse_scheme(color.substr(0, sep));
+  if (!scheme)
+    return std::nullopt;
+
+  return find_named_color(color.substr(sep + 1), *scheme);
+}
+
+}  // namespace gviz::colors
+
+#endif  // GVIZARD_COLORS_NAMES_HPP_
@@ -0,0 +1,241 @@
+#ifndef GVIZARD_COLORS_NEAREST_HPP_
+#define GVIZARD_COLORS_NEAREST_HPP_
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+
+#include "gvizard/colors/brewer.hpp"
+#include "gvizard/colors/general.hpp"
+#include "gvizard/colors/rgb.hpp"
+#include "gvizard/colors/svg.hpp"
+#include "gvizard/colors/x11.hpp"
+
+namespace gviz::colors {
+
+/** cheap perceptual distance between two colors, a squared euclidean
+ *  distance whose channels are weighted 2:4:3 by how sensitive the eye
+ *  is to them.
+ */
+constexpr int32_t color_distance(const RGB& lhs, const RGB& rhs) noexcept
+{
+  const int32_t dr = int32_t(lhs.r) - rhs.r;
+  const int32_t dg = int32_t(lhs.g) - rhs.g;
+  const int32_t db = int32_t(lhs.b) - rhs.b;
+
+  return 2 * dr * dr + 4 * dg * dg + 3 * db * db;
+}
+
+namespace detail {
+
+constexpr int32_t channel_weights[3] = { 2, 4, 3 };
+
+/** a static k-d tree of a scheme's table, built at compile time.
+ *
+ * points are stored in one array, the median of each subrange being its
+ * node which splits the rest by the channel they spread most along, so
+ * no links are needed. small subranges are left unsplit.
+ */
+template <std::size_t SizeV>
+class ColorKdTree final {
+  struct Point {
+    uint8_t  channels[3];
+    uint16_t index;
+  };
+
+  // ranges this small are scanned rather than split further.
+  constexpr static std::size_t leaf_size = 8;
+
+  std::array<Point, SizeV>   points_{};
+  std::array<uint8_t, SizeV> axes_{};  // split channel of each node
+
+  constexpr void sort(std::size_t lo, std::size_t hi, std::size_t axis)
+  {
+    // insertion sort, stable so equal colors keep their table order.
+    for (std::size_t i = lo + 1; i < hi; ++i) {
+      const Point point = points_[i];
+      std::size_t j = i;
+
+      for (; j > lo && points_[j - 1].channels[axis] > point.channels[axis];
+           --j)
+        points_[j] = points_[j - 1];
+
+      points_[j] = point;
+    }
+  }
+
+  // channel with the widest weighted spread within [lo, hi).
+  constexpr std::size_t widest_axis(std::size_t lo, std::size_t hi) const
+  {
+    std::size_t axis = 0;
+    int32_t     widest = -1;
+
+    for (std::size_t i = 0; i < 3; ++i) {
+      int32_t min = 255, max = 0;
+      for (std::size_t j = lo; j < hi; ++j) {
+        min = points_[j].channels[i] < min ? points_[j].channels[i] : min;
+        max = points_[j].channels[i] > max ? points_[j].channels[i] : max;
+      }
+
+      const int32_t spread = channel_weights[i] * (max - min) * (max - min);
+      if (spread > widest) {
+        axis   = i;
+        widest = spread;
+      }
+    }
+
+    return axis;
+  }
+
+  constexpr void build(std::size_t lo, std::size_t hi)
+  {
+    if (hi - lo <= leaf_size)
+      return;
+
+    const std::size_t mid = lo + (hi - lo) / 2;
+
+    axes_[mid] = uint8_t(widest_axis(lo, hi));
+    sort(lo, hi, axes_[mid]);
+
+    build(lo, mid);
+    build(mid + 1, hi);
+  }
+
+  struct Best {
+    int32_t  distance;
+    uint16_t index;
+  };
+
+  constexpr void visit(const uint8_t (&query)[3], const Point& point,
+                       Best& best) const noexcept
+  {
+    int32_t distance = 0;
+    for (std::size_t i = 0; i < 3; ++i) {
+      const int32_t diff = int32_t(query[i]) - point.channels[i];
+      distance += channel_weights[i] * diff * diff;
+    }
+
+    // of equally near colors, the first of table wins.
+    if (distance < best.distance
+        || (distance == best.distance && point.index < best.index))
+      best = Best{ distance, point.index };
+  }
+
+  /** searches [lo, hi), whose bounding box is at least `box_distance`
+   *  away from query, `offsets` being query's distance to it per axis.
+   */
+  constexpr void search(const uint8_t (&query)[3], std::size_t lo,
+                        std::size_t hi, int32_t box_distance,
+                        int32_t (&offsets)[3],
+                        Best& best) const noexcept
+  {
+    if (hi - lo <= leaf_size) {
+      for (std::size_t i = lo; i < hi; ++i)
+        visit(query, points_[i], best);
+      return;
+    }
+
+    const std::size_t mid  = lo + (hi - lo) / 2;
+    const std::size_t axis = axes_[mid];
+
+    visit(query, points_[mid], best);
+
+    const int32_t diff  = int32_t(query[axis]) - points_[mid].channels[axis];
+    const bool    lower = diff < 0;
+
+    search(query, lower ? lo : mid + 1, lower ? mid : hi, box_distance,
+           offsets, best);
+
+    // the far side's box is the near one's, moved up to the split plane.
+    const int32_t old_offset = offsets[axis];
+    const int32_t far_distance = box_distance
+      + channel_weights[axis] * (diff * diff - old_offset * old_offset);
+
+    if (far_distance > best.distance)
+      return;
+
+    offsets[axis] = diff;
+    search(query, lower ? mid + 1 : lo, lower ? hi : mid, far_distance,
+           offsets, best);
+    offsets[axis] = old_offset;
+  }
+
+ public:
+  constexpr explicit ColorKdTree(const SchemeColor<RGB> (&list)[SizeV])
+  {
+    for (std::size_t i = 0; i < SizeV; ++i)
+      points_[i] = Point{ { list[i].color.r, list[i].color.g,
+                            list[i].color.b },
+                          uint16_t(i) };
+
+    build(0, SizeV);
+  }
+
+  /** index of table's color nearest to `color` by `color_distance`. */
+  constexpr uint16_t nearest(const RGB& color) const noexcept
+  {
+    const uint8_t query[3] = { color.r, color.g, color.b };
+
+    Best best{ INT32_MAX, UINT16_MAX };
+    int32_t offsets[3] = {};
+    search(query, 0, SizeV, 0, offsets, best);
+
+    return best.index;
+  }
+};
+
+template <std::size_t SizeV>
+ColorKdTree(const SchemeColor<RGB> (&)[SizeV]) -> ColorKdTree<SizeV>;
+
+constexpr auto x11_color_tree = ColorKdTree(X11Color::list);
+constexpr auto svg_color_tree = ColorKdTree(SVGColor::list);
+
+}  // namespace detail
+
+/** named color of `scheme` nearest to `color` by `color_distance`,
+ *  for reducing arbitrary colors to a palette of names.
+ *
+ * a k-d tree of X11 and SVG is built at compile time, so a lookup only
+ * visits a few dozen of the table's colors. of several equally near
+ * colors (e.g. "gray" and "grey"), the first of table is returned.
+ */
+constexpr SchemeColor<RGB> nearest_named(const RGB& color,
+                                         SchemeEnum scheme) noexcept
+{
+  if (scheme == SchemeEnum::SVG)
+    return SVGColor::list[detail::svg_color_tree.nearest(color)];
+
+  // brewer schemes have at most 12 colors, those are simply scanned.
+  if (const auto *info = BrewerColor::get_scheme_info(scheme)) {
+    const auto *first = BrewerColor::list + info->offset;
+    const auto *best  = first;
+
+    for (const auto *it = first + 1; it != first + info->size; ++it)
+      if (color_distance(color, it->color) < color_distance(color, best->color))
+        best = it;
+
+    return *best;
+  }
+
+  return X11Color::list[detail::x11_color_tree.nearest(color)];
+}
+
+/** reverse lookup of a color's name.
+ *
+ * @returns an optional containing the first named color of `scheme`
+ *          which is exactly `color`, otherwise std::nullopt.
+ */
+constexpr auto find_color_name(const RGB& color, SchemeEnum scheme) noexcept
+  -> std::optional<SchemeColor<RGB>>
+{
+  const auto named = nearest_named(color, scheme);
+  if (named.color != color)
+    return std::nullopt;
+
+  return named;
+}
+
+}  // namespace gviz::colors
+
+#endif  // GVIZARD_COLORS_NEAREST_HPP_
@@ -0,0 +1,317 @@
+#ifndef GVIZARD_COLORS_PACKED_HPP_
+#define GVIZARD_COLORS_PACKED_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string_view>
+#include <type_traits>
+#include <variant>
+
+#include "gvizard/utils.hpp"
+
+#include "gvizard/colors/brewer.hpp"
+#include "gvizard/colors/color.hpp"
+#include "gvizard/colors/converter.hpp"
+#include "gvizard/colors/general.hpp"
+#include "gvizard/colors/hsv.hpp"
+#include "gvizard/colors/names.hpp"
+#include "gvizard/colors/rgb.hpp"
+#include "gvizard/colors/rgba.hpp"
+#include "gvizard/colors/svg.hpp"
+#include "gvizard/colors/x11.hpp"
+
+namespace gviz::colors {
+
+namespace detail {
+
+template <typename T>
+struct is_scheme_color : std::false_type {};
+
+template <typename T>
+struct is_scheme_color<SchemeColor<T>> : std::true_type {};
+
+}  // namespace detail
+
+/** a color packed into a single 64-bit word.
+ *
+ * the low 32 bits hold the canonical RGBA value in `RGBA::to_binary`
+ * layout, the bits above them optionally tag a named color by its
+ * scheme and index (into the scheme's `list`, which holds all brewer
+ * schemes for `BrewerColor`), so the name can be written back out.
+ *
+ * unlike `Color`, which is a variant of many color kinds, comparing and
+ * hashing a PackedColor are integer operations.
+ * like `Color`, equality only considers the RGBA value, not the tag.
+ *
+ * layout: [63..48 scheme][47..32 index + 1][31..0 argb]
+ */
+class PackedColor final {
+  constexpr static int      index_shift  = 32;
+  constexpr static int      scheme_shift = 48;
+  constexpr static uint64_t rgba_mask    = 0xffffffffull;
+  constexpr static uint64_t index_mask   = 0xffffull;
+
+  uint64_t bits_ = 0xff000000ull;  // opaque black
+
+  constexpr static uint64_t tag(SchemeEnum scheme, uint16_t index) noexcept
+  {
+    return (uint64_t(scheme) << scheme_shift)
+         | (uint64_t(index + 1) << index_shift);
+  }
+
+ public:
+  constexpr PackedColor() noexcept = default;
+
+  constexpr PackedColor(RGBA color) noexcept : bits_(color.to_binary()) {}
+  constexpr PackedColor(RGB color) noexcept
+    : bits_(RGBA{ color.r, color.g, color.b }.to_binary())
+  {}
+
+  constexpr PackedColor(X11ColorEnum color) noexcept
+    : bits_(RGBA{ X11Color::list[uint16_t(color)].color.r,
+                  X11Color::list[uint16_t(color)].color.g,
+                  X11Color::list[uint16_t(color)].color.b }.to_binary()
+            | tag(SchemeEnum::X11, uint16_t(color)))
+  {}
+
+  constexpr PackedColor(SVGColorEnum color) noexcept
+    : bits_(RGBA{ SVGColor::list[uint16_t(color)].color.r,
+                  SVGColor::list[uint16_t(color)].color.g,
+                  SVGColor::list[uint16_t(color)].color.b }.to_binary()
+            | tag(SchemeEnum::SVG, uint16_t(color)))
+  {}
+
+  constexpr PackedColor(const BrewerColor& color) noexcept
+    : bits_(RGBA{ color.get_color().color.r,
+                  color.get_color().color.g,
+                  color.get_color().color.b }.to_binary()
+            | tag(color.get_scheme(),
+                  uint16_t(BrewerColor::get_scheme_info(color.get_scheme())
+                             ->offset + color.get_index() - 1)))
+  {}
+
+  constexpr PackedColor(const X11Color& color) noexcept
+    : PackedColor(color.get_enum())
+  {}
+
+  constexpr PackedColor(const SVGColor& color) noexcept
+    : PackedColor(color.get_enum())
+  {}
+
+  /** converts any color kind which `Color` can hold, named colors
+   *  (including `SchemeColor`s of a known name) keep their tag.
+   */
+  template <typename ColorT>
+  constexpr static PackedColor from(const ColorT& color)
+  {
+    // checked first, as SchemeColor converts implicitly to its color.
+    if constexpr (detail::is_scheme_color<ColorT>::value) {
+      const auto rgba =
+        PackedColor(utils::Converter<typename ColorT::color_type, RGBA>
+                      ::convert(color.color));
+
+      const auto named = color.name
+        ? find_named_color(color.name, color.scheme)
+        : std::nullopt;
+
+      if (!named)
+        return rgba;
+
+      // a name is only kept if it still names the same color.
+      const auto tagged =
+          color.scheme == SchemeEnum::X11
+        ? PackedColor(*find_x11_color(color.name))
+        : color.scheme == SchemeEnum::SVG
+        ? PackedColor(*find_svg_color(color.name))
+        : PackedColor(BrewerColor(color.scheme,
+                                  uint8_t(detail::parse_index(color.name))));
+
+      return tagged == rgba ? tagged : rgba;
+    }
+    else if constexpr (std::is_same_v<ColorT, PackedColor>
+                    || std::is_constructible_v<PackedColor, ColorT>) {
+      return PackedColor(color);
+    }
+    else if constexpr (std::is_same_v<ColorT, Color>) {
+      return std::visit(
+        [](const auto& alt) { return PackedColor::from(alt); }, color.color
+      );
+    }
+    else {
+      return PackedColor(utils::Converter<ColorT, RGBA>::convert(color));
+    }
+  }
+
+  constexpr static PackedColor from_bits(uint64_t bits) noexcept
+  {
+    PackedColor ret{};
+    ret.bits_ = bits;
+    return ret;
+  }
+
+  /** whole word, tag included. */
+  constexpr uint64_t bits() const noexcept { return bits_; }
+
+  /** the RGBA value in `RGBA::to_binary` layout. */
+  constexpr uint32_t rgba_bits() const noexcept
+  {
+    return uint32_t(bits_ & rgba_mask);
+  }
+
+  constexpr RGBA rgba() const noexcept { return RGBA::from_binary(rgba_bits()); }
+  constexpr RGB  rgb()  const noexcept { return RGB::from_binary(rgba_bits()); }
+
+  constexpr bool is_named() const noexcept
+  {
+    return ((bits_ >> index_shift) & index_mask) != 0;
+  }
+
+  /** scheme of the named color.
+   *
+   * @returns an optional containing scheme if color is named,
+   *          otherwise std::nullopt.
+   */
+  constexpr auto get_scheme() const noexcept -> std::optional<SchemeEnum>
+  {
+    if (!is_named())
+      return std::nullopt;
+
+    return SchemeEnum(uint16_t(bits_ >> scheme_shift));
+  }
+
+  constexpr auto get_x11_enum() const noexcept -> std::optional<X11ColorEnum>
+  {
+    if (get_scheme() != SchemeEnum::X11)
+      return std::nullopt;
+
+    return X11ColorEnum(uint16_t(((bits_ >> index_shift) & index_mask) - 1));
+  }
+
+  constexpr auto get_svg_enum() const noexcept -> std::optional<SVGColorEnum>
+  {
+    if (get_scheme() != SchemeEnum::SVG)
+      return std::nullopt;
+
+    return SVGColorEnum(uint16_t(((bits_ >> index_shift) & index_mask) - 1));
+  }
+
+  /** name of the named color, or an empty view if color isn't named.
+   *  colors of brewer schemes are named by their index, e.g. "3".
+   */
+  constexpr std::string_view get_name() const noexcept
+  {
+    if (const auto x11 = get_x11_enum())
+      return X11Color::list[uint16_t(*x11)].name;
+
+    if (const auto svg = get_svg_enum())
+      return SVGColor::list[uint16_t(*svg)].name;
+
+    if (is_named())
+      return BrewerColor::list[((bits_ >> index_shift) & index_mask) - 1].name;
+
+    return std::string_view{};
+  }
+
+  /** same color with the name tag dropped. */
+  constexpr PackedColor unnamed() const noexcept
+  {
+    return from_bits(bits_ & rgba_mask);
+  }
+
+  constexpr bool operator==(const PackedColor& other) const noexcept
+  {
+    return rgba_bits() == other.rgba_bits();
+  }
+
+  constexpr bool operator!=(const PackedColor& other) const noexcept
+  {
+    return rgba_bits() != other.rgba_bits();
+  }
+};
+
+/** hasher of PackedColor, consistent with its equality. */
+struct PackedColorHash final {
+  constexpr std::size_t operator()(const PackedColor& color) const noexcept
+  {
+    // spread the 32 bits over the whole word (murmur3's finalizer).
+    uint64_t hash = color.rgba_bits();
+    hash ^= hash >> 33;
+    hash *= 0xff51afd7ed558ccdull;
+    hash ^= hash >> 33;
+
+    return std::size_t(hash);
+  }
+};
+
+}  // namespace gviz::colors
+
+namespace gviz::utils {
+
+namespace detail {
+
+template <typename From>
+struct PackedColorConverter {
+  constexpr static auto convert(const From& color) -> colors::PackedColor
+  {
+    return colors::PackedColor::from(color);
+  }
+};
+
+}  // namespace detail
+
+// explicit specializations, as the generic converters of named colors
+// (and of Color) would drop the name tag.
+template <>
+struct Converter<colors::RGB, colors::PackedColor> final
+  : detail::PackedColorConverter<colors::RGB> {};
+
+template <>
+struct Converter<colors::RGBA, colors::PackedColor> final
+  : detail::PackedColorConverter<colors::RGBA> {};
+
+template <>
+struct Converter<colors::HSV, colors::PackedColor> final
+  : detail::PackedColorConverter<colors::HSV> {};
+
+template <>
+struct Converter<colors::X11Color, colors::PackedColor> final
+  : detail::PackedColorConverter<colors::X11Color> {};
+
+template <>
+struct Converter<colors::SVGColor, colors::PackedColor> final
+  : detail::PackedColorConverter<colors::SVGColor> {};
+
+template <>
+struct Converter<colors::X11ColorEnum, colors::PackedColor> final
+  : detail::PackedColorConverter<colors::X11ColorEnum> {};
+
+template <>
+struct Converter<colors::SVGColorEnum, colors::PackedColor> final
+  : detail::PackedColorConverter<colors::SVGColorEnum> {};
+
+template <>
+struct Converter<colors::BrewerColor, colors::PackedColor> final
+  : detail::PackedColorConverter<colors::BrewerColor> {};
+
+template <>
+struct Converter<colors::Color, colors::PackedColor> final
+  : detail::PackedColorConverter<colors::Color> {};
+
+template <typename To>
+struct Converter<colors::PackedColor, To,
+                 std::enable_if_t<!std::is_same_v<colors::PackedColor, To>>>
+  final
+{
+  constexpr static auto convert(const colors::PackedColor& color) -> To
+  {
+    if constexpr (std::is_same_v<To, colors::RGBA>)
+      return color.rgba();
+    else
+      return Converter<colors::RGBA, To>::convert(color.rgba());
+  }
+};
+
+}  // namespace gviz::utils
+
+#endif  // GVIZARD_COLORS_PACKED_HPP_
@@ -6,6 +6,7 @@
 #include <iterator>
 #include <memory>
 #include <optional>
+#include <string_view>
 #include <tuple>
 #include <type_traits>
 #include <unordered_map>
@@ -18,6 +19,8 @@
 #include <range/v3/view/take.hpp>
 
 #include "gvizard/utils.hpp"
+#include "gvizard/strings/name_map.hpp"
+#include "gvizard/strings/string_pool.hpp"
 
 #include "gvizard/graph/dynamic_square_matrix.hpp"
 #include "gvizard/graph/dynamic_half_square_matrix.hpp"
@@ -38,6 +41,13 @@ enum class EdgeDir  : unsigned int { in = 1, out = 2, inout = 3 };
  * ClusterId respectively for node, edge, cluster.
  * using a removed id results in undefined behavior.
  *
+ * strings interned by the graph live as long as the graph does, so
+ * attributes may hold `std::string_view`s to them instead of owning
+ * a `std::string` each.
+ *
+ * nodes may optionally be named, names are unique per graph and
+ * are indexed, so a node can be found by its name without allocating.
+ *
  * NOTE: use proxy methods to get/set/emplace/remove an entity's attribute
  *       instead of get_raw_registry.
  */
@@ -58,6 +68,7 @@ class Graph {
   struct NodeItem final {
     std::size_t              idx;
     std::optional<ClusterId> cluster_id = std::nullopt;
+    std::string_view         name{};  // interned, empty if unnamed.
   };
 
   struct EdgeItem final {
@@ -137,9 +148,11 @@ class Graph {
     >;
   using map_type = MapT<entity_type, Item>;
 
-  matrix_type   matrix_{};
-  map_type      entities_map_{};
-  registry_type registry_{};
+  matrix_type               matrix_{};
+  map_type                  entities_map_{};
+  registry_type             registry_{};
+  strings::StringPool       strings_{};
+  strings::NameMap<NodeId>  node_names_{};
 
   std::size_t nodes_count_    = 0;
   std::size_t edges_count_    = 0;
@@ -149,6 +162,77 @@ class Graph {
   auto&       get_raw_registry()       noexcept { return registry_; }
   const auto& get_raw_registry() const noexcept { return registry_; }
 
+  auto&       get_string_pool()       noexcept { return strings_; }
+  const auto& get_string_pool() const noexcept { return strings_; }
+
+  /** stores a copy of `str` in graph's string pool,
+   *  each distinct string is stored only once.
+   *
+   * @param str string to be interned.
+   * @returns a view to the pooled copy, valid as long as graph is.
+   */
+  std::string_view intern(std::string_view str)
+  {
+    return strings_.intern(str);
+  }
+
+  /** names a node, replacing its previous name if it had one.
+   *
+   * the name is interned in graph's string pool.
+   * an empty `name` removes node's name.
+   *
+   * @param node_id target node's id.
+   * @param name    new name of the node.
+   * @returns true if `node_id` is valid and `name` isn't taken by
+   *          another node, otherwise false.
+   */
+  bool set_node_name(NodeId node_id, std::string_view name)
+  {
+    auto node_iter = entities_map_.find(node_id);
+    if (node_iter == entities_map_.end() || !node_iter->second.is_node())
+      return false;
+
+    auto& node_item = node_iter->second.as_node();
+    if (node_item.name == name)
+      return true;
+
+    if (node_names_.contains(name))
+      return false;
+
+    node_names_.erase(node_item.name);
+
+    node_item.name = strings_.intern(name);
+    node_names_.insert(node_item.name, node_id);
+
+    return true;
+  }
+
+  /** retrieves name of given node.
+   *
+   * @param node_id target node's id.
+   * @returns an optional containing node's name if `node_id` is valid,
+   *          otherwise std::nullopt. name is empty if node is unnamed.
+   */
+  auto get_node_name(NodeId node_id) const -> std::optional<std::string_view>
+  {
+    auto node_iter = entities_map_.find(node_id);
+    if (node_iter == entities_map_.end() || !node_iter->second.is_node())
+      return std::nullopt;
+
+    return node_iter->second.as_node().name;
+  }
+
+  /** finds a node by its name, without allocating.
+   *
+   * @param name target node's name.
+   * @returns an optional containing NodeId if a node is named `name`,
+   *          otherwise std::nullopt.
+   */
+  auto find_node(std::string_view name) const -> std::optional<NodeId>
+  {
+    return node_names_.find(name);
+  }
+
   constexpr static bool is_directed() noexcept
   {
     return DirV == GraphDir::directed;
@@ -304,6 +388,22 @@ class Graph {
     return node_id;
   }
 
+  /** finds the node named `name`, or creates one with that name.
+   *
+   * @param name name of the node, must not be empty.
+   * @returns id of the found or created node.
+   */
+  auto get_or_create_node(std::string_view name) -> NodeId
+  {
+    if (auto node_id = find_node(name))
+      return *node_id;
+
+    auto node_id = create_node();
+    set_node_name(node_id, name);
+
+    return node_id;
+  }
+
   /** creates a node in the given cluster.
    *
    * @param cluster_id cluster's id to create node in.
@@ -540,6 +640,8 @@ class Graph {
       ++iter;
     }
 
+    node_names_.erase(node_item.name);
+
     registry_.destroy(node_id);
     entities_map_.erase(node_iter);
 
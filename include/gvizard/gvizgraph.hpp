@@ -1,6 +1,7 @@
 #ifndef GVIZARD_GVIZGRAPH_HPP_
 #define GVIZARD_GVIZGRAPH_HPP_
 
+#include <string_view>
 #include <utility>
 
 #include "gvizard/attrtypes/label.hpp"
@@ -44,6 +45,28 @@ struct GvizGraph {
   constexpr bool is_directed()   const { return graph.is_directed();   }
   constexpr bool is_undirected() const { return graph.is_undirected(); }
 
+  // node name helper methods
+
+  auto find_node(std::string_view name) const
+  {
+    return graph.find_node(name);
+  }
+
+  auto get_node_name(NodeId node_id) const
+  {
+    return graph.get_node_name(node_id);
+  }
+
+  bool set_node_name(NodeId node_id, std::string_view name)
+  {
+    return graph.set_node_name(node_id, name);
+  }
+
+  auto get_or_create_node(std::string_view name)
+  {
+    return graph.get_or_create_node(name);
+  }
+
   // get attribute helper methods
 
   auto get_node_label(NodeId node_id) const
@@ -51,6 +74,11 @@ struct GvizGraph {
     return graph.template get_entity_attr<attrs::Label>(node_id);
   }
 
+  auto get_node_label_view(NodeId node_id) const
+  {
+    return graph.template get_entity_attr<attrs::LabelView>(node_id);
+  }
+
   auto get_node_style(NodeId node_id) const
   {
     return graph.template get_entity_attr<attrs::Style>(node_id);
@@ -63,6 +91,17 @@ struct GvizGraph {
     graph.template set_entity_attr<attrs::Label>(node_id, std::move(label));
   }
 
+  /** sets node's label to `format` interned in graph's string pool,
+   *  so nodes sharing the same format also share its storage.
+   */
+  void set_node_label_view(NodeId node_id, std::string_view format)
+  {
+    graph.template set_entity_attr<attrs::LabelView>(
+        node_id,
+        attrtypes::Label<std::string_view>(graph.intern(format))
+    );
+  }
+
   void set_node_style(NodeId node_id, attrtypes::Style style)
   {
     graph.template set_entity_attr<attrs::Style>(node_id, std::move(style));
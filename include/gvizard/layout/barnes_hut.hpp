@@ -0,0 +1,436 @@
+#ifndef GVIZARD_LAYOUT_BARNES_HUT_HPP_
+#define GVIZARD_LAYOUT_BARNES_HUT_HPP_
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include "gvizard/layout/layout_graph.hpp"
+#include "gvizard/parallel/parallel_for.hpp"
+#include "gvizard/simd/vec.hpp"
+
+namespace gviz::layout {
+
+namespace detail {
+
+/** spreads the low 21 bits of `value` so that `D - 1` zero bits follow
+ *  each one.
+ */
+template <std::size_t D>
+constexpr uint64_t spread_bits(uint64_t value) noexcept
+{
+  uint64_t ret = 0;
+  for (std::size_t bit = 0; bit < 21; ++bit)
+    ret |= ((value >> bit) & 1) << (bit * D);
+  return ret;
+}
+
+/** sorts `items` by `keys` of `bits` significant bits, both in place,
+ *  by least significant digits first. it is stable, so that items of
+ *  equal keys keep their order between calls.
+ */
+inline void radix_sort(std::vector<uint64_t>& keys,
+                       std::vector<uint32_t>& items, std::size_t bits)
+{
+  constexpr std::size_t digit_bits = 11;
+  constexpr std::size_t radix      = std::size_t(1) << digit_bits;
+
+  std::vector<uint64_t> key_buffer(keys.size());
+  std::vector<uint32_t> item_buffer(items.size());
+  std::vector<std::size_t> counts(radix);
+
+  for (std::size_t shift = 0; shift < bits; shift += digit_bits) {
+    std::fill(counts.begin(), counts.end(), 0);
+    for (auto key : keys)
+      ++counts[(key >> shift) & (radix - 1)];
+
+    std::size_t sum = 0;
+    for (auto& count : counts)
+      sum += std::exchange(count, sum);
+
+    for (std::size_t i = 0; i < keys.size(); ++i) {
+      const auto at = counts[(keys[i] >> shift) & (radix - 1)]++;
+      key_buffer[at]  = keys[i];
+      item_buffer[at] = items[i];
+    }
+    keys.swap(key_buffer);
+    items.swap(item_buffer);
+  }
+}
+
+}  // namespace detail
+
+/** a quadtree, or an octree if `D` is 3, of weighted points, summing
+ *  up far away points by their center of mass to approximate repulsive
+ *  forces between all points in O(n log n), as by Barnes and Hut.
+ *
+ * points are sorted along a Morton curve, so that each cell's points
+ * are contiguous and near cells are near in memory. a leaf's points
+ * share what they interact with, gathered once as an array per axis
+ * and evaluated a few points at a time.
+ */
+template <std::size_t D>
+class BarnesHut final {
+  static_assert(D == 2 || D == 3, "Barnes-Hut trees are of 2 or 3 dims");
+
+ public:
+  /** most points of a leaf, unless they are too close to split. */
+  static constexpr std::size_t leaf_size = 16;
+
+  /** levels below the root, cells are split at most that many times. */
+  static constexpr std::size_t max_depth = 16;
+
+ private:
+  static constexpr std::size_t lanes    = 4;
+  static constexpr std::size_t children = std::size_t(1) << D;
+
+  using f64v = simd::Vec<double, lanes>;
+
+  struct Cell final {
+    std::array<double, D> center{};
+    double   mass  = 0.;
+    double   side  = 0.;
+    uint32_t first = 0;  ///< points of the cell are [first, last).
+    uint32_t last  = 0;
+    uint32_t child = 0;  ///< children are [child, child + child_count).
+    uint32_t child_count = 0;
+    uint32_t depth = 0;
+  };
+
+  // points in Morton order, and where each one is in the input.
+  Coords<D>             coords_{};
+  std::vector<double>   masses_{};
+  std::vector<uint32_t> order_{};
+  std::vector<uint64_t> keys_{};
+
+  std::vector<Cell>     cells_{};
+  std::vector<uint32_t> leaves_{};
+
+  // what points of a leaf interact with: points and centers of mass.
+  struct Interactions final {
+    Coords<D>           coords{};
+    std::vector<double> masses{};
+    std::vector<uint32_t> stack{};
+
+    void clear()
+    {
+      for (auto& axis : coords)
+        axis.clear();
+      masses.clear();
+    }
+
+    void push(const std::array<double, D>& point, double mass)
+    {
+      for (std::size_t axis = 0; axis < D; ++axis)
+        coords[axis].push_back(point[axis]);
+      masses.push_back(mass);
+    }
+
+    // massless points add no force, so they fill the last vector.
+    void pad()
+    {
+      while (masses.size() % lanes != 0)
+        push(std::array<double, D>{}, 0.);
+    }
+  };
+
+  void gather(const Cell& leaf, double theta, Interactions& out) const
+  {
+    std::array<double, D> low{}, high{};
+    for (std::size_t axis = 0; axis < D; ++axis) {
+      const auto first = coords_[axis].begin() + leaf.first;
+      const auto last  = coords_[axis].begin() + leaf.last;
+      const auto [min, max] = std::minmax_element(first, last);
+      low[axis]  = *min;
+      high[axis] = *max;
+    }
+
+    out.clear();
+    out.stack.assign(1, 0);
+    while (!out.stack.empty()) {
+      const auto& cell = cells_[out.stack.back()];
+      out.stack.pop_back();
+      if (cell.mass == 0.)
+        continue;
+
+      if (cell.child_count == 0) {
+        for (auto i = cell.first; i < cell.last; ++i) {
+          std::array<double, D> point{};
+          for (std::size_t axis = 0; axis < D; ++axis)
+            point[axis] = coords_[axis][i];
+          out.push(point, masses_.empty() ? 1. : masses_[i]);
+        }
+        continue;
+      }
+
+      // distance from the center of mass to the nearest point of the
+      // leaf's bounding box.
+      double distance2 = 0.;
+      for (std::size_t axis = 0; axis < D; ++axis) {
+        const double gap = std::max({ low[axis] - cell.center[axis],
+                                      cell.center[axis] - high[axis],
+                                      0. });
+        distance2 += gap * gap;
+      }
+
+      if (cell.side * cell.side < theta * theta * distance2)
+        out.push(cell.center, cell.mass);
+      else
+        for (uint32_t i = 0; i < cell.child_count; ++i)
+          out.stack.push_back(cell.child + i);
+    }
+    out.pad();
+  }
+
+  /** sum of `(point - other) * mass / distance^(power + 1)` over what
+   *  `point` interacts with.
+   */
+  static std::array<double, D>
+  repel(const std::array<double, D>& point, const Interactions& with,
+        double power)
+  {
+    std::array<f64v, D> sums{};
+    sums.fill(f64v::broadcast(0.));
+
+    std::array<f64v, D> at{};
+    for (std::size_t axis = 0; axis < D; ++axis)
+      at[axis] = f64v::broadcast(point[axis]);
+
+    const bool squared = power == 1.;
+    const double exponent = -(power + 1.) / 2.;
+
+    for (std::size_t i = 0; i < with.masses.size(); i += lanes) {
+      std::array<f64v, D> delta{};
+      f64v distance2 = f64v::broadcast(0.);
+      for (std::size_t axis = 0; axis < D; ++axis) {
+        const auto *coords = with.coords[axis].data() + i;
+        delta[axis] = at[axis] - f64v::generate([&](std::size_t lane) {
+          return coords[lane];
+        });
+        distance2 = distance2 + delta[axis] * delta[axis];
+      }
+
+      const auto *masses = with.masses.data() + i;
+      const f64v mass = f64v::generate([&](std::size_t lane) {
+        return masses[lane];
+      });
+
+      // distance 0 happens for the point itself only, or for points
+      // at the same place, which push each other nowhere.
+      const f64v zero  = f64v::broadcast(0.);
+      const f64v scale = select(distance2 > zero,
+                                squared
+                                ? mass / distance2
+                                : mass * f64v::generate([&](std::size_t lane) {
+                                    return std::pow(distance2[lane],
+                                                    exponent);
+                                  }),
+                                zero);
+
+      for (std::size_t axis = 0; axis < D; ++axis)
+        sums[axis] = sums[axis] + delta[axis] * scale;
+    }
+
+    std::array<double, D> ret{};
+    for (std::size_t axis = 0; axis < D; ++axis)
+      for (std::size_t lane = 0; lane < lanes; ++lane)
+        ret[axis] += sums[axis][lane];
+    return ret;
+  }
+
+  void sort_points(const Coords<D>& coords, unsigned threads)
+  {
+    const std::size_t count = coords[0].size();
+
+    std::array<double, D> low{};
+    double side = 0.;
+    for (std::size_t axis = 0; axis < D; ++axis) {
+      const auto [min, max] = std::minmax_element(coords[axis].begin(),
+                                                  coords[axis].end());
+      low[axis] = *min;
+      side      = std::max(side, *max - *min);
+    }
+
+    // cells of the deepest level are numbered along each axis.
+    constexpr double cells = double(uint64_t(1) << max_depth);
+    const double scale = side > 0. ? cells / side : 0.;
+
+    // the order of the last call is kept for the sort to start from, as
+    // points move little between calls.
+    if (order_.size() != count) {
+      order_.resize(count);
+      for (uint32_t i = 0; i < count; ++i)
+        order_[i] = i;
+    }
+
+    keys_.resize(count);
+    parallel::parallel_for(count, [&](std::size_t begin, std::size_t end) {
+      for (std::size_t i = begin; i < end; ++i) {
+        const auto point = order_[i];
+        uint64_t key = 0;
+        for (std::size_t axis = 0; axis < D; ++axis) {
+          const double cell = (coords[axis][point] - low[axis]) * scale;
+          key |= detail::spread_bits<D>(
+                   uint64_t(std::min(std::max(cell, 0.), cells - 1.)))
+                 << axis;
+        }
+        keys_[i] = key;
+      }
+    }, 4096, threads);
+
+    detail::radix_sort(keys_, order_, max_depth * D);
+
+    cells_.assign(1, Cell{});
+    cells_[0].last = uint32_t(count);
+    cells_[0].side = side;
+  }
+
+  /** splits cells breadth first, so that each cell's children are
+   *  contiguous and follow it.
+   */
+  void split_cells()
+  {
+    leaves_.clear();
+    for (std::size_t idx = 0; idx < cells_.size(); ++idx) {
+      const auto cell = cells_[idx];
+      if (cell.last - cell.first <= leaf_size || cell.depth == max_depth) {
+        leaves_.push_back(uint32_t(idx));
+        continue;
+      }
+
+      const auto shift = (max_depth - 1 - cell.depth) * D;
+      const auto digit = [&](uint32_t i) {
+        return (keys_[i] >> shift) & (children - 1);
+      };
+
+      const auto child = uint32_t(cells_.size());
+      for (auto first = cell.first; first < cell.last;) {
+        const auto value = digit(first);
+        auto last = first + 1;
+        while (last < cell.last && digit(last) == value)
+          ++last;
+
+        Cell sub{};
+        sub.first = first;
+        sub.last  = last;
+        sub.side  = cell.side / 2.;
+        sub.depth = cell.depth + 1;
+        cells_.push_back(sub);
+        first = last;
+      }
+
+      cells_[idx].child       = child;
+      cells_[idx].child_count = uint32_t(cells_.size()) - child;
+    }
+  }
+
+  void sum_masses()
+  {
+    // children follow their parent, so they are summed before it.
+    for (std::size_t idx = cells_.size(); idx-- > 0;) {
+      auto& cell = cells_[idx];
+      std::array<double, D> moment{};
+      double mass = 0.;
+
+      if (cell.child_count == 0)
+        for (auto i = cell.first; i < cell.last; ++i) {
+          const double weight = masses_.empty() ? 1. : masses_[i];
+          for (std::size_t axis = 0; axis < D; ++axis)
+            moment[axis] += coords_[axis][i] * weight;
+          mass += weight;
+        }
+      else
+        for (auto i = cell.child; i < cell.child + cell.child_count; ++i) {
+          const auto& child = cells_[i];
+          for (std::size_t axis = 0; axis < D; ++axis)
+            moment[axis] += child.center[axis] * child.mass;
+          mass += child.mass;
+        }
+
+      cell.mass = mass;
+      for (std::size_t axis = 0; axis < D; ++axis)
+        cell.center[axis] = mass > 0. ? moment[axis] / mass : 0.;
+    }
+  }
+
+ public:
+  BarnesHut() = default;
+
+  /** builds the tree of points at `coords`, weighted by `masses` or all
+   *  by 1 if it is empty.
+   */
+  void build(const Coords<D>& coords, const std::vector<double>& masses = {},
+             unsigned threads = 0)
+  {
+    const std::size_t count = coords[0].size();
+    if (count == 0) {
+      cells_.clear();
+      leaves_.clear();
+      order_.clear();
+      return;
+    }
+
+    sort_points(coords, threads);
+
+    for (std::size_t axis = 0; axis < D; ++axis) {
+      coords_[axis].resize(count);
+      for (std::size_t i = 0; i < count; ++i)
+        coords_[axis][i] = coords[axis][order_[i]];
+    }
+
+    masses_.clear();
+    if (!masses.empty()) {
+      masses_.resize(count);
+      for (std::size_t i = 0; i < count; ++i)
+        masses_[i] = masses[order_[i]];
+    }
+
+    split_cells();
+    sum_masses();
+  }
+
+  std::size_t cell_count() const noexcept { return cells_.size(); }
+  std::size_t leaf_count() const noexcept { return leaves_.size(); }
+
+  /** adds to `forces` of each point the repulsion of all others, that of
+   *  a point of mass `m` at distance `d` being `strength * m / d^power`
+   *  times the point's own mass, away from it.
+   *
+   * @param theta cells whose side is less than `theta` times their
+   *              distance are taken as a whole, 0 makes it exact.
+   */
+  void add_repulsion(Coords<D>& forces, double strength, double power,
+                     double theta, unsigned threads = 0) const
+  {
+    parallel::parallel_for(
+      leaves_.size(),
+      [&](std::size_t begin, std::size_t end) {
+        Interactions with{};
+        for (std::size_t idx = begin; idx < end; ++idx) {
+          const auto& leaf = cells_[leaves_[idx]];
+          gather(leaf, theta, with);
+
+          for (auto i = leaf.first; i < leaf.last; ++i) {
+            std::array<double, D> point{};
+            for (std::size_t axis = 0; axis < D; ++axis)
+              point[axis] = coords_[axis][i];
+
+            const auto force = repel(point, with, power);
+            const double scale =
+              strength * (masses_.empty() ? 1. : masses_[i]);
+            for (std::size_t axis = 0; axis < D; ++axis)
+              forces[axis][order_[i]] += force[axis] * scale;
+          }
+        }
+      },
+      8, threads);
+  }
+};
+
+}  // namespace gviz::layout
+
+#endif  // GVIZARD_LAYOUT_BARNES_HUT_HPP_
@@ -0,0 +1,521 @@
+#ifndef GVIZARD_LAYOUT_CIRCULAR_HPP_
+#define GVIZARD_LAYOUT_CIRCULAR_HPP_
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include "gvizard/layout/components.hpp"
+#include "gvizard/layout/layout_graph.hpp"
+#include "gvizard/layout/packing.hpp"
+#include "gvizard/parallel/parallel_for.hpp"
+
+#include "gvizard/attrs/mindist.hpp"
+
+namespace gviz::layout {
+
+/** parameters of `circular`, defaults being those of the attributes
+ *  they're named after.
+ */
+struct CircularOptions final {
+  /** least space between nodes in inches, beyond their sizes. */
+  double mindist = attrs::MinDist::get_default_value();
+
+  /** margin between components, see `pack_margin`. */
+  attrs::PackType pack = attrs::Pack::get_default_value();
+
+  /** packing of components, see `pack_components`. */
+  attrtypes::PackMode packmode = attrs::PackMode::get_default_value();
+
+  /** maximum count of threads, 0 means default_concurrency(). */
+  unsigned threads = 0;
+};
+
+namespace detail {
+
+/** biconnected components of a connected component, as nodes of each
+ *  in order of discovery, the node joining it to the rest first.
+ *
+ * blocks are listed in the order they are found, so that those joined
+ * at a node come before the one it was reached from.
+ */
+struct Blocks final {
+  std::vector<uint32_t> offsets{ 0 };
+  std::vector<uint32_t> nodes{};
+
+  std::size_t count() const noexcept { return offsets.size() - 1; }
+
+  IndexRange operator[](std::size_t block) const noexcept
+  {
+    return IndexRange{ nodes.data() + offsets[block],
+                       nodes.data() + offsets[block + 1] };
+  }
+};
+
+/** finds blocks of the component of `root` by Tarjan's depth first
+ *  search, without recursion.
+ *
+ * @param discovery order of discovery of nodes, `no_node` for those of
+ *                  the component.
+ * @param lows lowest discovery reachable from each node's subtree.
+ */
+inline Blocks find_blocks(const LayoutGraph& graph, uint32_t root,
+                          std::vector<uint32_t>& discovery,
+                          std::vector<uint32_t>& lows)
+{
+  struct Frame final {
+    uint32_t node, parent_edge, next;
+  };
+
+  Blocks blocks{};
+  std::vector<Frame>    frames{};
+  std::vector<uint32_t> stack{};
+  uint32_t time = 0;
+
+  const auto discover = [&](uint32_t node, uint32_t parent_edge) {
+    discovery[node] = lows[node] = time++;
+    stack.push_back(node);
+    frames.push_back(Frame{ node, parent_edge, 0 });
+  };
+  discover(root, no_node);
+
+  while (!frames.empty()) {
+    const auto node = frames.back().node;
+    const auto out  = graph.out_edges(node);
+    const auto in   = graph.in_edges(node);
+
+    if (auto& next = frames.back().next; next < out.size() + in.size()) {
+      const auto edge = next < out.size() ? out[next]
+                                          : in[next - out.size()];
+      ++next;
+      if (edge == frames.back().parent_edge)
+        continue;
+
+      const auto other = graph.opposite(edge, node);
+      if (discovery[other] == no_node)
+        discover(other, edge);
+      else
+        lows[node] = std::min(lows[node], discovery[other]);
+      continue;
+    }
+
+    frames.pop_back();
+    if (frames.empty())
+      break;
+
+    // a subtree reaching no higher than its parent is a block with it.
+    const auto parent = frames.back().node;
+    lows[parent] = std::min(lows[parent], lows[node]);
+    if (lows[node] < discovery[parent])
+      continue;
+
+    const std::size_t first = blocks.nodes.size();
+    blocks.nodes.push_back(parent);
+    for (auto top = no_node; top != node; stack.pop_back()) {
+      top = stack.back();
+      blocks.nodes.push_back(top);
+    }
+    std::reverse(blocks.nodes.begin() + first + 1, blocks.nodes.end());
+    blocks.offsets.push_back(uint32_t(blocks.nodes.size()));
+  }
+
+  // a node alone is a block of its own.
+  if (blocks.count() == 0) {
+    blocks.nodes.push_back(root);
+    blocks.offsets.push_back(1);
+  }
+  return blocks;
+}
+
+/** places blocks of a component on circles, each block attached at a
+ *  node to the outside of the one it was reached from.
+ */
+class BlockPlacer final {
+  static constexpr double pi = 3.14159265358979323846;
+
+  const LayoutGraph& graph_;
+  const Blocks&      blocks_;
+  double             mindist_;
+  Coords<2>&         coords_;
+
+  std::vector<double> radii_{};
+  std::vector<double> distances_{};
+  std::vector<double> middles_{};
+
+  struct Disk final {
+    double x, y, radius;
+  };
+  // disks holding blocks with what hangs off them, centered off the
+  // blocks' own centers, and one for each block's children in turn.
+  std::vector<Disk> bounds_{};
+  std::vector<Disk> disks_{};
+
+  // wedges of nodes of each block, by their place in `blocks_`, as
+  // angles from the direction facing away from the block's center.
+  struct Wedge final {
+    double from, to;
+  };
+  std::vector<Wedge>       wedges_{};
+  std::vector<std::size_t> marks_{};
+
+  // blocks joined at each node, sorted by node, and where those of each
+  // node of each block start, by its place in `blocks_`.
+  std::vector<std::pair<uint32_t, uint32_t>> children_{};
+  std::vector<uint32_t> firsts_{};
+
+  std::size_t root_block_ = 0;
+
+  struct Pending final {
+    uint32_t block;
+    double   x, y;   ///< center of the block's circle.
+    double   entry;  ///< angle of its first node from the center.
+  };
+
+  /** largest width or height of nodes of `block`, in inches. */
+  double size_of(std::size_t block) const
+  {
+    double size = 0.;
+    for (auto node : blocks_[block])
+      size = std::max({ size, graph_.node(node).width,
+                        graph_.node(node).height });
+    return size / points_per_inch;
+  }
+
+  /** radius of the circle of `block`, 0 for an edge hanging off another
+   *  block, which is drawn as its far node at the block's center.
+   */
+  double radius_of(std::size_t block) const
+  {
+    const auto nodes = blocks_[block];
+    if (nodes.size() < 2 || (nodes.size() == 2 && block != root_block_))
+      return 0.;
+
+    // neighbours on the circle are a node's size and mindist apart.
+    const double chord = size_of(block) + mindist_;
+    return chord / (2. * std::sin(pi / double(nodes.size())));
+  }
+
+  /** calls `func(child)` for each block joined at the `i`th node of
+   *  `block`.
+   */
+  template <typename F>
+  void each_child(std::size_t block, std::size_t i, F&& func) const
+  {
+    const auto node = blocks_[block][i];
+    for (auto at = firsts_[blocks_.offsets[block] + i];
+         at < children_.size() && children_[at].first == node; ++at)
+      func(children_[at].second);
+  }
+
+  std::size_t joined_at(std::size_t block, std::size_t i) const
+  {
+    std::size_t joined = 0;
+    each_child(block, i, [&](uint32_t) { ++joined; });
+    return joined;
+  }
+
+  /** sets wedges around nodes of `block` for blocks joined at them to
+   *  spread over. off a circle, a node gets the half turn facing away
+   *  from its center, but for halves of the angles to the nearest other
+   *  nodes with blocks of their own, so that wedges of neighbours don't
+   *  cross. around a node alone, it gets the whole turn, and off an edge
+   *  all but a share left for the edge, or none for a block alone.
+   */
+  void set_wedges(std::size_t block)
+  {
+    const auto nodes = blocks_[block];
+    const std::size_t size = nodes.size();
+    const std::size_t first = block == root_block_ ? 0 : 1;
+    Wedge* const wedges = wedges_.data() + blocks_.offsets[block];
+
+    if (radii_[block] == 0.) {
+      for (std::size_t i = first; i < size; ++i) {
+        const std::size_t joined = joined_at(block, i);
+        const double wedge =
+          size == 1  ? 2. * pi
+          : joined < 2 ? 0.
+                       : 2. * pi * double(joined) / double(joined + 1);
+        wedges[i] = Wedge{ -wedge / 2., wedge / 2. };
+      }
+      return;
+    }
+
+    marks_.clear();
+    for (std::size_t i = first; i < size; ++i)
+      if (joined_at(block, i) > 0)
+        marks_.push_back(i);
+    const double step = 2. * pi / double(size);
+    for (std::size_t k = 0; k < marks_.size(); ++k) {
+      const std::size_t i = marks_[k];
+      const std::size_t before = marks_[(k + marks_.size() - 1)
+                                        % marks_.size()];
+      const std::size_t after = marks_[(k + 1) % marks_.size()];
+      const auto half = [&](std::size_t gap) {
+        return gap == 0 ? pi / 2. : std::min(step * double(gap), pi) / 2.;
+      };
+      wedges[i] = Wedge{ -half((i + size - before) % size),
+                         half((after + size - i) % size) };
+    }
+  }
+
+  /** sets distances from the `i`th node of `block` of the centers of
+   *  blocks joined at it and the angles from the node's outward facing
+   *  direction that they lie at, as in circo. each is far enough that
+   *  the disk holding it and what hangs off it fits in its share of the
+   *  node's wedge with mindist to spare, and shares are the angles they
+   *  take as near as they fit together, widened to fill the wedge.
+   */
+  void arrange(std::size_t block, std::size_t i)
+  {
+    const auto [from, to] = wedges_[blocks_.offsets[block] + i];
+
+    // the least distance of a child's center off its circle or edge.
+    const auto least = [&](uint32_t child) {
+      return radii_[child] > 0. ? radii_[child] : size_of(child) + mindist_;
+    };
+
+    std::size_t joined = 0;
+    double margin = 0.;
+    each_child(block, i, [&](uint32_t child) {
+      ++joined;
+      margin = std::max(margin, bounds_[child].radius + mindist_ / 2.);
+    });
+    if (to <= from || margin <= 0.) {
+      each_child(block, i, [&](uint32_t child) {
+        middles_[child] = 0.;
+        distances_[child] = least(child);
+      });
+      return;
+    }
+
+    // the distance of the center of a child's disk from the node, turned
+    // to lie along the middle of its share, and half the angle it takes
+    // at `at` if it's to be no nearer.
+    const auto reach = [&](uint32_t child, double at) {
+      const auto& bound = bounds_[child];
+      return std::max(at, std::hypot(least(child) + bound.x, bound.y));
+    };
+    const auto half = [&](uint32_t child, double at) {
+      const double margin = bounds_[child].radius + mindist_ / 2.;
+      const double distance = reach(child, at);
+      return margin < distance ? std::asin(margin / distance) : pi / 2.;
+    };
+    const auto total = [&](double at) {
+      double angle = 0.;
+      each_child(block, i, [&](uint32_t child) {
+        angle += 2. * half(child, at);
+      });
+      return angle;
+    };
+
+    // the distance they fit at, halving a range in which it lies, from
+    // one as near as the largest lets them be to one far enough for all
+    // to fit in even shares.
+    const double wedge = to - from;
+    double near = margin;
+    double far = margin / std::sin(std::min(wedge / double(joined), pi)
+                                   / 2.);
+    if (joined > 1)
+      for (int iteration = 0; iteration < 32; ++iteration) {
+        const double middle = (near + far) / 2.;
+        (total(middle) <= wedge ? far : near) = middle;
+      }
+
+    const double widen = wedge / total(far);
+    double at = from;
+    each_child(block, i, [&](uint32_t child) {
+      const auto& bound = bounds_[child];
+      const double share = 2. * half(child, far) * widen;
+      const double distance =
+        reach(child, (bound.radius + mindist_ / 2.)
+                     / std::sin(std::min(share, pi) / 2.));
+      distances_[child] = std::max(
+        least(child),
+        std::sqrt(distance * distance - bound.y * bound.y) - bound.x);
+      middles_[child] = at + share / 2.
+                      - std::atan2(bound.y, distances_[child] + bound.x);
+      at += share;
+    });
+  }
+
+  /** arranges blocks joined at `block` and sets the disk holding it
+   *  with them, by the offset of its center from that of `block`, with
+   *  the node joining it to the left, and its radius. held off center,
+   *  a block with one big child is little bigger than it, where a disk
+   *  centered on the block would be twice as big.
+   */
+  void bound(std::size_t block)
+  {
+    const auto nodes = blocks_[block];
+    const double radius = radii_[block];
+    const double step = 2. * pi / double(nodes.size());
+    const double size = size_of(block);
+    disks_.clear();
+    for (std::size_t i = 1; i < nodes.size(); ++i) {
+      const double at = pi + step * double(i);
+      const double nx = radius * std::cos(at), ny = radius * std::sin(at);
+      disks_.push_back(Disk{ nx, ny, size / 2. });
+      const double outward = radius > 0. ? at : 0.;
+      arrange(block, i);
+      each_child(block, i, [&](uint32_t child) {
+        // the child's own disk, turned as place() turns the child.
+        const double heading = outward + middles_[child];
+        const double cx = nx + distances_[child] * std::cos(heading);
+        const double cy = ny + distances_[child] * std::sin(heading);
+        const auto& bound = bounds_[child];
+        disks_.push_back(Disk{
+          cx + bound.x * std::cos(heading) - bound.y * std::sin(heading),
+          cy + bound.x * std::sin(heading) + bound.y * std::cos(heading),
+          bound.radius });
+      });
+    }
+
+    // grown from the largest disk to hold each of the others in turn,
+    // just wide enough across both.
+    auto& bound = bounds_[block];
+    bound = *std::max_element(disks_.begin(), disks_.end(),
+                              [](const Disk& lhs, const Disk& rhs) {
+                                return lhs.radius < rhs.radius;
+                              });
+    for (const auto& disk : disks_) {
+      const double dx = disk.x - bound.x, dy = disk.y - bound.y;
+      const double apart = std::hypot(dx, dy);
+      if (apart + disk.radius <= bound.radius)
+        continue;
+      const double radius = (apart + bound.radius + disk.radius) / 2.;
+      const double move = (radius - bound.radius) / apart;
+      bound = Disk{ bound.x + dx * move, bound.y + dy * move, radius };
+    }
+  }
+
+ public:
+  BlockPlacer(const LayoutGraph& graph, const Blocks& blocks,
+              double mindist, Coords<2>& coords)
+    : graph_(graph), blocks_(blocks), mindist_(mindist), coords_(coords)
+  {
+    const std::size_t count = blocks.count();
+
+    // the largest of the blocks joined at the root, found last, is the
+    // center.
+    root_block_ = count - 1;
+    const auto root = blocks[root_block_][0];
+    for (std::size_t block = 0; block < count; ++block)
+      if (blocks[block][0] == root
+          && blocks[block].size() > blocks[root_block_].size())
+        root_block_ = block;
+
+    for (std::size_t block = 0; block < count; ++block)
+      if (block != root_block_)
+        children_.emplace_back(blocks[block][0], uint32_t(block));
+    std::sort(children_.begin(), children_.end());
+    firsts_.reserve(blocks.nodes.size());
+    for (auto node : blocks.nodes)
+      firsts_.push_back(uint32_t(
+        std::lower_bound(children_.begin(), children_.end(),
+                         std::make_pair(node, uint32_t(0)))
+        - children_.begin()));
+
+    // disks holding blocks with what hangs off them, those hanging found
+    // first. the root block needs none, and blocks joined to it may come
+    // after it.
+    radii_.resize(count);
+    distances_.resize(count);
+    middles_.resize(count);
+    bounds_.resize(count);
+    wedges_.resize(blocks.nodes.size());
+    for (std::size_t block = 0; block < count; ++block) {
+      radii_[block] = radius_of(block);
+      set_wedges(block);
+      if (block != root_block_)
+        bound(block);
+    }
+    for (std::size_t i = 0; i < blocks[root_block_].size(); ++i)
+      arrange(root_block_, i);
+  }
+
+  void place()
+  {
+    std::vector<Pending> queue{ Pending{ uint32_t(root_block_), 0., 0.,
+                                         pi / 2. } };
+    for (std::size_t idx = 0; idx < queue.size(); ++idx) {
+      const auto [block, x, y, entry] = queue[idx];
+
+      const auto nodes = blocks_[block];
+      const double step = 2. * pi / double(nodes.size());
+      for (std::size_t i = block == root_block_ ? 0 : 1; i < nodes.size();
+           ++i) {
+        const double angle = entry + step * double(i);
+        const double nx = x + radii_[block] * std::cos(angle);
+        const double ny = y + radii_[block] * std::sin(angle);
+        coords_[0][nodes[i]] = nx;
+        coords_[1][nodes[i]] = ny;
+
+        // blocks joined at the node spread over its wedge, facing away
+        // from the center of its own.
+        const double outward = radii_[block] > 0. ? angle : entry + pi;
+        each_child(block, i, [&](uint32_t child) {
+          const double heading = outward + middles_[child];
+          queue.push_back(Pending{
+            child, nx + distances_[child] * std::cos(heading),
+            ny + distances_[child] * std::sin(heading), heading + pi });
+        });
+      }
+    }
+  }
+};
+
+}  // namespace detail
+
+/** lays out `graph` on circles, in the manner of circo: each block, or
+ *  biconnected component, on a circle of its own, and blocks joined at
+ *  a node outside of one another, away from the largest block.
+ *
+ * nodes of a block follow a depth first search around it, so that
+ * cycles are drawn as circles. circles are as small as mindist lets
+ * neighbours on them be, and blocks joined at a node as close to it as
+ * their shares of the space around it let them be without overlapping.
+ * it runs in nearly linear time, components apart across threads, and
+ * packs components by `pack_components`.
+ *
+ * node positions are centers in points, the lower left corner of the
+ * drawing at the origin. edges are left straight.
+ */
+inline Layout circular(const LayoutGraph& graph,
+                       const CircularOptions& options = {})
+{
+  const std::size_t count = graph.node_count();
+  const Components  components(graph);
+
+  Coords<2> coords{};
+  coords[0].resize(count);
+  coords[1].resize(count);
+
+  std::vector<uint32_t> discovery(count, detail::no_node), lows(count);
+  parallel::parallel_for_each_index(components.count(),
+                                    [&](std::size_t component) {
+    const auto blocks = detail::find_blocks(
+      graph, components.nodes(component)[0], discovery, lows);
+    detail::BlockPlacer(graph, blocks, options.mindist, coords).place();
+  }, 1, options.threads);
+
+  return pack_components(
+    graph, components, make_layout<2>(graph, coords),
+    PackOptions{ options.pack, options.packmode, {}, options.threads });
+}
+
+/** lays out `graph` by `circular`, setting `pos` of its nodes.
+ *  graph attributes are given in `options`, see `make_layout_input`.
+ */
+template <typename GraphT>
+void circular_layout(GraphT& graph, const CircularOptions& options = {})
+{
+  const auto input = make_layout_input(graph);
+  write_layout(graph, input, circular(input.graph, options));
+}
+
+}  // namespace gviz::layout
+
+#endif  // GVIZARD_LAYOUT_CIRCULAR_HPP_
@@ -0,0 +1,77 @@
+#ifndef GVIZARD_LAYOUT_CLUSTERS_HPP_
+#define GVIZARD_LAYOUT_CLUSTERS_HPP_
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include "gvizard/layout/layout_graph.hpp"
+
+namespace gviz::layout {
+
+/** nodes of a `LayoutGraph` grouped by the cluster they are in.
+ *
+ * clusters are numbered by their order in `LayoutInput`, and nodes in
+ * none belong to the root, numbered after them. each lists its nodes
+ * in increasing order.
+ */
+class Clusters final {
+  std::vector<uint32_t> cluster_of_{};
+  std::vector<uint32_t> offsets_{ 0, 0 };
+  std::vector<uint32_t> nodes_{};
+
+ public:
+  Clusters() = default;
+
+  /** groups nodes by `cluster_of`, `count` for those in no cluster.
+   *
+   * @param count count of clusters.
+   */
+  Clusters(std::vector<uint32_t> cluster_of, std::size_t count)
+    : cluster_of_(std::move(cluster_of))
+  {
+    detail::group_by_key(cluster_of_, count + 1, offsets_, nodes_);
+  }
+
+  /** count of clusters, the root not counted. */
+  std::size_t count() const noexcept { return offsets_.size() - 2; }
+
+  /** cluster of `node`, `count()` if it is in none. */
+  uint32_t cluster_of(std::size_t node) const noexcept
+  {
+    return cluster_of_[node];
+  }
+
+  /** nodes of `cluster`, those in none for `count()`. */
+  IndexRange nodes(std::size_t cluster) const noexcept
+  {
+    return IndexRange{ nodes_.data() + offsets_[cluster],
+                       nodes_.data() + offsets_[cluster + 1] };
+  }
+
+  /** nodes in no cluster. */
+  IndexRange loose() const noexcept { return nodes(count()); }
+};
+
+/** clusters of nodes of `input`, as made of `graph`. */
+template <typename GraphT>
+Clusters make_clusters(const GraphT& graph, const LayoutInput<GraphT>& input)
+{
+  const std::size_t count = input.clusters.size();
+
+  std::vector<uint32_t> cluster_of(input.nodes.size(), uint32_t(count));
+  for (std::size_t i = 0; i < input.nodes.size(); ++i)
+    if (const auto cluster = graph.get_node_cluster(input.nodes[i]))
+      cluster_of[i] = uint32_t(
+        std::lower_bound(input.clusters.begin(), input.clusters.end(),
+                         *cluster)
+        - input.clusters.begin());
+
+  return Clusters(std::move(cluster_of), count);
+}
+
+}  // namespace gviz::layout
+
+#endif  // GVIZARD_LAYOUT_CLUSTERS_HPP_
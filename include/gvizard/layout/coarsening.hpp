@@ -0,0 +1,425 @@
+#ifndef GVIZARD_LAYOUT_COARSENING_HPP_
+#define GVIZARD_LAYOUT_COARSENING_HPP_
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include "gvizard/layout/layout_graph.hpp"
+#include "gvizard/parallel/parallel_for.hpp"
+
+namespace gviz::layout {
+
+/** how nodes are grouped into those of a coarser graph. */
+enum class CoarseningScheme : uint8_t {
+  matching = 0,     ///< pairs of linked nodes merge.
+  independent_set,  ///< nodes join a neighbour of a maximal independent set.
+};
+
+/** parameters of `coarsen`. */
+struct CoarseningOptions final {
+  CoarseningScheme scheme = CoarseningScheme::matching;
+
+  /** graphs of at most this many nodes aren't coarsened further. */
+  std::size_t min_nodes = 50;
+
+  /** coarsening stops once a level keeps more than this part of the
+   *  nodes of the one before. a matching that does is replaced by an
+   *  independent set, which shrinks stars and the like much further.
+   */
+  double max_ratio = .75;
+
+  /** most levels made. */
+  std::size_t max_levels = 30;
+
+  /** seeds priorities among equal choices. */
+  uint32_t seed = 1;
+
+  /** maximum count of threads, 0 means default_concurrency(). */
+  unsigned threads = 0;
+};
+
+/** a graph standing for a finer one, each of its nodes for a group of
+ *  linked nodes of the finer graph.
+ *
+ * edges are undirected, from the lower index to the higher, weighted by
+ * the sum of those they stand for and as long as their average `len`.
+ */
+struct CoarseLevel final {
+  LayoutGraph graph{};
+
+  /** count of input nodes each node stands for. */
+  std::vector<double> masses{};
+
+  /** node of this level each node of the finer one is part of. */
+  std::vector<uint32_t> parents{};
+};
+
+namespace detail {
+
+/** a well mixed hash of `value`, splitmix64's finalizer. */
+constexpr uint64_t mix_bits(uint64_t value) noexcept
+{
+  value += 0x9e3779b97f4a7c15u;
+  value = (value ^ (value >> 30)) * 0xbf58476d1ce4e5b9u;
+  value = (value ^ (value >> 27)) * 0x94d049bb133111ebu;
+  return value ^ (value >> 31);
+}
+
+template <typename F>
+void parallel_nodes(std::size_t count, unsigned threads, F&& func)
+{
+  parallel::parallel_for(count, [&](std::size_t begin, std::size_t end) {
+    for (auto node = uint32_t(begin); node < end; ++node)
+      func(node);
+  }, 4096, threads);
+}
+
+/** calls `func(other, edge)` for each node linked to `node`, by either
+ *  direction.
+ */
+template <typename F>
+void each_neighbour(const LayoutGraph& graph, uint32_t node, F&& func)
+{
+  for (auto edge : graph.out_edges(node))
+    if (graph.edge(edge).target != node)
+      func(graph.edge(edge).target, edge);
+  for (auto edge : graph.in_edges(node))
+    if (graph.edge(edge).source != node)
+      func(graph.edge(edge).source, edge);
+}
+
+/** numbers groups of nodes densely, by their first node.
+ *
+ * @param leaders node of each node's group, being itself for the first.
+ * @returns count of groups, `leaders` becoming group numbers.
+ */
+inline std::size_t number_groups(std::vector<uint32_t>& leaders)
+{
+  std::vector<uint32_t> numbers(leaders.size(), no_node);
+  uint32_t count = 0;
+  for (std::size_t node = 0; node < leaders.size(); ++node)
+    if (leaders[node] == node)
+      numbers[node] = count++;
+  for (auto& leader : leaders)
+    leader = numbers[leader];
+  return count;
+}
+
+/** groups nodes by matching, as handshakes: each node unmatched picks
+ *  its best neighbour unmatched, and pairs that picked each other match,
+ *  until none do. edges are best by weight over the masses of their
+ *  ends, so that groups grow evenly.
+ *
+ * @returns group of each node, by its first node.
+ */
+inline std::vector<uint32_t>
+match_nodes(const LayoutGraph& graph, const std::vector<double>& masses,
+            uint32_t seed, unsigned threads)
+{
+  const std::size_t count = graph.node_count();
+
+  std::vector<uint32_t> partners(count, no_node), choices(count);
+  for (int round = 0; round < 8; ++round) {
+    parallel_nodes(count, threads, [&](uint32_t node) {
+      choices[node] = no_node;
+      if (partners[node] != no_node)
+        return;
+
+      double   best  = -1.;
+      uint64_t order = 0;
+      each_neighbour(graph, node, [&](uint32_t other, uint32_t edge) {
+        if (partners[other] != no_node)
+          return;
+        const double score = graph.edge(edge).weight
+                           / (masses[node] * masses[other]);
+        const uint64_t tie = mix_bits(uint64_t(other) ^ seed);
+        if (score > best || (score == best && tie > order)) {
+          best  = score;
+          order = tie;
+          choices[node] = other;
+        }
+      });
+    });
+
+    std::size_t matched = 0;
+    for (uint32_t node = 0; node < count; ++node)
+      if (choices[node] != no_node && choices[choices[node]] == node) {
+        partners[node] = choices[node];
+        ++matched;
+      }
+    if (matched == 0)
+      break;
+  }
+
+  std::vector<uint32_t> leaders(count);
+  for (uint32_t node = 0; node < count; ++node)
+    leaders[node] = partners[node] == no_node
+                  ? node : std::min(node, partners[node]);
+  return leaders;
+}
+
+/** groups nodes around a maximal independent set, found by Luby's
+ *  rounds of local maxima of priorities, each other node joining its
+ *  best neighbour in the set.
+ *
+ * nodes of higher degree come first, random ones among equals, so that
+ * hubs gather their neighbours.
+ *
+ * @returns group of each node, by its node in the set.
+ */
+inline std::vector<uint32_t>
+independent_set(const LayoutGraph& graph, const std::vector<double>& masses,
+                uint32_t seed, unsigned threads)
+{
+  enum State : uint8_t { undecided, in_set, out_of_set };
+
+  const std::size_t count = graph.node_count();
+  const auto priority = [&](uint32_t node) {
+    return std::make_tuple(graph.out_edges(node).size()
+                             + graph.in_edges(node).size(),
+                           mix_bits(uint64_t(node) ^ seed), node);
+  };
+
+  std::vector<uint8_t> states(count, undecided), next(count);
+  for (bool changed = true; changed;) {
+    parallel_nodes(count, threads, [&](uint32_t node) {
+      next[node] = states[node];
+      if (states[node] != undecided)
+        return;
+
+      bool highest = true;
+      each_neighbour(graph, node, [&](uint32_t other, uint32_t) {
+        highest = highest && (states[other] == out_of_set
+                              || (states[other] == undecided
+                                  && priority(other) < priority(node)));
+      });
+      if (highest)
+        next[node] = in_set;
+    });
+    states.swap(next);
+
+    parallel_nodes(count, threads, [&](uint32_t node) {
+      next[node] = states[node];
+      if (states[node] == undecided)
+        each_neighbour(graph, node, [&](uint32_t other, uint32_t) {
+          if (states[other] == in_set)
+            next[node] = out_of_set;
+        });
+    });
+
+    changed = false;
+    for (std::size_t node = 0; node < count && !changed; ++node)
+      changed = next[node] == undecided;
+    states.swap(next);
+  }
+
+  std::vector<uint32_t> leaders(count);
+  parallel_nodes(count, threads, [&](uint32_t node) {
+    leaders[node] = node;
+    if (states[node] == in_set)
+      return;
+
+    double best = -1.;
+    each_neighbour(graph, node, [&](uint32_t other, uint32_t edge) {
+      const double score = graph.edge(edge).weight / masses[other];
+      if (states[other] == in_set
+          && (score > best || (score == best && other < leaders[node]))) {
+        best = score;
+        leaders[node] = other;
+      }
+    });
+  });
+  return leaders;
+}
+
+/** the graph of `groups` of nodes of `graph`, edges between groups
+ *  merged, built group by group across threads.
+ */
+inline CoarseLevel contract(const LayoutGraph& graph,
+                            const std::vector<double>& masses,
+                            std::vector<uint32_t> groups,
+                            std::size_t group_count, unsigned threads)
+{
+  const std::size_t count = graph.node_count();
+
+  // members of each group, in order.
+  std::vector<uint32_t> offsets(group_count + 1, 0), members(count);
+  for (auto group : groups)
+    ++offsets[group + 1];
+  for (std::size_t group = 0; group < group_count; ++group)
+    offsets[group + 1] += offsets[group];
+  {
+    std::vector<uint32_t> fill(offsets.begin(), offsets.end() - 1);
+    for (uint32_t node = 0; node < count; ++node)
+      members[fill[groups[node]]++] = node;
+  }
+
+  CoarseLevel level{};
+  level.masses.assign(group_count, 0.);
+  std::vector<LayoutNode> nodes(group_count);
+
+  // edges to groups of higher numbers, counted and then written.
+  std::vector<uint32_t> edge_offsets(group_count + 1, 0);
+  std::vector<LayoutEdge> edges{};
+
+  struct Link final {
+    uint32_t group;
+    double   weight, len;
+  };
+
+  const auto links_of = [&](uint32_t group, std::vector<Link>& links) {
+    links.clear();
+    for (auto i = offsets[group]; i < offsets[group + 1]; ++i)
+      each_neighbour(graph, members[i], [&](uint32_t other, uint32_t edge) {
+        if (groups[other] > group)
+          links.push_back(Link{ groups[other], graph.edge(edge).weight,
+                                graph.edge(edge).len });
+      });
+    std::sort(links.begin(), links.end(),
+              [](const Link& lhs, const Link& rhs) {
+                return lhs.group < rhs.group;
+              });
+
+    // links to the same group merge, lengths averaged.
+    std::size_t merged = 0;
+    for (std::size_t i = 0; i < links.size();) {
+      auto link = links[i];
+      std::size_t same = 1;
+      for (++i; i < links.size() && links[i].group == link.group; ++i) {
+        link.weight += links[i].weight;
+        link.len    += links[i].len;
+        ++same;
+      }
+      link.len /= double(same);
+      links[merged++] = link;
+    }
+    links.resize(merged);
+  };
+
+  const auto each_group = [&](auto&& func) {
+    parallel::parallel_for(group_count, [&](std::size_t begin,
+                                            std::size_t end) {
+      std::vector<Link> links{};
+      for (auto group = uint32_t(begin); group < end; ++group)
+        func(group, links);
+    }, 1024, threads);
+  };
+
+  each_group([&](uint32_t group, std::vector<Link>& links) {
+    double mass = 0., area = 0.;
+    for (auto i = offsets[group]; i < offsets[group + 1]; ++i) {
+      const auto& node = graph.node(members[i]);
+      mass += masses[members[i]];
+      area += node.width * node.height;
+    }
+    level.masses[group] = mass;
+    nodes[group].width = nodes[group].height = std::sqrt(area);
+
+    links_of(group, links);
+    edge_offsets[group + 1] = uint32_t(links.size());
+  });
+
+  for (std::size_t group = 0; group < group_count; ++group)
+    edge_offsets[group + 1] += edge_offsets[group];
+  edges.resize(edge_offsets.back());
+
+  each_group([&](uint32_t group, std::vector<Link>& links) {
+    links_of(group, links);
+    auto at = edge_offsets[group];
+    for (const auto& link : links) {
+      auto& edge  = edges[at++];
+      edge.source = group;
+      edge.target = link.group;
+      edge.weight = link.weight;
+      edge.len    = link.len;
+    }
+  });
+
+  level.graph   = LayoutGraph(std::move(nodes), std::move(edges));
+  level.parents = std::move(groups);
+  return level;
+}
+
+}  // namespace detail
+
+/** builds a hierarchy of ever coarser graphs of `graph`, as multilevel
+ *  layouts start from, each level grouping linked nodes of the one
+ *  before.
+ *
+ * groups are chosen and contracted across threads, the result doesn't
+ * depend on thread count.
+ *
+ * @returns levels from the finest to the coarsest, the first one of
+ *          `graph`, none if it is too small to coarsen.
+ */
+inline std::vector<CoarseLevel>
+coarsen(const LayoutGraph& graph, const CoarseningOptions& options = {})
+{
+  std::vector<CoarseLevel> levels{};
+  std::vector<double> masses(graph.node_count(), 1.);
+
+  const LayoutGraph *finer = &graph;
+  while (levels.size() < options.max_levels
+         && finer->node_count() > options.min_nodes) {
+    const std::size_t count = finer->node_count();
+    const auto seed = options.seed + uint32_t(levels.size());
+    const auto too_many = [&](std::size_t groups) {
+      return double(groups) > options.max_ratio * double(count);
+    };
+
+    std::vector<uint32_t> groups{};
+    std::size_t group_count = count;
+    if (options.scheme == CoarseningScheme::matching) {
+      groups = detail::match_nodes(*finer, masses, seed, options.threads);
+      group_count = detail::number_groups(groups);
+    }
+    if (options.scheme == CoarseningScheme::independent_set
+        || too_many(group_count)) {
+      groups = detail::independent_set(*finer, masses, seed,
+                                       options.threads);
+      group_count = detail::number_groups(groups);
+    }
+    if (too_many(group_count))
+      break;
+
+    levels.push_back(detail::contract(*finer, masses, std::move(groups),
+                                      group_count, options.threads));
+    masses = levels.back().masses;
+    finer  = &levels.back().graph;
+  }
+  return levels;
+}
+
+/** positions of the nodes of the level finer than `level`, at those of
+ *  their group in `coarse`, moved by up to `jitter` so that nodes of a
+ *  group come apart.
+ */
+template <std::size_t D>
+Coords<D> prolong(const CoarseLevel& level, const Coords<D>& coarse,
+                  double jitter, uint32_t seed = 1, unsigned threads = 0)
+{
+  const std::size_t count = level.parents.size();
+
+  Coords<D> fine{};
+  for (auto& axis : fine)
+    axis.resize(count);
+
+  detail::parallel_nodes(count, threads, [&](uint32_t node) {
+    auto bits = uint64_t(node) << 32 | seed;
+    for (std::size_t axis = 0; axis < D; ++axis) {
+      bits = detail::mix_bits(bits);
+      const double unit = double(bits >> 11) * 0x1p-53 * 2. - 1.;
+      fine[axis][node] = coarse[axis][level.parents[node]] + jitter * unit;
+    }
+  });
+  return fine;
+}
+
+}  // namespace gviz::layout
+
+#endif  // GVIZARD_LAYOUT_COARSENING_HPP_
@@ -0,0 +1,391 @@
+#ifndef GVIZARD_LAYOUT_COMPONENTS_HPP_
+#define GVIZARD_LAYOUT_COMPONENTS_HPP_
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <numeric>
+#include <optional>
+#include <utility>
+#include <variant>
+#include <vector>
+
+#include "gvizard/layout/disjoint_sets.hpp"
+#include "gvizard/layout/layout_graph.hpp"
+#include "gvizard/layout/packing.hpp"
+#include "gvizard/parallel/parallel_for.hpp"
+
+namespace gviz::layout {
+
+/** nodes of a `LayoutGraph` grouped by connected component, edges taken
+ *  either way.
+ *
+ * components are numbered by their lowest node, and list their nodes
+ * and edges in increasing order.
+ */
+class Components final {
+  std::vector<uint32_t> component_of_{};
+  std::vector<uint32_t> node_offsets_{ 0 };
+  std::vector<uint32_t> nodes_{};
+  std::vector<uint32_t> edge_offsets_{ 0 };
+  std::vector<uint32_t> edges_{};
+
+ public:
+  Components() = default;
+
+  /** finds components of `graph` by union-find over its edges. */
+  explicit Components(const LayoutGraph& graph)
+  {
+    const std::size_t node_count = graph.node_count();
+
+    DisjointSets sets(node_count);
+    for (const auto& edge : graph.edges())
+      sets.unite(edge.source, edge.target);
+
+    // roots are named by the first node of their set.
+    std::vector<uint32_t> numbers(node_count, detail::no_node);
+    component_of_.resize(node_count);
+    uint32_t count = 0;
+    for (std::size_t node = 0; node < node_count; ++node) {
+      auto& number = numbers[sets.find(node)];
+      if (number == detail::no_node)
+        number = count++;
+      component_of_[node] = number;
+    }
+
+    std::vector<uint32_t> edge_components(graph.edge_count());
+    for (std::size_t edge = 0; edge < graph.edge_count(); ++edge)
+      edge_components[edge] = component_of_[graph.edge(edge).source];
+
+    detail::group_by_key(component_of_, count, node_offsets_, nodes_);
+    detail::group_by_key(edge_components, count, edge_offsets_, edges_);
+  }
+
+  /** count of components. */
+  std::size_t count() const noexcept { return node_offsets_.size() - 1; }
+
+  /** component of `node`. */
+  uint32_t component_of(std::size_t node) const noexcept
+  {
+    return component_of_[node];
+  }
+
+  /** nodes of `component`. */
+  IndexRange nodes(std::size_t component) const noexcept
+  {
+    return IndexRange{ nodes_.data() + node_offsets_[component],
+                       nodes_.data() + node_offsets_[component + 1] };
+  }
+
+  /** edges of `component`. */
+  IndexRange edges(std::size_t component) const noexcept
+  {
+    return IndexRange{ edges_.data() + edge_offsets_[component],
+                       edges_.data() + edge_offsets_[component + 1] };
+  }
+};
+
+/** a component of a `LayoutGraph` as a graph of its own, engines taking
+ *  whole graphs, and what its nodes and edges are in the original.
+ */
+struct Subgraph final {
+  LayoutGraph           graph{};
+  std::vector<uint32_t> nodes{};
+  std::vector<uint32_t> edges{};
+};
+
+/** copies `component` of `graph` out, nodes and edges in their order. */
+inline Subgraph make_subgraph(const LayoutGraph& graph,
+                              const Components& components,
+                              std::size_t component)
+{
+  Subgraph subgraph{};
+  const auto nodes = components.nodes(component);
+  const auto edges = components.edges(component);
+  subgraph.nodes.assign(nodes.begin(), nodes.end());
+  subgraph.edges.assign(edges.begin(), edges.end());
+
+  const auto local = [&](uint32_t node) {
+    return uint32_t(std::lower_bound(subgraph.nodes.begin(),
+                                     subgraph.nodes.end(), node)
+                    - subgraph.nodes.begin());
+  };
+
+  std::vector<LayoutNode> own_nodes{};
+  own_nodes.reserve(nodes.size());
+  for (auto node : nodes)
+    own_nodes.push_back(graph.node(node));
+
+  std::vector<LayoutEdge> own_edges{};
+  own_edges.reserve(edges.size());
+  for (auto edge : edges) {
+    auto item   = graph.edge(edge);
+    item.source = local(item.source);
+    item.target = local(item.target);
+    own_edges.push_back(item);
+  }
+
+  subgraph.graph = LayoutGraph(std::move(own_nodes), std::move(own_edges));
+  return subgraph;
+}
+
+namespace detail {
+
+template <typename SplinesT, typename F>
+void each_control_point(SplinesT& splines, F&& func)
+{
+  for (auto& spline : splines.splines) {
+    func(spline.point);
+    for (auto& [first, second, third] : spline.triples) {
+      func(first);
+      func(second);
+      func(third);
+    }
+    if (spline.endp)
+      func(*spline.endp);
+    if (spline.startp)
+      func(*spline.startp);
+  }
+}
+
+}  // namespace detail
+
+/** moves components of `layout` apart, packed by `options`, their lower
+ *  left corner at the origin.
+ *
+ * components are packed as an array of their bounding boxes if the
+ * mode is an array, or as polyominoes otherwise: of their bounding box
+ * for the graph mode, and of their nodes and edges for the others, so
+ * that components nest. node positions and edge splines move, and
+ * clusters are left where they are.
+ */
+inline Layout pack_components(const LayoutGraph& graph,
+                              const Components& components, Layout layout,
+                              const PackOptions& options = {})
+{
+  using attrtypes::PackModeEnum;
+
+  const std::size_t count = components.count();
+  if (count == 0)
+    return layout;
+
+  const auto size_of = [&](std::size_t node) -> const LayoutNode& {
+    return layout.sizes.empty() ? graph.node(node) : layout.sizes[node];
+  };
+  const auto box_of = [&](std::size_t node) {
+    const auto& pos = layout.positions[node];
+    const double half_width  = size_of(node).width / 2.;
+    const double half_height = size_of(node).height / 2.;
+    return Box{ pos.x - half_width, pos.y - half_height,
+                pos.x + half_width, pos.y + half_height };
+  };
+  const auto splines_of = [&](std::size_t edge)
+    -> const Layout::splines_type * {
+    return edge < layout.splines.size()
+        && !layout.splines[edge].splines.empty()
+         ? &layout.splines[edge] : nullptr;
+  };
+
+  std::vector<Box> boxes(count);
+  parallel::parallel_for_each_index(count, [&](std::size_t component) {
+    auto& box = boxes[component];
+    box = box_of(components.nodes(component)[0]);
+    const auto grow = [&](double x, double y) {
+      box = Box{ std::min(box.llx, x), std::min(box.lly, y),
+                 std::max(box.urx, x), std::max(box.ury, y) };
+    };
+
+    for (auto node : components.nodes(component)) {
+      const auto own = box_of(node);
+      grow(own.llx, own.lly);
+      grow(own.urx, own.ury);
+    }
+    for (auto edge : components.edges(component))
+      if (const auto *splines = splines_of(edge))
+        detail::each_control_point(*splines, [&](const auto& point) {
+          const Point at(point);
+          grow(at.x, at.y);
+        });
+  }, 64, options.threads);
+
+  const auto mode   = options.packmode.normalized();
+  const double margin = pack_margin(options.pack);
+
+  std::vector<Point> offsets{};
+  if (mode.mode == PackModeEnum::array) {
+    std::vector<LayoutNode> sizes{};
+    for (const auto& box : boxes)
+      sizes.push_back(LayoutNode{ box.width(), box.height() });
+
+    offsets = pack_array(sizes, options.sortvs, mode, margin);
+    for (std::size_t component = 0; component < count; ++component) {
+      offsets[component].x -= boxes[component].llx;
+      offsets[component].y -= boxes[component].lly;
+    }
+  }
+  else {
+    // parts are grown by half the margin, so that they keep it apart.
+    const double step = grid_step(boxes, margin);
+    const auto   grow = [&](Box box) {
+      box.llx -= margin / 2.;
+      box.lly -= margin / 2.;
+      box.urx += margin / 2.;
+      box.ury += margin / 2.;
+      return box;
+    };
+
+    std::vector<Polyomino> parts(count, Polyomino(step));
+    parallel::parallel_for_each_index(count, [&](std::size_t component) {
+      auto& part = parts[component];
+      if (mode.mode == PackModeEnum::graph) {
+        part.add_box(grow(boxes[component]));
+        return;
+      }
+
+      for (auto node : components.nodes(component))
+        part.add_box(grow(box_of(node)));
+      for (auto edge : components.edges(component)) {
+        const auto *splines = splines_of(edge);
+        if (!splines) {
+          const auto& item = graph.edge(edge);
+          part.add_segment(layout.positions[item.source],
+                           layout.positions[item.target]);
+          continue;
+        }
+
+        std::optional<Point> last{};
+        detail::each_control_point(*splines, [&](const auto& point) {
+          const Point at(point);
+          if (last)
+            part.add_segment(*last, at);
+          last = at;
+        });
+      }
+    }, 64, options.threads);
+
+    offsets = pack_polyominoes(parts, step, options.threads);
+  }
+
+  // moved, then shifted for the lower left corner to be the origin.
+  double left = std::numeric_limits<double>::max(), bottom = left;
+  for (std::size_t component = 0; component < count; ++component) {
+    left   = std::min(left, boxes[component].llx + offsets[component].x);
+    bottom = std::min(bottom, boxes[component].lly + offsets[component].y);
+  }
+  for (auto& offset : offsets) {
+    offset.x -= left;
+    offset.y -= bottom;
+  }
+
+  parallel::parallel_for(layout.positions.size(),
+                         [&](std::size_t begin, std::size_t end) {
+    for (std::size_t node = begin; node < end; ++node) {
+      const auto& offset = offsets[components.component_of(node)];
+      layout.positions[node].x += offset.x;
+      layout.positions[node].y += offset.y;
+    }
+  }, 4096, options.threads);
+
+  parallel::parallel_for_each_index(layout.splines.size(),
+                                    [&](std::size_t edge) {
+    const auto& offset =
+      offsets[components.component_of(graph.edge(edge).source)];
+    detail::each_control_point(layout.splines[edge], [&](auto& point) {
+      std::visit([&](auto& at) {
+        at.x += offset.x;
+        at.y += offset.y;
+      }, point.point);
+    });
+  }, 1024, options.threads);
+
+  return layout;
+}
+
+/** lays out each component of `graph` by `engine` on its own, and packs
+ *  them by `pack_components`.
+ *
+ * components are laid out at once across threads, from the largest, a
+ * thread each. those too large to share the threads with others are
+ * laid out first, one at a time and with all of them.
+ *
+ * @param engine a callable taking a `LayoutGraph` and a count of
+ *               threads, and returning its `Layout`.
+ */
+template <typename Engine>
+Layout layout_components(const LayoutGraph& graph, Engine&& engine,
+                         const PackOptions& options = {})
+{
+  const Components components(graph);
+  const std::size_t count = components.count();
+  if (count <= 1)
+    return engine(graph, options.threads);
+
+  const unsigned threads = options.threads
+                         ? options.threads
+                         : parallel::default_concurrency();
+
+  std::vector<uint32_t> order(count);
+  std::iota(order.begin(), order.end(), uint32_t(0));
+  std::stable_sort(order.begin(), order.end(),
+                   [&](uint32_t lhs, uint32_t rhs) {
+                     return components.nodes(lhs).size()
+                          > components.nodes(rhs).size();
+                   });
+
+  const std::size_t share = graph.node_count() / threads;
+  std::size_t large = 0;
+  while (threads > 1 && large < count
+         && components.nodes(order[large]).size() > share)
+    ++large;
+
+  std::vector<Subgraph> subgraphs(count);
+  std::vector<Layout>   layouts(count);
+  const auto run = [&](std::size_t component, unsigned own_threads) {
+    subgraphs[component] = make_subgraph(graph, components, component);
+    layouts[component]   = engine(subgraphs[component].graph, own_threads);
+  };
+
+  for (std::size_t i = 0; i < large; ++i)
+    run(order[i], threads);
+  parallel::parallel_for_each_index(count - large, [&](std::size_t i) {
+    run(order[large + i], 1);
+  }, 1, threads);
+
+  // parts are put together by index in the whole graph.
+  Layout layout{};
+  layout.positions.resize(graph.node_count());
+  const auto has = [&](auto member) {
+    return std::any_of(layouts.begin(), layouts.end(),
+                       [&](const Layout& part) {
+                         return !(part.*member).empty();
+                       });
+  };
+  if (has(&Layout::splines))
+    layout.splines.resize(graph.edge_count());
+  if (has(&Layout::z))
+    layout.z.resize(graph.node_count());
+  if (has(&Layout::sizes))
+    layout.sizes = graph.nodes();
+
+  for (std::size_t component = 0; component < count; ++component) {
+    const auto& subgraph = subgraphs[component];
+    auto&       part     = layouts[component];
+    for (std::size_t i = 0; i < subgraph.nodes.size(); ++i) {
+      const auto node = subgraph.nodes[i];
+      layout.positions[node] = part.positions[i];
+      if (i < part.z.size())
+        layout.z[node] = part.z[i];
+      if (i < part.sizes.size())
+        layout.sizes[node] = part.sizes[i];
+    }
+    for (std::size_t i = 0; i < part.splines.size(); ++i)
+      layout.splines[subgraph.edges[i]] = std::move(part.splines[i]);
+  }
+
+  return pack_components(graph, components, std::move(layout), options);
+}
+
+}  // namespace gviz::layout
+
+#endif  // GVIZARD_LAYOUT_COMPONENTS_HPP_
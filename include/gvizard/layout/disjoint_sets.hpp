@@ -0,0 +1,81 @@
+#ifndef GVIZARD_LAYOUT_DISJOINT_SETS_HPP_
+#define GVIZARD_LAYOUT_DISJOINT_SETS_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <numeric>
+#include <utility>
+#include <vector>
+
+namespace gviz::layout {
+
+/** union-find over indices [0, size), each set named by a root index.
+ *
+ * sets are united by size and paths halved on lookup, so any sequence
+ * of operations runs in nearly linear time.
+ */
+class DisjointSets final {
+  std::vector<uint32_t> parent_{};
+  std::vector<uint32_t> size_{};
+  std::size_t           count_ = 0;
+
+ public:
+  DisjointSets() = default;
+
+  explicit DisjointSets(std::size_t size)
+    : parent_(size)
+    , size_(size, 1)
+    , count_(size)
+  {
+    std::iota(parent_.begin(), parent_.end(), uint32_t(0));
+  }
+
+  /** count of elements. */
+  std::size_t size() const noexcept { return parent_.size(); }
+
+  /** count of disjoint sets. */
+  std::size_t count() const noexcept { return count_; }
+
+  /** root of the set containing `idx`. */
+  uint32_t find(std::size_t idx) noexcept
+  {
+    auto node = uint32_t(idx);
+    while (parent_[node] != node) {
+      parent_[node] = parent_[parent_[node]];
+      node = parent_[node];
+    }
+    return node;
+  }
+
+  /** count of elements in the set containing `idx`. */
+  std::size_t size_of(std::size_t idx) noexcept { return size_[find(idx)]; }
+
+  bool same(std::size_t lhs, std::size_t rhs) noexcept
+  {
+    return find(lhs) == find(rhs);
+  }
+
+  /** merges the sets containing `lhs` and `rhs`.
+   *
+   * @returns root of the merged set.
+   */
+  uint32_t unite(std::size_t lhs, std::size_t rhs) noexcept
+  {
+    auto a = find(lhs);
+    auto b = find(rhs);
+    if (a == b)
+      return a;
+
+    if (size_[a] < size_[b])
+      std::swap(a, b);
+
+    parent_[b] = a;
+    size_[a] += size_[b];
+    --count_;
+    return a;
+  }
+};
+
+}  // namespace gviz::layout
+
+#endif  // GVIZARD_LAYOUT_DISJOINT_SETS_HPP_
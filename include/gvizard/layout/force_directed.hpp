@@ -0,0 +1,310 @@
+#ifndef GVIZARD_LAYOUT_FORCE_DIRECTED_HPP_
+#define GVIZARD_LAYOUT_FORCE_DIRECTED_HPP_
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <numeric>
+#include <optional>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+#include "gvizard/layout/barnes_hut.hpp"
+#include "gvizard/layout/coarsening.hpp"
+#include "gvizard/layout/layout_graph.hpp"
+#include "gvizard/parallel/parallel_for.hpp"
+
+#include "gvizard/attrs/damping.hpp"
+#include "gvizard/attrs/dim.hpp"
+#include "gvizard/attrs/epsilon.hpp"
+#include "gvizard/attrs/k.hpp"
+#include "gvizard/attrs/maxiter.hpp"
+#include "gvizard/attrs/repulsiveforce.hpp"
+
+namespace gviz::layout {
+
+/** parameters of `force_directed`, defaults being those of the
+ *  attributes they're named after.
+ */
+struct ForceOptions final {
+  /** 2 or 3, the number of axes of positions. */
+  int dim = attrs::Dim::get_default_value();
+
+  /** ideal length of edges in inches. */
+  double K = attrs::Kvalue::get_default_value();
+
+  /** most iterations, 600 if unset. */
+  std::optional<int> maxiter = attrs::MaxIter::get_default_value();
+
+  /** iterations stop once nodes move less than this times K on
+   *  average, 0.001 if unset.
+   */
+  std::optional<double> epsilon = attrs::Epsilon::get_default_value();
+
+  /** part of each step nodes move by. */
+  double damping = attrs::Damping::get_default_value();
+
+  /** how fast repulsion falls off with distance, its exponent. */
+  double repulsiveforce = attrs::RepulsiveForce::get_default_value();
+
+  /** cells of the Barnes-Hut tree smaller than this times their
+   *  distance are taken as a whole.
+   */
+  double theta = 1.2;
+
+  /** seeds random initial positions. */
+  uint32_t seed = 1;
+
+  /** whether to lay out ever coarser graphs of the graph first, each
+   *  one's layout being where nodes of the next finer one start.
+   */
+  bool multilevel = true;
+
+  /** maximum count of threads, 0 means default_concurrency(). */
+  unsigned threads = 0;
+};
+
+namespace detail {
+
+constexpr int    default_maxiter = 600;
+constexpr double default_epsilon = .001;
+
+// relative strength of repulsion and the factor steps shrink by, as
+// suggested by Hu in "Efficient and High Quality Force-Directed Graph
+// Drawing".
+constexpr double repulsion_strength = .2;
+constexpr double step_cooling       = .9;
+
+/** checks that `dim` is one `force_directed` handles.
+ *
+ * @throws std::invalid_argument if it is neither 2 nor 3.
+ */
+inline void check_dimensions(int dim)
+{
+  if (dim != 2 && dim != 3)
+    throw std::invalid_argument("layouts are of 2 or 3 dimensions");
+}
+
+/** coordinates of `count` nodes spread uniformly over a square, or a
+ *  cube, that fits them `spacing` apart.
+ */
+template <std::size_t D>
+Coords<D> random_coords(std::size_t count, double spacing, uint32_t seed)
+{
+  std::mt19937 random(seed);
+  const double side = spacing * std::sqrt(double(std::max<std::size_t>(
+                                  count, 1)));
+  std::uniform_real_distribution<double> coord(0., side);
+
+  Coords<D> coords{};
+  for (auto& axis : coords)
+    axis.resize(count);
+  for (std::size_t i = 0; i < count; ++i)
+    for (std::size_t axis = 0; axis < D; ++axis)
+      coords[axis][i] = coord(random);
+  return coords;
+}
+
+/** moves nodes at `coords` by spring-electrical forces until they settle
+ *  or iterations run out, nodes of `masses` repelling others as much as
+ *  that many nodes would.
+ *
+ * @returns count of iterations made.
+ */
+template <std::size_t D>
+std::size_t spring_electrical(const LayoutGraph& graph, Coords<D>& coords,
+                              const ForceOptions& options,
+                              const std::vector<double>& masses = {})
+{
+  const std::size_t count = graph.node_count();
+  if (count < 2)
+    return 0;
+
+  const double K       = options.K > 0. ? options.K : 1.;
+  const double power   = options.repulsiveforce;
+  const double epsilon = options.epsilon.value_or(default_epsilon);
+  const auto   maxiter =
+    std::size_t(std::max(options.maxiter.value_or(default_maxiter), 0));
+  const double strength = repulsion_strength * std::pow(K, 1. + power);
+
+  constexpr std::size_t grain = 1024;
+  const std::size_t blocks = (count + grain - 1) / grain;
+
+  BarnesHut<D>        tree{};
+  Coords<D>           forces{};
+  std::vector<double> energies(blocks), moves(blocks);
+  for (auto& axis : forces)
+    axis.resize(count);
+
+  double step = K, last_energy = std::numeric_limits<double>::max();
+  int    progress = 0;
+
+  std::size_t iteration = 0;
+  while (iteration < maxiter) {
+    ++iteration;
+
+    tree.build(coords, masses, options.threads);
+    for (auto& axis : forces)
+      std::fill(axis.begin(), axis.end(), 0.);
+    tree.add_repulsion(forces, strength, power, options.theta,
+                       options.threads);
+
+    // springs pull by the square of their length over K.
+    parallel::parallel_for(count, [&](std::size_t begin, std::size_t end) {
+      for (std::size_t node = begin; node < end; ++node) {
+        const auto pull = [&](uint32_t other) {
+          if (other == node)
+            return;
+
+          std::array<double, D> delta{};
+          double length2 = 0.;
+          for (std::size_t axis = 0; axis < D; ++axis) {
+            delta[axis] = coords[axis][other] - coords[axis][node];
+            length2 += delta[axis] * delta[axis];
+          }
+
+          const double scale = std::sqrt(length2) / K;
+          for (std::size_t axis = 0; axis < D; ++axis)
+            forces[axis][node] += delta[axis] * scale;
+        };
+
+        for (auto edge : graph.out_edges(node))
+          pull(graph.edge(edge).target);
+        for (auto edge : graph.in_edges(node))
+          pull(graph.edge(edge).source);
+      }
+    }, grain, options.threads);
+
+    // nodes move along their force by the step, whatever its size. sums
+    // are of fixed blocks, so they don't depend on thread count.
+    parallel::parallel_for_each_index(blocks, [&](std::size_t block) {
+      const std::size_t begin = block * grain;
+      const std::size_t end   = std::min(begin + grain, count);
+
+      double energy = 0., moved = 0.;
+      for (std::size_t node = begin; node < end; ++node) {
+        double norm2 = 0.;
+        for (std::size_t axis = 0; axis < D; ++axis)
+          norm2 += forces[axis][node] * forces[axis][node];
+        if (!(norm2 > 0.) || !std::isfinite(norm2))
+          continue;
+
+        const double norm  = std::sqrt(norm2);
+        const double scale = options.damping * step / norm;
+        for (std::size_t axis = 0; axis < D; ++axis)
+          coords[axis][node] += forces[axis][node] * scale;
+
+        energy += norm2;
+        moved  += options.damping * step;
+      }
+      energies[block] = energy;
+      moves[block]    = moved;
+    }, 1, options.threads);
+
+    const double energy = std::accumulate(energies.begin(), energies.end(),
+                                          0.);
+    const double moved  = std::accumulate(moves.begin(), moves.end(), 0.);
+
+    // steps grow back after steady progress, and shrink otherwise.
+    if (energy < last_energy) {
+      if (++progress >= 5) {
+        progress = 0;
+        step /= step_cooling;
+      }
+    }
+    else {
+      progress = 0;
+      step *= step_cooling;
+    }
+    last_energy = energy;
+
+    if (moved < epsilon * K * double(count))
+      break;
+  }
+  return iteration;
+}
+
+// part of K nodes of a group come apart by as they're laid out finer,
+// and part of the iterations levels finer than the coarsest take.
+constexpr double prolong_jitter   = .1;
+constexpr double finer_iterations = 1. / 6.;
+
+template <std::size_t D>
+Layout force_directed(const LayoutGraph& graph, const ForceOptions& options)
+{
+  const double K = options.K > 0. ? options.K : 1.;
+
+  std::vector<CoarseLevel> levels{};
+  if (options.multilevel) {
+    CoarseningOptions coarsening{};
+    coarsening.seed    = options.seed;
+    coarsening.threads = options.threads;
+    levels = coarsen(graph, coarsening);
+  }
+
+  const auto& coarsest = levels.empty() ? graph : levels.back().graph;
+  auto coords = random_coords<D>(coarsest.node_count(), K, options.seed);
+  spring_electrical<D>(coarsest, coords, options,
+                       levels.empty() ? std::vector<double>{}
+                                      : levels.back().masses);
+
+  // finer levels start near where they settle, so they take fewer
+  // iterations.
+  ForceOptions finer = options;
+  finer.maxiter = int(std::ceil(
+    options.maxiter.value_or(default_maxiter) * finer_iterations));
+  for (std::size_t level = levels.size(); level-- > 0;) {
+    coords = prolong<D>(levels[level], coords, prolong_jitter * K,
+                        options.seed, options.threads);
+    if (level == 0)
+      spring_electrical<D>(graph, coords, finer);
+    else
+      spring_electrical<D>(levels[level - 1].graph, coords, finer,
+                           levels[level - 1].masses);
+  }
+  return make_layout<D>(graph, coords);
+}
+
+}  // namespace detail
+
+/** lays out `graph` by spring-electrical forces, in the manner of sfdp:
+ *  edges pull their ends together by the square of their length, and
+ *  all nodes push each other apart, approximated by a Barnes-Hut tree.
+ *
+ * nodes move along their force by a step that adapts to progress, as
+ * described by Hu in "Efficient and High Quality Force-Directed Graph
+ * Drawing". unless `multilevel` is off, the graph is `coarsen`ed and
+ * the coarsest one laid out from random positions first, each finer
+ * one starting where its groups ended up. forces are computed across
+ * threads, the result doesn't depend on thread count.
+ *
+ * node positions are centers in points, the lower left corner of the
+ * drawing at the origin. edges are left straight.
+ *
+ * @throws std::invalid_argument if `dim` is neither 2 nor 3.
+ */
+inline Layout force_directed(const LayoutGraph& graph,
+                             const ForceOptions& options = {})
+{
+  detail::check_dimensions(options.dim);
+  return options.dim == 3 ? detail::force_directed<3>(graph, options)
+                          : detail::force_directed<2>(graph, options);
+}
+
+/** lays out `graph` by `force_directed`, setting `pos` of its nodes.
+ *  graph attributes are given in `options`, see `make_layout_input`.
+ */
+template <typename GraphT>
+void force_directed_layout(GraphT& graph, const ForceOptions& options = {})
+{
+  const auto input = make_layout_input(graph);
+  write_layout(graph, input, force_directed(input.graph, options));
+}
+
+}  // namespace gviz::layout
+
+#endif  // GVIZARD_LAYOUT_FORCE_DIRECTED_HPP_
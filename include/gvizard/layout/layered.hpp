@@ -0,0 +1,1490 @@
+#ifndef GVIZARD_LAYOUT_LAYERED_HPP_
+#define GVIZARD_LAYOUT_LAYERED_HPP_
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <numeric>
+#include <optional>
+#include <stdexcept>
+#include <string_view>
+#include <utility>
+#include <variant>
+#include <vector>
+
+#include "gvizard/attrtypes/rank.hpp"
+#include "gvizard/layout/disjoint_sets.hpp"
+#include "gvizard/layout/layout_graph.hpp"
+#include "gvizard/layout/network_simplex.hpp"
+#include "gvizard/parallel/parallel_for.hpp"
+
+#include "gvizard/attrs/mclimit.hpp"
+#include "gvizard/attrs/nodesep.hpp"
+#include "gvizard/attrs/nslimit.hpp"
+#include "gvizard/attrs/rank.hpp"
+#include "gvizard/attrs/rankdir.hpp"
+#include "gvizard/attrs/ranksep.hpp"
+#include "gvizard/attrs/searchsize.hpp"
+
+namespace gviz::layout {
+
+/** nodes constrained to a rank, like those of a subgraph with `rank`.
+ *
+ * nodes of all groups of type `min` or `source` share the minimum rank,
+ * which has no other nodes if any of them is a `source`. likewise for
+ * `max` and `sink`.
+ */
+struct RankGroup final {
+  attrtypes::RankType   type = attrtypes::RankType::same;
+  std::vector<uint32_t> nodes{};
+};
+
+/** order kept between edges of a node, see `attrs::Ordering`. */
+enum class EdgeOrdering : uint8_t {
+  none = 0,
+  out,  ///< heads of out edges are left to right in edge order.
+  in,   ///< tails of in edges are left to right in edge order.
+};
+
+/** parses a value of `attrs::Ordering`, anything unknown is none. */
+constexpr EdgeOrdering to_edge_ordering(std::string_view value) noexcept
+{
+  if (value == "out")
+    return EdgeOrdering::out;
+  if (value == "in")
+    return EdgeOrdering::in;
+  return EdgeOrdering::none;
+}
+
+/** parameters of `layered`, defaults being those of the attributes
+ *  they're named after.
+ */
+struct LayeredOptions final {
+  attrtypes::RankDir rankdir  = attrs::RankDir::get_default_value();
+
+  /** space between ranks in inches, 0.5 if unset. a list gives space
+   *  below each rank, its last value repeating.
+   */
+  attrs::RankSepType ranksep  = attrs::RankSep::get_default_value();
+
+  /** space between nodes of a rank in inches. */
+  double             nodesep  = attrs::NodeSep::get_default_value();
+
+  EdgeOrdering       ordering = EdgeOrdering::none;
+
+  /** scales iterations of crossing minimization. */
+  double             mclimit  = attrs::MCLimit::get_default_value();
+
+  /** limits network simplex to this many iterations per node. */
+  std::optional<double> nslimit = attrs::NSLimit::get_default_value();
+
+  int                searchsize = attrs::SearchSize::get_default_value();
+
+  /** edges end before their head, which is given as arrow end point. */
+  bool               directed = true;
+
+  std::vector<RankGroup> rank_groups{};
+
+  /** maximum count of threads, 0 means default_concurrency(). */
+  unsigned           threads = 0;
+};
+
+namespace detail {
+
+constexpr double arrow_length = 10.;
+
+/** reverses edges closing a cycle, found by depth first search. */
+inline void break_cycles(std::size_t node_count,
+                         std::vector<NetworkSimplex::Edge>& edges)
+{
+  std::vector<uint32_t> offsets(node_count + 1, 0);
+  for (const auto& edge : edges)
+    ++offsets[edge.tail + 1];
+  std::partial_sum(offsets.begin(), offsets.end(), offsets.begin());
+
+  std::vector<uint32_t> out(edges.size());
+  std::vector<uint32_t> fill(offsets.begin(), offsets.end() - 1);
+  for (std::size_t i = 0; i < edges.size(); ++i)
+    out[fill[edges[i].tail]++] = uint32_t(i);
+
+  enum : uint8_t { unvisited = 0, active, done };
+  std::vector<uint8_t> state(node_count, unvisited);
+  std::vector<char>    back(edges.size(), 0);
+
+  std::vector<std::pair<uint32_t, uint32_t>> stack{};
+  for (uint32_t start = 0; start < node_count; ++start) {
+    if (state[start] != unvisited)
+      continue;
+
+    state[start] = active;
+    stack.emplace_back(start, offsets[start]);
+    while (!stack.empty()) {
+      const auto node = stack.back().first;
+      if (stack.back().second == offsets[node + 1]) {
+        state[node] = done;
+        stack.pop_back();
+        continue;
+      }
+
+      const auto edge = out[stack.back().second++];
+      const auto head = edges[edge].head;
+      if (state[head] == active)
+        back[edge] = 1;
+      else if (state[head] == unvisited) {
+        state[head] = active;
+        stack.emplace_back(head, offsets[head]);
+      }
+    }
+  }
+
+  for (std::size_t i = 0; i < edges.size(); ++i)
+    if (back[i])
+      std::swap(edges[i].tail, edges[i].head);
+}
+
+/** moves nodes having equal in and out weights to the least populated
+ *  rank they fit in, so that ranks are of more even size.
+ */
+inline void balance_ranks(std::vector<int>& ranks,
+                          const std::vector<uint32_t>& sizes,
+                          const std::vector<NetworkSimplex::Edge>& edges,
+                          uint32_t fixed_min, uint32_t fixed_max)
+{
+  const std::size_t count = ranks.size();
+  if (count == 0)
+    return;
+
+  const int max_rank = *std::max_element(ranks.begin(), ranks.end());
+
+  std::vector<std::size_t> populations(std::size_t(max_rank) + 1, 0);
+  for (std::size_t i = 0; i < count; ++i)
+    populations[std::size_t(ranks[i])] += sizes[i];
+
+  std::vector<uint32_t> offsets(count + 1, 0);
+  for (const auto& edge : edges) {
+    ++offsets[edge.tail + 1];
+    ++offsets[edge.head + 1];
+  }
+  std::partial_sum(offsets.begin(), offsets.end(), offsets.begin());
+
+  std::vector<uint32_t> incident(edges.size() * 2);
+  std::vector<uint32_t> fill(offsets.begin(), offsets.end() - 1);
+  for (std::size_t i = 0; i < edges.size(); ++i) {
+    incident[fill[edges[i].tail]++] = uint32_t(i);
+    incident[fill[edges[i].head]++] = uint32_t(i);
+  }
+
+  for (uint32_t node = 0; node < count; ++node) {
+    if (node == fixed_min || node == fixed_max)
+      continue;
+
+    double in_weight = 0., out_weight = 0.;
+    int low = 0, high = max_rank;
+    for (auto i = offsets[node]; i < offsets[node + 1]; ++i) {
+      const auto& edge = edges[incident[i]];
+      if (edge.head == node) {
+        in_weight += edge.weight;
+        low = std::max(low, ranks[edge.tail] + edge.minlen);
+      }
+      else {
+        out_weight += edge.weight;
+        high = std::min(high, ranks[edge.head] - edge.minlen);
+      }
+    }
+
+    if (in_weight != out_weight)
+      continue;
+
+    int choice = low;
+    for (int rank = low + 1; rank <= high; ++rank)
+      if (populations[std::size_t(rank)] < populations[std::size_t(choice)])
+        choice = rank;
+
+    populations[std::size_t(ranks[node])] -= sizes[node];
+    populations[std::size_t(choice)]      += sizes[node];
+    ranks[node] = choice;
+  }
+
+  const int min_rank = *std::min_element(ranks.begin(), ranks.end());
+  for (auto& rank : ranks)
+    rank -= min_rank;
+}
+
+/** ranks of nodes of `graph`: rank groups are merged into single nodes,
+ *  cycles broken and the rest left to network simplex.
+ *
+ * @throws std::out_of_range if a rank group has a nonexistent node.
+ */
+inline std::vector<int> rank_nodes(const LayoutGraph& graph,
+                                   const LayeredOptions& options)
+{
+  using attrtypes::RankType;
+
+  const std::size_t count = graph.node_count();
+
+  DisjointSets sets(count);
+  uint32_t min_node = no_node, max_node = no_node;
+  int      min_gap  = 0,       max_gap  = 0;
+
+  for (const auto& group : options.rank_groups) {
+    if (group.nodes.empty() || group.type == RankType::none)
+      continue;
+
+    const auto leader = group.nodes.front();
+    for (auto node : group.nodes) {
+      if (node >= count)
+        throw std::out_of_range("rank group of nonexistent node");
+      sets.unite(leader, node);
+    }
+
+    switch (group.type) {
+      case RankType::source:
+        min_gap = 1;
+        [[fallthrough]];
+      case RankType::min:
+        min_node = min_node == no_node ? leader
+                                       : sets.unite(min_node, leader);
+        break;
+      case RankType::sink:
+        max_gap = 1;
+        [[fallthrough]];
+      case RankType::max:
+        max_node = max_node == no_node ? leader
+                                       : sets.unite(max_node, leader);
+        break;
+      default:
+        break;
+    }
+  }
+
+  // rank nodes, one for each set of nodes sharing a rank.
+  std::vector<uint32_t> rank_node(count);
+  std::vector<uint32_t> index_of(count, no_node);
+  std::vector<uint32_t> sizes{};
+  for (std::size_t node = 0; node < count; ++node) {
+    const auto root = sets.find(node);
+    if (index_of[root] == no_node) {
+      index_of[root] = uint32_t(sizes.size());
+      sizes.push_back(0);
+    }
+    rank_node[node] = index_of[root];
+    ++sizes[index_of[root]];
+  }
+
+  const std::size_t rank_count = sizes.size();
+
+  const uint32_t first = min_node == no_node ? no_node : rank_node[min_node];
+  uint32_t       last  = max_node == no_node ? no_node : rank_node[max_node];
+  if (last == first)
+    last = no_node;
+
+  std::vector<NetworkSimplex::Edge> edges{};
+  edges.reserve(graph.edge_count());
+  for (const auto& edge : graph.edges()) {
+    auto tail = rank_node[edge.source];
+    auto head = rank_node[edge.target];
+    if (tail == head)
+      continue;
+
+    // edges go out of the minimum rank and into the maximum one.
+    if ((head == first || tail == last) && tail != first && head != last)
+      std::swap(tail, head);
+    edges.push_back(
+      NetworkSimplex::Edge{ tail, head, std::max(edge.minlen, 0),
+                            edge.weight });
+  }
+
+  break_cycles(rank_count, edges);
+
+  // parallel edges are merged, they pull as much as all of them.
+  std::sort(edges.begin(), edges.end(), [](const auto& lhs, const auto& rhs) {
+    return std::pair{ lhs.tail, lhs.head } < std::pair{ rhs.tail, rhs.head };
+  });
+
+  std::size_t merged = 0;
+  for (std::size_t i = 0; i < edges.size(); ++i) {
+    if (merged != 0 && edges[merged - 1].tail == edges[i].tail
+                    && edges[merged - 1].head == edges[i].head) {
+      edges[merged - 1].weight += edges[i].weight;
+      edges[merged - 1].minlen = std::max(edges[merged - 1].minlen,
+                                          edges[i].minlen);
+    }
+    else
+      edges[merged++] = edges[i];
+  }
+  edges.resize(merged);
+
+  if (first != no_node || last != no_node) {
+    std::vector<char> has_in(rank_count, 0), has_out(rank_count, 0);
+    for (const auto& edge : edges) {
+      has_out[edge.tail] = 1;
+      has_in[edge.head]  = 1;
+    }
+
+    for (uint32_t node = 0; node < rank_count; ++node) {
+      if (first != no_node && node != first && !has_in[node])
+        edges.push_back(NetworkSimplex::Edge{ first, node, min_gap, 0. });
+      if (last != no_node && node != last && !has_out[node])
+        edges.push_back(NetworkSimplex::Edge{ node, last, max_gap, 0. });
+    }
+  }
+
+  NetworkSimplex simplex(rank_count, std::move(edges));
+
+  std::size_t max_iterations = std::numeric_limits<std::size_t>::max();
+  if (options.nslimit)
+    max_iterations = std::size_t(
+      std::max(0., *options.nslimit * double(rank_count)));
+
+  simplex.solve(max_iterations,
+                std::size_t(std::max(options.searchsize, 1)));
+
+  auto ranks = simplex.ranks();
+  balance_ranks(ranks, sizes, simplex.edges(), first, last);
+
+  std::vector<int> result(count);
+  for (std::size_t node = 0; node < count; ++node)
+    result[node] = ranks[rank_node[node]];
+  return result;
+}
+
+enum class RouteKind : uint8_t { chain = 0, flat, loop };
+
+/** ranked nodes, real ones followed by virtual ones making up chains of
+ *  edges spanning several ranks, linked by segments between adjacent
+ *  ranks.
+ */
+struct Layering final {
+  std::size_t real_count = 0;
+
+  // by node: rank, extent along and across ranks, position in rank.
+  std::vector<int>      rank{};
+  std::vector<double>   breadth{};
+  std::vector<double>   depth{};
+  std::vector<uint32_t> order{};
+
+  std::vector<std::vector<uint32_t>> layers{};
+
+  // segments from a node to one of the next rank.
+  std::vector<uint32_t> upper{};
+  std::vector<uint32_t> lower{};
+  std::vector<uint32_t> down_offsets{};
+  std::vector<uint32_t> down{};
+  std::vector<uint32_t> up_offsets{};
+  std::vector<uint32_t> up{};
+
+  // by edge: nodes it goes through, from its upper to its lower end.
+  std::vector<RouteKind> kind{};
+  std::vector<char>      reversed{};
+  std::vector<uint32_t>  route_offsets{};
+  std::vector<uint32_t>  route{};
+
+  bool is_virtual(uint32_t node) const noexcept
+  {
+    return node >= real_count;
+  }
+
+  std::size_t node_count() const noexcept { return rank.size(); }
+
+  /** segments to the next rank. */
+  IndexRange downs(uint32_t node) const noexcept
+  {
+    return IndexRange{ down.data() + down_offsets[node],
+                       down.data() + down_offsets[node + 1] };
+  }
+
+  /** segments from the previous rank. */
+  IndexRange ups(uint32_t node) const noexcept
+  {
+    return IndexRange{ up.data() + up_offsets[node],
+                       up.data() + up_offsets[node + 1] };
+  }
+
+  IndexRange route_of(std::size_t edge) const noexcept
+  {
+    return IndexRange{ route.data() + route_offsets[edge],
+                       route.data() + route_offsets[edge + 1] };
+  }
+};
+
+inline Layering make_layering(const LayoutGraph& graph,
+                              const std::vector<int>& ranks,
+                              bool sideways)
+{
+  Layering layering{};
+  layering.real_count = graph.node_count();
+  layering.rank       = ranks;
+
+  for (const auto& node : graph.nodes()) {
+    layering.breadth.push_back(sideways ? node.height : node.width);
+    layering.depth.push_back(sideways ? node.width : node.height);
+  }
+
+  const auto add_node = [&](int rank) {
+    layering.rank.push_back(rank);
+    layering.breadth.push_back(0.);
+    layering.depth.push_back(0.);
+    return uint32_t(layering.rank.size() - 1);
+  };
+
+  layering.route_offsets.push_back(0);
+  for (const auto& edge : graph.edges()) {
+    const auto source = edge.source;
+    const auto target = edge.target;
+    const int  rank_s = ranks[source];
+    const int  rank_t = ranks[target];
+
+    bool reversed = false;
+    if (source == target) {
+      layering.kind.push_back(RouteKind::loop);
+      layering.route.push_back(source);
+    }
+    else if (rank_s == rank_t) {
+      layering.kind.push_back(RouteKind::flat);
+      layering.route.push_back(source);
+      layering.route.push_back(target);
+    }
+    else {
+      reversed = rank_s > rank_t;
+      const auto top    = reversed ? target : source;
+      const auto bottom = reversed ? source : target;
+
+      layering.kind.push_back(RouteKind::chain);
+      layering.route.push_back(top);
+
+      auto previous = top;
+      for (int rank = layering.rank[top] + 1;
+           rank < layering.rank[bottom]; ++rank) {
+        const auto node = add_node(rank);
+        layering.upper.push_back(previous);
+        layering.lower.push_back(node);
+        layering.route.push_back(node);
+        previous = node;
+      }
+      layering.upper.push_back(previous);
+      layering.lower.push_back(bottom);
+      layering.route.push_back(bottom);
+    }
+
+    layering.reversed.push_back(reversed);
+    layering.route_offsets.push_back(uint32_t(layering.route.size()));
+  }
+
+  const std::size_t count = layering.node_count();
+  const auto index = [&](const std::vector<uint32_t>& ends,
+                         std::vector<uint32_t>& offsets,
+                         std::vector<uint32_t>& segments) {
+    offsets.assign(count + 1, 0);
+    for (auto node : ends)
+      ++offsets[node + 1];
+    std::partial_sum(offsets.begin(), offsets.end(), offsets.begin());
+
+    segments.resize(ends.size());
+    std::vector<uint32_t> fill(offsets.begin(), offsets.end() - 1);
+    for (std::size_t i = 0; i < ends.size(); ++i)
+      segments[fill[ends[i]]++] = uint32_t(i);
+  };
+  index(layering.upper, layering.down_offsets, layering.down);
+  index(layering.lower, layering.up_offsets, layering.up);
+
+  int max_rank = -1;
+  for (auto rank : layering.rank)
+    max_rank = std::max(max_rank, rank);
+  layering.layers.resize(std::size_t(max_rank + 1));
+  layering.order.assign(count, 0);
+
+  return layering;
+}
+
+/** initial order of ranks, by breadth first search from the topmost
+ *  nodes, so that connected nodes start out close.
+ */
+inline void init_order(Layering& layering)
+{
+  const std::size_t count = layering.node_count();
+
+  std::vector<uint32_t> by_rank(count);
+  std::iota(by_rank.begin(), by_rank.end(), uint32_t(0));
+  std::stable_sort(by_rank.begin(), by_rank.end(),
+                   [&](uint32_t lhs, uint32_t rhs) {
+                     return layering.rank[lhs] < layering.rank[rhs];
+                   });
+
+  std::vector<char>     reached(count, 0);
+  std::vector<uint32_t> queue{};
+  queue.reserve(count);
+
+  for (auto start : by_rank) {
+    if (reached[start])
+      continue;
+
+    reached[start] = 1;
+    queue.push_back(start);
+    for (std::size_t i = queue.size() - 1; i < queue.size(); ++i) {
+      const auto node = queue[i];
+      auto& layer = layering.layers[std::size_t(layering.rank[node])];
+      layering.order[node] = uint32_t(layer.size());
+      layer.push_back(node);
+
+      const auto visit = [&](uint32_t other) {
+        if (!reached[other]) {
+          reached[other] = 1;
+          queue.push_back(other);
+        }
+      };
+      for (auto segment : layering.downs(node))
+        visit(layering.lower[segment]);
+      for (auto segment : layering.ups(node))
+        visit(layering.upper[segment]);
+    }
+  }
+}
+
+/** sets of nodes of a rank to be kept in a given order. */
+struct OrderGroups final {
+  std::vector<std::vector<uint32_t>> nodes{};
+  std::vector<std::vector<uint32_t>> by_layer{};
+  std::vector<uint32_t>              group_of{};
+};
+
+inline OrderGroups make_order_groups(const LayoutGraph& graph,
+                                     const Layering& layering,
+                                     EdgeOrdering ordering)
+{
+  OrderGroups groups{};
+  groups.by_layer.resize(layering.layers.size());
+  groups.group_of.assign(layering.node_count(), no_node);
+
+  if (ordering == EdgeOrdering::none)
+    return groups;
+
+  std::vector<uint32_t> members{};
+  for (uint32_t node = 0; node < graph.node_count(); ++node) {
+    const bool out = ordering == EdgeOrdering::out;
+
+    members.clear();
+    for (auto edge : out ? graph.out_edges(node) : graph.in_edges(node)) {
+      if (layering.kind[edge] != RouteKind::chain || layering.reversed[edge])
+        continue;
+
+      // the neighbour of node along the edge's route.
+      const auto route = layering.route_of(edge);
+      const auto next  = out ? route[1] : route[route.size() - 2];
+      if (std::find(members.begin(), members.end(), next) == members.end())
+        members.push_back(next);
+    }
+
+    if (members.size() < 2)
+      continue;
+
+    const auto id = uint32_t(groups.nodes.size());
+    for (auto member : members)
+      if (groups.group_of[member] == no_node)
+        groups.group_of[member] = id;
+
+    groups.by_layer[std::size_t(layering.rank[members.front()])]
+      .push_back(id);
+    groups.nodes.push_back(members);
+  }
+  return groups;
+}
+
+/** puts groups of a rank back into their order, in place of each other. */
+inline void fix_order(Layering& layering, const OrderGroups& groups,
+                      std::size_t rank)
+{
+  auto& layer = layering.layers[rank];
+
+  std::vector<uint32_t> positions{};
+  for (auto id : groups.by_layer[rank]) {
+    const auto& members = groups.nodes[id];
+
+    positions.clear();
+    for (auto member : members)
+      positions.push_back(layering.order[member]);
+    std::sort(positions.begin(), positions.end());
+
+    for (std::size_t i = 0; i < members.size(); ++i) {
+      layer[positions[i]] = members[i];
+      layering.order[members[i]] = positions[i];
+    }
+  }
+}
+
+/** count of crossings between segments from `rank` to the next one, by
+ *  the accumulator tree of Barth et al.
+ */
+inline std::size_t count_crossings(const Layering& layering,
+                                   std::size_t rank)
+{
+  const std::size_t lower_size = layering.layers[rank + 1].size();
+  if (lower_size < 2)
+    return 0;
+
+  std::vector<uint32_t> positions{};
+  for (auto node : layering.layers[rank]) {
+    const auto begin = positions.size();
+    for (auto segment : layering.downs(node))
+      positions.push_back(layering.order[layering.lower[segment]]);
+    std::sort(positions.begin() + std::ptrdiff_t(begin), positions.end());
+  }
+
+  std::size_t first = 1;
+  while (first < lower_size)
+    first *= 2;
+  std::vector<uint32_t> tree(2 * first - 1, 0);
+  --first;
+
+  std::size_t crossings = 0;
+  for (auto position : positions) {
+    std::size_t idx = position + first;
+    ++tree[idx];
+    while (idx > 0) {
+      if (idx % 2 == 1)
+        crossings += tree[idx + 1];
+      idx = (idx - 1) / 2;
+      ++tree[idx];
+    }
+  }
+  return crossings;
+}
+
+inline std::size_t total_crossings(const Layering& layering,
+                                   unsigned threads)
+{
+  const std::size_t layers = layering.layers.size();
+  if (layers < 2)
+    return 0;
+
+  std::vector<std::size_t> counts(layers - 1, 0);
+  parallel::parallel_for_each_index(
+    layers - 1,
+    [&](std::size_t rank) { counts[rank] = count_crossings(layering, rank); },
+    4, threads);
+
+  return std::accumulate(counts.begin(), counts.end(), std::size_t(0));
+}
+
+/** weighted median of sorted `positions`, -1 if there are none. */
+inline double median_value(const std::vector<uint32_t>& positions) noexcept
+{
+  const std::size_t size = positions.size();
+  if (size == 0)
+    return -1.;
+  if (size == 1)
+    return positions[0];
+  if (size == 2)
+    return (positions[0] + positions[1]) / 2.;
+
+  const std::size_t mid = size / 2;
+  if (size % 2 == 1)
+    return positions[mid];
+
+  const double left  = positions[mid - 1] - positions[0];
+  const double right = positions[size - 1] - positions[mid];
+  if (left + right == 0.)
+    return (positions[mid - 1] + positions[mid]) / 2.;
+
+  return (positions[mid - 1] * right + positions[mid] * left)
+       / (left + right);
+}
+
+/** sorts `rank` by medians of neighbours above or below, nodes without
+ *  any keeping their position. ties are flipped if `reverse`.
+ */
+inline void reorder(Layering& layering, const OrderGroups& groups,
+                    std::size_t rank, bool from_upper, bool reverse)
+{
+  auto& layer = layering.layers[rank];
+
+  std::vector<uint32_t>                 positions{};
+  std::vector<uint32_t>                 slots{};
+  std::vector<std::pair<double, uint32_t>> movable{};
+
+  for (uint32_t i = 0; i < layer.size(); ++i) {
+    const auto node = layer[i];
+
+    positions.clear();
+    if (from_upper)
+      for (auto segment : layering.ups(node))
+        positions.push_back(layering.order[layering.upper[segment]]);
+    else
+      for (auto segment : layering.downs(node))
+        positions.push_back(layering.order[layering.lower[segment]]);
+    std::sort(positions.begin(), positions.end());
+
+    if (const double median = median_value(positions); median >= 0.) {
+      slots.push_back(i);
+      movable.emplace_back(median, node);
+    }
+  }
+
+  if (reverse)
+    std::reverse(movable.begin(), movable.end());
+  std::stable_sort(movable.begin(), movable.end(),
+                   [](const auto& lhs, const auto& rhs) {
+                     return lhs.first < rhs.first;
+                   });
+
+  for (std::size_t i = 0; i < slots.size(); ++i)
+    layer[slots[i]] = movable[i].second;
+  for (uint32_t i = 0; i < layer.size(); ++i)
+    layering.order[layer[i]] = i;
+
+  fix_order(layering, groups, rank);
+}
+
+/** crossings among segments to sorted positions `lhs` of a left node and
+ *  `rhs` of a right one, as they are and if they were swapped.
+ */
+inline std::pair<std::size_t, std::size_t>
+pair_crossings(IndexRange lhs, IndexRange rhs) noexcept
+{
+  std::size_t as_is = 0, swapped = 0;
+  std::size_t above = 0, below = 0;
+  for (auto position : rhs) {
+    while (above < lhs.size() && lhs[above] <= position)
+      ++above;
+    while (below < lhs.size() && lhs[below] < position)
+      ++below;
+    as_is   += lhs.size() - above;
+    swapped += below;
+  }
+  return { as_is, swapped };
+}
+
+/** swaps neighbours of `rank` as long as it removes crossings.
+ *
+ * @returns count of crossings removed.
+ */
+inline std::size_t transpose_rank(Layering& layering,
+                                  const OrderGroups& groups,
+                                  std::size_t rank, bool reverse)
+{
+  auto& layer = layering.layers[rank];
+
+  // ranks around stay put, so positions of each node's neighbours above
+  // and below are sorted once, and follow the node by its slot.
+  std::vector<uint32_t> offsets{ 0 };
+  std::vector<uint32_t> positions{};
+  std::vector<uint32_t> slots(layer.size());
+  for (uint32_t i = 0; i < layer.size(); ++i) {
+    slots[i] = i;
+    for (bool from_upper : { true, false }) {
+      if (from_upper)
+        for (auto segment : layering.ups(layer[i]))
+          positions.push_back(layering.order[layering.upper[segment]]);
+      else
+        for (auto segment : layering.downs(layer[i]))
+          positions.push_back(layering.order[layering.lower[segment]]);
+
+      std::sort(positions.begin() + offsets.back(), positions.end());
+      offsets.push_back(uint32_t(positions.size()));
+    }
+  }
+
+  const auto range = [&](uint32_t slot, bool from_upper) {
+    const auto idx = 2 * slot + (from_upper ? 0 : 1);
+    return IndexRange{ positions.data() + offsets[idx],
+                       positions.data() + offsets[idx + 1] };
+  };
+
+  std::size_t total = 0, delta = 0;
+  do {
+    delta = 0;
+    for (uint32_t i = 0; i + 1 < layer.size(); ++i) {
+      const auto left  = layer[i];
+      const auto right = layer[i + 1];
+
+      const auto group = groups.group_of[left];
+      if (group != no_node && group == groups.group_of[right])
+        continue;
+
+      const auto upper = pair_crossings(range(slots[i], true),
+                                        range(slots[i + 1], true));
+      const auto lower = pair_crossings(range(slots[i], false),
+                                        range(slots[i + 1], false));
+      const auto as_is   = upper.first + lower.first;
+      const auto swapped = upper.second + lower.second;
+
+      if (swapped < as_is || (as_is > 0 && reverse && swapped == as_is)) {
+        std::swap(layer[i], layer[i + 1]);
+        std::swap(slots[i], slots[i + 1]);
+        layering.order[right] = i;
+        layering.order[left]  = i + 1;
+        delta += as_is - swapped;
+      }
+    }
+    total += delta;
+  } while (delta > 0);
+
+  return total;
+}
+
+/** calls `func(rank)` for ranks of each parity in turn, those of the
+ *  same parity across threads, as they are only read by each other.
+ *
+ * @param first first rank, followed by every other one, then the rest.
+ * @param last  rank past the last one, ranks go downward if it is less.
+ */
+template <typename F>
+void for_ranks_by_parity(std::ptrdiff_t first, std::ptrdiff_t last,
+                         unsigned threads, F&& func)
+{
+  const std::ptrdiff_t step  = first <= last ? 1 : -1;
+  const std::ptrdiff_t count = (last - first) * step;
+
+  for (std::ptrdiff_t phase = 0; phase < 2 && phase < count; ++phase)
+    parallel::parallel_for_each_index(
+      std::size_t((count - phase + 1) / 2),
+      [&](std::size_t idx) {
+        func(std::size_t(first + (phase + 2 * std::ptrdiff_t(idx)) * step));
+      },
+      1, threads);
+}
+
+/** orders ranks to reduce crossings by weighted median sweeps followed by
+ *  transposition of neighbours, keeping the best order found.
+ */
+inline void minimize_crossings(Layering& layering, const OrderGroups& groups,
+                               const LayeredOptions& options)
+{
+  const auto layers  = std::ptrdiff_t(layering.layers.size());
+  const auto threads = options.threads;
+
+  for (std::size_t rank = 0; rank < layering.layers.size(); ++rank)
+    fix_order(layering, groups, rank);
+
+  // ranks are transposed again only if they or a neighbour changed.
+  const auto transpose = [&](bool reverse) {
+    std::vector<std::size_t> removed(layering.layers.size(), 0);
+    std::vector<char>        candidate(layering.layers.size(), 1);
+    bool changed = true;
+    while (changed) {
+      for_ranks_by_parity(0, layers, threads, [&](std::size_t rank) {
+        removed[rank] = candidate[rank]
+                      ? transpose_rank(layering, groups, rank, reverse)
+                      : 0;
+      });
+
+      changed = false;
+      std::fill(candidate.begin(), candidate.end(), 0);
+      for (std::size_t rank = 0; rank < removed.size(); ++rank) {
+        if (removed[rank] == 0)
+          continue;
+
+        changed = true;
+        candidate[rank] = 1;
+        if (rank > 0)
+          candidate[rank - 1] = 1;
+        if (rank + 1 < candidate.size())
+          candidate[rank + 1] = 1;
+      }
+    }
+  };
+
+  const auto sweep = [&](bool downward, bool reverse) {
+    if (downward)
+      for_ranks_by_parity(1, layers, threads, [&](std::size_t rank) {
+        reorder(layering, groups, rank, true, reverse);
+      });
+    else
+      for_ranks_by_parity(layers - 2, -1, threads, [&](std::size_t rank) {
+        reorder(layering, groups, rank, false, reverse);
+      });
+  };
+
+  const auto max_iterations = std::size_t(std::max(0., 24. * options.mclimit));
+  const auto min_quit       = std::size_t(std::max(1., 8. * options.mclimit));
+  constexpr double convergence = .995;
+
+  std::size_t crossings = total_crossings(layering, threads);
+  std::size_t best      = crossings;
+  auto        best_layers = layering.layers;
+
+  std::size_t trying = 0;
+  for (std::size_t iter = 0; iter < max_iterations; ++iter) {
+    if (trying++ >= min_quit || crossings == 0)
+      break;
+
+    const bool reverse = iter % 4 < 2;
+    sweep(iter % 2 == 0, reverse);
+    transpose(reverse);
+
+    crossings = total_crossings(layering, threads);
+    if (crossings <= best) {
+      if (double(crossings) < convergence * double(best))
+        trying = 0;
+      best        = crossings;
+      best_layers = layering.layers;
+    }
+  }
+
+  layering.layers = std::move(best_layers);
+  for (const auto& layer : layering.layers)
+    for (uint32_t i = 0; i < layer.size(); ++i)
+      layering.order[layer[i]] = i;
+
+  if (max_iterations != 0)
+    transpose(false);
+}
+
+/** marks segments crossing an inner segment, one between two virtual
+ *  nodes, which is to stay straight rather than them.
+ */
+inline std::vector<char> find_conflicts(const Layering& layering,
+                                        unsigned threads)
+{
+  std::vector<char> conflicts(layering.upper.size(), 0);
+  if (layering.layers.size() < 2)
+    return conflicts;
+
+  parallel::parallel_for_each_index(
+    layering.layers.size() - 1,
+    [&](std::size_t idx) {
+      const auto& previous = layering.layers[idx];
+      const auto& layer    = layering.layers[idx + 1];
+
+      std::size_t k0 = 0, scan = 0;
+      for (std::size_t i = 0; i < layer.size(); ++i) {
+        const auto node  = layer[i];
+        uint32_t   inner = no_node;
+        if (layering.is_virtual(node))
+          for (auto segment : layering.ups(node))
+            if (layering.is_virtual(layering.upper[segment]))
+              inner = layering.upper[segment];
+
+        if (inner == no_node && i + 1 != layer.size())
+          continue;
+
+        const std::size_t k1 = inner == no_node ? previous.size()
+                                                : layering.order[inner];
+        for (; scan <= i; ++scan) {
+          const auto other = layer[scan];
+          for (auto segment : layering.ups(other)) {
+            const auto upper = layering.upper[segment];
+            const std::size_t position = layering.order[upper];
+            if ((position < k0 || k1 < position)
+                && !(layering.is_virtual(upper)
+                     && layering.is_virtual(other)))
+              conflicts[segment] = 1;
+          }
+        }
+        k0 = k1;
+      }
+    },
+    4, threads);
+
+  return conflicts;
+}
+
+/** x coordinates of one of the four alignments of Brandes and Köpf:
+ *  nodes are aligned with a median neighbour above (or below) into
+ *  blocks, which are then placed left (or right) as far as they go.
+ */
+inline std::vector<double>
+align_blocks(const Layering& layering, const std::vector<char>& conflicts,
+             double nodesep, bool upward, bool rightward)
+{
+  const std::size_t count  = layering.node_count();
+  const std::size_t layers = layering.layers.size();
+
+  const auto position = [&](uint32_t node) {
+    const auto& layer = layering.layers[std::size_t(layering.rank[node])];
+    return rightward ? uint32_t(layer.size() - 1 - layering.order[node])
+                     : layering.order[node];
+  };
+  const auto at = [&](const std::vector<uint32_t>& layer, std::size_t i) {
+    return rightward ? layer[layer.size() - 1 - i] : layer[i];
+  };
+
+  std::vector<uint32_t> root(count);
+  std::iota(root.begin(), root.end(), uint32_t(0));
+
+  std::vector<std::pair<uint32_t, uint32_t>> neighbours{};
+  for (std::size_t idx = 0; idx < layers; ++idx) {
+    const auto& layer = layering.layers[upward ? idx : layers - 1 - idx];
+
+    int64_t previous = -1;
+    for (std::size_t i = 0; i < layer.size(); ++i) {
+      const auto node = at(layer, i);
+
+      neighbours.clear();
+      if (upward)
+        for (auto segment : layering.ups(node))
+          neighbours.emplace_back(position(layering.upper[segment]), segment);
+      else
+        for (auto segment : layering.downs(node))
+          neighbours.emplace_back(position(layering.lower[segment]), segment);
+
+      if (neighbours.empty())
+        continue;
+      std::sort(neighbours.begin(), neighbours.end());
+
+      const std::size_t size = neighbours.size();
+      for (std::size_t m = (size - 1) / 2; m <= size / 2; ++m) {
+        const auto [other_position, segment] = neighbours[m];
+        if (previous < int64_t(other_position) && !conflicts[segment]) {
+          const auto other = upward ? layering.upper[segment]
+                                    : layering.lower[segment];
+          root[node] = root[other];
+          previous   = other_position;
+          break;
+        }
+      }
+    }
+  }
+
+  // graph of blocks, by their root, separated from their right neighbour.
+  const auto gap = [&](uint32_t node) {
+    return layering.is_virtual(node) ? nodesep / 4. : nodesep / 2.;
+  };
+
+  std::vector<uint32_t> sources{}, targets{};
+  std::vector<double>   separations{};
+  for (const auto& layer : layering.layers)
+    for (std::size_t i = 1; i < layer.size(); ++i) {
+      const auto left  = at(layer, i - 1);
+      const auto right = at(layer, i);
+      sources.push_back(root[left]);
+      targets.push_back(root[right]);
+      separations.push_back((layering.breadth[left]
+                             + layering.breadth[right]) / 2.
+                            + gap(left) + gap(right));
+    }
+
+  std::vector<uint32_t> in_offsets(count + 1, 0), out_offsets(count + 1, 0);
+  for (std::size_t i = 0; i < sources.size(); ++i) {
+    ++out_offsets[sources[i] + 1];
+    ++in_offsets[targets[i] + 1];
+  }
+  std::partial_sum(in_offsets.begin(), in_offsets.end(), in_offsets.begin());
+  std::partial_sum(out_offsets.begin(), out_offsets.end(),
+                   out_offsets.begin());
+
+  std::vector<uint32_t> in(sources.size()), out(sources.size());
+  {
+    std::vector<uint32_t> in_fill(in_offsets.begin(), in_offsets.end() - 1);
+    std::vector<uint32_t> out_fill(out_offsets.begin(),
+                                   out_offsets.end() - 1);
+    for (std::size_t i = 0; i < sources.size(); ++i) {
+      out[out_fill[sources[i]]++] = uint32_t(i);
+      in[in_fill[targets[i]]++]   = uint32_t(i);
+    }
+  }
+
+  std::vector<uint32_t> pending(count), sorted{};
+  sorted.reserve(count);
+  for (uint32_t node = 0; node < count; ++node)
+    if (root[node] == node) {
+      pending[node] = in_offsets[node + 1] - in_offsets[node];
+      if (pending[node] == 0)
+        sorted.push_back(node);
+    }
+
+  for (std::size_t i = 0; i < sorted.size(); ++i) {
+    const auto block = sorted[i];
+    for (auto j = out_offsets[block]; j < out_offsets[block + 1]; ++j)
+      if (--pending[targets[out[j]]] == 0)
+        sorted.push_back(targets[out[j]]);
+  }
+
+  // blocks as far left as they go, then right as far as their right
+  // neighbours let them.
+  std::vector<double> xs(count, 0.);
+  for (auto block : sorted)
+    for (auto j = in_offsets[block]; j < in_offsets[block + 1]; ++j)
+      xs[block] = std::max(xs[block],
+                           xs[sources[in[j]]] + separations[in[j]]);
+
+  for (auto iter = sorted.rbegin(); iter != sorted.rend(); ++iter) {
+    const auto block = *iter;
+    if (out_offsets[block] == out_offsets[block + 1])
+      continue;
+
+    double limit = std::numeric_limits<double>::infinity();
+    for (auto j = out_offsets[block]; j < out_offsets[block + 1]; ++j)
+      limit = std::min(limit, xs[targets[out[j]]] - separations[out[j]]);
+    xs[block] = std::max(xs[block], limit);
+  }
+
+  // into a vector of their own, so that roots read after being
+  // placed aren't negated yet.
+  std::vector<double> placed(count);
+  for (uint32_t node = 0; node < count; ++node)
+    placed[node] = rightward ? -xs[root[node]] : xs[root[node]];
+  return placed;
+}
+
+/** x coordinates of nodes, the average of the two median candidates of
+ *  the four alignments, all being shifted to the narrowest one.
+ */
+inline std::vector<double> assign_x(const Layering& layering,
+                                    double nodesep, unsigned threads)
+{
+  const std::size_t count = layering.node_count();
+  const auto conflicts = find_conflicts(layering, threads);
+
+  std::array<std::vector<double>, 4> alignments{};
+  parallel::parallel_for_each_index(
+    alignments.size(),
+    [&](std::size_t idx) {
+      alignments[idx] = align_blocks(layering, conflicts, nodesep,
+                                     idx < 2, idx % 2 == 1);
+    },
+    1, threads);
+
+  std::array<double, 4> lows{}, highs{};
+  std::size_t narrowest = 0;
+  for (std::size_t idx = 0; idx < alignments.size(); ++idx) {
+    lows[idx]  = std::numeric_limits<double>::infinity();
+    highs[idx] = -std::numeric_limits<double>::infinity();
+    for (std::size_t node = 0; node < count; ++node) {
+      const double half = layering.breadth[node] / 2.;
+      lows[idx]  = std::min(lows[idx], alignments[idx][node] - half);
+      highs[idx] = std::max(highs[idx], alignments[idx][node] + half);
+    }
+    if (highs[idx] - lows[idx] < highs[narrowest] - lows[narrowest])
+      narrowest = idx;
+  }
+
+  std::vector<double> xs(count, 0.);
+  for (std::size_t node = 0; node < count; ++node) {
+    std::array<double, 4> candidates{};
+    for (std::size_t idx = 0; idx < alignments.size(); ++idx) {
+      const double shift = idx % 2 == 0 ? lows[narrowest] - lows[idx]
+                                        : highs[narrowest] - highs[idx];
+      candidates[idx] = alignments[idx][node] + shift;
+    }
+    std::sort(candidates.begin(), candidates.end());
+    xs[node] = (candidates[1] + candidates[2]) / 2.;
+  }
+  return xs;
+}
+
+/** space below `rank` in points. */
+inline double rank_separation(const attrs::RankSepType& ranksep,
+                              std::size_t rank)
+{
+  constexpr double fallback = .5, minimum = .02;
+
+  double inches = fallback;
+  if (ranksep) {
+    if (const auto *value = std::get_if<double>(&*ranksep))
+      inches = *value;
+    else if (const auto& list = std::get<std::vector<double>>(*ranksep);
+             !list.empty())
+      inches = list[std::min(rank, list.size() - 1)];
+  }
+  return std::max(inches, minimum) * points_per_inch;
+}
+
+struct Vec2 final {
+  double x = 0., y = 0.;
+
+  friend Vec2 operator+(Vec2 lhs, Vec2 rhs) { return { lhs.x + rhs.x,
+                                                       lhs.y + rhs.y }; }
+  friend Vec2 operator-(Vec2 lhs, Vec2 rhs) { return { lhs.x - rhs.x,
+                                                       lhs.y - rhs.y }; }
+  friend Vec2 operator*(Vec2 lhs, double k) { return { lhs.x * k,
+                                                       lhs.y * k }; }
+
+  double length() const noexcept { return std::hypot(x, y); }
+};
+
+/** point where the ray from the center of an ellipse towards `toward`
+ *  leaves it.
+ */
+inline Vec2 clip_ellipse(Vec2 center, double width, double height,
+                         Vec2 toward) noexcept
+{
+  const Vec2   dir = toward - center;
+  const double rx  = std::max(width / 2., 1e-9);
+  const double ry  = std::max(height / 2., 1e-9);
+
+  const double scale = std::hypot(dir.x / rx, dir.y / ry);
+  if (scale <= 1.)
+    return toward;
+  return center + dir * (1. / scale);
+}
+
+/** points of a Catmull-Rom spline through `points`, as Bézier control
+ *  points, starting with the first point.
+ */
+inline std::vector<Vec2> smooth(const std::vector<Vec2>& points)
+{
+  std::vector<Vec2> out{ points.front() };
+  const std::size_t last = points.size() - 1;
+  for (std::size_t i = 0; i < last; ++i) {
+    const Vec2 p0 = points[i == 0 ? 0 : i - 1];
+    const Vec2 p1 = points[i];
+    const Vec2 p2 = points[i + 1];
+    const Vec2 p3 = points[std::min(i + 2, last)];
+
+    out.push_back(p1 + (p2 - p0) * (1. / 6.));
+    out.push_back(p2 - (p3 - p1) * (1. / 6.));
+    out.push_back(p2);
+  }
+  return out;
+}
+
+/** moves the end of Bézier `points` back along the last segment to
+ *  leave room for an arrow head.
+ *
+ * @returns where the arrow ends.
+ */
+inline Vec2 make_room_for_arrow(std::vector<Vec2>& points)
+{
+  const Vec2   tip    = points.back();
+  const Vec2   from   = points[points.size() - 4];
+  const double length = (tip - from).length();
+  if (length <= 0.)
+    return tip;
+
+  const double cut   = std::min(arrow_length, length / 2.);
+  const Vec2   shift = (tip - from) * (cut / length);
+  for (std::size_t i = points.size() - 2; i < points.size(); ++i)
+    points[i] = points[i] - shift;
+  return tip;
+}
+
+}  // namespace detail
+
+/** lays out `graph` in ranks, in the manner of dot, as described by
+ *  Gansner et al. in "A Technique for Drawing Directed Graphs":
+ *
+ *  1. ranks nodes by network simplex, after reversing edges closing
+ *     cycles and merging rank groups,
+ *  2. orders ranks by weighted median sweeps and transposition, ranks
+ *     of the same parity being ordered across threads together,
+ *  3. places nodes of ranks by Brandes and Köpf's alignment,
+ *  4. routes edges as splines through virtual nodes left in ranks they
+ *     span.
+ *
+ * node positions are centers in points, the lower left corner of the
+ * drawing at the origin. the result doesn't depend on thread count.
+ *
+ * @throws std::out_of_range if a rank group has a nonexistent node.
+ */
+inline Layout layered(const LayoutGraph& graph,
+                      const LayeredOptions& options = {})
+{
+  using attrtypes::RankDir;
+  using detail::Vec2;
+
+  Layout layout{};
+  const std::size_t count = graph.node_count();
+  if (count == 0)
+    return layout;
+
+  const bool sideways = options.rankdir == RankDir::left_right
+                     || options.rankdir == RankDir::right_left;
+
+  const auto ranks = detail::rank_nodes(graph, options);
+  auto layering    = detail::make_layering(graph, ranks, sideways);
+  detail::init_order(layering);
+
+  const auto groups = detail::make_order_groups(graph, layering,
+                                                options.ordering);
+  detail::minimize_crossings(layering, groups, options);
+
+  const double nodesep = std::max(options.nodesep, .02) * points_per_inch;
+  const auto   xs      = detail::assign_x(layering, nodesep,
+                                          options.threads);
+
+  // ranks downward from 0, each as deep as its deepest node.
+  const std::size_t layers = layering.layers.size();
+  std::vector<double> depths(layers, 0.), ys(layers, 0.);
+  for (uint32_t node = 0; node < count; ++node) {
+    auto& depth = depths[std::size_t(layering.rank[node])];
+    depth = std::max(depth, layering.depth[node]);
+  }
+  for (std::size_t rank = 1; rank < layers; ++rank)
+    ys[rank] = ys[rank - 1] - depths[rank - 1] / 2.
+             - detail::rank_separation(options.ranksep, rank - 1)
+             - depths[rank] / 2.;
+
+  const auto at = [&](uint32_t node) {
+    return Vec2{ xs[node], ys[std::size_t(layering.rank[node])] };
+  };
+
+  // edges are routed with ranks top to bottom, then turned.
+  std::vector<std::vector<Vec2>> routes(graph.edge_count());
+  std::vector<std::optional<Vec2>> tips(graph.edge_count());
+
+  const double loop_size = nodesep;
+  const double flat_rise = detail::rank_separation(options.ranksep, 0) / 2.;
+
+  parallel::parallel_for_each_index(
+    graph.edge_count(),
+    [&](std::size_t edge) {
+      const auto route = layering.route_of(edge);
+      auto&      out   = routes[edge];
+
+      const auto first = route[0];
+      const Vec2 center = at(first);
+      const double width  = layering.breadth[first];
+      const double height = layering.depth[first];
+
+      switch (layering.kind[edge]) {
+        case detail::RouteKind::loop: {
+          const double rx = width / 2., ry = height / 2.;
+          const Vec2 start{ center.x + rx * .866, center.y + ry * .5 };
+          Vec2       end{ center.x + rx * .866, center.y - ry * .5 };
+          if (options.directed) {
+            tips[edge] = end;
+            end.x += detail::arrow_length;
+          }
+          out = { start,
+                  Vec2{ center.x + rx + loop_size, center.y + ry },
+                  Vec2{ end.x + loop_size, center.y - ry },
+                  end };
+          return;
+        }
+
+        case detail::RouteKind::flat: {
+          const auto   last  = route[1];
+          const Vec2   other = at(last);
+          const auto   apart = layering.order[first] > layering.order[last]
+                             ? layering.order[first] - layering.order[last]
+                             : layering.order[last] - layering.order[first];
+          if (apart == 1) {
+            std::vector<Vec2> points{
+              detail::clip_ellipse(center, width, height, other),
+              detail::clip_ellipse(other, layering.breadth[last],
+                                   layering.depth[last], center) };
+            out = detail::smooth(points);
+          }
+          else {
+            const Vec2 start{ center.x, center.y + height / 2. };
+            const Vec2 end{ other.x, other.y + layering.depth[last] / 2. };
+            out = { start, start + Vec2{ 0., flat_rise },
+                    end + Vec2{ 0., flat_rise }, end };
+          }
+          if (options.directed)
+            tips[edge] = detail::make_room_for_arrow(out);
+          return;
+        }
+
+        case detail::RouteKind::chain: {
+          std::vector<Vec2> points{};
+          for (auto node : route)
+            points.push_back(at(node));
+          if (layering.reversed[edge])
+            std::reverse(points.begin(), points.end());
+
+          const auto source = layering.reversed[edge] ? route.end()[-1]
+                                                      : route[0];
+          const auto target = layering.reversed[edge] ? route[0]
+                                                      : route.end()[-1];
+          points.front() = detail::clip_ellipse(
+            points.front(), layering.breadth[source], layering.depth[source],
+            points[1]);
+          points.back() = detail::clip_ellipse(
+            points.back(), layering.breadth[target], layering.depth[target],
+            points[points.size() - 2]);
+
+          out = detail::smooth(points);
+          if (options.directed)
+            tips[edge] = detail::make_room_for_arrow(out);
+          return;
+        }
+      }
+    },
+    256, options.threads);
+
+  // turned to rankdir, then moved to have the lower left corner at 0.
+  const auto turn = [&](Vec2 point) {
+    switch (options.rankdir) {
+      case RankDir::bottom_top: return Vec2{ point.x, -point.y };
+      case RankDir::left_right: return Vec2{ -point.y, -point.x };
+      case RankDir::right_left: return Vec2{ point.y, -point.x };
+      default:                  return point;
+    }
+  };
+
+  Vec2 low{ std::numeric_limits<double>::infinity(),
+            std::numeric_limits<double>::infinity() };
+  const auto extend = [&](Vec2 point) {
+    low.x = std::min(low.x, point.x);
+    low.y = std::min(low.y, point.y);
+  };
+
+  std::vector<Vec2> centers(count);
+  for (uint32_t node = 0; node < count; ++node) {
+    centers[node] = turn(at(node));
+    const auto& size = graph.node(node);
+    extend(centers[node] - Vec2{ size.width / 2., size.height / 2. });
+  }
+  for (auto& route : routes)
+    for (auto& point : route) {
+      point = turn(point);
+      extend(point);
+    }
+
+  layout.positions.reserve(count);
+  for (const auto& center : centers)
+    layout.positions.emplace_back(center.x - low.x, center.y - low.y);
+
+  const auto to_spline_point = [&](Vec2 point) {
+    point = point - low;
+    return attrtypes::spline_point_type(point.x, point.y);
+  };
+
+  layout.splines.resize(graph.edge_count());
+  for (std::size_t edge = 0; edge < routes.size(); ++edge) {
+    const auto& route = routes[edge];
+
+    attrtypes::Spline<> spline{};
+    spline.set_point(to_spline_point(route.front()));
+    for (std::size_t i = 1; i + 2 < route.size(); i += 3)
+      spline.add_triples({ to_spline_point(route[i]),
+                           to_spline_point(route[i + 1]),
+                           to_spline_point(route[i + 2]) });
+    if (tips[edge])
+      spline.set_endp(to_spline_point(turn(*tips[edge])));
+
+    layout.splines[edge].add_spline(spline);
+  }
+
+  return layout;
+}
+
+/** lays out `graph` by `layered`, setting `pos` of its nodes and edges.
+ *
+ * clusters with a `rank` make up the rank groups, in addition to those
+ * of `options`, which also holds the graph attributes, see
+ * `make_layout_input`.
+ */
+template <typename GraphT>
+void layered_layout(GraphT& graph, LayeredOptions options = {})
+{
+  const auto input = make_layout_input(graph);
+
+  std::vector<typename GraphT::ClusterId> clusters{};
+  for (auto cluster : graph.clusters_view())
+    clusters.push_back(cluster);
+  std::sort(clusters.begin(), clusters.end());
+
+  for (auto cluster : clusters) {
+    const auto rank = graph.template get_entity_attr<attrs::Rank>(cluster);
+    if (!rank || rank->get_value() == attrtypes::RankType::none)
+      continue;
+
+    RankGroup group{ rank->get_value(), {} };
+    for (auto node : graph.get_cluster_nodes(cluster))
+      group.nodes.push_back(uint32_t(input.index_of(node)));
+    std::sort(group.nodes.begin(), group.nodes.end());
+
+    options.rank_groups.push_back(std::move(group));
+  }
+
+  write_layout(graph, input, layered(input.graph, options));
+}
+
+}  // namespace gviz::layout
+
+#endif  // GVIZARD_LAYOUT_LAYERED_HPP_
@@ -0,0 +1,459 @@
+#ifndef GVIZARD_LAYOUT_LAYOUT_GRAPH_HPP_
+#define GVIZARD_LAYOUT_LAYOUT_GRAPH_HPP_
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <utility>
+#include <variant>
+#include <vector>
+
+#include "gvizard/utils.hpp"
+
+#include "gvizard/attrtypes/point.hpp"
+#include "gvizard/attrtypes/spline.hpp"
+
+#include "gvizard/attrs/boundingbox.hpp"
+#include "gvizard/attrs/height.hpp"
+#include "gvizard/attrs/len.hpp"
+#include "gvizard/attrs/minlen.hpp"
+#include "gvizard/attrs/pos.hpp"
+#include "gvizard/attrs/weight.hpp"
+#include "gvizard/attrs/width.hpp"
+
+namespace gviz::layout {
+
+/** a point in graph coordinates, in points with y growing upwards. */
+using Point = attrtypes::Point2D<double>;
+
+/** points per inch, sizes and separations are given in inches. */
+constexpr double points_per_inch = 72.;
+
+/** an axis aligned box in points, by its lower left and upper right
+ *  corners.
+ */
+struct Box final {
+  double llx = 0.;
+  double lly = 0.;
+  double urx = 0.;
+  double ury = 0.;
+
+  constexpr double width()  const noexcept { return urx - llx; }
+  constexpr double height() const noexcept { return ury - lly; }
+};
+
+/** a node of a `LayoutGraph`, by its size in points. */
+struct LayoutNode final {
+  double width  = attrs::Width::get_default_value() * points_per_inch;
+  double height = attrs::Height::get_default_value() * points_per_inch;
+};
+
+/** an edge of a `LayoutGraph`, between nodes by their index. */
+struct LayoutEdge final {
+  uint32_t source = 0;
+  uint32_t target = 0;
+  double   weight = attrs::Weight::get_default_value();
+  int      minlen = attrs::MinLen::get_default_value();
+  double   len    = attrs::Len::get_default_value();
+};
+
+/** contiguous indices of edges, as stored by `LayoutGraph`. */
+class IndexRange final {
+  const uint32_t *first_ = nullptr;
+  const uint32_t *last_  = nullptr;
+
+ public:
+  constexpr IndexRange() noexcept = default;
+  constexpr IndexRange(const uint32_t *first, const uint32_t *last) noexcept
+    : first_(first), last_(last)
+  {}
+
+  constexpr const uint32_t *begin() const noexcept { return first_; }
+  constexpr const uint32_t *end()   const noexcept { return last_; }
+
+  constexpr std::size_t size() const noexcept
+  {
+    return std::size_t(last_ - first_);
+  }
+
+  constexpr bool empty() const noexcept { return first_ == last_; }
+
+  constexpr uint32_t operator[](std::size_t idx) const noexcept
+  {
+    return first_[idx];
+  }
+};
+
+/** the structure layout engines work on: nodes by size and directed
+ *  edges between them, all referred to by index.
+ *
+ * unlike `graph::Graph`, whose adjacency matrix grows quadratically,
+ * it keeps adjacency as compressed arrays of edge indices, so that
+ * graphs of millions of nodes fit. it is immutable once built, and so
+ * is safe to be read from several threads.
+ */
+class LayoutGraph final {
+  std::vector<LayoutNode> nodes_{};
+  std::vector<LayoutEdge> edges_{};
+
+  // edges leaving and entering each node, indexed by offsets.
+  std::vector<uint32_t> out_offsets_{};
+  std::vector<uint32_t> out_edges_{};
+  std::vector<uint32_t> in_offsets_{};
+  std::vector<uint32_t> in_edges_{};
+
+  static void index(std::size_t node_count,
+                    const std::vector<LayoutEdge>& edges,
+                    uint32_t LayoutEdge::*end,
+                    std::vector<uint32_t>& offsets,
+                    std::vector<uint32_t>& indices)
+  {
+    offsets.assign(node_count + 1, 0);
+    for (const auto& edge : edges)
+      ++offsets[edge.*end + 1];
+
+    for (std::size_t i = 0; i < node_count; ++i)
+      offsets[i + 1] += offsets[i];
+
+    // edges are kept in their order in each node's range.
+    indices.resize(edges.size());
+    std::vector<uint32_t> fill(offsets.begin(), offsets.end() - 1);
+    for (std::size_t i = 0; i < edges.size(); ++i)
+      indices[fill[edges[i].*end]++] = uint32_t(i);
+  }
+
+ public:
+  LayoutGraph() = default;
+
+  /** indexes `edges` between `nodes`.
+   *
+   * @throws std::out_of_range if an edge refers to a node that isn't.
+   */
+  LayoutGraph(std::vector<LayoutNode> nodes, std::vector<LayoutEdge> edges)
+    : nodes_(std::move(nodes))
+    , edges_(std::move(edges))
+  {
+    for (const auto& edge : edges_)
+      if (edge.source >= nodes_.size() || edge.target >= nodes_.size())
+        throw std::out_of_range("edge of nonexistent node");
+
+    index(nodes_.size(), edges_, &LayoutEdge::source,
+          out_offsets_, out_edges_);
+    index(nodes_.size(), edges_, &LayoutEdge::target,
+          in_offsets_, in_edges_);
+  }
+
+  std::size_t node_count() const noexcept { return nodes_.size(); }
+  std::size_t edge_count() const noexcept { return edges_.size(); }
+
+  const LayoutNode& node(std::size_t idx) const noexcept
+  {
+    return nodes_[idx];
+  }
+
+  const LayoutEdge& edge(std::size_t idx) const noexcept
+  {
+    return edges_[idx];
+  }
+
+  const std::vector<LayoutNode>& nodes() const noexcept { return nodes_; }
+  const std::vector<LayoutEdge>& edges() const noexcept { return edges_; }
+
+  /** indices of edges whose source is `node`. */
+  IndexRange out_edges(std::size_t node) const noexcept
+  {
+    return IndexRange{ out_edges_.data() + out_offsets_[node],
+                       out_edges_.data() + out_offsets_[node + 1] };
+  }
+
+  /** indices of edges whose target is `node`. */
+  IndexRange in_edges(std::size_t node) const noexcept
+  {
+    return IndexRange{ in_edges_.data() + in_offsets_[node],
+                       in_edges_.data() + in_offsets_[node + 1] };
+  }
+
+  /** the other end of `edge` than `node`. */
+  uint32_t opposite(std::size_t edge, std::size_t node) const noexcept
+  {
+    const auto& item = edges_[edge];
+    return item.source == node ? item.target : item.source;
+  }
+};
+
+/** where layout engines put nodes and edges.
+ *
+ * positions are nodes' centers, and an edge without splines has no
+ * route of its own, so it is drawn straight if at all.
+ */
+struct Layout final {
+  using splines_type = attrtypes::SplineType<std::vector>;
+
+  std::vector<Point>        positions{};
+  std::vector<splines_type> splines{};
+
+  /** z coordinates of nodes, only in layouts of 3 dimensions. */
+  std::vector<double> z{};
+
+  /** sizes of nodes, only in layouts that size them. */
+  std::vector<LayoutNode> sizes{};
+
+  /** bounding boxes of clusters by their order in `LayoutInput`, only
+   *  in layouts that place them.
+   */
+  std::vector<Box> clusters{};
+};
+
+/** coordinates of nodes in inches, one array per axis so that they are
+ *  processed several nodes at a time.
+ */
+template <std::size_t D>
+using Coords = std::array<std::vector<double>, D>;
+
+/** a layout of nodes at `coords`, in points and moved so that the lower
+ *  left corner of their bounding box, sizes included, is the origin.
+ *  the third axis, if any, starts at 0.
+ */
+template <std::size_t D>
+Layout make_layout(const LayoutGraph& graph, const Coords<D>& coords)
+{
+  static_assert(D == 2 || D == 3, "layouts are of 2 or 3 dimensions");
+
+  Layout layout{};
+  const std::size_t count = graph.node_count();
+  if (count == 0)
+    return layout;
+
+  double left = std::numeric_limits<double>::max();
+  double bottom = left;
+  for (std::size_t i = 0; i < count; ++i) {
+    const auto& node = graph.node(i);
+    left   = std::min(left, coords[0][i] * points_per_inch - node.width / 2.);
+    bottom = std::min(bottom,
+                      coords[1][i] * points_per_inch - node.height / 2.);
+  }
+
+  layout.positions.reserve(count);
+  for (std::size_t i = 0; i < count; ++i)
+    layout.positions.push_back(Point{ coords[0][i] * points_per_inch - left,
+                                      coords[1][i] * points_per_inch
+                                        - bottom });
+
+  if constexpr (D == 3) {
+    const double back = *std::min_element(coords[2].begin(),
+                                          coords[2].end());
+    layout.z.reserve(count);
+    for (auto z : coords[2])
+      layout.z.push_back((z - back) * points_per_inch);
+  }
+  return layout;
+}
+
+/** a `LayoutGraph` of a `graph::Graph` and which entity each of its
+ *  nodes and edges is.
+ */
+template <typename GraphT>
+struct LayoutInput final {
+  LayoutGraph                          graph{};
+  std::vector<typename GraphT::NodeId> nodes{};
+  std::vector<typename GraphT::EdgeId> edges{};
+
+  /** clusters of the graph, ordered by id. */
+  std::vector<typename GraphT::ClusterId> clusters{};
+
+  /** index of `node` in `graph`, nodes are ordered by id. */
+  std::size_t index_of(typename GraphT::NodeId node) const
+  {
+    return std::size_t(std::lower_bound(nodes.begin(), nodes.end(), node)
+                       - nodes.begin());
+  }
+};
+
+namespace detail {
+
+/** an index of no node, for links not made yet. */
+constexpr uint32_t no_node = std::numeric_limits<uint32_t>::max();
+
+/** indices of `keys` grouped by key, those of key `k` being
+ *  `items[offsets[k], offsets[k + 1])` in increasing order.
+ */
+inline void group_by_key(const std::vector<uint32_t>& keys,
+                         std::size_t count, std::vector<uint32_t>& offsets,
+                         std::vector<uint32_t>& items)
+{
+  offsets.assign(count + 1, 0);
+  for (auto key : keys)
+    ++offsets[key + 1];
+  for (std::size_t i = 0; i < count; ++i)
+    offsets[i + 1] += offsets[i];
+
+  items.resize(keys.size());
+  std::vector<uint32_t> fill(offsets.begin(), offsets.end() - 1);
+  for (std::size_t i = 0; i < keys.size(); ++i)
+    items[fill[keys[i]]++] = uint32_t(i);
+}
+
+template <typename Attr, typename GraphT, typename EntityT>
+auto get_or_default(const GraphT& graph, EntityT entity)
+  -> typename Attr::value_type
+{
+  if (const auto attr = graph.template get_entity_attr<Attr>(entity))
+    return attr->get_value();
+
+  return Attr::get_default_value();
+}
+
+}  // namespace detail
+
+/** copies the structure of `graph` for layout engines to work on.
+ *
+ * nodes are sized by their `width` and `height` and edges weighted by
+ * their `weight`, `minlen` and `len`. nodes and edges are ordered by
+ * id, which is their order of creation, so layouts don't depend on
+ * hashing.
+ *
+ * graphs have no attributes of their own, so the `*_layout` functions
+ * laying out a graph through this take those of the graph, such as
+ * `mindist` or `splines`, as fields of their options.
+ */
+template <typename GraphT>
+LayoutInput<GraphT> make_layout_input(const GraphT& graph)
+{
+  LayoutInput<GraphT> input{};
+
+  for (auto node : graph.nodes_view())
+    input.nodes.push_back(node);
+  for (auto edge : graph.edges_view())
+    input.edges.push_back(edge);
+
+  for (auto cluster : graph.clusters_view())
+    input.clusters.push_back(cluster);
+
+  std::sort(input.nodes.begin(), input.nodes.end());
+  std::sort(input.edges.begin(), input.edges.end());
+  std::sort(input.clusters.begin(), input.clusters.end());
+
+  std::vector<LayoutNode> nodes{};
+  nodes.reserve(input.nodes.size());
+  for (auto node : input.nodes)
+    nodes.push_back(LayoutNode{
+      detail::get_or_default<attrs::Width>(graph, node) * points_per_inch,
+      detail::get_or_default<attrs::Height>(graph, node) * points_per_inch });
+
+  std::vector<LayoutEdge> edges{};
+  edges.reserve(input.edges.size());
+  for (auto edge : input.edges) {
+    const auto [source, target] = *graph.get_edge_nodes(edge);
+    edges.push_back(LayoutEdge{
+      uint32_t(input.index_of(source)), uint32_t(input.index_of(target)),
+      detail::get_or_default<attrs::Weight>(graph, edge),
+      detail::get_or_default<attrs::MinLen>(graph, edge),
+      detail::get_or_default<attrs::Len>(graph, edge) });
+  }
+
+  input.graph = LayoutGraph(std::move(nodes), std::move(edges));
+  return input;
+}
+
+/** sets `pos` of nodes to their positions in `layout`, and of edges
+ *  to their splines if they have any. nodes are sized and clusters
+ *  given their `bb` if the layout has them.
+ */
+template <typename GraphT>
+void write_layout(GraphT& graph, const LayoutInput<GraphT>& input,
+                  const Layout& layout)
+{
+  for (std::size_t i = 0; i < input.nodes.size(); ++i) {
+    const auto& point = layout.positions[i];
+    graph.template set_entity_attr<attrs::Pos>(
+      input.nodes[i],
+      attrs::PosType(i < layout.z.size()
+                     ? attrtypes::PointType<double>(point.x, point.y,
+                                                    layout.z[i])
+                     : attrtypes::PointType<double>(point.x, point.y)));
+  }
+
+  for (std::size_t i = 0; i < input.edges.size(); ++i)
+    if (i < layout.splines.size() && !layout.splines[i].splines.empty())
+      graph.template set_entity_attr<attrs::Pos>(
+        input.edges[i], attrs::PosType(layout.splines[i]));
+
+  // sizes are kept to the least the attributes take.
+  constexpr double least_size = .01;
+  for (std::size_t i = 0; i < layout.sizes.size(); ++i) {
+    graph.template set_entity_attr<attrs::Width>(
+      input.nodes[i],
+      std::max(layout.sizes[i].width / points_per_inch, least_size));
+    graph.template set_entity_attr<attrs::Height>(
+      input.nodes[i],
+      std::max(layout.sizes[i].height / points_per_inch, least_size));
+  }
+
+  for (std::size_t i = 0; i < layout.clusters.size(); ++i) {
+    const auto& box = layout.clusters[i];
+    graph.template set_entity_attr<attrs::BoundingBox>(
+      input.clusters[i],
+      attrtypes::Rect::make(box.llx, box.lly, box.urx, box.ury));
+  }
+}
+
+/** a layout of `graph` where `pos` of its nodes and edges puts them, as
+ *  `write_layout` sets it: nodes without a point at the origin, and
+ *  edges without splines left without any. z coordinates are read if
+ *  any node has one.
+ */
+template <typename GraphT>
+Layout read_layout(const GraphT& graph, const LayoutInput<GraphT>& input)
+{
+  using PointType = attrtypes::PointType<double>;
+
+  Layout layout{};
+  layout.positions.resize(input.nodes.size());
+  std::vector<double> z(input.nodes.size(), 0.);
+  bool deep = false;
+
+  for (std::size_t i = 0; i < input.nodes.size(); ++i) {
+    const auto pos =
+      graph.template get_entity_attr<attrs::Pos>(input.nodes[i]);
+    const auto *point = pos && pos->get_value()
+                      ? std::get_if<PointType>(&*pos->get_value())
+                      : nullptr;
+    if (!point)
+      continue;
+
+    utils::LambdaVisit(
+      point->point,
+      [&](const attrtypes::Point2D<double>& at) {
+        layout.positions[i] = Point{ at.x, at.y };
+      },
+      [&](const attrtypes::Point3D<double>& at) {
+        layout.positions[i] = Point{ at.x, at.y };
+        z[i] = at.z;
+        deep = true;
+      });
+  }
+  if (deep)
+    layout.z = std::move(z);
+
+  for (std::size_t i = 0; i < input.edges.size(); ++i) {
+    const auto pos =
+      graph.template get_entity_attr<attrs::Pos>(input.edges[i]);
+    const auto *splines = pos && pos->get_value()
+                        ? std::get_if<Layout::splines_type>(
+                            &*pos->get_value())
+                        : nullptr;
+    if (!splines)
+      continue;
+
+    layout.splines.resize(input.edges.size());
+    layout.splines[i] = *splines;
+  }
+  return layout;
+}
+
+}  // namespace gviz::layout
+
+#endif  // GVIZARD_LAYOUT_LAYOUT_GRAPH_HPP_
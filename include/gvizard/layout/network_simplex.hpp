@@ -0,0 +1,630 @@
+#ifndef GVIZARD_LAYOUT_NETWORK_SIMPLEX_HPP_
+#define GVIZARD_LAYOUT_NETWORK_SIMPLEX_HPP_
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <queue>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "gvizard/layout/disjoint_sets.hpp"
+
+namespace gviz::layout {
+
+/** optimal ranking of a directed acyclic graph by network simplex, as
+ *  described by Gansner et al. in "A Technique for Drawing Directed
+ *  Graphs".
+ *
+ * assigns each node an integer rank such that each edge spans at least
+ * its `minlen` ranks, minimizing the sum of edge lengths times weights.
+ * nodes that aren't connected are ranked separately, minimum rank is 0.
+ */
+class NetworkSimplex final {
+ public:
+  struct Edge final {
+    uint32_t tail   = 0;
+    uint32_t head   = 0;
+    int      minlen = 1;
+    double   weight = 1.;
+  };
+
+ private:
+  static constexpr int32_t none = -1;
+
+  // cut values are sums of weights, those below are taken as negative.
+  static constexpr double negative_cut = -1e-9;
+
+  std::size_t       node_count_ = 0;
+  std::vector<Edge> edges_{};
+
+  std::vector<uint32_t> out_offsets_{};
+  std::vector<uint32_t> out_{};
+  std::vector<uint32_t> in_offsets_{};
+  std::vector<uint32_t> in_{};
+
+  std::vector<int> rank_{};
+
+  // spanning forest: tree edges in a list, each one's index in it, and
+  // tree edges of each node.
+  std::vector<uint32_t>              tree_{};
+  std::vector<int32_t>               tree_index_{};
+  std::vector<std::vector<uint32_t>> tree_adj_{};
+
+  // each node's parent edge and depth in the tree.
+  std::vector<int32_t>  parent_{};
+  std::vector<uint32_t> depth_{};
+
+  // subtrees as ranges of postorder numbers [low, lim], lim being the
+  // node's own number, only kept while cut values are initialized.
+  std::vector<int32_t> low_{};
+  std::vector<int32_t> lim_{};
+
+  std::vector<double> cut_{};
+
+  // nodes of the part cut off by the leaving edge, those of it marked
+  // by the count of pivots when it was.
+  std::vector<uint32_t>    part_{};
+  std::vector<std::size_t> mark_{};
+  std::size_t              pivot_ = 0;
+
+  std::size_t search_start_ = 0;
+
+  static void index(std::size_t node_count, const std::vector<Edge>& edges,
+                    uint32_t Edge::*end, std::vector<uint32_t>& offsets,
+                    std::vector<uint32_t>& indices)
+  {
+    offsets.assign(node_count + 1, 0);
+    for (const auto& edge : edges)
+      ++offsets[edge.*end + 1];
+    for (std::size_t i = 0; i < node_count; ++i)
+      offsets[i + 1] += offsets[i];
+
+    indices.resize(edges.size());
+    std::vector<uint32_t> fill(offsets.begin(), offsets.end() - 1);
+    for (std::size_t i = 0; i < edges.size(); ++i)
+      indices[fill[edges[i].*end]++] = uint32_t(i);
+  }
+
+  template <typename F>
+  void for_incident(uint32_t node, F&& func) const
+  {
+    for (auto i = out_offsets_[node]; i < out_offsets_[node + 1]; ++i)
+      func(out_[i]);
+    for (auto i = in_offsets_[node]; i < in_offsets_[node + 1]; ++i)
+      func(in_[i]);
+  }
+
+  uint32_t opposite(uint32_t edge, uint32_t node) const noexcept
+  {
+    return edges_[edge].tail == node ? edges_[edge].head : edges_[edge].tail;
+  }
+
+  bool in_tree(uint32_t edge) const noexcept
+  {
+    return tree_index_[edge] != none;
+  }
+
+  /** true if `node` is in the subtree of postorder range [low, lim]. */
+  bool in_subtree(uint32_t node, int32_t low, int32_t lim) const noexcept
+  {
+    return low <= lim_[node] && lim_[node] <= lim;
+  }
+
+  void add_tree_edge(uint32_t edge)
+  {
+    tree_index_[edge] = int32_t(tree_.size());
+    tree_.push_back(edge);
+    tree_adj_[edges_[edge].tail].push_back(edge);
+    tree_adj_[edges_[edge].head].push_back(edge);
+  }
+
+  void exchange_tree_edges(uint32_t leaving, uint32_t entering)
+  {
+    tree_[std::size_t(tree_index_[leaving])] = entering;
+    tree_index_[entering] = tree_index_[leaving];
+    tree_index_[leaving]  = none;
+
+    for (auto node : { edges_[leaving].tail, edges_[leaving].head }) {
+      auto& adj = tree_adj_[node];
+      *std::find(adj.begin(), adj.end(), leaving) = adj.back();
+      adj.pop_back();
+    }
+    tree_adj_[edges_[entering].tail].push_back(entering);
+    tree_adj_[edges_[entering].head].push_back(entering);
+  }
+
+  /** longest path ranking from sources.
+   *
+   * @throws std::invalid_argument if the graph has a cycle.
+   */
+  void init_rank()
+  {
+    std::vector<uint32_t> pending(node_count_);
+    std::vector<uint32_t> queue{};
+    queue.reserve(node_count_);
+
+    for (uint32_t node = 0; node < node_count_; ++node) {
+      pending[node] = in_offsets_[node + 1] - in_offsets_[node];
+      if (pending[node] == 0)
+        queue.push_back(node);
+    }
+
+    for (std::size_t i = 0; i < queue.size(); ++i) {
+      const auto node = queue[i];
+      for (auto j = out_offsets_[node]; j < out_offsets_[node + 1]; ++j) {
+        const auto& edge = edges_[out_[j]];
+        rank_[edge.head] = std::max(rank_[edge.head],
+                                    rank_[node] + edge.minlen);
+        if (--pending[edge.head] == 0)
+          queue.push_back(edge.head);
+      }
+    }
+
+    if (queue.size() != node_count_)
+      throw std::invalid_argument("network simplex of a cyclic graph");
+
+    // longest paths leave nodes far from where most of their weight
+    // pulls them, moving them there first saves most pivots.
+    for (int pass = 0; pass < 4; ++pass) {
+      for (std::size_t i = node_count_; i-- > 0;)
+        move_node(queue[i]);
+      for (auto node : queue)
+        move_node(node);
+    }
+  }
+
+  /** moves `node` to the end of its feasible ranks its edges pull it to.
+   */
+  void move_node(uint32_t node)
+  {
+    int    low = std::numeric_limits<int>::min();
+    int    high = std::numeric_limits<int>::max();
+    double pull = 0.;
+
+    for (auto i = in_offsets_[node]; i < in_offsets_[node + 1]; ++i) {
+      const auto& edge = edges_[in_[i]];
+      low  = std::max(low, rank_[edge.tail] + edge.minlen);
+      pull -= edge.weight;
+    }
+    for (auto i = out_offsets_[node]; i < out_offsets_[node + 1]; ++i) {
+      const auto& edge = edges_[out_[i]];
+      high = std::min(high, rank_[edge.head] - edge.minlen);
+      pull += edge.weight;
+    }
+
+    if (pull > 0. && high != std::numeric_limits<int>::max())
+      rank_[node] = high;
+    else if (pull < 0. && low != std::numeric_limits<int>::min())
+      rank_[node] = low;
+  }
+
+  /** grows tight subtrees and merges them, smallest first, along their
+   *  least slack edges until each connected part is spanned.
+   */
+  void feasible_tree()
+  {
+    DisjointSets sets(node_count_);
+    std::vector<char> reached(node_count_, 0);
+    std::vector<std::pair<uint32_t, uint32_t>> stack{};
+
+    for (uint32_t start = 0; start < node_count_; ++start) {
+      if (reached[start])
+        continue;
+
+      reached[start] = 1;
+      stack.emplace_back(start, 0);
+      while (!stack.empty()) {
+        const auto node = stack.back().first;
+        stack.pop_back();
+        for_incident(node, [&](uint32_t edge) {
+          const auto other = opposite(edge, node);
+          if (!reached[other] && slack(edge) == 0) {
+            reached[other] = 1;
+            add_tree_edge(edge);
+            sets.unite(node, other);
+            stack.emplace_back(other, 0);
+          }
+        });
+      }
+    }
+
+    using Entry = std::pair<std::size_t, uint32_t>;
+    std::priority_queue<Entry, std::vector<Entry>, std::greater<Entry>>
+      heap{};
+    for (uint32_t node = 0; node < node_count_; ++node)
+      if (sets.find(node) == node)
+        heap.emplace(sets.size_of(node), node);
+
+    std::vector<uint32_t> members{};
+
+    while (!heap.empty()) {
+      const auto [size, root] = heap.top();
+      heap.pop();
+      if (sets.find(root) != root || sets.size_of(root) != size)
+        continue;
+
+      // tree nodes and the least slack edge leaving the tree.
+      members.clear();
+      int32_t best       = none;
+      int     best_slack = std::numeric_limits<int>::max();
+
+      stack.emplace_back(root, uint32_t(none));
+      while (!stack.empty()) {
+        const auto [node, via] = stack.back();
+        stack.pop_back();
+        members.push_back(node);
+
+        for (auto edge : tree_adj_[node])
+          if (edge != via)
+            stack.emplace_back(opposite(edge, node), edge);
+
+        for_incident(node, [&](uint32_t edge) {
+          if (in_tree(edge) || sets.find(opposite(edge, node)) == root)
+            return;
+          if (const int edge_slack = slack(edge); edge_slack < best_slack) {
+            best       = int32_t(edge);
+            best_slack = edge_slack;
+          }
+        });
+      }
+
+      if (best == none)
+        continue;
+
+      const auto& edge  = edges_[std::size_t(best)];
+      const bool  out   = sets.find(edge.tail) == root;
+      const int   delta = out ? best_slack : -best_slack;
+      for (auto node : members)
+        rank_[node] += delta;
+
+      add_tree_edge(uint32_t(best));
+      const auto merged = sets.unite(edge.tail, edge.head);
+      heap.emplace(sets.size_of(merged), merged);
+    }
+  }
+
+  /** numbers the subtree of `root` in postorder from `low`, and sets
+   *  parents and depths in it.
+   *
+   * @returns the next number.
+   */
+  int32_t dfs_range(uint32_t root, int32_t low)
+  {
+    // nodes and the next of their tree edges.
+    struct Frame final { uint32_t node; std::size_t next; };
+    std::vector<Frame> stack{ Frame{ root, 0 } };
+
+    parent_[root] = none;
+    depth_[root]  = 0;
+    low_[root]    = low;
+
+    int32_t counter = low;
+    while (!stack.empty()) {
+      const auto node = stack.back().node;
+      const auto& adj = tree_adj_[node];
+
+      if (stack.back().next < adj.size()) {
+        const auto edge = adj[stack.back().next++];
+        if (int32_t(edge) == parent_[node])
+          continue;
+
+        const auto child = opposite(edge, node);
+        parent_[child] = int32_t(edge);
+        depth_[child]  = depth_[node] + 1;
+        low_[child]    = counter;
+        stack.push_back(Frame{ child, 0 });
+      }
+      else {
+        lim_[node] = counter++;
+        stack.pop_back();
+      }
+    }
+    return counter;
+  }
+
+  double x_val(uint32_t edge, uint32_t node, int dir) const noexcept
+  {
+    const auto& item  = edges_[edge];
+    const auto  other = opposite(edge, node);
+
+    const bool outside = !in_subtree(other, low_[node], lim_[node]);
+
+    double value = outside
+                 ? item.weight
+                 : (in_tree(edge) ? cut_[edge] : 0.) - item.weight;
+
+    int d = dir > 0 ? (item.head == node ? 1 : -1)
+                    : (item.tail == node ? 1 : -1);
+    if (outside)
+      d = -d;
+    return d < 0 ? -value : value;
+  }
+
+  void x_cutval(uint32_t edge)
+  {
+    const auto& item = edges_[edge];
+    const bool  tail = parent_[item.tail] == int32_t(edge);
+    const auto  node = tail ? item.tail : item.head;
+    const int   dir  = tail ? 1 : -1;
+
+    double sum = 0.;
+    for_incident(node, [&](uint32_t other) {
+      sum += x_val(other, node, dir);
+    });
+    cut_[edge] = sum;
+  }
+
+  void init_cutvalues()
+  {
+    std::fill(parent_.begin(), parent_.end(), none);
+    std::fill(lim_.begin(), lim_.end(), none);
+
+    int32_t counter = 1;
+    for (uint32_t node = 0; node < node_count_; ++node)
+      if (lim_[node] == none)
+        counter = dfs_range(node, counter);
+
+    // postorder has children first.
+    std::vector<uint32_t> order(node_count_);
+    for (uint32_t node = 0; node < node_count_; ++node)
+      order[std::size_t(lim_[node] - 1)] = node;
+
+    for (auto node : order)
+      if (parent_[node] != none)
+        x_cutval(uint32_t(parent_[node]));
+  }
+
+  /** a tree edge of negative cut value, the most negative among the next
+   *  `search_size` such ones.
+   */
+  int32_t leave_edge(std::size_t search_size)
+  {
+    int32_t     found = none;
+    std::size_t count = 0;
+
+    const std::size_t size = tree_.size();
+    for (std::size_t step = 0; step < size; ++step) {
+      const std::size_t idx = (search_start_ + step) % size;
+      const auto edge = tree_[idx];
+      if (cut_[edge] >= negative_cut)
+        continue;
+
+      if (found == none || cut_[edge] < cut_[std::size_t(found)])
+        found = int32_t(edge);
+
+      if (++count >= search_size) {
+        search_start_ = idx;
+        return found;
+      }
+    }
+    search_start_ = 0;
+    return found;
+  }
+
+  /** collects the part of the tree below `leaving` in `part_`, the
+   *  lower end of it first, and marks it.
+   */
+  void cut_off(uint32_t leaving)
+  {
+    const auto& item = edges_[leaving];
+
+    ++pivot_;
+    part_.assign(1, parent_[item.tail] == int32_t(leaving) ? item.tail
+                                                           : item.head);
+    for (std::size_t i = 0; i < part_.size(); ++i) {
+      const auto node = part_[i];
+      mark_[node] = pivot_;
+
+      for (auto edge : tree_adj_[node]) {
+        const auto other = opposite(edge, node);
+        if (parent_[other] == int32_t(edge))
+          part_.push_back(other);
+      }
+    }
+  }
+
+  /** the non tree edge of least slack that reconnects both parts of the
+   *  tree without `leaving`, going the same way across.
+   */
+  int32_t enter_edge(uint32_t leaving) const
+  {
+    // if the part cut off is below the tail of leaving, edges going into
+    // it are searched, otherwise edges going out of it.
+    const bool  outsearch = part_.front() == edges_[leaving].head;
+    const auto& offsets   = outsearch ? out_offsets_ : in_offsets_;
+    const auto& edges     = outsearch ? out_ : in_;
+
+    int32_t found      = none;
+    int     best_slack = std::numeric_limits<int>::max();
+
+    for (std::size_t i = 0; i < part_.size() && best_slack > 0; ++i) {
+      const auto node = part_[i];
+      for (auto j = offsets[node]; j < offsets[node + 1]; ++j) {
+        const auto edge = edges[j];
+        if (in_tree(edge) || mark_[opposite(edge, node)] == pivot_)
+          continue;
+        if (const int edge_slack = slack(edge); edge_slack < best_slack) {
+          found      = int32_t(edge);
+          best_slack = edge_slack;
+        }
+      }
+    }
+    return found;
+  }
+
+  uint32_t parent_node(uint32_t node) const noexcept
+  {
+    return opposite(uint32_t(parent_[node]), node);
+  }
+
+  uint32_t common_ancestor(uint32_t lhs, uint32_t rhs) const noexcept
+  {
+    while (lhs != rhs) {
+      if (depth_[lhs] >= depth_[rhs])
+        lhs = parent_node(lhs);
+      else
+        rhs = parent_node(rhs);
+    }
+    return lhs;
+  }
+
+  /** adds `cutvalue` to cut values of tree edges from `node` up to its
+   *  ancestor `top`.
+   */
+  void treeupdate(uint32_t node, uint32_t top, double cutvalue, bool dir)
+  {
+    for (; node != top; node = parent_node(node)) {
+      const auto edge = uint32_t(parent_[node]);
+      const bool d    = node == edges_[edge].tail ? dir : !dir;
+      cut_[edge] += d ? cutvalue : -cutvalue;
+    }
+  }
+
+  /** hangs the part cut off from `entering`, rerooted at its end. */
+  void reroot(uint32_t entering, uint32_t leaving)
+  {
+    const auto& item = edges_[entering];
+    const auto  root = mark_[item.tail] == pivot_ ? item.tail : item.head;
+
+    // parents on the path from the new root to the old one turn around.
+    auto    node = root;
+    int32_t edge = int32_t(entering);
+    for (;;) {
+      const auto next = parent_[node];
+      parent_[node] = edge;
+      if (next == int32_t(leaving))
+        break;
+
+      edge = next;
+      node = opposite(uint32_t(next), node);
+    }
+
+    part_.assign(1, root);
+    depth_[root] = depth_[opposite(entering, root)] + 1;
+    for (std::size_t i = 0; i < part_.size(); ++i) {
+      const auto parent = part_[i];
+      for (auto child_edge : tree_adj_[parent]) {
+        const auto child = opposite(child_edge, parent);
+        if (parent_[child] == int32_t(child_edge)) {
+          depth_[child] = depth_[parent] + 1;
+          part_.push_back(child);
+        }
+      }
+    }
+  }
+
+  void update(uint32_t entering, uint32_t leaving)
+  {
+    // entering becomes tight by moving the part cut off.
+    if (const int delta = slack(entering); delta > 0) {
+      const int shift = part_.front() == edges_[leaving].tail ? -delta
+                                                              : delta;
+      for (auto node : part_)
+        rank_[node] += shift;
+    }
+
+    const double cutvalue = cut_[leaving];
+    const auto&  enter    = edges_[entering];
+    const auto   lca      = common_ancestor(enter.tail, enter.head);
+    treeupdate(enter.tail, lca, cutvalue, true);
+    treeupdate(enter.head, lca, cutvalue, false);
+
+    cut_[entering] = -cutvalue;
+    cut_[leaving]  = 0.;
+    exchange_tree_edges(leaving, entering);
+    reroot(entering, leaving);
+  }
+
+ public:
+  NetworkSimplex() = default;
+
+  /** @throws std::out_of_range if an edge refers to a node that isn't. */
+  NetworkSimplex(std::size_t node_count, std::vector<Edge> edges)
+    : node_count_(node_count)
+    , edges_(std::move(edges))
+  {
+    for (const auto& edge : edges_)
+      if (edge.tail >= node_count_ || edge.head >= node_count_)
+        throw std::out_of_range("edge of nonexistent node");
+
+    index(node_count_, edges_, &Edge::tail, out_offsets_, out_);
+    index(node_count_, edges_, &Edge::head, in_offsets_, in_);
+  }
+
+  std::size_t node_count() const noexcept { return node_count_; }
+  const std::vector<Edge>& edges() const noexcept { return edges_; }
+
+  /** ranks found by the last call to `solve`. */
+  const std::vector<int>& ranks() const noexcept { return rank_; }
+
+  /** length of `edge` beyond its minimum, never negative once solved. */
+  int slack(std::size_t edge) const noexcept
+  {
+    const auto& item = edges_[edge];
+    return rank_[item.head] - rank_[item.tail] - item.minlen;
+  }
+
+  /** ranks nodes, making at most `max_iterations` pivots.
+   *
+   * a ranking is feasible even if pivots run out, only not optimal.
+   *
+   * @param max_iterations maximum count of tree edges exchanged.
+   * @param search_size    count of negative cut values compared when
+   *                       looking for a tree edge to exchange.
+   * @returns count of pivots made.
+   * @throws std::invalid_argument if the graph has a cycle.
+   */
+  std::size_t solve(
+    std::size_t max_iterations = std::numeric_limits<std::size_t>::max(),
+    std::size_t search_size = 30)
+  {
+    rank_.assign(node_count_, 0);
+    tree_.clear();
+    tree_index_.assign(edges_.size(), none);
+    tree_adj_.assign(node_count_, {});
+    parent_.assign(node_count_, none);
+    depth_.assign(node_count_, 0);
+    low_.assign(node_count_, 0);
+    lim_.assign(node_count_, 0);
+    cut_.assign(edges_.size(), 0.);
+    mark_.assign(node_count_, 0);
+    pivot_        = 0;
+    search_start_ = 0;
+
+    init_rank();
+    feasible_tree();
+    init_cutvalues();
+
+    search_size = std::max<std::size_t>(search_size, 1);
+
+    std::size_t iterations = 0;
+    while (iterations < max_iterations) {
+      const auto leaving = leave_edge(search_size);
+      if (leaving == none)
+        break;
+
+      cut_off(uint32_t(leaving));
+      const auto entering = enter_edge(uint32_t(leaving));
+      if (entering == none)
+        break;
+
+      update(uint32_t(entering), uint32_t(leaving));
+      ++iterations;
+    }
+
+    if (node_count_ != 0) {
+      const int min = *std::min_element(rank_.begin(), rank_.end());
+      for (auto& rank : rank_)
+        rank -= min;
+    }
+    return iterations;
+  }
+};
+
+}  // namespace gviz::layout
+
+#endif  // GVIZARD_LAYOUT_NETWORK_SIMPLEX_HPP_
@@ -0,0 +1,188 @@
+#ifndef GVIZARD_LAYOUT_OSAGE_HPP_
+#define GVIZARD_LAYOUT_OSAGE_HPP_
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "gvizard/layout/clusters.hpp"
+#include "gvizard/layout/layout_graph.hpp"
+#include "gvizard/layout/packing.hpp"
+#include "gvizard/parallel/parallel_for.hpp"
+
+#include "gvizard/attrs/pack.hpp"
+#include "gvizard/attrs/packmode.hpp"
+#include "gvizard/attrs/sortv.hpp"
+
+namespace gviz::layout {
+
+/** parameters of `osage`, defaults being those of the attributes
+ *  they're named after.
+ */
+struct OsageOptions final {
+  /** margin between boxes packed at the root, see `pack_margin`. */
+  attrs::PackType pack = attrs::Pack::get_default_value();
+
+  /** how boxes are packed at the root, as an array by default. */
+  attrtypes::PackMode packmode{ attrtypes::PackModeEnum::array };
+
+  /** `pack` of clusters, those past its end taking the root's. */
+  std::vector<attrs::PackType> cluster_packs{};
+
+  /** `packmode` of clusters, those past its end taking the root's. */
+  std::vector<attrtypes::PackMode> cluster_packmodes{};
+
+  /** sort values of nodes and of clusters, ordering boxes packed by the
+   *  user's order. those past the end are 0.
+   */
+  std::vector<int> sortvs{};
+  std::vector<int> cluster_sortvs{};
+
+  /** maximum count of threads, 0 means default_concurrency(). */
+  unsigned threads = 0;
+};
+
+namespace detail {
+
+template <typename T>
+T option_or(const std::vector<T>& values, std::size_t idx,
+            const T& fallback)
+{
+  return idx < values.size() ? values[idx] : fallback;
+}
+
+}  // namespace detail
+
+/** lays out `graph` by packing boxes, in the manner of osage: the nodes
+ *  of each cluster are packed into its box, and the boxes of clusters
+ *  and of nodes in none are packed together.
+ *
+ * boxes are packed by `pack_array`, rows and columns as in the cluster's
+ * or the root's `packmode`, its margin apart, and clusters are padded
+ * by their margin. packing modes other than arrays pack as arrays of
+ * their default shape. clusters are packed across threads, and edges
+ * are left straight.
+ *
+ * node positions are centers in points, the lower left corner of the
+ * drawing at the origin.
+ */
+inline Layout osage(const LayoutGraph& graph, const Clusters& clusters,
+                    const OsageOptions& options = {})
+{
+  const std::size_t count          = graph.node_count();
+  const std::size_t clusters_count = clusters.count();
+
+  Layout layout{};
+  layout.positions.resize(count);
+  layout.sizes = graph.nodes();
+  layout.clusters.resize(clusters_count);
+
+  // boxes of the first `extra` clusters and of `nodes`.
+  const auto pack = [&](const IndexRange& nodes, std::size_t extra,
+                        const attrtypes::PackMode& mode, double margin) {
+    std::vector<LayoutNode> sizes(extra + nodes.size());
+    std::vector<int> sortvs(sizes.size());
+    for (std::size_t i = 0; i < extra; ++i) {
+      sizes[i]  = LayoutNode{ layout.clusters[i].width(),
+                              layout.clusters[i].height() };
+      sortvs[i] = detail::option_or(options.cluster_sortvs, i, 0);
+    }
+    for (std::size_t i = 0; i < nodes.size(); ++i) {
+      sizes[extra + i]  = graph.node(nodes[i]);
+      sortvs[extra + i] = detail::option_or(options.sortvs, nodes[i], 0);
+    }
+
+    return pack_array(sizes, sortvs, mode.normalized(), margin);
+  };
+
+  const auto place = [&](uint32_t node, const Point& corner) {
+    layout.positions[node] = Point{ corner.x + graph.node(node).width / 2.,
+                                    corner.y + graph.node(node).height / 2. };
+  };
+
+  // clusters are packed on their own, their boxes' lower left corners at
+  // the origin.
+  parallel::parallel_for_each_index(clusters_count,
+                                    [&](std::size_t cluster) {
+    const auto nodes    = clusters.nodes(cluster);
+    const double margin = pack_margin(
+      detail::option_or(options.cluster_packs, cluster, options.pack));
+    const auto corners  = pack(
+      nodes, 0,
+      detail::option_or(options.cluster_packmodes, cluster,
+                        options.packmode),
+      margin);
+
+    Box box{ 0., 0., 0., 0. };
+    for (std::size_t i = 0; i < nodes.size(); ++i) {
+      box.urx = std::max(box.urx, corners[i].x + graph.node(nodes[i]).width);
+      box.ury = std::max(box.ury,
+                         corners[i].y + graph.node(nodes[i]).height);
+      place(nodes[i], Point{ corners[i].x + margin, corners[i].y + margin });
+    }
+    box.urx += 2. * margin;
+    box.ury += 2. * margin;
+    layout.clusters[cluster] = box;
+  }, 1, options.threads);
+
+  // then moved along with their nodes where the root packs them.
+  const auto loose   = clusters.loose();
+  const auto corners = pack(loose, clusters_count, options.packmode,
+                            pack_margin(options.pack));
+  for (std::size_t cluster = 0; cluster < clusters_count; ++cluster) {
+    const auto& corner = corners[cluster];
+    auto& box = layout.clusters[cluster];
+    box = Box{ corner.x, corner.y, corner.x + box.urx, corner.y + box.ury };
+
+    for (auto node : clusters.nodes(cluster)) {
+      layout.positions[node].x += corner.x;
+      layout.positions[node].y += corner.y;
+    }
+  }
+  for (std::size_t i = 0; i < loose.size(); ++i)
+    place(loose[i], corners[clusters_count + i]);
+
+  return layout;
+}
+
+/** lays out `graph` by `osage`, setting `pos`, `width` and `height` of
+ *  its nodes and `bb` of its clusters.
+ *
+ * clusters are packed by their `pack` and `packmode` if they have them,
+ * and by the user's order of `sortv`, the graph itself by `options`, see
+ * `make_layout_input`.
+ */
+template <typename GraphT>
+void osage_layout(GraphT& graph, OsageOptions options = {})
+{
+  const auto input = make_layout_input(graph);
+
+  options.sortvs.resize(input.nodes.size());
+  for (std::size_t i = 0; i < input.nodes.size(); ++i)
+    options.sortvs[i] =
+      detail::get_or_default<attrs::SortV>(graph, input.nodes[i]);
+
+  const std::size_t clusters_count = input.clusters.size();
+  options.cluster_packs.resize(clusters_count, options.pack);
+  options.cluster_packmodes.resize(clusters_count, options.packmode);
+  options.cluster_sortvs.resize(clusters_count);
+  for (std::size_t i = 0; i < clusters_count; ++i) {
+    const auto cluster = input.clusters[i];
+    if (const auto pack = graph.template get_entity_attr<attrs::Pack>(
+          cluster))
+      options.cluster_packs[i] = pack->get_value();
+    if (const auto mode = graph.template get_entity_attr<attrs::PackMode>(
+          cluster))
+      options.cluster_packmodes[i] = mode->get_value();
+    options.cluster_sortvs[i] =
+      detail::get_or_default<attrs::SortV>(graph, cluster);
+  }
+
+  write_layout(graph, input,
+               osage(input.graph, make_clusters(graph, input), options));
+}
+
+}  // namespace gviz::layout
+
+#endif  // GVIZARD_LAYOUT_OSAGE_HPP_
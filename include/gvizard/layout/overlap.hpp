@@ -0,0 +1,864 @@
+#ifndef GVIZARD_LAYOUT_OVERLAP_HPP_
+#define GVIZARD_LAYOUT_OVERLAP_HPP_
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <numeric>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <variant>
+#include <vector>
+
+#include "gvizard/layout/layout_graph.hpp"
+#include "gvizard/layout/stress.hpp"
+#include "gvizard/parallel/parallel_for.hpp"
+#include "gvizard/utils.hpp"
+
+#include "gvizard/attrs/overlap_related.hpp"
+#include "gvizard/attrs/pos.hpp"
+#include "gvizard/attrs/sep.hpp"
+#include "gvizard/attrs/voro_margin.hpp"
+
+namespace gviz::layout {
+
+/** how overlaps of nodes are removed, see `attrs::Overlap`. */
+enum class OverlapMode : uint8_t {
+  retain = 0,  ///< overlaps are kept.
+  prism,       ///< by PRISM, nodes keeping near their neighbours.
+  scale,       ///< by scaling the layout up uniformly.
+  scalexy,     ///< by scaling axes apart, the area growing least.
+  voronoi,     ///< by scaling up in steps of 1 + 2 voro_margin.
+};
+
+/** parses a value of `attrs::Overlap`. true, yes and nonzero numbers
+ *  keep overlaps, anything unknown being prism, the way modes of
+ *  solvers that aren't here, such as ortho and vpsc, are.
+ */
+inline OverlapMode to_overlap_mode(const attrs::OverlapType& value)
+{
+  if (const auto *keep = std::get_if<bool>(&value))
+    return *keep ? OverlapMode::retain : OverlapMode::prism;
+
+  const std::string_view name = std::get<std::string>(value);
+  if (name.empty() || name == "true" || name == "yes")
+    return OverlapMode::retain;
+  if (name == "scale")
+    return OverlapMode::scale;
+  if (name == "scalexy")
+    return OverlapMode::scalexy;
+  if (name == "voronoi")
+    return OverlapMode::voronoi;
+
+  const bool number = name.find_first_not_of("0123456789") == name.npos;
+  return number && name.find_first_not_of('0') != name.npos
+       ? OverlapMode::retain : OverlapMode::prism;
+}
+
+/** parameters of `remove_overlaps`, defaults being those of the
+ *  attributes they're named after.
+ */
+struct OverlapOptions final {
+  /** how overlaps are removed, see `to_overlap_mode`. "prismN" makes at
+   *  most N iterations of PRISM, 1000 by default.
+   */
+  attrs::OverlapType overlap = attrs::Overlap::get_default_value();
+
+  /** scaling of the layout before PRISM. a negative value scales it so
+   *  that edges are that many times as long as nodes are large.
+   */
+  double overlap_scaling = attrs::OverlapScaling::get_default_value();
+
+  /** whether the layout is shrunk after PRISM, as far as it can be
+   *  without nodes overlapping again, if nonzero.
+   */
+  double overlap_shrink = attrs::OverlapShrink::get_default_value();
+
+  /** margin around nodes in points, see `attrs::Sep`. */
+  attrs::SepType sep = attrs::Sep::get_default_value();
+
+  /** part of the layout's size it grows by each step of voronoi. */
+  double voro_margin = attrs::VoroMargin::get_default_value();
+
+  /** maximum count of threads, 0 means default_concurrency(). */
+  unsigned threads = 0;
+};
+
+namespace detail {
+
+constexpr std::size_t default_prism_attempts = 1000;
+
+// PRISM moves overlapping neighbours at most this much further apart
+// each iteration, as Gansner and Hu suggest.
+constexpr double prism_max_expansion = 1.5;
+
+// overlapping pairs are wanted this much further apart than would
+// just remove their overlap, or stress of their neighbours keeps those
+// barely overlapping from ever parting.
+constexpr double prism_overshoot = 1.1;
+
+// neighbours of each node in the proximity graph.
+constexpr std::size_t proximity_neighbours = 6;
+
+// solves of PRISM stop once residuals shrink by this part.
+constexpr double prism_solver_tolerance = 1e-3;
+
+// PRISM gives up after this many steps not lessening overlaps.
+constexpr std::size_t prism_patience = 50;
+
+// shrinking stops once a pass would shrink by less.
+constexpr double least_shrink = .99;
+
+// factors are raised by this much so that rounding can't leave nodes
+// overlapping by a hair.
+constexpr double scale_slack = 1. + 1e-9;
+
+constexpr double infinite_scale = std::numeric_limits<double>::infinity();
+
+/** iterations of PRISM `overlap` asks for. */
+inline std::size_t prism_attempts(const attrs::OverlapType& overlap)
+{
+  const auto *name = std::get_if<std::string>(&overlap);
+  if (!name || name->size() <= 5 || name->compare(0, 5, "prism") != 0
+      || name->find_first_not_of("0123456789", 5) != name->npos)
+    return default_prism_attempts;
+
+  return std::size_t(std::stoul(name->substr(5)));
+}
+
+/** centers of nodes and half their sizes with margins, in points. */
+struct Boxes final {
+  Coords<2> centers{};
+  Coords<2> halves{};
+  double    largest_x = 0.;
+  double    largest_y = 0.;
+
+  std::size_t size() const noexcept { return centers[0].size(); }
+
+  /** a size of grid cells that most boxes span one or two of. */
+  double cell() const noexcept
+  {
+    double sum = 0.;
+    for (std::size_t i = 0; i < size(); ++i)
+      sum += std::max(halves[0][i], halves[1][i]);
+    return 2. * sum / double(std::max<std::size_t>(size(), 1));
+  }
+
+  /** least factor positions are to be scaled by for boxes `lhs` and
+   *  `rhs` not to overlap.
+   */
+  double separation(uint32_t lhs, uint32_t rhs) const noexcept
+  {
+    const auto factor = [&](std::size_t axis) {
+      const double delta = std::abs(centers[axis][lhs] - centers[axis][rhs]);
+      const double width = halves[axis][lhs] + halves[axis][rhs];
+      return delta > 0. ? width / delta : infinite_scale;
+    };
+    return std::min(factor(0), factor(1));
+  }
+
+  void scale(double x, double y) noexcept
+  {
+    for (auto& value : centers[0])
+      value *= x;
+    for (auto& value : centers[1])
+      value *= y;
+  }
+};
+
+/** half of a node's `width` and `height`, grown by `sep`: by as many
+ *  points if it's additive, otherwise scaled by 1 + it.
+ */
+inline std::pair<double, double> separated_halves(const attrs::SepType& sep,
+                                                  double width,
+                                                  double height)
+{
+  return utils::LambdaVisit(
+    sep,
+    [&](const attrtypes::AddDouble& margin) {
+      return bool(margin.addible)
+           ? std::make_pair(width / 2. + margin.value,
+                            height / 2. + margin.value)
+           : std::make_pair(width * (1. + margin.value) / 2.,
+                            height * (1. + margin.value) / 2.);
+    },
+    [&](const attrtypes::Addible<attrtypes::PointType<double>>& margin) {
+      const auto point = attrtypes::Point2D<double>(margin.value);
+      return bool(margin.addible)
+           ? std::make_pair(width / 2. + point.x, height / 2. + point.y)
+           : std::make_pair(width * (1. + point.x) / 2.,
+                            height * (1. + point.y) / 2.);
+    });
+}
+
+inline Boxes make_boxes(const LayoutGraph& graph, const Layout& layout,
+                        const attrs::SepType& sep)
+{
+  const std::size_t count = layout.positions.size();
+
+  Boxes boxes{};
+  for (auto* axis : { &boxes.centers, &boxes.halves }) {
+    (*axis)[0].resize(count);
+    (*axis)[1].resize(count);
+  }
+
+  for (std::size_t i = 0; i < count; ++i) {
+    const auto& node = i < layout.sizes.size() ? layout.sizes[i]
+                                               : graph.node(i);
+    const auto [x, y] = separated_halves(sep, node.width, node.height);
+    boxes.centers[0][i] = layout.positions[i].x;
+    boxes.centers[1][i] = layout.positions[i].y;
+    boxes.halves[0][i]  = std::max(x, 0.);
+    boxes.halves[1][i]  = std::max(y, 0.);
+    boxes.largest_x = std::max(boxes.largest_x, boxes.halves[0][i]);
+    boxes.largest_y = std::max(boxes.largest_y, boxes.halves[1][i]);
+  }
+  return boxes;
+}
+
+/** moves nodes at the same place as others a little apart, around it,
+ *  since nothing tells which way they are to be separated.
+ */
+inline void separate_coincident(Boxes& boxes)
+{
+  constexpr double golden_angle = 2.39996322972865332;
+  constexpr double nudge = 1e-3;
+
+  const std::size_t count = boxes.size();
+  auto& [xs, ys] = boxes.centers;
+
+  std::vector<uint32_t> order(count);
+  std::iota(order.begin(), order.end(), uint32_t(0));
+  std::sort(order.begin(), order.end(), [&](uint32_t lhs, uint32_t rhs) {
+    return std::make_pair(xs[lhs], ys[lhs]) < std::make_pair(xs[rhs], ys[rhs]);
+  });
+
+  for (std::size_t first = 0, i = 1; i <= count; ++i) {
+    if (i < count && xs[order[i]] == xs[order[first]]
+        && ys[order[i]] == ys[order[first]])
+      continue;
+
+    const double x = xs[order[first]], y = ys[order[first]];
+    for (std::size_t k = first + 1; k < i; ++k) {
+      const auto node = order[k];
+      const double radius =
+        nudge * (boxes.halves[0][node] + boxes.halves[1][node] + 1.)
+        * std::sqrt(double(k - first));
+      const double angle = golden_angle * double(k - first);
+      xs[node] = x + radius * std::cos(angle);
+      ys[node] = y + radius * std::sin(angle);
+    }
+    first = i;
+  }
+}
+
+/** a uniform grid of square cells over points, each cell listing the
+ *  points in it.
+ */
+class PointGrid final {
+  double left_   = 0.;
+  double bottom_ = 0.;
+  double cell_   = 1.;
+  std::size_t columns_ = 1;
+  std::size_t rows_    = 1;
+
+  std::vector<uint32_t> offsets_{};
+  std::vector<uint32_t> points_{};
+
+  std::size_t column(double x) const noexcept
+  {
+    const double at = std::floor((x - left_) / cell_);
+    return at <= 0. ? 0 : std::min(std::size_t(at), columns_ - 1);
+  }
+
+  std::size_t row(double y) const noexcept
+  {
+    const double at = std::floor((y - bottom_) / cell_);
+    return at <= 0. ? 0 : std::min(std::size_t(at), rows_ - 1);
+  }
+
+  template <typename F>
+  void each_in_cell(std::size_t column, std::size_t row, F& func) const
+  {
+    const std::size_t cell = row * columns_ + column;
+    for (auto i = offsets_[cell]; i < offsets_[cell + 1]; ++i)
+      func(points_[i]);
+  }
+
+ public:
+  /** a grid of cells `cell` wide over `coords`, wider if there would be
+   *  more than a few cells per point.
+   */
+  PointGrid(const Coords<2>& coords, double cell)
+  {
+    constexpr double cells_per_point = 4.;
+
+    const auto& [xs, ys] = coords;
+    const std::size_t count = xs.size();
+    if (count == 0) {
+      offsets_.assign(2, 0);
+      return;
+    }
+
+    const auto [left, right] = std::minmax_element(xs.begin(), xs.end());
+    const auto [bottom, top] = std::minmax_element(ys.begin(), ys.end());
+    left_   = *left;
+    bottom_ = *bottom;
+
+    const double width = *right - *left, height = *top - *bottom;
+    const double most = cells_per_point * double(count);
+    cell_ = std::max({ cell, std::sqrt(width * height / most),
+                       width / most, height / most });
+    if (!(cell_ > 0.))
+      cell_ = 1.;
+
+    columns_ = std::size_t(width / cell_) + 1;
+    rows_    = std::size_t(height / cell_) + 1;
+
+    // points by cell, counted then placed.
+    std::vector<uint32_t> cells(count);
+    offsets_.assign(columns_ * rows_ + 1, 0);
+    for (std::size_t i = 0; i < count; ++i) {
+      cells[i] = uint32_t(row(ys[i]) * columns_ + column(xs[i]));
+      ++offsets_[cells[i] + 1];
+    }
+    std::partial_sum(offsets_.begin(), offsets_.end(), offsets_.begin());
+
+    auto next = offsets_;
+    points_.resize(count);
+    for (std::size_t i = 0; i < count; ++i)
+      points_[next[cells[i]]++] = uint32_t(i);
+  }
+
+  double cell() const noexcept { return cell_; }
+
+  /** calls `func` with each point in cells meeting a rectangle. */
+  template <typename F>
+  void each_in(double llx, double lly, double urx, double ury,
+               F&& func) const
+  {
+    if (points_.empty())
+      return;
+
+    const auto first_column = column(llx), last_column = column(urx);
+    for (auto r = row(lly), last_row = row(ury); r <= last_row; ++r)
+      for (auto c = first_column; c <= last_column; ++c)
+        each_in_cell(c, r, func);
+  }
+
+  /** calls `func` with each point in cells `ring` cells around the one
+   *  of `x`, `y`, being at least `ring - 1` cells away from it.
+   *
+   * @returns whether the ring meets the grid at all.
+   */
+  template <typename F>
+  bool each_in_ring(double x, double y, std::size_t ring, F&& func) const
+  {
+    const auto at_column = std::ptrdiff_t(column(x));
+    const auto at_row    = std::ptrdiff_t(row(y));
+    const auto size      = std::ptrdiff_t(ring);
+
+    const auto visit = [&](std::ptrdiff_t c, std::ptrdiff_t r) {
+      if (c < 0 || r < 0 || c >= std::ptrdiff_t(columns_)
+          || r >= std::ptrdiff_t(rows_))
+        return false;
+      each_in_cell(std::size_t(c), std::size_t(r), func);
+      return true;
+    };
+
+    if (ring == 0)
+      return visit(at_column, at_row);
+
+    bool met = false;
+    for (auto c = at_column - size; c <= at_column + size; ++c) {
+      met = visit(c, at_row - size) || met;
+      met = visit(c, at_row + size) || met;
+    }
+    for (auto r = at_row - size + 1; r < at_row + size; ++r) {
+      met = visit(at_column - size, r) || met;
+      met = visit(at_column + size, r) || met;
+    }
+    return met;
+  }
+};
+
+using NodePair = std::pair<uint32_t, uint32_t>;
+
+/** pairs `func(node, pairs)` adds for each node, found across threads
+ *  in blocks and joined in order, so they don't depend on thread count.
+ */
+template <typename F>
+std::vector<NodePair> collect_pairs(std::size_t count, F&& func,
+                                    unsigned threads)
+{
+  constexpr std::size_t grain = 1024;
+  const std::size_t blocks = (count + grain - 1) / grain;
+
+  std::vector<std::vector<NodePair>> found(blocks);
+  parallel::parallel_for_each_index(blocks, [&](std::size_t block) {
+    const std::size_t end = std::min(count, (block + 1) * grain);
+    for (std::size_t node = block * grain; node < end; ++node)
+      func(uint32_t(node), found[block]);
+  }, 1, threads);
+
+  std::size_t total = 0;
+  for (const auto& pairs : found)
+    total += pairs.size();
+
+  std::vector<NodePair> pairs{};
+  pairs.reserve(total);
+  for (const auto& block : found)
+    pairs.insert(pairs.end(), block.begin(), block.end());
+  return pairs;
+}
+
+/** pairs of boxes that overlap, as they would if they were `grow` times
+ *  as large, each with its lower index first.
+ */
+inline std::vector<NodePair> overlapping_pairs(const Boxes& boxes,
+                                               const PointGrid& grid,
+                                               double grow, unsigned threads)
+{
+  const auto& [xs, ys] = boxes.centers;
+  const auto& [hxs, hys] = boxes.halves;
+
+  return collect_pairs(boxes.size(), [&](uint32_t node,
+                                         std::vector<NodePair>& pairs) {
+    const double x = xs[node], y = ys[node];
+    const double reach_x = grow * (hxs[node] + boxes.largest_x);
+    const double reach_y = grow * (hys[node] + boxes.largest_y);
+
+    grid.each_in(x - reach_x, y - reach_y, x + reach_x, y + reach_y,
+                 [&](uint32_t other) {
+      if (other > node
+          && std::abs(xs[other] - x) < grow * (hxs[node] + hxs[other])
+          && std::abs(ys[other] - y) < grow * (hys[node] + hys[other]))
+        pairs.emplace_back(node, other);
+    });
+  }, threads);
+}
+
+/** edges between each node and its `neighbours` nearest ones, a sparse
+ *  proximity graph, each with its lower index first.
+ */
+inline std::vector<NodePair> nearest_pairs(const Boxes& boxes,
+                                           const PointGrid& grid,
+                                           std::size_t neighbours,
+                                           unsigned threads)
+{
+  const auto& [xs, ys] = boxes.centers;
+
+  auto pairs = collect_pairs(boxes.size(), [&](uint32_t node,
+                                               std::vector<NodePair>& pairs) {
+    using Entry = std::pair<double, uint32_t>;
+    std::vector<Entry> nearest{};
+    nearest.reserve(neighbours + 1);
+
+    const double x = xs[node], y = ys[node];
+    const auto consider = [&](uint32_t other) {
+      if (other == node)
+        return;
+      const double dx = xs[other] - x, dy = ys[other] - y;
+      const Entry entry{ dx * dx + dy * dy, other };
+      if (nearest.size() == neighbours && !(entry < nearest.back()))
+        return;
+      nearest.insert(std::upper_bound(nearest.begin(), nearest.end(), entry),
+                     entry);
+      if (nearest.size() > neighbours)
+        nearest.pop_back();
+    };
+
+    // rings farther than the farthest found can't hold nearer ones.
+    for (std::size_t ring = 0;; ++ring) {
+      const double least = double(ring) * grid.cell() - grid.cell();
+      if (nearest.size() == neighbours && least > 0.
+          && nearest.back().first <= least * least)
+        break;
+      if (!grid.each_in_ring(x, y, ring, consider))
+        break;
+    }
+
+    for (const auto& [distance2, other] : nearest)
+      pairs.emplace_back(std::min(node, other), std::max(node, other));
+  }, threads);
+
+  std::sort(pairs.begin(), pairs.end());
+  pairs.erase(std::unique(pairs.begin(), pairs.end()), pairs.end());
+  return pairs;
+}
+
+/** terms of stress of `pairs` being as far apart as PRISM wants them:
+ *  overlapping ones moved apart by a little more than removes their
+ *  overlap, up to `prism_max_expansion` times, others kept as they are.
+ */
+inline StressTerms prism_terms(const Boxes& boxes,
+                               const std::vector<NodePair>& pairs)
+{
+  const std::size_t count = boxes.size();
+
+  StressTerms terms{};
+  terms.offsets.assign(count + 1, 0);
+  for (const auto& [lhs, rhs] : pairs) {
+    ++terms.offsets[lhs + 1];
+    ++terms.offsets[rhs + 1];
+  }
+  std::partial_sum(terms.offsets.begin(), terms.offsets.end(),
+                   terms.offsets.begin());
+
+  terms.others.resize(terms.offsets.back());
+  terms.distances.resize(terms.offsets.back());
+  terms.weights.resize(terms.offsets.back());
+
+  auto next = terms.offsets;
+  const auto add = [&](uint32_t node, uint32_t other, double distance) {
+    const auto i = next[node]++;
+    terms.others[i]    = other;
+    terms.distances[i] = distance;
+    terms.weights[i]   = 1. / (distance * distance);
+  };
+
+  for (const auto& [lhs, rhs] : pairs) {
+    const double separation = boxes.separation(lhs, rhs);
+    const double expansion =
+      separation > 1. ? std::min(separation * prism_overshoot,
+                                 prism_max_expansion)
+                      : 1.;
+    const double distance =
+      expansion * pair_distance<2>(boxes.centers, lhs, rhs);
+    if (!(distance > 0.))
+      continue;
+    add(lhs, rhs, distance);
+    add(rhs, lhs, distance);
+  }
+
+  // pairs of nodes at the same place, left out, leave gaps in rows.
+  std::size_t kept = 0;
+  for (std::size_t node = 0; node < count; ++node) {
+    const auto begin = terms.offsets[node];
+    terms.offsets[node] = uint32_t(kept);
+    for (auto i = begin; i < next[node]; ++i, ++kept) {
+      terms.others[kept]    = terms.others[i];
+      terms.distances[kept] = terms.distances[i];
+      terms.weights[kept]   = terms.weights[i];
+    }
+  }
+  terms.offsets[count] = uint32_t(kept);
+  terms.others.resize(kept);
+  terms.distances.resize(kept);
+  terms.weights.resize(kept);
+  return terms;
+}
+
+/** moves nodes at `coords` by a step of stress majorization of `terms`,
+ *  as `majorize` makes.
+ *
+ * solves stop once residuals shrink by `prism_solver_tolerance` of those
+ * they start with, rather than of the right side, as only nodes near
+ * overlaps are off and their moves would be lost among all the others.
+ */
+inline void prism_step(const StressTerms& terms, Coords<2>& coords,
+                       unsigned threads)
+{
+  const std::size_t count = terms.node_count();
+
+  std::vector<double> diagonal(count), inverse_diagonal(count);
+  for (std::size_t node = 0; node < count; ++node) {
+    diagonal[node] = std::accumulate(
+      terms.weights.begin() + terms.offsets[node],
+      terms.weights.begin() + terms.offsets[node + 1], 0.);
+    inverse_diagonal[node] = diagonal[node] > 0. ? 1. / diagonal[node] : 0.;
+  }
+
+  const auto laplacian = [&](const std::vector<double>& in,
+                             std::vector<double>& out) {
+    parallel::parallel_for(count, [&](std::size_t begin, std::size_t end) {
+      for (std::size_t node = begin; node < end; ++node) {
+        double sum = 0.;
+        for (auto i = terms.offsets[node]; i < terms.offsets[node + 1]; ++i)
+          sum += terms.weights[i] * in[terms.others[i]];
+        out[node] = diagonal[node] * in[node] - sum;
+      }
+    }, 1024, threads);
+  };
+
+  std::vector<double> lengths(terms.others.size());
+  parallel::parallel_for(count, [&](std::size_t begin, std::size_t end) {
+    for (std::size_t node = begin; node < end; ++node)
+      for (auto i = terms.offsets[node]; i < terms.offsets[node + 1]; ++i)
+        lengths[i] = pair_distance<2>(coords, uint32_t(node),
+                                      terms.others[i]);
+  }, 1024, threads);
+
+  std::vector<double> right(count), product(count);
+  for (auto& values : coords) {
+    parallel::parallel_for(count, [&](std::size_t begin, std::size_t end) {
+      for (std::size_t node = begin; node < end; ++node) {
+        double sum = 0.;
+        for (auto i = terms.offsets[node]; i < terms.offsets[node + 1]; ++i)
+          if (lengths[i] > 0.)
+            sum += terms.weights[i] * terms.distances[i]
+                 * (values[node] - values[terms.others[i]]) / lengths[i];
+        right[node] = sum;
+      }
+    }, 1024, threads);
+
+    laplacian(values, product);
+    const double start = parallel_sum(count, [&](std::size_t node) {
+      const double residual = right[node] - product[node];
+      return residual * residual;
+    }, threads);
+    const double norm = parallel_sum(count, [&](std::size_t node) {
+      return right[node] * right[node];
+    }, threads);
+    if (!(norm > 0.))
+      continue;
+
+    conjugate_gradient(laplacian, right, inverse_diagonal, values,
+                       prism_solver_tolerance * std::sqrt(start / norm),
+                       solver_maxiter, threads);
+  }
+}
+
+/** scales the layout before PRISM by `scaling`, see `overlap_scaling`. */
+inline void prescale(const LayoutGraph& graph, Boxes& boxes, double scaling)
+{
+  double factor = scaling;
+  if (scaling < 0.) {
+    double lengths = 0., sizes = 0.;
+    std::size_t edges = 0;
+    for (const auto& edge : graph.edges())
+      if (edge.source != edge.target) {
+        lengths += pair_distance<2>(boxes.centers, edge.source,
+                                    edge.target);
+        ++edges;
+      }
+    for (std::size_t i = 0; i < boxes.size(); ++i)
+      sizes += boxes.halves[0][i] + boxes.halves[1][i];
+
+    if (edges == 0 || !(lengths > 0.))
+      return;
+    factor = -scaling * (sizes / double(boxes.size()))
+           / (lengths / double(edges));
+  }
+
+  if (factor > 0.)
+    boxes.scale(factor, factor);
+}
+
+/** PRISM, by Gansner and Hu: steps of stress majorization of a proximity
+ *  graph whose overlapping edges want to be longer, until no nodes
+ *  overlap, `attempts` steps are made or `prism_patience` steps don't
+ *  lessen overlaps.
+ *
+ * the proximity graph is that of nearest neighbours, rather than the
+ * Delaunay triangulation, joined by pairs overlapping so that overlaps
+ * between nodes that aren't neighbours are removed too.
+ */
+inline void prism(Boxes& boxes, std::size_t attempts, unsigned threads)
+{
+  std::size_t fewest = std::numeric_limits<std::size_t>::max();
+  std::size_t since_fewest = 0;
+
+  for (std::size_t attempt = 0; attempt < attempts; ++attempt) {
+    const PointGrid grid(boxes.centers, boxes.cell());
+
+    auto pairs = overlapping_pairs(boxes, grid, 1., threads);
+    if (pairs.empty())
+      break;
+
+    if (pairs.size() < fewest) {
+      fewest = pairs.size();
+      since_fewest = 0;
+    } else if (++since_fewest == prism_patience) {
+      break;
+    }
+
+    const auto near = nearest_pairs(boxes, grid, proximity_neighbours,
+                                    threads);
+    pairs.insert(pairs.end(), near.begin(), near.end());
+    std::sort(pairs.begin(), pairs.end());
+    pairs.erase(std::unique(pairs.begin(), pairs.end()), pairs.end());
+
+    prism_step(prism_terms(boxes, pairs), boxes.centers, threads);
+  }
+}
+
+/** least factor the layout is to be scaled by for none of `pairs` to
+ *  overlap, at least `least`.
+ */
+inline double separating_scale(const Boxes& boxes,
+                               const std::vector<NodePair>& pairs,
+                               double least)
+{
+  double factor = least;
+  for (const auto& [lhs, rhs] : pairs)
+    factor = std::max(factor, boxes.separation(lhs, rhs));
+  return factor * scale_slack;
+}
+
+/** scales the layout up uniformly, as little as removes overlaps, or
+ *  by the least power of `step` that does if it's above 1.
+ */
+inline void scale_apart(Boxes& boxes, double step, unsigned threads)
+{
+  const PointGrid grid(boxes.centers, boxes.cell());
+  const auto pairs = overlapping_pairs(boxes, grid, 1., threads);
+  if (pairs.empty())
+    return;
+
+  double factor = separating_scale(boxes, pairs, 1.);
+  if (step > 1.)
+    factor = std::pow(step, std::ceil(std::log(factor) / std::log(step)))
+           * scale_slack;
+  boxes.scale(factor, factor);
+}
+
+/** scales axes of the layout up apart, by factors removing overlaps
+ *  whose product is least.
+ *
+ * each overlapping pair is removed by scaling x or y enough. taking
+ * pairs by decreasing x factor, those before one are removed by y and
+ * the rest by x, the best of which split is chosen.
+ */
+inline void scale_xy_apart(Boxes& boxes, unsigned threads)
+{
+  const PointGrid grid(boxes.centers, boxes.cell());
+  const auto pairs = overlapping_pairs(boxes, grid, 1., threads);
+  if (pairs.empty())
+    return;
+
+  const auto factor = [&](const NodePair& pair, std::size_t axis) {
+    const auto [lhs, rhs] = pair;
+    const double delta =
+      std::abs(boxes.centers[axis][lhs] - boxes.centers[axis][rhs]);
+    const double width = boxes.halves[axis][lhs] + boxes.halves[axis][rhs];
+    return delta > 0. ? width / delta : infinite_scale;
+  };
+
+  std::vector<std::pair<double, double>> factors{};
+  factors.reserve(pairs.size());
+  for (const auto& pair : pairs)
+    factors.emplace_back(factor(pair, 0), factor(pair, 1));
+  std::sort(factors.begin(), factors.end(), std::greater<>{});
+
+  double best_x = 1., best_y = infinite_scale;
+  double y = 1.;
+  for (std::size_t i = 0; i <= factors.size(); ++i) {
+    const double x = i < factors.size() ? std::max(factors[i].first, 1.)
+                                        : 1.;
+    if (x < infinite_scale && x * y < best_x * best_y) {
+      best_x = x;
+      best_y = y;
+    }
+    if (i < factors.size())
+      y = std::max(y, factors[i].second);
+  }
+  boxes.scale(best_x * scale_slack, best_y * scale_slack);
+}
+
+/** scales the layout down as far as it can be without boxes overlapping,
+ *  pass by pass, each shrinking it by half at most.
+ */
+inline void shrink(Boxes& boxes, unsigned threads)
+{
+  constexpr int passes = 8;
+
+  for (int pass = 0; pass < passes; ++pass) {
+    const PointGrid grid(boxes.centers, boxes.cell());
+    const double factor = separating_scale(
+      boxes, overlapping_pairs(boxes, grid, 2., threads), .5);
+    if (factor >= least_shrink)
+      break;
+    boxes.scale(factor, factor);
+  }
+}
+
+}  // namespace detail
+
+/** moves nodes of `layout` of `graph` so that none overlap, by the mode
+ *  `overlap` asks for, nodes being their size and `sep` large.
+ *
+ * overlapping pairs are found by a uniform grid of nodes, in time about
+ * linear in their count, across threads. PRISM takes time about linear
+ * per iteration, nearest neighbours also being found by the grid, and
+ * leaves no overlaps by scaling up at last if its iterations didn't
+ * remove all. the layout is moved so that the lower left corner of its
+ * bounding box is the origin; edges are left straight and boxes of
+ * clusters are dropped, as they no longer fit.
+ */
+inline Layout remove_overlaps(const LayoutGraph& graph, Layout layout,
+                              const OverlapOptions& options = {})
+{
+  const auto mode = to_overlap_mode(options.overlap);
+  const std::size_t count = layout.positions.size();
+  if (mode == OverlapMode::retain || count < 2)
+    return layout;
+
+  auto boxes = detail::make_boxes(graph, layout, options.sep);
+  detail::separate_coincident(boxes);
+
+  switch (mode) {
+    case OverlapMode::prism:
+      detail::prescale(graph, boxes, options.overlap_scaling);
+      detail::prism(boxes, detail::prism_attempts(options.overlap),
+                    options.threads);
+      detail::scale_apart(boxes, 1., options.threads);
+      if (options.overlap_shrink != 0.)
+        detail::shrink(boxes, options.threads);
+      break;
+    case OverlapMode::scalexy:
+      detail::scale_xy_apart(boxes, options.threads);
+      break;
+    case OverlapMode::voronoi:
+      detail::scale_apart(boxes, 1. + 2. * options.voro_margin,
+                          options.threads);
+      break;
+    default:
+      detail::scale_apart(boxes, 1., options.threads);
+  }
+
+  double left = std::numeric_limits<double>::max();
+  double bottom = left;
+  for (std::size_t i = 0; i < count; ++i) {
+    const auto& node = i < layout.sizes.size() ? layout.sizes[i]
+                                               : graph.node(i);
+    left   = std::min(left, boxes.centers[0][i] - node.width / 2.);
+    bottom = std::min(bottom, boxes.centers[1][i] - node.height / 2.);
+  }
+  for (std::size_t i = 0; i < count; ++i)
+    layout.positions[i] = Point{ boxes.centers[0][i] - left,
+                                 boxes.centers[1][i] - bottom };
+
+  layout.splines.clear();
+  layout.clusters.clear();
+  return layout;
+}
+
+/** removes overlaps of nodes of `graph` where `pos` puts them, as left
+ *  by a layout, by `remove_overlaps`, setting `pos` of its nodes again
+ *  and unsetting that of its edges.
+ *
+ * nodes without a position are at the origin. graph attributes are
+ * given in `options`, see `make_layout_input`.
+ */
+template <typename GraphT>
+void remove_overlaps_layout(GraphT& graph, const OverlapOptions& options = {})
+{
+  if (to_overlap_mode(options.overlap) == OverlapMode::retain)
+    return;
+
+  const auto input = make_layout_input(graph);
+  write_layout(graph, input,
+               remove_overlaps(input.graph, read_layout(graph, input),
+                               options));
+  for (auto edge : input.edges)
+    graph.template remove_entity_attr<attrs::Pos>(edge);
+}
+
+}  // namespace gviz::layout
+
+#endif  // GVIZARD_LAYOUT_OVERLAP_HPP_
@@ -0,0 +1,465 @@
+#ifndef GVIZARD_LAYOUT_PACKING_HPP_
+#define GVIZARD_LAYOUT_PACKING_HPP_
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <numeric>
+#include <utility>
+#include <variant>
+#include <vector>
+
+#include "gvizard/layout/layout_graph.hpp"
+#include "gvizard/parallel/parallel_for.hpp"
+
+#include "gvizard/attrs/pack.hpp"
+#include "gvizard/attrs/packmode.hpp"
+
+namespace gviz::layout {
+
+/** how parts of a drawing are packed, defaults being those of the
+ *  attributes they're named after.
+ */
+struct PackOptions final {
+  /** margin between parts, see `pack_margin`. */
+  attrs::PackType pack = attrs::Pack::get_default_value();
+
+  /** packing of parts, as polyominoes unless an array. */
+  attrtypes::PackMode packmode = attrs::PackMode::get_default_value();
+
+  /** sort values of parts, ordering arrays by the user's order. */
+  std::vector<int> sortvs{};
+
+  /** maximum count of threads, 0 means default_concurrency(). */
+  unsigned threads = 0;
+};
+
+namespace detail {
+
+// margin between packed boxes in points, unless `pack` gives one.
+constexpr double default_pack_margin = 8.;
+
+// cells of polyominoes per part, the grid's step is chosen for.
+constexpr double cells_per_part = 100.;
+
+}  // namespace detail
+
+/** margin between packed boxes in points by `pack`, a number being one
+ *  and anything else asking for the default.
+ */
+inline double pack_margin(const attrs::PackType& pack)
+{
+  if (const auto *margin = std::get_if<int>(&pack); margin && *margin >= 0)
+    return double(*margin);
+
+  return detail::default_pack_margin;
+}
+
+/** packs boxes of `sizes` as an array, `margin` apart, returning their
+ *  lower left corners, the array's being the origin.
+ *
+ * cells are filled by rows from the top, or by columns from the left if
+ * `mode` has the column flag, as many in each row, or column, as `mode`
+ * gives, or about the square root of their count. boxes are centered in
+ * their cell unless `mode` aligns them to a side, and are taken in
+ * increasing order of `sortvs` if it has the user flag.
+ */
+inline std::vector<Point> pack_array(const std::vector<LayoutNode>& sizes,
+                                     const std::vector<int>& sortvs,
+                                     const attrtypes::PackMode& mode,
+                                     double margin)
+{
+  using Flag = attrtypes::PackModeArrayFlag;
+
+  const std::size_t count = sizes.size();
+  std::vector<Point> corners(count);
+  if (count == 0)
+    return corners;
+
+  std::vector<uint32_t> order(count);
+  std::iota(order.begin(), order.end(), uint32_t(0));
+  if (mode.flag == Flag::user && sortvs.size() == count)
+    std::stable_sort(order.begin(), order.end(),
+                     [&](uint32_t lhs, uint32_t rhs) {
+                       return sortvs[lhs] < sortvs[rhs];
+                     });
+
+  const bool by_columns = mode.flag == Flag::column;
+  const std::size_t major = mode.number > 0
+    ? std::min(std::size_t(mode.number), count)
+    : std::size_t(std::ceil(std::sqrt(double(count))));
+  const std::size_t minor = (count + major - 1) / major;
+
+  const std::size_t columns = by_columns ? minor : major;
+  const std::size_t rows    = by_columns ? major : minor;
+  const auto cell = [&](std::size_t i) {
+    return by_columns ? std::make_pair(i % rows, i / rows)
+                      : std::make_pair(i / columns, i % columns);
+  };
+
+  std::vector<double> widths(columns), heights(rows);
+  for (std::size_t i = 0; i < count; ++i) {
+    const auto [row, column] = cell(i);
+    widths[column] = std::max(widths[column], sizes[order[i]].width);
+    heights[row]   = std::max(heights[row], sizes[order[i]].height);
+  }
+
+  // left sides of columns, and tops of rows from the top down.
+  std::vector<double> lefts(columns), tops(rows);
+  for (std::size_t column = 1; column < columns; ++column)
+    lefts[column] = lefts[column - 1] + widths[column - 1] + margin;
+  double top = std::accumulate(heights.begin(), heights.end(), 0.)
+             + margin * double(rows - 1);
+  for (std::size_t row = 0; row < rows; ++row) {
+    tops[row] = top;
+    top -= heights[row] + margin;
+  }
+
+  for (std::size_t i = 0; i < count; ++i) {
+    const auto [row, column] = cell(i);
+    const auto& size = sizes[order[i]];
+
+    const double spare_x = widths[column] - size.width;
+    const double spare_y = heights[row] - size.height;
+    corners[order[i]] = Point{
+      lefts[column] + (mode.flag == Flag::left    ? 0.
+                       : mode.flag == Flag::right ? spare_x
+                                                  : spare_x / 2.),
+      tops[row] - size.height - (mode.flag == Flag::top      ? 0.
+                                 : mode.flag == Flag::bottom ? spare_y
+                                                             : spare_y / 2.)
+    };
+  }
+  return corners;
+}
+
+/** side of cells of polyominoes for parts within `boxes`, so that each
+ *  part covers about a hundred cells, as packing in graphviz does.
+ *
+ * @param margin margin between parts in points.
+ */
+inline double grid_step(const std::vector<Box>& boxes, double margin)
+{
+  if (boxes.empty())
+    return 1.;
+
+  // the root of a * l^2 + b * l + c, as areas of parts grown by a cell
+  // add up to the cells wanted.
+  double sides = 0., areas = 0.;
+  for (const auto& box : boxes) {
+    const double width  = box.width() + margin;
+    const double height = box.height() + margin;
+    sides += width + height;
+    areas += width * height;
+  }
+
+  const double a = detail::cells_per_part * double(boxes.size()) - 1.;
+  const double root = (sides + std::sqrt(sides * sides + 4. * a * areas))
+                    / (2. * a);
+  return std::max(std::floor(root), 1.);
+}
+
+/** cells of a square grid that a part of a drawing covers, to be packed
+ *  by `pack_polyominoes`.
+ */
+class Polyomino final {
+  double step_;
+  std::vector<std::pair<int32_t, int32_t>> cells_{};
+
+  std::pair<int32_t, int32_t> cell_of(double x, double y) const
+  {
+    return { int32_t(std::floor(x / step_)), int32_t(std::floor(y / step_)) };
+  }
+
+ public:
+  /** a polyomino of no cells, of a grid of cells `step` points wide. */
+  explicit Polyomino(double step) : step_(step) {}
+
+  /** covers cells `box` overlaps. */
+  void add_box(const Box& box)
+  {
+    const auto [left, bottom] = cell_of(box.llx, box.lly);
+    const auto [right, top]   = cell_of(box.urx, box.ury);
+    for (auto x = left; x <= right; ++x)
+      for (auto y = bottom; y <= top; ++y)
+        cells_.emplace_back(x, y);
+  }
+
+  /** covers cells along the segment from `from` to `to`. */
+  void add_segment(const Point& from, const Point& to)
+  {
+    const double length = std::hypot(to.x - from.x, to.y - from.y);
+    const auto   steps  = std::max(
+      std::size_t(std::ceil(2. * length / step_)), std::size_t(1));
+
+    for (std::size_t i = 0; i <= steps; ++i) {
+      const double at = double(i) / double(steps);
+      cells_.push_back(cell_of(from.x + (to.x - from.x) * at,
+                               from.y + (to.y - from.y) * at));
+    }
+  }
+
+  /** covered cells, in no order and possibly repeated. */
+  const std::vector<std::pair<int32_t, int32_t>>& cells() const noexcept
+  {
+    return cells_;
+  }
+};
+
+namespace detail {
+
+/** cells taken by packed polyominoes, as a square of flags around the
+ *  origin growing to hold them.
+ *
+ * it counts cells taken in each ring, a ring being the cells as far
+ * from the origin along either axis, and links each taken cell to the
+ * next one along its row and along its column by disjoint sets, so
+ * that searches skip cells taken.
+ */
+class CellGrid final {
+  int64_t reach_ = 0;
+  std::vector<uint8_t>  flags_ = std::vector<uint8_t>(1);
+  std::vector<uint32_t> rows_{ 0, 1 };
+  std::vector<uint32_t> columns_{ 0, 1 };
+  std::vector<int64_t>  rings_ = std::vector<int64_t>(1);
+  std::size_t           first_free_ = 0;
+
+  static int64_t ring_of(int64_t x, int64_t y) noexcept
+  {
+    return std::max(x < 0 ? -x : x, y < 0 ? -y : y);
+  }
+
+  int64_t side() const noexcept { return 2 * reach_ + 1; }
+
+  std::size_t index(int64_t x, int64_t y) const noexcept
+  {
+    return std::size_t((y + reach_) * side() + x + reach_);
+  }
+
+  // links of a line hold one past its end, never taken.
+  std::size_t link(int64_t line, int64_t at) const noexcept
+  {
+    return std::size_t((line + reach_) * (side() + 1) + at + reach_);
+  }
+
+  /** first cell not taken from `at` on, along a line of `links`. */
+  static uint32_t next_free(std::vector<uint32_t>& links, std::size_t base,
+                            uint32_t at) noexcept
+  {
+    while (links[base + at] != at) {
+      links[base + at] = links[base + links[base + at]];
+      at = links[base + at];
+    }
+    return at;
+  }
+
+  void grow(int64_t reach)
+  {
+    const auto old_reach = reach_;
+    const auto old_flags = std::move(flags_);
+    const auto old_side  = side();
+
+    reach_ = reach;
+    flags_.assign(std::size_t(side() * side()), 0);
+    for (int64_t y = -old_reach; y <= old_reach; ++y)
+      for (int64_t x = -old_reach; x <= old_reach; ++x)
+        flags_[index(x, y)] = old_flags[std::size_t(
+          (y + old_reach) * old_side + x + old_reach)];
+
+    rows_.resize(std::size_t(side() * (side() + 1)));
+    columns_.resize(rows_.size());
+    for (int64_t line = -reach_; line <= reach_; ++line)
+      for (int64_t at = -reach_; at <= reach_ + 1; ++at) {
+        const auto own = uint32_t(at + reach_);
+        rows_[link(line, at)] =
+          at <= reach_ && flags_[index(at, line)] ? own + 1 : own;
+        columns_[link(line, at)] =
+          at <= reach_ && flags_[index(line, at)] ? own + 1 : own;
+      }
+  }
+
+ public:
+  bool taken(int64_t x, int64_t y) const noexcept
+  {
+    return ring_of(x, y) <= reach_ && flags_[index(x, y)];
+  }
+
+  void take(int64_t x, int64_t y)
+  {
+    const auto ring = ring_of(x, y);
+    if (ring > reach_)
+      grow(std::max(ring, 2 * reach_));
+
+    if (auto& flag = flags_[index(x, y)]; !flag) {
+      flag = 1;
+      rows_[link(y, x)]    = uint32_t(x + reach_ + 1);
+      columns_[link(x, y)] = uint32_t(y + reach_ + 1);
+      if (rings_.size() <= std::size_t(ring))
+        rings_.resize(std::size_t(ring) + 1);
+      ++rings_[std::size_t(ring)];
+    }
+  }
+
+  /** steps from `x`, `y` along increasing x, or y if not `along_x`, to
+   *  the first cell not taken.
+   */
+  int64_t taken_run(int64_t x, int64_t y, bool along_x) noexcept
+  {
+    if (ring_of(x, y) > reach_)
+      return 0;
+
+    auto& links = along_x ? rows_ : columns_;
+    const auto line = along_x ? y : x;
+    const auto at   = along_x ? x : y;
+    const auto base = link(line, -reach_);
+    return int64_t(next_free(links, base, uint32_t(at + reach_)))
+         - (at + reach_);
+  }
+
+  /** the innermost ring with a cell not taken. */
+  int64_t first_free() noexcept
+  {
+    const auto full = [](std::size_t ring) {
+      return ring == 0 ? int64_t(1) : int64_t(8 * ring);
+    };
+    while (first_free_ < rings_.size()
+           && rings_[first_free_] == full(first_free_))
+      ++first_free_;
+    return int64_t(first_free_);
+  }
+};
+
+}  // namespace detail
+
+/** packs `parts` so that no two cover a cell, returning how far each is
+ *  to be moved, in points.
+ *
+ * parts are placed from the largest, each at the first place in rings
+ * of cells around the origin where it fits, after the manner of
+ * polyomino packing of Freivalds et al. so that parts nest in the gaps
+ * of others. parts are readied across threads.
+ *
+ * @param step side of cells of the parts in points.
+ */
+inline std::vector<Point> pack_polyominoes(
+  const std::vector<Polyomino>& parts, double step, unsigned threads = 0)
+{
+  using Cell = std::pair<int32_t, int32_t>;
+
+  const std::size_t count = parts.size();
+  std::vector<Point> offsets(count, Point{ 0., 0. });
+
+  // cells of each part around the center of their bounds.
+  std::vector<std::vector<Cell>> cells(count);
+  std::vector<Cell>    centers(count);
+  std::vector<int64_t> extents(count);
+  parallel::parallel_for_each_index(count, [&](std::size_t part) {
+    auto& own = cells[part];
+    own = parts[part].cells();
+    std::sort(own.begin(), own.end());
+    own.erase(std::unique(own.begin(), own.end()), own.end());
+    if (own.empty())
+      return;
+
+    Cell low = own.front(), high = own.front();
+    for (const auto& [x, y] : own) {
+      low  = { std::min(low.first, x), std::min(low.second, y) };
+      high = { std::max(high.first, x), std::max(high.second, y) };
+    }
+    centers[part] = { low.first + (high.first - low.first) / 2,
+                      low.second + (high.second - low.second) / 2 };
+    extents[part] = int64_t(high.first - low.first)
+                  + int64_t(high.second - low.second);
+    for (auto& [x, y] : own) {
+      x -= centers[part].first;
+      y -= centers[part].second;
+    }
+  }, 1, threads);
+
+  std::vector<uint32_t> order(count);
+  std::iota(order.begin(), order.end(), uint32_t(0));
+  std::stable_sort(order.begin(), order.end(),
+                   [&](uint32_t lhs, uint32_t rhs) {
+                     return extents[lhs] > extents[rhs];
+                   });
+
+  // the cell last found taken is tried first, as offsets nearby likely
+  // find it taken too.
+  detail::CellGrid taken{};
+  std::size_t last_taken = 0;
+  const auto fits = [&](const std::vector<Cell>& own, int64_t dx,
+                        int64_t dy) {
+    if (taken.taken(own[last_taken].first + dx,
+                    own[last_taken].second + dy))
+      return false;
+
+    for (std::size_t i = 0; i < own.size(); ++i)
+      if (taken.taken(own[i].first + dx, own[i].second + dy)) {
+        last_taken = i;
+        return false;
+      }
+    return true;
+  };
+
+  for (auto part : order) {
+    auto& own = cells[part];
+    if (own.empty())
+      continue;
+
+    // the cell nearest the center is tried first, and moved no nearer
+    // than the full rings around the origin.
+    const auto ring_of = [](const Cell& cell) {
+      return std::max(std::abs(cell.first), std::abs(cell.second));
+    };
+    const auto anchor = std::min_element(
+      own.begin(), own.end(), [&](const Cell& lhs, const Cell& rhs) {
+        return ring_of(lhs) < ring_of(rhs);
+      });
+    std::iter_swap(own.begin(), anchor);
+    last_taken = 0;
+    const int64_t start = std::max(
+      taken.first_free() - int64_t(ring_of(own.front())), int64_t(0));
+
+    // rings of cells `ring` away from the origin, by their bottom and
+    // top rows and the columns between them, skipping offsets putting
+    // the first cell on one taken.
+    int64_t dx = 0, dy = 0;
+    const auto scan = [&](int64_t x, int64_t y, int64_t along_x,
+                          int64_t along_y, int64_t length) {
+      for (int64_t i = 0; i < length;) {
+        const int64_t at_x = x + along_x * i, at_y = y + along_y * i;
+        if (const auto run = taken.taken_run(at_x + own.front().first,
+                                             at_y + own.front().second,
+                                             along_x != 0)) {
+          i += run;
+          continue;
+        }
+        if (fits(own, at_x, at_y)) {
+          dx = at_x, dy = at_y;
+          return true;
+        }
+        ++i;
+      }
+      return false;
+    };
+
+    for (int64_t ring = start;; ++ring)
+      if (ring == 0 ? scan(0, 0, 1, 0, 1)
+          : scan(-ring, -ring, 1, 0, 2 * ring + 1)
+            || scan(-ring, ring, 1, 0, 2 * ring + 1)
+            || scan(-ring, -ring + 1, 0, 1, 2 * ring - 1)
+            || scan(ring, -ring + 1, 0, 1, 2 * ring - 1))
+        break;
+
+    for (const auto& [x, y] : own)
+      taken.take(x + dx, y + dy);
+    offsets[part] = Point{ double(dx - centers[part].first) * step,
+                           double(dy - centers[part].second) * step };
+  }
+  return offsets;
+}
+
+}  // namespace gviz::layout
+
+#endif  // GVIZARD_LAYOUT_PACKING_HPP_
@@ -0,0 +1,231 @@
+#ifndef GVIZARD_LAYOUT_PATCHWORK_HPP_
+#define GVIZARD_LAYOUT_PATCHWORK_HPP_
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <numeric>
+#include <vector>
+
+#include "gvizard/layout/clusters.hpp"
+#include "gvizard/layout/layout_graph.hpp"
+#include "gvizard/parallel/parallel_for.hpp"
+
+#include "gvizard/attrs/area.hpp"
+
+namespace gviz::layout {
+
+/** parameters of `patchwork`, defaults being those of the attributes
+ *  they're named after.
+ */
+struct PatchworkOptions final {
+  /** areas of nodes in square inches by index, `attrs::Area`'s default
+   *  for those past its end.
+   */
+  std::vector<double> areas{};
+
+  /** areas of clusters in square inches, only those without nodes
+   *  taking theirs. the others are as large as their nodes.
+   */
+  std::vector<double> cluster_areas{};
+
+  /** maximum count of threads, 0 means default_concurrency(). */
+  unsigned threads = 0;
+};
+
+namespace detail {
+
+/** the worst ratio of sides of boxes in a row along a side `side` long,
+ *  of areas from `largest` to `smallest` adding up to `sum`.
+ */
+inline double worst_ratio(double largest, double smallest, double sum,
+                          double side)
+{
+  if (sum <= 0. || side <= 0. || smallest <= 0.)
+    return std::numeric_limits<double>::infinity();
+
+  const double thickness2 = (sum / side) * (sum / side);
+  return std::max(thickness2 / smallest, largest / thickness2);
+}
+
+/** splits `box` into boxes of `areas` by the squarified treemap of
+ *  Bruls et al., so that they are as nearly square as rows let them.
+ *
+ * areas are to be in decreasing order and to add up to that of `box`.
+ * rows are laid along the shorter side of what is left of it, from its
+ * upper left corner, and grow while their worst ratio gets no worse.
+ */
+inline std::vector<Box> squarify(const std::vector<double>& areas, Box box)
+{
+  std::vector<Box> boxes(areas.size());
+
+  for (std::size_t first = 0; first < areas.size();) {
+    const bool across = box.width() >= box.height();
+    const double side = std::max(std::min(box.width(), box.height()), 0.);
+
+    double sum   = areas[first];
+    double worst = worst_ratio(areas[first], areas[first], sum, side);
+    std::size_t last = first + 1;
+    for (; last < areas.size(); ++last) {
+      const double next = worst_ratio(areas[first], areas[last],
+                                      sum + areas[last], side);
+      if (next > worst)
+        break;
+      sum  += areas[last];
+      worst = next;
+    }
+
+    // a column at the left of a wide box, a row at the top of a tall one.
+    const double thickness = side > 0. ? sum / side : 0.;
+    double at = 0.;
+    for (std::size_t i = first; i < last; ++i) {
+      const double length = thickness > 0. ? areas[i] / thickness : 0.;
+      boxes[i] = across
+        ? Box{ box.llx, box.ury - at - length, box.llx + thickness,
+               box.ury - at }
+        : Box{ box.llx + at, box.ury - thickness, box.llx + at + length,
+               box.ury };
+      at += length;
+    }
+
+    if (across)
+      box.llx = std::min(box.llx + thickness, box.urx);
+    else
+      box.ury = std::max(box.ury - thickness, box.lly);
+    first = last;
+  }
+  return boxes;
+}
+
+/** indices of `areas` from the largest to the smallest, ties by index. */
+inline std::vector<uint32_t> by_decreasing_area(
+  const std::vector<double>& areas)
+{
+  std::vector<uint32_t> order(areas.size());
+  std::iota(order.begin(), order.end(), uint32_t(0));
+  std::stable_sort(order.begin(), order.end(),
+                   [&](uint32_t lhs, uint32_t rhs) {
+                     return areas[lhs] > areas[rhs];
+                   });
+  return order;
+}
+
+}  // namespace detail
+
+/** lays out `graph` as a squarified treemap of its clusters, in the
+ *  manner of patchwork: the drawing is a square split into a box for
+ *  each cluster and node in no cluster, each cluster's box being split
+ *  into boxes of its nodes.
+ *
+ * boxes are as large as the areas of nodes, clusters being as large as
+ * their nodes together. nodes are sized to fill their boxes, and the
+ * clusters' boxes are split across threads. edges are left straight.
+ *
+ * node positions are centers in points, the lower left corner of the
+ * drawing at the origin.
+ */
+inline Layout patchwork(const LayoutGraph& graph, const Clusters& clusters,
+                        const PatchworkOptions& options = {})
+{
+  constexpr double square_points = points_per_inch * points_per_inch;
+
+  const std::size_t count          = graph.node_count();
+  const std::size_t clusters_count = clusters.count();
+
+  Layout layout{};
+  layout.positions.resize(count);
+  layout.sizes.resize(count);
+  layout.clusters.resize(clusters_count);
+
+  std::vector<double> areas(count);
+  for (std::size_t node = 0; node < count; ++node)
+    areas[node] = square_points * (node < options.areas.size()
+                                   ? options.areas[node]
+                                   : attrs::Area::get_default_value());
+
+  // items of the root are its clusters, then nodes in none.
+  const auto loose = clusters.loose();
+  std::vector<double> items(clusters_count + loose.size());
+  for (std::size_t cluster = 0; cluster < clusters_count; ++cluster) {
+    for (auto node : clusters.nodes(cluster))
+      items[cluster] += areas[node];
+    if (clusters.nodes(cluster).empty())
+      items[cluster] = square_points
+                     * (cluster < options.cluster_areas.size()
+                        ? options.cluster_areas[cluster]
+                        : attrs::Area::get_default_value());
+  }
+  for (std::size_t i = 0; i < loose.size(); ++i)
+    items[clusters_count + i] = areas[loose[i]];
+
+  const auto place = [&](uint32_t node, const Box& box) {
+    layout.positions[node] = Point{ (box.llx + box.urx) / 2.,
+                                    (box.lly + box.ury) / 2. };
+    layout.sizes[node] = LayoutNode{ box.width(), box.height() };
+  };
+
+  const auto order = detail::by_decreasing_area(items);
+  std::vector<double> sorted(items.size());
+  for (std::size_t i = 0; i < order.size(); ++i)
+    sorted[i] = items[order[i]];
+
+  const double side = std::sqrt(
+    std::accumulate(sorted.begin(), sorted.end(), 0.));
+  const auto boxes = detail::squarify(sorted, Box{ 0., 0., side, side });
+  for (std::size_t i = 0; i < order.size(); ++i) {
+    if (order[i] < clusters_count)
+      layout.clusters[order[i]] = boxes[i];
+    else
+      place(loose[order[i] - clusters_count], boxes[i]);
+  }
+
+  parallel::parallel_for_each_index(clusters_count,
+                                    [&](std::size_t cluster) {
+    const auto nodes = clusters.nodes(cluster);
+
+    std::vector<double> own(nodes.size());
+    for (std::size_t i = 0; i < nodes.size(); ++i)
+      own[i] = areas[nodes[i]];
+
+    const auto ranks = detail::by_decreasing_area(own);
+    for (std::size_t i = 0; i < ranks.size(); ++i)
+      own[i] = areas[nodes[ranks[i]]];
+
+    const auto parts = detail::squarify(own, layout.clusters[cluster]);
+    for (std::size_t i = 0; i < ranks.size(); ++i)
+      place(nodes[ranks[i]], parts[i]);
+  }, 1, options.threads);
+
+  return layout;
+}
+
+/** lays out `graph` by `patchwork`, setting `pos`, `width` and `height`
+ *  of its nodes and `bb` of its clusters.
+ *
+ * nodes and clusters are as large as their `area`.
+ */
+template <typename GraphT>
+void patchwork_layout(GraphT& graph, PatchworkOptions options = {})
+{
+  const auto input = make_layout_input(graph);
+
+  options.areas.resize(input.nodes.size());
+  for (std::size_t i = 0; i < input.nodes.size(); ++i)
+    options.areas[i] =
+      detail::get_or_default<attrs::Area>(graph, input.nodes[i]);
+
+  options.cluster_areas.resize(input.clusters.size());
+  for (std::size_t i = 0; i < input.clusters.size(); ++i)
+    options.cluster_areas[i] =
+      detail::get_or_default<attrs::Area>(graph, input.clusters[i]);
+
+  write_layout(graph, input,
+               patchwork(input.graph, make_clusters(graph, input),
+                         options));
+}
+
+}  // namespace gviz::layout
+
+#endif  // GVIZARD_LAYOUT_PATCHWORK_HPP_
@@ -0,0 +1,235 @@
+#ifndef GVIZARD_LAYOUT_RADIAL_HPP_
+#define GVIZARD_LAYOUT_RADIAL_HPP_
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <variant>
+#include <vector>
+
+#include "gvizard/layout/components.hpp"
+#include "gvizard/layout/layout_graph.hpp"
+#include "gvizard/layout/packing.hpp"
+#include "gvizard/parallel/parallel_for.hpp"
+#include "gvizard/utils.hpp"
+
+#include "gvizard/attrs/ranksep.hpp"
+#include "gvizard/attrs/root.hpp"
+
+namespace gviz::layout {
+
+/** parameters of `radial`, defaults being those of the attributes
+ *  they're named after.
+ */
+struct RadialOptions final {
+  /** space between rings in inches, 1 if unset. a list gives space
+   *  outside each ring, its last value repeating.
+   */
+  attrs::RankSepType ranksep = attrs::RankSep::get_default_value();
+
+  /** nodes to be centers, see `attrs::Root`. components without one are
+   *  centered at a node of theirs nearest to all others.
+   */
+  std::vector<uint32_t> roots{};
+
+  /** margin between components, see `pack_margin`. */
+  attrs::PackType pack = attrs::Pack::get_default_value();
+
+  /** packing of components, see `pack_components`. */
+  attrtypes::PackMode packmode = attrs::PackMode::get_default_value();
+
+  /** maximum count of threads, 0 means default_concurrency(). */
+  unsigned threads = 0;
+};
+
+namespace detail {
+
+/** space outside ring `ring` in inches. */
+inline double ring_separation(const attrs::RankSepType& ranksep,
+                              std::size_t ring)
+{
+  constexpr double fallback = 1., minimum = .02;
+
+  double inches = fallback;
+  if (ranksep) {
+    if (const auto *value = std::get_if<double>(&*ranksep))
+      inches = *value;
+    else if (const auto& list = std::get<std::vector<double>>(*ranksep);
+             !list.empty())
+      inches = list[std::min(ring, list.size() - 1)];
+  }
+  return std::max(inches, minimum);
+}
+
+/** breadth first search over edges taken either way, reusing arrays
+ *  indexed by node, so that searches of different components can run
+ *  at once.
+ */
+struct TreeSearch final {
+  const LayoutGraph&     graph;
+  std::vector<uint32_t>& depths;
+  std::vector<uint32_t>& parents;
+
+  /** nodes reached from `root` in order, depths and parents set. */
+  void run(uint32_t root, const IndexRange& component,
+           std::vector<uint32_t>& order) const
+  {
+    for (auto node : component)
+      depths[node] = no_node;
+
+    order.assign(1, root);
+    depths[root]  = 0;
+    parents[root] = no_node;
+    for (std::size_t i = 0; i < order.size(); ++i) {
+      const auto node = order[i];
+      const auto reach = [&](uint32_t other) {
+        if (depths[other] == no_node) {
+          depths[other]  = depths[node] + 1;
+          parents[other] = node;
+          order.push_back(other);
+        }
+      };
+      for (auto edge : graph.out_edges(node))
+        reach(graph.edge(edge).target);
+      for (auto edge : graph.in_edges(node))
+        reach(graph.edge(edge).source);
+    }
+  }
+};
+
+/** middle of a longest path found by two searches, a node nearly as
+ *  near to all others as can be.
+ */
+inline uint32_t find_center(const TreeSearch& search,
+                            const IndexRange& component,
+                            std::vector<uint32_t>& order)
+{
+  search.run(component[0], component, order);
+  search.run(order.back(), component, order);
+
+  auto node = order.back();
+  for (auto steps = search.depths[node] / 2; steps > 0; --steps)
+    node = search.parents[node];
+  return node;
+}
+
+}  // namespace detail
+
+/** lays out `graph` radially, in the manner of twopi: a breadth first
+ *  tree from the root of each component, its nodes on rings around the
+ *  root by their depth.
+ *
+ * each node gets a sector of the ring in proportion to the leaves below
+ * it, children dividing their parent's sector, so branches don't cross.
+ * it runs in linear time, components apart across threads, and packs
+ * components by `pack_components`.
+ *
+ * node positions are centers in points, the lower left corner of the
+ * drawing at the origin. edges are left straight.
+ */
+inline Layout radial(const LayoutGraph& graph,
+                     const RadialOptions& options = {})
+{
+  constexpr double pi = 3.14159265358979323846;
+
+  const std::size_t count = graph.node_count();
+  const Components  components(graph);
+
+  std::vector<uint32_t> roots(components.count(), detail::no_node);
+  for (auto root : options.roots)
+    if (root < count && roots[components.component_of(root)]
+                          == detail::no_node)
+      roots[components.component_of(root)] = root;
+
+  Coords<2> coords{};
+  coords[0].resize(count);
+  coords[1].resize(count);
+
+  std::vector<uint32_t> depths(count), parents(count);
+  std::vector<double>   leaves(count), starts(count);
+  const detail::TreeSearch search{ graph, depths, parents };
+
+  parallel::parallel_for_each_index(components.count(),
+                                    [&](std::size_t component) {
+    const auto nodes = components.nodes(component);
+    std::vector<uint32_t> order{};
+
+    auto root = roots[component];
+    if (root == detail::no_node)
+      root = detail::find_center(search, nodes, order);
+    search.run(root, nodes, order);
+
+    // leaves below each node, children coming after their parent.
+    for (auto node : order)
+      leaves[node] = 0.;
+    for (std::size_t i = order.size(); i-- > 1;) {
+      const auto node = order[i];
+      leaves[node] = std::max(leaves[node], 1.);
+      leaves[parents[node]] += leaves[node];
+    }
+
+    // sectors are [start, start + share of the parent's), children of a
+    // node being consecutive in order.
+    std::vector<double> radii{ 0. };
+    starts[root] = 0.;
+    for (std::size_t i = 0; i < order.size(); ++i) {
+      const auto node  = order[i];
+      const auto depth = depths[node];
+      while (radii.size() <= depth)
+        radii.push_back(radii.back() + detail::ring_separation(
+                                         options.ranksep, radii.size() - 1));
+
+      double sector = 2. * pi;
+      if (node != root) {
+        const auto parent = parents[node];
+        sector = 2. * pi * leaves[node] / std::max(leaves[root], 1.);
+        starts[node] = starts[parent];
+        starts[parent] += sector;
+      }
+
+      const double angle = starts[node] + sector / 2.;
+      coords[0][node] = radii[depth] * std::cos(angle);
+      coords[1][node] = radii[depth] * std::sin(angle);
+    }
+  }, 1, options.threads);
+
+  return pack_components(
+    graph, components, make_layout<2>(graph, coords),
+    PackOptions{ options.pack, options.packmode, {}, options.threads });
+}
+
+/** lays out `graph` by `radial`, setting `pos` of its nodes.
+ *
+ * nodes whose `root` is set to anything but false, 0 or nothing are
+ * roots, in addition to those of `options`, which also holds the graph
+ * attributes, see `make_layout_input`.
+ */
+template <typename GraphT>
+void radial_layout(GraphT& graph, RadialOptions options = {})
+{
+  const auto input = make_layout_input(graph);
+
+  for (std::size_t i = 0; i < input.nodes.size(); ++i) {
+    const auto root =
+      graph.template get_entity_attr<attrs::Root>(input.nodes[i]);
+    if (!root || !root->get_value())
+      continue;
+
+    const bool is_root = utils::LambdaVisit(
+      *root->get_value(),
+      [](double value) { return value != 0.; },
+      [](const std::string& value) {
+        return !value.empty() && value != "false" && value != "0";
+      });
+    if (is_root)
+      options.roots.push_back(uint32_t(i));
+  }
+
+  write_layout(graph, input, radial(input.graph, options));
+}
+
+}  // namespace gviz::layout
+
+#endif  // GVIZARD_LAYOUT_RADIAL_HPP_
@@ -0,0 +1,1091 @@
+#ifndef GVIZARD_LAYOUT_ROUTING_HPP_
+#define GVIZARD_LAYOUT_ROUTING_HPP_
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <initializer_list>
+#include <limits>
+#include <numeric>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <variant>
+#include <vector>
+
+#include "gvizard/layout/layered.hpp"
+#include "gvizard/layout/layout_graph.hpp"
+#include "gvizard/layout/overlap.hpp"
+#include "gvizard/parallel/parallel_for.hpp"
+
+#include "gvizard/attrtypes/shape.hpp"
+
+#include "gvizard/attrs/esep.hpp"
+#include "gvizard/attrs/shape.hpp"
+#include "gvizard/attrs/splines.hpp"
+
+namespace gviz::layout {
+
+/** how edges are drawn, see `attrs::Splines`. */
+enum class EdgeRouting : uint8_t {
+  none = 0,  ///< edges aren't drawn.
+  line,      ///< straight, across nodes in the way.
+  polyline,  ///< straight segments around nodes.
+  spline,    ///< curves around nodes.
+  ortho,     ///< horizontal and vertical segments around nodes.
+};
+
+/** parses a value of `attrs::Splines`. unset, true and anything unknown,
+ *  such as curved and compound, are splines.
+ */
+inline EdgeRouting to_edge_routing(const attrs::SplinesType& value)
+{
+  if (!value)
+    return EdgeRouting::spline;
+  if (const auto *curved = std::get_if<bool>(&*value))
+    return *curved ? EdgeRouting::spline : EdgeRouting::line;
+
+  const std::string_view name = std::get<std::string>(*value);
+  if (name.empty() || name == "none")
+    return EdgeRouting::none;
+  if (name == "line" || name == "false" || name == "no" || name == "0")
+    return EdgeRouting::line;
+  if (name == "polyline")
+    return EdgeRouting::polyline;
+  if (name == "ortho")
+    return EdgeRouting::ortho;
+  return EdgeRouting::spline;
+}
+
+/** parameters of `route_edges`, defaults being those of the attributes
+ *  they're named after.
+ */
+struct RouteOptions final {
+  /** how edges are drawn, see `to_edge_routing`. */
+  attrs::SplinesType splines = attrs::Splines::get_default_value();
+
+  /** margin kept around nodes in points, see `attrs::Esep`. */
+  attrs::EsepType esep = attrs::Esep::get_default_value();
+
+  /** shapes of nodes by index, ellipses for those left out. */
+  std::vector<attrtypes::ShapeType> shapes{};
+
+  /** edges end before their head, which is given as arrow end point. */
+  bool directed = true;
+
+  /** maximum count of threads, 0 means default_concurrency(). */
+  unsigned threads = 0;
+};
+
+namespace detail {
+
+// segments must enter obstacles this deep to be blocked by them, so
+// that routes may run along their sides and through their corners.
+constexpr double route_epsilon = 1e-6;
+
+// obstacles gathered around an edge at most, edges crowded by more
+// taking a simple route.
+constexpr std::size_t most_route_gathered = 4096;
+
+// routes are searched among at most this many obstacles near an edge
+// and orthogonal ones over at most this many crossings of tracks, edges
+// crowded by more taking a simple route.
+constexpr std::size_t most_route_obstacles = 256;
+constexpr std::size_t most_route_crossings = std::size_t(1) << 18;
+
+// times the area searched around an edge is doubled when no route is
+// found in it.
+constexpr int route_widenings = 3;
+
+// length in points a bend of an orthogonal route costs as much as.
+constexpr double ortho_bend_cost = 18.;
+
+// reach of loops beyond their node in points.
+constexpr double loop_reach = 18.;
+
+inline bool is_elliptic(attrtypes::ShapeType shape) noexcept
+{
+  using attrtypes::ShapeType;
+  switch (shape) {
+    case ShapeType::ellipse:
+    case ShapeType::oval:
+    case ShapeType::circle:
+    case ShapeType::doublecircle:
+    case ShapeType::Mcircle:
+    case ShapeType::point:
+    case ShapeType::egg:
+      return true;
+    default:
+      return false;
+  }
+}
+
+/** adds corners of a convex polygon around a node of `shape` half `hx`
+ *  wide and `hy` high at `center`, counterclockwise: an octagon around
+ *  ellipses, diamonds for diamonds and the bounding box of the rest.
+ */
+inline void add_shape_corners(attrtypes::ShapeType shape, Vec2 center,
+                              double hx, double hy, std::vector<Vec2>& out)
+{
+  using attrtypes::ShapeType;
+  constexpr double pi = 3.14159265358979323846;
+
+  if (is_elliptic(shape)) {
+    const double reach = 1. / std::cos(pi / 8.);
+    for (int i = 0; i < 8; ++i) {
+      const double angle = pi / 8. + pi / 4. * double(i);
+      out.push_back(center + Vec2{ hx * reach * std::cos(angle),
+                                   hy * reach * std::sin(angle) });
+    }
+    return;
+  }
+
+  if (shape == ShapeType::diamond || shape == ShapeType::Mdiamond) {
+    out.push_back(center + Vec2{ hx, 0. });
+    out.push_back(center + Vec2{ 0., hy });
+    out.push_back(center + Vec2{ -hx, 0. });
+    out.push_back(center + Vec2{ 0., -hy });
+    return;
+  }
+
+  out.push_back(center + Vec2{ hx, -hy });
+  out.push_back(center + Vec2{ hx, hy });
+  out.push_back(center + Vec2{ -hx, hy });
+  out.push_back(center + Vec2{ -hx, -hy });
+}
+
+/** part of segment `a`, `b` inside a convex counterclockwise polygon, by
+ *  Cyrus and Beck's clipping, as the range of its parameter. `inset`
+ *  shrinks the polygon by as much.
+ */
+inline std::pair<double, double> clip_segment(const Vec2 *begin,
+                                              const Vec2 *end, Vec2 a,
+                                              Vec2 b, double inset)
+{
+  const Vec2 direction = b - a;
+  double enter = 0., exit = 1.;
+
+  for (const Vec2 *corner = begin; corner != end; ++corner) {
+    const Vec2 next  = corner + 1 == end ? *begin : corner[1];
+    const Vec2 side  = next - *corner;
+    const Vec2 normal{ side.y, -side.x };  // outwards.
+
+    const double along  = normal.x * direction.x + normal.y * direction.y;
+    const double margin = normal.x * (corner->x - a.x)
+                        + normal.y * (corner->y - a.y)
+                        - inset * side.length();
+    if (along == 0.) {
+      if (margin < 0.)
+        return { 1., 0. };
+      continue;
+    }
+
+    const double at = margin / along;
+    if (along > 0.)
+      exit = std::min(exit, at);
+    else
+      enter = std::max(enter, at);
+    if (enter >= exit)
+      return { 1., 0. };
+  }
+  return { enter, exit };
+}
+
+/** node sizes grown by `esep` as convex polygons, and a uniform grid of
+ *  their bounding boxes to find those near a place. it is only read
+ *  once made, so edges are routed against it across threads.
+ */
+class Obstacles final {
+  std::vector<Box>      boxes_{};
+  std::vector<uint32_t> offsets_{ 0 };
+  std::vector<Vec2>     corners_{};
+
+  double left_   = 0.;
+  double bottom_ = 0.;
+  double cell_   = 1.;
+  std::size_t columns_ = 1;
+  std::size_t rows_    = 1;
+
+  std::vector<uint32_t> cell_offsets_{};
+  std::vector<uint32_t> cell_items_{};
+
+  std::size_t column(double x) const noexcept
+  {
+    const double at = std::floor((x - left_) / cell_);
+    return at <= 0. ? 0 : std::min(std::size_t(at), columns_ - 1);
+  }
+
+  std::size_t row(double y) const noexcept
+  {
+    const double at = std::floor((y - bottom_) / cell_);
+    return at <= 0. ? 0 : std::min(std::size_t(at), rows_ - 1);
+  }
+
+  template <typename F>
+  void each_cell(const Box& box, F&& func) const
+  {
+    const auto first_column = column(box.llx), last_column = column(box.urx);
+    for (auto r = row(box.lly), last_row = row(box.ury); r <= last_row; ++r)
+      for (auto c = first_column; c <= last_column; ++c)
+        func(r * columns_ + c);
+  }
+
+ public:
+  Obstacles(const LayoutGraph& graph, const Layout& layout,
+            const RouteOptions& options)
+  {
+    constexpr double cells_per_obstacle = 4.;
+
+    const std::size_t count = layout.positions.size();
+    boxes_.reserve(count);
+    for (std::size_t i = 0; i < count; ++i) {
+      const auto& node = i < layout.sizes.size() ? layout.sizes[i]
+                                                 : graph.node(i);
+      const auto [hx, hy] =
+        separated_halves(options.esep, node.width, node.height);
+      const auto shape = i < options.shapes.size()
+                       ? options.shapes[i] : attrtypes::ShapeType::ellipse;
+
+      const Vec2 center{ layout.positions[i].x, layout.positions[i].y };
+      add_shape_corners(shape, center, std::max(hx, 0.), std::max(hy, 0.),
+                        corners_);
+      offsets_.push_back(uint32_t(corners_.size()));
+
+      Box box{ center.x, center.y, center.x, center.y };
+      for (auto c = offsets_[i]; c < offsets_[i + 1]; ++c) {
+        box.llx = std::min(box.llx, corners_[c].x);
+        box.lly = std::min(box.lly, corners_[c].y);
+        box.urx = std::max(box.urx, corners_[c].x);
+        box.ury = std::max(box.ury, corners_[c].y);
+      }
+      boxes_.push_back(box);
+    }
+
+    if (count == 0) {
+      cell_offsets_.assign(2, 0);
+      return;
+    }
+
+    Box all = boxes_[0];
+    double sizes = 0.;
+    for (const auto& box : boxes_) {
+      all.llx = std::min(all.llx, box.llx);
+      all.lly = std::min(all.lly, box.lly);
+      all.urx = std::max(all.urx, box.urx);
+      all.ury = std::max(all.ury, box.ury);
+      sizes += std::max(box.width(), box.height());
+    }
+
+    const double most = cells_per_obstacle * double(count);
+    left_   = all.llx;
+    bottom_ = all.lly;
+    cell_   = std::max({ sizes / double(count),
+                         std::sqrt(all.width() * all.height() / most),
+                         all.width() / most, all.height() / most });
+    if (!(cell_ > 0.))
+      cell_ = 1.;
+    columns_ = std::size_t(all.width() / cell_) + 1;
+    rows_    = std::size_t(all.height() / cell_) + 1;
+
+    // obstacles by the cells they meet, counted then placed.
+    cell_offsets_.assign(columns_ * rows_ + 1, 0);
+    for (const auto& box : boxes_)
+      each_cell(box, [&](std::size_t cell) { ++cell_offsets_[cell + 1]; });
+    std::partial_sum(cell_offsets_.begin(), cell_offsets_.end(),
+                     cell_offsets_.begin());
+
+    auto next = cell_offsets_;
+    cell_items_.resize(cell_offsets_.back());
+    for (std::size_t i = 0; i < count; ++i)
+      each_cell(boxes_[i], [&](std::size_t cell) {
+        cell_items_[next[cell]++] = uint32_t(i);
+      });
+  }
+
+  std::size_t size() const noexcept { return boxes_.size(); }
+
+  const Box& box(uint32_t obstacle) const noexcept
+  {
+    return boxes_[obstacle];
+  }
+
+  const Vec2 *corners_begin(uint32_t obstacle) const noexcept
+  {
+    return corners_.data() + offsets_[obstacle];
+  }
+
+  const Vec2 *corners_end(uint32_t obstacle) const noexcept
+  {
+    return corners_.data() + offsets_[obstacle + 1];
+  }
+
+  /** sets `found` to obstacles whose boxes meet `area`, in order. */
+  void query(const Box& area, std::vector<uint32_t>& found) const
+  {
+    found.clear();
+    if (boxes_.empty())
+      return;
+
+    each_cell(area, [&](std::size_t cell) {
+      for (auto i = cell_offsets_[cell]; i < cell_offsets_[cell + 1]; ++i) {
+        const auto& box = boxes_[cell_items_[i]];
+        if (box.llx <= area.urx && area.llx <= box.urx
+            && box.lly <= area.ury && area.lly <= box.ury)
+          found.push_back(cell_items_[i]);
+      }
+    });
+    std::sort(found.begin(), found.end());
+    found.erase(std::unique(found.begin(), found.end()), found.end());
+  }
+
+  /** calls `func(obstacle)` for obstacles in the cells segment `a`, `b`
+   *  passes through, some more than once, until it returns true.
+   *
+   * @returns whether `func` returned true.
+   */
+  template <typename F>
+  bool any_along(Vec2 a, Vec2 b, F&& func) const
+  {
+    if (boxes_.empty())
+      return false;
+
+    // the part of the segment over the grid, by Liang and Barsky's
+    // clipping, then its cells in order, by Amanatides and Woo's walk.
+    const Vec2 delta = b - a;
+    const double lows[2]  = { left_, bottom_ };
+    const double highs[2] = { left_ + cell_ * double(columns_),
+                              bottom_ + cell_ * double(rows_) };
+    const double starts[2] = { a.x, a.y };
+    const double steps[2]  = { delta.x, delta.y };
+
+    double enter = 0., exit = 1.;
+    for (int axis = 0; axis < 2; ++axis) {
+      if (steps[axis] == 0.) {
+        if (starts[axis] < lows[axis] || starts[axis] > highs[axis])
+          return false;
+        continue;
+      }
+      double near = (lows[axis] - starts[axis]) / steps[axis];
+      double far  = (highs[axis] - starts[axis]) / steps[axis];
+      if (near > far)
+        std::swap(near, far);
+      enter = std::max(enter, near);
+      exit  = std::min(exit, far);
+    }
+    if (enter > exit)
+      return false;
+
+    const Vec2 first = a + delta * enter;
+    const Vec2 last  = a + delta * exit;
+    std::size_t c = column(first.x), r = row(first.y);
+    const std::size_t last_column = column(last.x), last_row = row(last.y);
+
+    const auto next_at = [&](double start, double step, std::size_t at,
+                             double low) {
+      if (step > 0.)
+        return (low + cell_ * double(at + 1) - start) / step;
+      if (step < 0.)
+        return (low + cell_ * double(at) - start) / step;
+      return std::numeric_limits<double>::infinity();
+    };
+    const Vec2 span = last - first;
+    double next_x = next_at(first.x, span.x, c, left_);
+    double next_y = next_at(first.y, span.y, r, bottom_);
+    const double step_x = span.x != 0. ? cell_ / std::abs(span.x)
+                        : std::numeric_limits<double>::infinity();
+    const double step_y = span.y != 0. ? cell_ / std::abs(span.y)
+                        : std::numeric_limits<double>::infinity();
+
+    for (std::size_t visits = columns_ + rows_ + 1; visits > 0; --visits) {
+      const std::size_t cell = r * columns_ + c;
+      for (auto i = cell_offsets_[cell]; i < cell_offsets_[cell + 1]; ++i)
+        if (func(cell_items_[i]))
+          return true;
+
+      if (c == last_column && r == last_row)
+        break;
+      if (next_x < next_y) {
+        if (span.x > 0. ? c + 1 >= columns_ : c == 0)
+          break;
+        c = span.x > 0. ? c + 1 : c - 1;
+        next_x += step_x;
+      }
+      else {
+        if (span.y > 0. ? r + 1 >= rows_ : r == 0)
+          break;
+        r = span.y > 0. ? r + 1 : r - 1;
+        next_y += step_y;
+      }
+    }
+    return false;
+  }
+
+  /** whether segment `a`, `b` goes into the polygon of `obstacle`,
+   *  rather than along its sides or past its corners.
+   */
+  bool crosses(uint32_t obstacle, Vec2 a, Vec2 b) const noexcept
+  {
+    const auto& box = boxes_[obstacle];
+    if (std::max(a.x, b.x) <= box.llx || std::min(a.x, b.x) >= box.urx
+        || std::max(a.y, b.y) <= box.lly || std::min(a.y, b.y) >= box.ury)
+      return false;
+
+    const auto [enter, exit] = clip_segment(
+      corners_begin(obstacle), corners_end(obstacle), a, b, route_epsilon);
+    return enter < exit;
+  }
+
+  /** whether axis aligned segment `a`, `b` goes into the bounding box
+   *  of `obstacle`.
+   */
+  bool crosses_box(uint32_t obstacle, Vec2 a, Vec2 b) const noexcept
+  {
+    const auto& box = boxes_[obstacle];
+    return std::max(a.x, b.x) > box.llx + route_epsilon
+        && std::min(a.x, b.x) < box.urx - route_epsilon
+        && std::max(a.y, b.y) > box.lly + route_epsilon
+        && std::min(a.y, b.y) < box.ury - route_epsilon;
+  }
+};
+
+/** arrays a search for routes reuses from one edge to the next. */
+struct RouteSearch final {
+  using Entry = std::pair<double, uint32_t>;
+
+  std::vector<uint32_t> local{};
+  std::vector<Vec2>     vertices{};
+  std::vector<Vec2>     befores{};
+  std::vector<Vec2>     afters{};
+  std::vector<double>   costs{};
+  std::vector<uint32_t> parents{};
+  std::vector<char>     closed{};
+  std::vector<Entry>    heap{};
+  std::vector<std::pair<uint32_t, uint32_t>> links{};
+
+  std::vector<double> xs{};
+  std::vector<double> ys{};
+  std::vector<char>   blocked{};
+
+  void push(double priority, uint32_t item)
+  {
+    heap.emplace_back(priority, item);
+    std::push_heap(heap.begin(), heap.end(), std::greater<Entry>{});
+  }
+
+  Entry pop()
+  {
+    std::pop_heap(heap.begin(), heap.end(), std::greater<Entry>{});
+    const auto entry = heap.back();
+    heap.pop_back();
+    return entry;
+  }
+};
+
+/** the box around `a` and `b`, `pad` larger each way. */
+inline Box padded_box(Vec2 a, Vec2 b, double pad) noexcept
+{
+  return Box{ std::min(a.x, b.x) - pad, std::min(a.y, b.y) - pad,
+              std::max(a.x, b.x) + pad, std::max(a.y, b.y) + pad };
+}
+
+/** whether segment `a`, `b` goes into any obstacle but those of the
+ *  ends of an edge, by `crosses` or `crosses_box` if `boxes`, among
+ *  those of the cells it passes through.
+ */
+inline bool blocked_anywhere(const Obstacles& obstacles, uint32_t source,
+                             uint32_t target, Vec2 a, Vec2 b, bool boxes)
+{
+  return obstacles.any_along(a, b, [&](uint32_t obstacle) {
+    return obstacle != source && obstacle != target
+        && (boxes ? obstacles.crosses_box(obstacle, a, b)
+                  : obstacles.crosses(obstacle, a, b));
+  });
+}
+
+/** obstacles within `area` but those of the ends of an edge, false if
+ *  there are too many to gather.
+ */
+inline bool gather_local(const Obstacles& obstacles, uint32_t source,
+                         uint32_t target, const Box& area,
+                         RouteSearch& search)
+{
+  obstacles.query(area, search.local);
+  search.local.erase(
+    std::remove_if(search.local.begin(), search.local.end(),
+                   [&](uint32_t obstacle) {
+                     return obstacle == source || obstacle == target;
+                   }),
+    search.local.end());
+  return search.local.size() <= most_route_gathered;
+}
+
+/** whether all segments of `route` keep out of obstacles, those beyond
+ *  the area searched included.
+ */
+inline bool route_is_clear(const Obstacles& obstacles, uint32_t source,
+                           uint32_t target, const std::vector<Vec2>& route,
+                           bool boxes)
+{
+  for (std::size_t i = 0; i + 1 < route.size(); ++i)
+    if (blocked_anywhere(obstacles, source, target, route[i], route[i + 1],
+                         boxes))
+      return false;
+  return true;
+}
+
+/** first route from `from` to `to` keeping out of obstacles among a few
+ *  of horizontal and vertical segments: bending once at a corner, or
+ *  twice midway or along a side of the box of an end. otherwise the one
+ *  bending at a corner if `boxes`, or none.
+ */
+inline std::vector<Vec2> simple_route(const Obstacles& obstacles,
+                                      uint32_t source, uint32_t target,
+                                      Vec2 from, Vec2 to, bool boxes)
+{
+  const auto& source_box = obstacles.box(source);
+  const auto& target_box = obstacles.box(target);
+
+  std::vector<Vec2> route{};
+  const auto tried = [&](std::initializer_list<Vec2> bends) {
+    route.assign({ from });
+    for (const Vec2 bend : bends)
+      if (bend.x != route.back().x || bend.y != route.back().y)
+        route.push_back(bend);
+    if (to.x != route.back().x || to.y != route.back().y)
+      route.push_back(to);
+    return route_is_clear(obstacles, source, target, route, boxes);
+  };
+
+  if (tried({ Vec2{ to.x, from.y } }) || tried({ Vec2{ from.x, to.y } }))
+    return route;
+  for (double x : { (from.x + to.x) / 2., source_box.llx, source_box.urx,
+                    target_box.llx, target_box.urx })
+    if (tried({ Vec2{ x, from.y }, Vec2{ x, to.y } }))
+      return route;
+  for (double y : { (from.y + to.y) / 2., source_box.lly, source_box.ury,
+                    target_box.lly, target_box.ury })
+    if (tried({ Vec2{ from.x, y }, Vec2{ to.x, y } }))
+      return route;
+
+  if (!boxes)
+    return {};
+  tried({ Vec2{ to.x, from.y } });
+  return route;
+}
+
+/** shortest route from `from` to `to` among obstacles near them, by A*
+ *  over the visibility graph of their corners, its edges being found as
+ *  they are needed. empty if there's none.
+ *
+ * shortest routes only bend around corners they touch, so only sight
+ * lines tangent to the obstacles of both their ends are tried, and
+ * corners inside other obstacles not at all. sight lines are tested
+ * against obstacles in the cells of the grid they pass through.
+ */
+inline std::vector<Vec2> visible_route(const Obstacles& obstacles,
+                                       uint32_t source, uint32_t target,
+                                       Vec2 from, Vec2 to,
+                                       RouteSearch& search)
+{
+  constexpr auto none = std::numeric_limits<uint32_t>::max();
+
+  const auto visible = [&](Vec2 a, Vec2 b) {
+    return !blocked_anywhere(obstacles, source, target, a, b, false);
+  };
+  if (visible(from, to))
+    return { from, to };
+
+  const auto& source_box = obstacles.box(source);
+  const auto& target_box = obstacles.box(target);
+  double pad = std::max({ source_box.width(), source_box.height(),
+                          target_box.width(), target_box.height() });
+
+  // a wider area meeting no more obstacles has no other routes.
+  std::size_t searched = none;
+  for (int widening = 0; widening <= route_widenings;
+       ++widening, pad *= 2.) {
+    if (!gather_local(obstacles, source, target, padded_box(from, to, pad),
+                      search))
+      return {};
+
+    // only those within `pad` of the straight line, the box around it
+    // holding many more of long slanted edges.
+    const Vec2 line = to - from;
+    const double length2 = line.x * line.x + line.y * line.y;
+    search.local.erase(
+      std::remove_if(search.local.begin(), search.local.end(),
+                     [&](uint32_t obstacle) {
+                       const auto& box = obstacles.box(obstacle);
+                       const Vec2 center{ (box.llx + box.urx) / 2.,
+                                          (box.lly + box.ury) / 2. };
+                       const Vec2 off = center - from;
+                       const double along = std::clamp(
+                         (off.x * line.x + off.y * line.y) / length2, 0.,
+                         1.);
+                       const double reach =
+                         pad + Vec2{ box.width(), box.height() }.length()
+                               / 2.;
+                       return (center - (from + line * along)).length()
+                              > reach;
+                     }),
+      search.local.end());
+    if (search.local.size() > most_route_obstacles)
+      return {};
+    if (search.local.size() == searched)
+      continue;
+    searched = search.local.size();
+
+    // corners, with their neighbours on their obstacle.
+    auto& vertices = search.vertices;
+    vertices.assign({ from, to });
+    search.befores.assign({ from, to });
+    search.afters.assign({ from, to });
+    for (auto obstacle : search.local) {
+      const Vec2 *begin = obstacles.corners_begin(obstacle);
+      const Vec2 *end   = obstacles.corners_end(obstacle);
+      for (const Vec2 *corner = begin; corner != end; ++corner) {
+        const bool inside = obstacles.any_along(
+          *corner, *corner, [&](uint32_t other) {
+            return other != obstacle
+                && obstacles.crosses(other, *corner, *corner);
+          });
+        if (inside)
+          continue;
+        vertices.push_back(*corner);
+        search.befores.push_back(corner == begin ? end[-1] : corner[-1]);
+        search.afters.push_back(corner + 1 == end ? *begin : corner[1]);
+      }
+    }
+
+    const auto tangent = [&](Vec2 at, uint32_t corner) {
+      const Vec2 sight = vertices[corner] - at;
+      const auto side = [&](Vec2 neighbour) {
+        const Vec2 out = neighbour - vertices[corner];
+        return sight.x * out.y - sight.y * out.x;
+      };
+      return side(search.befores[corner]) * side(search.afters[corner])
+             >= 0.;
+    };
+
+    // sight lines are only tested once the search reaches them: each
+    // item of the heap is a vertex and the one it's seen from, and
+    // dropped when popped if that one doesn't see it.
+    const std::size_t count = vertices.size();
+    search.costs.assign(count, 0.);
+    search.parents.assign(count, none);
+    search.closed.assign(count, 0);
+    search.heap.clear();
+    search.links.clear();
+
+    const auto reach = [&](uint32_t vertex, uint32_t parent,
+                           double priority) {
+      search.links.emplace_back(vertex, parent);
+      search.push(priority, uint32_t(search.links.size() - 1));
+    };
+
+    reach(0, none, (to - from).length());
+    while (!search.heap.empty()) {
+      const auto [vertex, parent] = search.links[search.pop().second];
+      if (search.closed[vertex]
+          || (parent != none
+              && !visible(vertices[parent], vertices[vertex])))
+        continue;
+      search.closed[vertex]  = 1;
+      search.parents[vertex] = parent;
+      if (parent != none)
+        search.costs[vertex] = search.costs[parent]
+                             + (vertices[vertex] - vertices[parent]).length();
+      if (vertex == 1)
+        break;
+
+      // a taut route bends around the corner it reached towards the
+      // obstacle the corner is of, keeping it on the same side.
+      const Vec2 at = vertices[vertex];
+      const Vec2 arrival = parent != none ? at - vertices[parent]
+                                          : Vec2{ 0., 0. };
+      const auto cross = [](Vec2 lhs, Vec2 rhs) {
+        return lhs.x * rhs.y - lhs.y * rhs.x;
+      };
+      double side = cross(arrival, search.befores[vertex] - at);
+      if (side == 0.)
+        side = cross(arrival, search.afters[vertex] - at);
+
+      for (uint32_t other = 1; other < count; ++other) {
+        if (search.closed[other]
+            || cross(arrival, vertices[other] - at) * side < 0.
+            || !tangent(at, other) || !tangent(vertices[other], vertex))
+          continue;
+        reach(other, vertex, search.costs[vertex]
+                             + (vertices[other] - at).length()
+                             + (to - vertices[other]).length());
+      }
+    }
+
+    if (!search.closed[1])
+      continue;
+
+    std::vector<Vec2> route{};
+    for (auto vertex = uint32_t(1); vertex != none;
+         vertex = search.parents[vertex])
+      route.push_back(vertices[vertex]);
+    std::reverse(route.begin(), route.end());
+    return route;
+  }
+  return {};
+}
+
+/** route from `from` to `to` of horizontal and vertical segments among
+ *  bounding boxes of obstacles near them, with as little length and as
+ *  few bends as can be, by A* over tracks running between boxes. empty
+ *  if there's none.
+ */
+inline std::vector<Vec2> ortho_route(const Obstacles& obstacles,
+                                     uint32_t source, uint32_t target,
+                                     Vec2 from, Vec2 to,
+                                     RouteSearch& search)
+{
+  constexpr auto none = std::numeric_limits<uint32_t>::max();
+  constexpr int  steps[4][2] = { { 1, 0 }, { -1, 0 }, { 0, 1 }, { 0, -1 } };
+
+  const auto& source_box = obstacles.box(source);
+  const auto& target_box = obstacles.box(target);
+  double pad = std::max({ source_box.width(), source_box.height(),
+                          target_box.width(), target_box.height() });
+
+  for (int widening = 0; widening <= route_widenings;
+       ++widening, pad *= 2.) {
+    const auto area = padded_box(from, to, pad);
+    if (!gather_local(obstacles, source, target, area, search))
+      return {};
+
+    // tracks through the ends, along the area's sides and midway
+    // between sides of boxes.
+    const auto tracks = [&](std::vector<double>& out, double start,
+                            double end, double low, double high,
+                            double Box::*first, double Box::*second) {
+      out.clear();
+      for (auto obstacle : search.local) {
+        out.push_back(obstacles.box(obstacle).*first);
+        out.push_back(obstacles.box(obstacle).*second);
+      }
+      std::sort(out.begin(), out.end());
+      out.erase(std::unique(out.begin(), out.end()), out.end());
+
+      const std::size_t sides = out.size();
+      for (std::size_t i = 0; i + 1 < sides; ++i)
+        out.push_back((out[i] + out[i + 1]) / 2.);
+      out.erase(out.begin(), out.begin() + std::ptrdiff_t(sides));
+      out.insert(out.end(), { start, end, low, high });
+      std::sort(out.begin(), out.end());
+      out.erase(std::unique(out.begin(), out.end()), out.end());
+    };
+    tracks(search.xs, from.x, to.x, area.llx, area.urx, &Box::llx,
+           &Box::urx);
+    tracks(search.ys, from.y, to.y, area.lly, area.ury, &Box::lly,
+           &Box::ury);
+
+    const auto& xs = search.xs;
+    const auto& ys = search.ys;
+    const std::size_t columns = xs.size(), rows = ys.size();
+    if (columns * rows > most_route_crossings)
+      return {};
+
+    // crossings of tracks inside boxes are blocked.
+    auto& blocked = search.blocked;
+    blocked.assign(columns * rows, 0);
+    for (auto obstacle : search.local) {
+      const auto& box = obstacles.box(obstacle);
+      const auto first_column = std::upper_bound(
+        xs.begin(), xs.end(), box.llx + route_epsilon) - xs.begin();
+      const auto end_column = std::lower_bound(
+        xs.begin(), xs.end(), box.urx - route_epsilon) - xs.begin();
+      const auto first_row = std::upper_bound(
+        ys.begin(), ys.end(), box.lly + route_epsilon) - ys.begin();
+      const auto end_row = std::lower_bound(
+        ys.begin(), ys.end(), box.ury - route_epsilon) - ys.begin();
+      for (auto r = first_row; r < end_row; ++r)
+        for (auto c = first_column; c < end_column; ++c)
+          blocked[std::size_t(r) * columns + std::size_t(c)] = 1;
+    }
+
+    const auto index_of = [](const std::vector<double>& values,
+                             double value) {
+      return std::size_t(std::lower_bound(values.begin(), values.end(),
+                                          value) - values.begin());
+    };
+    const std::size_t start = index_of(ys, from.y) * columns
+                            + index_of(xs, from.x);
+    const std::size_t goal  = index_of(ys, to.y) * columns
+                            + index_of(xs, to.x);
+
+    // states are crossings by the way they're entered.
+    const std::size_t count = columns * rows * 4;
+    search.costs.assign(count, std::numeric_limits<double>::infinity());
+    search.parents.assign(count, none);
+    search.closed.assign(count, 0);
+    search.heap.clear();
+
+    const auto estimate = [&](std::size_t crossing) {
+      return std::abs(xs[crossing % columns] - to.x)
+           + std::abs(ys[crossing / columns] - to.y);
+    };
+    for (uint32_t way = 0; way < 4; ++way) {
+      search.costs[start * 4 + way] = 0.;
+      search.push(estimate(start), uint32_t(start * 4 + way));
+    }
+
+    uint32_t reached = none;
+    while (!search.heap.empty()) {
+      const auto state = search.pop().second;
+      if (search.closed[state])
+        continue;
+      search.closed[state] = 1;
+
+      const std::size_t crossing = state / 4, way = state % 4;
+      if (crossing == goal) {
+        reached = state;
+        break;
+      }
+
+      const auto column = std::ptrdiff_t(crossing % columns);
+      const auto row    = std::ptrdiff_t(crossing / columns);
+      for (std::size_t next_way = 0; next_way < 4; ++next_way) {
+        if ((next_way ^ 1) == way)
+          continue;
+        const auto c = column + steps[next_way][0];
+        const auto r = row + steps[next_way][1];
+        if (c < 0 || r < 0 || c >= std::ptrdiff_t(columns)
+            || r >= std::ptrdiff_t(rows))
+          continue;
+
+        const std::size_t next = std::size_t(r) * columns + std::size_t(c);
+        if (blocked[next])
+          continue;
+
+        const double cost = search.costs[state]
+          + std::abs(xs[std::size_t(c)] - xs[std::size_t(column)])
+          + std::abs(ys[std::size_t(r)] - ys[std::size_t(row)])
+          + (next_way == way ? 0. : ortho_bend_cost);
+        const auto next_state = uint32_t(next * 4 + next_way);
+        if (cost < search.costs[next_state]) {
+          search.costs[next_state]   = cost;
+          search.parents[next_state] = state;
+          search.push(cost + estimate(next), next_state);
+        }
+      }
+    }
+
+    if (reached == none)
+      continue;
+
+    // crossings where the way turns, with the ends.
+    std::vector<Vec2> route{ to };
+    for (auto state = reached; search.parents[state] != none;
+         state = search.parents[state]) {
+      const auto parent = search.parents[state];
+      if (parent % 4 != state % 4 && search.parents[parent] != none) {
+        const std::size_t crossing = parent / 4;
+        route.push_back(Vec2{ xs[crossing % columns],
+                              ys[crossing / columns] });
+      }
+    }
+    route.push_back(from);
+    std::reverse(route.begin(), route.end());
+
+    if (route_is_clear(obstacles, source, target, route, true))
+      return route;
+  }
+  return {};
+}
+
+/** point where the segment from the center of node `node` towards
+ *  `toward` leaves its shape, as a box if `boxed`.
+ */
+inline Vec2 clip_to_node(const LayoutGraph& graph, const Layout& layout,
+                         const RouteOptions& options, uint32_t node,
+                         Vec2 toward, bool boxed)
+{
+  const auto& size = node < layout.sizes.size() ? layout.sizes[node]
+                                                : graph.node(node);
+  const auto shape = boxed ? attrtypes::ShapeType::box
+                   : node < options.shapes.size()
+                   ? options.shapes[node] : attrtypes::ShapeType::ellipse;
+  const Vec2 center{ layout.positions[node].x, layout.positions[node].y };
+
+  if (is_elliptic(shape))
+    return clip_ellipse(center, size.width, size.height, toward);
+
+  std::vector<Vec2> corners{};
+  add_shape_corners(shape, center, size.width / 2., size.height / 2.,
+                    corners);
+  const auto [enter, exit] = clip_segment(
+    corners.data(), corners.data() + corners.size(), center, toward, 0.);
+  return enter < exit ? center + (toward - center) * exit : toward;
+}
+
+/** Bézier control points of straight segments through `points`,
+ *  starting with the first point.
+ */
+inline std::vector<Vec2> straight_beziers(const std::vector<Vec2>& points)
+{
+  std::vector<Vec2> out{ points.front() };
+  for (std::size_t i = 0; i + 1 < points.size(); ++i) {
+    const Vec2 step = (points[i + 1] - points[i]) * (1. / 3.);
+    out.push_back(points[i] + step);
+    out.push_back(points[i] + step * 2.);
+    out.push_back(points[i + 1]);
+  }
+  return out;
+}
+
+/** Bézier control points of a loop on the right side of `node`. */
+inline std::vector<Vec2> loop_beziers(const LayoutGraph& graph,
+                                      const Layout& layout, uint32_t node)
+{
+  const auto& size = node < layout.sizes.size() ? layout.sizes[node]
+                                                : graph.node(node);
+  const Vec2 center{ layout.positions[node].x, layout.positions[node].y };
+  const double hx = size.width / 2., hy = size.height / 2.;
+  const double reach = std::max(loop_reach, hy);
+
+  const Vec2 start = clip_ellipse(center, size.width, size.height,
+                                  center + Vec2{ hx, hy / 2. });
+  const Vec2 end   = clip_ellipse(center, size.width, size.height,
+                                  center + Vec2{ hx, -hy / 2. });
+  return { start, start + Vec2{ reach, reach }, end + Vec2{ reach, -reach },
+           end };
+}
+
+}  // namespace detail
+
+/** routes edges of `graph` between nodes of `layout`, as `splines` asks,
+ *  setting their splines.
+ *
+ * nodes are obstacles of their shape, grown by `esep`, ellipses being
+ * taken as octagons around them and shapes other than boxes and
+ * diamonds as their bounding box. polylines and splines follow the
+ * shortest route around obstacles, by A* over the visibility graph of
+ * obstacles near the edge, splines being smoothed through its corners.
+ * orthogonal routes follow tracks between bounding boxes of obstacles,
+ * trading length for bends. edges with no route found, such as those
+ * of nodes inside others or crowded by too many obstacles to search
+ * among, take the first of a few routes bending once or twice that
+ * keeps out of obstacles, if any. otherwise, orthogonal edges bend once
+ * at a corner, through whatever is in the way, and others are straight.
+ *
+ * obstacles are indexed by a uniform grid, read by edges routed across
+ * threads. node positions are kept.
+ */
+inline Layout route_edges(const LayoutGraph& graph, Layout layout,
+                          const RouteOptions& options = {})
+{
+  using detail::Vec2;
+
+  const auto mode = to_edge_routing(options.splines);
+  const std::size_t count = graph.edge_count();
+
+  layout.splines.clear();
+  if (mode == EdgeRouting::none || count == 0)
+    return layout;
+
+  const detail::Obstacles obstacles(graph, layout, options);
+  const auto center = [&](uint32_t node) {
+    return Vec2{ layout.positions[node].x, layout.positions[node].y };
+  };
+
+  std::vector<std::vector<Vec2>>  routes(count);
+  std::vector<std::optional<Vec2>> tips(count);
+  parallel::parallel_for(count, [&](std::size_t begin, std::size_t end) {
+    detail::RouteSearch search{};
+    for (std::size_t edge = begin; edge < end; ++edge) {
+      const auto [source, target] = std::pair(graph.edge(edge).source,
+                                              graph.edge(edge).target);
+      auto& out = routes[edge];
+      if (source == target) {
+        out = detail::loop_beziers(graph, layout, source);
+      }
+      else {
+        const Vec2 from = center(source), to = center(target);
+        std::vector<Vec2> points{};
+        if (mode == EdgeRouting::ortho)
+          points = detail::ortho_route(obstacles, source, target, from, to,
+                                       search);
+        else if (mode != EdgeRouting::line)
+          points = detail::visible_route(obstacles, source, target, from,
+                                         to, search);
+        const bool boxed = mode == EdgeRouting::ortho;
+        if (points.empty() && mode != EdgeRouting::line)
+          points = detail::simple_route(obstacles, source, target, from, to,
+                                        boxed);
+        if (points.empty())
+          points = { from, to };
+
+        points.front() = detail::clip_to_node(graph, layout, options, source,
+                                              points[1], boxed);
+        points.back()  = detail::clip_to_node(graph, layout, options, target,
+                                              points[points.size() - 2],
+                                              boxed);
+
+        out = mode == EdgeRouting::spline ? detail::smooth(points)
+                                          : detail::straight_beziers(points);
+      }
+      if (options.directed)
+        tips[edge] = detail::make_room_for_arrow(out);
+    }
+  }, 16, options.threads);
+
+  const auto to_spline_point = [](Vec2 point) {
+    return attrtypes::spline_point_type(point.x, point.y);
+  };
+
+  layout.splines.resize(count);
+  for (std::size_t edge = 0; edge < count; ++edge) {
+    const auto& route = routes[edge];
+
+    attrtypes::Spline<> spline{};
+    spline.set_point(to_spline_point(route.front()));
+    for (std::size_t i = 1; i + 2 < route.size(); i += 3)
+      spline.add_triples({ to_spline_point(route[i]),
+                           to_spline_point(route[i + 1]),
+                           to_spline_point(route[i + 2]) });
+    if (tips[edge])
+      spline.set_endp(to_spline_point(*tips[edge]));
+
+    layout.splines[edge].add_spline(spline);
+  }
+  return layout;
+}
+
+/** routes edges of `graph` between its nodes where `pos` puts them, by
+ *  `route_edges`, setting `pos` of its edges, or unsetting it if edges
+ *  aren't drawn.
+ *
+ * nodes are shaped by their `shape`, and edges have arrows if the graph
+ * is directed. other graph attributes, such as `splines`, are given in
+ * `options`, see `make_layout_input`.
+ */
+template <typename GraphT>
+void route_edges_layout(GraphT& graph, RouteOptions options = {})
+{
+  const auto input = make_layout_input(graph);
+
+  options.directed = GraphT::is_directed();
+  options.shapes.clear();
+  for (auto node : input.nodes)
+    options.shapes.push_back(
+      detail::get_or_default<attrs::Shape>(graph, node));
+
+  const auto layout = route_edges(input.graph, read_layout(graph, input),
+                                  options);
+  if (layout.splines.empty())
+    for (auto edge : input.edges)
+      graph.template remove_entity_attr<attrs::Pos>(edge);
+  write_layout(graph, input, layout);
+}
+
+}  // namespace gviz::layout
+
+#endif  // GVIZARD_LAYOUT_ROUTING_HPP_
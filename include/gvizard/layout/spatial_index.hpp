@@ -0,0 +1,651 @@
+#ifndef GVIZARD_LAYOUT_SPATIAL_INDEX_HPP_
+#define GVIZARD_LAYOUT_SPATIAL_INDEX_HPP_
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <numeric>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include "gvizard/layout/layout_graph.hpp"
+#include "gvizard/parallel/parallel_for.hpp"
+#include "gvizard/utils.hpp"
+
+#include "gvizard/attrs/height.hpp"
+#include "gvizard/attrs/pos.hpp"
+#include "gvizard/attrs/width.hpp"
+
+namespace gviz::layout {
+
+/** a node or an edge of a `SpatialIndex`, by its index in a layout. */
+struct SpatialItem final {
+  enum class Kind : uint8_t { node = 0, edge };
+
+  Kind     kind  = Kind::node;
+  uint32_t index = 0;
+
+  constexpr bool operator==(const SpatialItem& other) const noexcept
+  {
+    return kind == other.kind && index == other.index;
+  }
+
+  constexpr bool operator!=(const SpatialItem& other) const noexcept
+  {
+    return !(*this == other);
+  }
+
+  constexpr bool operator<(const SpatialItem& other) const noexcept
+  {
+    return kind < other.kind || (kind == other.kind && index < other.index);
+  }
+};
+
+namespace detail {
+
+/** a box containing nothing, not even a point. */
+constexpr Box empty_box{ std::numeric_limits<double>::infinity(),
+                         std::numeric_limits<double>::infinity(),
+                         -std::numeric_limits<double>::infinity(),
+                         -std::numeric_limits<double>::infinity() };
+
+/** whether `box` contains nothing, as boxes of NaN don't either. */
+inline bool is_empty(const Box& box) noexcept
+{
+  return !(box.llx <= box.urx && box.lly <= box.ury);
+}
+
+inline void grow_box(Box& box, const Box& other) noexcept
+{
+  box.llx = std::min(box.llx, other.llx);
+  box.lly = std::min(box.lly, other.lly);
+  box.urx = std::max(box.urx, other.urx);
+  box.ury = std::max(box.ury, other.ury);
+}
+
+inline void grow_box(Box& box, double x, double y) noexcept
+{
+  box.llx = std::min(box.llx, x);
+  box.lly = std::min(box.lly, y);
+  box.urx = std::max(box.urx, x);
+  box.ury = std::max(box.ury, y);
+}
+
+inline bool boxes_meet(const Box& lhs, const Box& rhs) noexcept
+{
+  return lhs.llx <= rhs.urx && rhs.llx <= lhs.urx
+      && lhs.lly <= rhs.ury && rhs.lly <= lhs.ury;
+}
+
+/** squared distance from `point` to `box`, 0 inside it and infinite to
+ *  an empty box.
+ */
+inline double box_distance2(const Box& box, const Point& point) noexcept
+{
+  if (is_empty(box))
+    return std::numeric_limits<double>::infinity();
+
+  const double dx = std::max({ box.llx - point.x, 0., point.x - box.urx });
+  const double dy = std::max({ box.lly - point.y, 0., point.y - box.ury });
+  return dx * dx + dy * dy;
+}
+
+/** box of a node of `size` centered at `center`. */
+inline Box node_box(const Point& center, const LayoutNode& size) noexcept
+{
+  return Box{ center.x - size.width / 2., center.y - size.height / 2.,
+              center.x + size.width / 2., center.y + size.height / 2. };
+}
+
+/** box of control points of `splines`, which holds their curves, and of
+ *  their arrow ends. empty if there are none.
+ */
+inline Box splines_box(const Layout::splines_type& splines) noexcept
+{
+  Box box = empty_box;
+  const auto add = [&](const attrtypes::spline_point_type& point) {
+    const attrtypes::Point2D<double> at(point);
+    grow_box(box, at.x, at.y);
+  };
+
+  for (const auto& spline : splines.splines) {
+    add(spline.point);
+    for (const auto& [first, second, third] : spline.triples) {
+      add(first);
+      add(second);
+      add(third);
+    }
+    if (spline.startp)
+      add(*spline.startp);
+    if (spline.endp)
+      add(*spline.endp);
+  }
+  return box;
+}
+
+}  // namespace detail
+
+/** an R-tree of boxes of nodes and edges of a layout, for finding what
+ *  is at a point, within an area or nearest to a point.
+ *
+ * it is bulk loaded by sort-tile-recursive packing: boxes are sorted by
+ * x into vertical slices, each sorted by y, and runs of `fanout` of them
+ * grouped, level after level, so that nodes of the tree are full and
+ * stored by level in flat arrays without links.
+ *
+ * updated boxes are refitted in place, enlarging their ancestors, and
+ * boxes of new items are searched one by one until there are enough of
+ * them, or of removed ones, for the tree to be packed again.
+ */
+class SpatialIndex final {
+ public:
+  static constexpr std::size_t fanout = 16;
+
+ private:
+  static constexpr uint32_t none = std::numeric_limits<uint32_t>::max();
+
+  // entries, those packed first, then those added since.
+  std::vector<SpatialItem> items_{};
+  std::vector<Box>         boxes_{};
+  std::size_t              packed_  = 0;
+  std::size_t              removed_ = 0;
+
+  // boxes of runs of `fanout` entries, then of runs of those, up to the
+  // root.
+  std::vector<std::vector<Box>> levels_{};
+
+  // entries of nodes and edges by their index, `none` if not indexed.
+  std::vector<uint32_t> node_slots_{};
+  std::vector<uint32_t> edge_slots_{};
+
+  unsigned threads_ = 0;
+
+  std::vector<uint32_t>& slots_of(SpatialItem::Kind kind) noexcept
+  {
+    return kind == SpatialItem::Kind::node ? node_slots_ : edge_slots_;
+  }
+
+  const std::vector<uint32_t>& slots_of(
+    SpatialItem::Kind kind) const noexcept
+  {
+    return kind == SpatialItem::Kind::node ? node_slots_ : edge_slots_;
+  }
+
+  uint32_t slot_of(SpatialItem item) const noexcept
+  {
+    const auto& slots = slots_of(item.kind);
+    return item.index < slots.size() ? slots[item.index] : none;
+  }
+
+  /** encloses boxes of the runs of `fanout` in `below`. */
+  static void enclose(const std::vector<Box>& below, std::vector<Box>& out,
+                      unsigned threads)
+  {
+    out.assign((below.size() + fanout - 1) / fanout, detail::empty_box);
+    parallel::parallel_for(out.size(),
+                           [&](std::size_t begin, std::size_t end) {
+      for (std::size_t i = begin; i < end; ++i)
+        for (std::size_t j = i * fanout;
+             j < std::min((i + 1) * fanout, below.size()); ++j)
+          detail::grow_box(out[i], below[j]);
+    }, 1024, threads);
+  }
+
+  /** updates boxes enclosing entry `slot`, from its run to the root. */
+  void refit(std::size_t slot)
+  {
+    const std::vector<Box> *below = &boxes_;
+    std::size_t index = slot, count = packed_;
+    for (auto& level : levels_) {
+      index /= fanout;
+      Box box = detail::empty_box;
+      for (std::size_t j = index * fanout;
+           j < std::min((index + 1) * fanout, count); ++j)
+        detail::grow_box(box, (*below)[j]);
+      level[index] = box;
+
+      below = &level;
+      count = level.size();
+    }
+  }
+
+  /** packs entries not removed into a new tree. */
+  void pack()
+  {
+    std::vector<uint32_t> live{};
+    live.reserve(items_.size() - removed_);
+    for (std::size_t slot = 0; slot < items_.size(); ++slot)
+      if (slot_of(items_[slot]) == slot)
+        live.push_back(uint32_t(slot));
+
+    const std::size_t count = live.size();
+    const auto center_x = [&](uint32_t slot) {
+      return boxes_[slot].llx + boxes_[slot].urx;
+    };
+    const auto center_y = [&](uint32_t slot) {
+      return boxes_[slot].lly + boxes_[slot].ury;
+    };
+
+    // slices of about sqrt(count / fanout) runs each, sorted by x, then
+    // runs within each sorted by y. ties keep the order of items.
+    std::sort(live.begin(), live.end(), [&](uint32_t lhs, uint32_t rhs) {
+      return std::make_pair(center_x(lhs), items_[lhs])
+           < std::make_pair(center_x(rhs), items_[rhs]);
+    });
+
+    const std::size_t runs  = (count + fanout - 1) / fanout;
+    const auto slice_runs   =
+      std::size_t(std::ceil(std::sqrt(double(runs))));
+    const std::size_t slice = std::max<std::size_t>(slice_runs, 1) * fanout;
+    parallel::parallel_for_each_index((count + slice - 1) / slice,
+                                      [&](std::size_t i) {
+      const auto first = live.begin() + std::ptrdiff_t(i * slice);
+      const auto last  = live.begin()
+                       + std::ptrdiff_t(std::min((i + 1) * slice, count));
+      std::sort(first, last, [&](uint32_t lhs, uint32_t rhs) {
+        return std::make_pair(center_y(lhs), items_[lhs])
+             < std::make_pair(center_y(rhs), items_[rhs]);
+      });
+    }, 1, threads_);
+
+    std::vector<SpatialItem> items(count);
+    std::vector<Box>         boxes(count);
+    for (std::size_t i = 0; i < count; ++i) {
+      items[i] = items_[live[i]];
+      boxes[i] = boxes_[live[i]];
+      slots_of(items[i].kind)[items[i].index] = uint32_t(i);
+    }
+    items_   = std::move(items);
+    boxes_   = std::move(boxes);
+    packed_  = count;
+    removed_ = 0;
+
+    levels_.clear();
+    if (count == 0)
+      return;
+
+    levels_.emplace_back();
+    enclose(boxes_, levels_.back(), threads_);
+    while (levels_.back().size() > 1) {
+      std::vector<Box> above{};
+      enclose(levels_.back(), above, threads_);
+      levels_.push_back(std::move(above));
+    }
+  }
+
+  /** packs the tree again once its added or removed entries are many. */
+  void pack_if_loose()
+  {
+    constexpr std::size_t least_loose = 64;
+
+    const std::size_t loose = items_.size() - packed_ + removed_;
+    if (loose > std::max(least_loose, packed_ / 8))
+      pack();
+  }
+
+ public:
+  SpatialIndex() = default;
+
+  /** indexes `items` by their `boxes`, given in the same order. empty
+   *  boxes aren't indexed.
+   *
+   * @param threads maximum count of threads building it and packing it
+   *                again, 0 means default_concurrency().
+   */
+  SpatialIndex(const std::vector<SpatialItem>& items,
+               const std::vector<Box>& boxes, unsigned threads = 0)
+    : threads_(threads)
+  {
+    for (std::size_t i = 0; i < items.size(); ++i) {
+      auto& slots = slots_of(items[i].kind);
+      if (slots.size() <= items[i].index)
+        slots.resize(items[i].index + 1, none);
+      if (detail::is_empty(boxes[i]))
+        continue;
+
+      if (slots[items[i].index] == none) {
+        slots[items[i].index] = uint32_t(items_.size());
+        items_.push_back(items[i]);
+        boxes_.push_back(boxes[i]);
+      }
+      else {
+        boxes_[slots[items[i].index]] = boxes[i];
+      }
+    }
+    pack();
+  }
+
+  /** indexes nodes of `layout` by their sizes, and edges by the boxes of
+   *  control points of their splines, edges without any being left out.
+   */
+  SpatialIndex(const LayoutGraph& graph, const Layout& layout,
+               unsigned threads = 0)
+    : threads_(threads)
+  {
+    const std::size_t nodes = layout.positions.size();
+    const std::size_t edges = layout.splines.size();
+
+    std::vector<SpatialItem> items(nodes + edges);
+    std::vector<Box>         boxes(nodes + edges);
+    parallel::parallel_for(nodes + edges,
+                           [&](std::size_t begin, std::size_t end) {
+      for (std::size_t i = begin; i < end; ++i) {
+        if (i < nodes) {
+          items[i] = SpatialItem{ SpatialItem::Kind::node, uint32_t(i) };
+          boxes[i] = detail::node_box(
+            layout.positions[i],
+            i < layout.sizes.size() ? layout.sizes[i] : graph.node(i));
+        }
+        else {
+          items[i] = SpatialItem{ SpatialItem::Kind::edge,
+                                  uint32_t(i - nodes) };
+          boxes[i] = detail::splines_box(layout.splines[i - nodes]);
+        }
+      }
+    }, 1024, threads);
+
+    *this = SpatialIndex(items, boxes, threads);
+  }
+
+  /** count of items indexed. */
+  std::size_t size() const noexcept
+  {
+    return items_.size() - removed_;
+  }
+
+  bool empty() const noexcept { return size() == 0; }
+
+  bool contains(SpatialItem item) const noexcept
+  {
+    return slot_of(item) != none;
+  }
+
+  /** box of `item`, empty if it isn't indexed. */
+  Box box(SpatialItem item) const noexcept
+  {
+    const auto slot = slot_of(item);
+    return slot == none ? detail::empty_box : boxes_[slot];
+  }
+
+  /** sets the box of `item`, indexing it if it wasn't. an empty box
+   *  removes it.
+   */
+  void update(SpatialItem item, const Box& box)
+  {
+    if (detail::is_empty(box)) {
+      remove(item);
+      return;
+    }
+
+    auto& slots = slots_of(item.kind);
+    if (slots.size() <= item.index)
+      slots.resize(item.index + 1, none);
+
+    if (const auto slot = slots[item.index]; slot != none) {
+      boxes_[slot] = box;
+      if (slot < packed_)
+        refit(slot);
+      return;
+    }
+
+    slots[item.index] = uint32_t(items_.size());
+    items_.push_back(item);
+    boxes_.push_back(box);
+    pack_if_loose();
+  }
+
+  /** removes `item`, if it's indexed. */
+  void remove(SpatialItem item)
+  {
+    const auto slot = slot_of(item);
+    if (slot == none)
+      return;
+
+    slots_of(item.kind)[item.index] = none;
+    boxes_[slot] = detail::empty_box;
+    ++removed_;
+    if (slot < packed_)
+      refit(slot);
+    pack_if_loose();
+  }
+
+  /** packs all items into a new tree, as if it were made anew. */
+  void rebuild() { pack(); }
+
+  /** calls `func(item, box)` for items whose boxes pass `test(box)`,
+   *  descending into nodes of the tree whose boxes pass it, in no
+   *  particular order.
+   */
+  template <typename Test, typename F>
+  void search(Test&& test, F&& func) const
+  {
+    if (!levels_.empty()) {
+      std::vector<std::pair<std::size_t, std::size_t>> stack{
+        { levels_.size() - 1, 0 } };
+      while (!stack.empty()) {
+        const auto [level, node] = stack.back();
+        stack.pop_back();
+        if (!test(levels_[level][node]))
+          continue;
+
+        const std::size_t first = node * fanout;
+        if (level == 0) {
+          for (auto slot = first; slot < std::min(first + fanout, packed_);
+               ++slot)
+            if (test(boxes_[slot]))
+              func(items_[slot], boxes_[slot]);
+          continue;
+        }
+
+        const std::size_t below = levels_[level - 1].size();
+        for (auto child = std::min(first + fanout, below); child-- > first;)
+          stack.emplace_back(level - 1, child);
+      }
+    }
+
+    for (auto slot = packed_; slot < items_.size(); ++slot)
+      if (test(boxes_[slot]))
+        func(items_[slot], boxes_[slot]);
+  }
+
+  /** items whose boxes hold `point`, in order. */
+  std::vector<SpatialItem> at(const Point& point) const
+  {
+    return in(Box{ point.x, point.y, point.x, point.y });
+  }
+
+  /** items whose boxes meet `area`, in order. */
+  std::vector<SpatialItem> in(const Box& area) const
+  {
+    std::vector<SpatialItem> found{};
+    search([&](const Box& box) { return detail::boxes_meet(box, area); },
+           [&](SpatialItem item, const Box&) { found.push_back(item); });
+    std::sort(found.begin(), found.end());
+    return found;
+  }
+
+  /** at most `count` items nearest to `point` by the distance to their
+   *  boxes, nearest first, ties in order of items.
+   *
+   * the tree is searched best first, nodes by the distance to their
+   * boxes, so that only those nearer than the items found are opened.
+   */
+  std::vector<SpatialItem> nearest(const Point& point,
+                                   std::size_t count) const
+  {
+    // entries of the heap are the distance, whether it's an item, the
+    // item, and the level and index of a node of the tree. nodes come
+    // before items as far, so that items as far are found in order.
+    using Entry = std::tuple<double, bool, SpatialItem, std::size_t,
+                             std::size_t>;
+
+    std::vector<Entry> heap{};
+    const auto push = [&](const Box& box, bool is_item, SpatialItem item,
+                          std::size_t level, std::size_t node) {
+      const double distance = detail::box_distance2(box, point);
+      if (std::isinf(distance))
+        return;
+      heap.emplace_back(distance, is_item, item, level, node);
+      std::push_heap(heap.begin(), heap.end(), std::greater<Entry>{});
+    };
+
+    if (!levels_.empty())
+      push(levels_.back()[0], false, SpatialItem{}, levels_.size() - 1, 0);
+    for (auto slot = packed_; slot < items_.size(); ++slot)
+      push(boxes_[slot], true, items_[slot], 0, 0);
+
+    std::vector<SpatialItem> found{};
+    while (!heap.empty() && found.size() < count) {
+      std::pop_heap(heap.begin(), heap.end(), std::greater<Entry>{});
+      const auto [distance, is_item, item, level, node] = heap.back();
+      heap.pop_back();
+
+      if (is_item) {
+        found.push_back(item);
+        continue;
+      }
+
+      const std::size_t first = node * fanout;
+      if (level == 0) {
+        for (auto slot = first; slot < std::min(first + fanout, packed_);
+             ++slot)
+          push(boxes_[slot], true, items_[slot], 0, 0);
+        continue;
+      }
+
+      const auto& below = levels_[level - 1];
+      for (auto child = first; child < std::min(first + fanout,
+                                                below.size()); ++child)
+        push(below[child], false, SpatialItem{}, level - 1, child);
+    }
+    return found;
+  }
+};
+
+/** a `SpatialIndex` of nodes and edges of a graph where their `pos`
+ *  puts them, nodes sized by their `width` and `height`, finding them
+ *  by their ids.
+ *
+ * the graph doesn't tell of changes to its attributes, so `update` is
+ * to be called for nodes and edges whose `pos` or size changed. nodes
+ * and edges made after the index aren't known to it.
+ */
+template <typename GraphT>
+class GraphSpatialIndex final {
+ public:
+  using entity_type = typename GraphT::entity_type;
+
+ private:
+  LayoutInput<GraphT> input_{};
+  SpatialIndex        index_{};
+
+  std::vector<entity_type> entities(
+    const std::vector<SpatialItem>& items) const
+  {
+    std::vector<entity_type> out{};
+    out.reserve(items.size());
+    for (auto item : items)
+      out.push_back(entity(item));
+    return out;
+  }
+
+ public:
+  /** indexes nodes of `graph` with a point as `pos`, and edges with
+   *  splines as theirs.
+   */
+  explicit GraphSpatialIndex(const GraphT& graph, unsigned threads = 0)
+    : input_(make_layout_input(graph))
+  {
+    // nodes without a point are at NaN, whose boxes are empty.
+    auto layout = read_layout(graph, input_);
+    for (std::size_t i = 0; i < input_.nodes.size(); ++i)
+      if (!graph.template has_entity_attr<attrs::Pos>(input_.nodes[i]))
+        layout.positions[i] = Point{ std::nan(""), std::nan("") };
+
+    index_ = SpatialIndex(input_.graph, layout, threads);
+  }
+
+  const SpatialIndex& index() const noexcept { return index_; }
+
+  entity_type entity(SpatialItem item) const
+  {
+    return item.kind == SpatialItem::Kind::node ? input_.nodes[item.index]
+                                                : input_.edges[item.index];
+  }
+
+  /** nodes and edges whose boxes hold `point`, nodes first. */
+  std::vector<entity_type> at(const Point& point) const
+  {
+    return entities(index_.at(point));
+  }
+
+  /** nodes and edges whose boxes meet `area`, nodes first. */
+  std::vector<entity_type> in(const Box& area) const
+  {
+    return entities(index_.in(area));
+  }
+
+  /** at most `count` nodes and edges nearest to `point`, nearest first. */
+  std::vector<entity_type> nearest(const Point& point,
+                                   std::size_t count) const
+  {
+    return entities(index_.nearest(point, count));
+  }
+
+  /** reads `pos` of `entity` again, and `width` and `height` if it's a
+   *  node, removing it from the index if it has none. ids of entities
+   *  not indexed are ignored.
+   */
+  void update(const GraphT& graph, entity_type entity)
+  {
+    SpatialItem item{};
+    if (const auto node = input_.index_of(entity);
+        node < input_.nodes.size() && input_.nodes[node] == entity) {
+      item = SpatialItem{ SpatialItem::Kind::node, uint32_t(node) };
+    }
+    else if (const auto edge = std::size_t(
+               std::lower_bound(input_.edges.begin(), input_.edges.end(),
+                                entity) - input_.edges.begin());
+             edge < input_.edges.size() && input_.edges[edge] == entity) {
+      item = SpatialItem{ SpatialItem::Kind::edge, uint32_t(edge) };
+    }
+    else {
+      return;
+    }
+
+    const auto pos = graph.template get_entity_attr<attrs::Pos>(entity);
+    if (!pos || !pos->get_value()) {
+      index_.remove(item);
+      return;
+    }
+
+    const auto box = utils::LambdaVisit(
+      *pos->get_value(),
+      [&](const attrtypes::PointType<double>& point) {
+        if (item.kind != SpatialItem::Kind::node)
+          return detail::empty_box;
+
+        const attrtypes::Point2D<double> at(point);
+        return detail::node_box(
+          Point{ at.x, at.y },
+          LayoutNode{
+            detail::get_or_default<attrs::Width>(graph, entity)
+              * points_per_inch,
+            detail::get_or_default<attrs::Height>(graph, entity)
+              * points_per_inch });
+      },
+      [&](const Layout::splines_type& splines) {
+        return item.kind == SpatialItem::Kind::edge
+             ? detail::splines_box(splines) : detail::empty_box;
+      });
+    index_.update(item, box);
+  }
+};
+
+}  // namespace gviz::layout
+
+#endif  // GVIZARD_LAYOUT_SPATIAL_INDEX_HPP_
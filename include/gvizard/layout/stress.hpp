@@ -0,0 +1,772 @@
+#ifndef GVIZARD_LAYOUT_STRESS_HPP_
+#define GVIZARD_LAYOUT_STRESS_HPP_
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <numeric>
+#include <optional>
+#include <random>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "gvizard/attrtypes/starttype.hpp"
+#include "gvizard/layout/force_directed.hpp"
+#include "gvizard/layout/layout_graph.hpp"
+#include "gvizard/parallel/parallel_for.hpp"
+
+#include "gvizard/attrs/defaultdist.hpp"
+#include "gvizard/attrs/dim.hpp"
+#include "gvizard/attrs/epsilon.hpp"
+#include "gvizard/attrs/maxiter.hpp"
+#include "gvizard/attrs/model.hpp"
+#include "gvizard/attrs/start.hpp"
+
+namespace gviz::layout {
+
+/** how ideal distances between nodes are found, see `attrs::Model`. */
+enum class StressModel : uint8_t {
+  shortpath = 0,  ///< lengths of shortest paths, edges being `len` long.
+  mds,            ///< like shortpath, but linked nodes are `len` apart.
+};
+
+/** parses a value of `attrs::Model`, anything unknown is shortpath. */
+constexpr StressModel to_stress_model(std::string_view value) noexcept
+{
+  return value == "mds" ? StressModel::mds : StressModel::shortpath;
+}
+
+/** parameters of `stress`, defaults being those of the attributes
+ *  they're named after.
+ */
+struct StressOptions final {
+  /** 2 or 3, the number of axes of positions. */
+  int dim = attrs::Dim::get_default_value();
+
+  /** how ideal distances are found, of `attrs::Model`. */
+  StressModel model = StressModel::shortpath;
+
+  /** most iterations, 200 if unset. */
+  std::optional<int> maxiter = attrs::MaxIter::get_default_value();
+
+  /** iterations stop once stress drops by less than this part of it,
+   *  0.0001 if unset.
+   */
+  std::optional<double> epsilon = attrs::Epsilon::get_default_value();
+
+  /** initial positions: random ones of `seed`, regular ones on a circle,
+   *  or otherwise by pivot MDS.
+   */
+  attrtypes::StartType start = attrs::Start::get_default_value();
+
+  /** distance between nodes not connected, in inches. 0 means
+   *  `1 + average len * sqrt(node count)`.
+   */
+  double defaultdist = attrs::DefaultDist::get_default_value();
+
+  /** graphs of more nodes are laid out by sparse stress, of distances
+   *  to `pivots` nodes only, instead of between all pairs.
+   */
+  std::size_t sparse_threshold = 1000;
+
+  /** count of pivot nodes of pivot MDS and sparse stress. */
+  std::size_t pivots = 50;
+
+  /** maximum count of threads, 0 means default_concurrency(). */
+  unsigned threads = 0;
+};
+
+namespace detail {
+
+constexpr int    default_stress_maxiter = 200;
+constexpr double default_stress_epsilon = 1e-4;
+
+// conjugate gradient stops at this residual, relative to the right side.
+constexpr double solver_tolerance  = 1e-3;
+constexpr std::size_t solver_maxiter = 100;
+
+constexpr double unreachable = std::numeric_limits<double>::infinity();
+
+/** sum of `func(idx)` over [0, count) across threads, added up in fixed
+ *  blocks so that it doesn't depend on thread count.
+ */
+template <typename F>
+double parallel_sum(std::size_t count, F&& func, unsigned threads)
+{
+  constexpr std::size_t grain = 4096;
+  const std::size_t blocks = (count + grain - 1) / grain;
+
+  std::vector<double> sums(blocks, 0.);
+  parallel::parallel_for_each_index(blocks, [&](std::size_t block) {
+    const std::size_t end = std::min(count, (block + 1) * grain);
+    double sum = 0.;
+    for (std::size_t idx = block * grain; idx < end; ++idx)
+      sum += func(idx);
+    sums[block] = sum;
+  }, 1, threads);
+
+  return std::accumulate(sums.begin(), sums.end(), 0.);
+}
+
+/** finds shortest path lengths of edges taken both ways, by breadth
+ *  first search if all edges are as long, otherwise by Dijkstra's.
+ */
+class PathFinder final {
+  const LayoutGraph& graph_;
+  bool   uniform_ = true;
+  double length_  = 1.;
+
+  std::vector<uint32_t> queue_{};
+
+  using Entry = std::pair<double, uint32_t>;
+  std::vector<Entry> heap_{};
+
+ public:
+  explicit PathFinder(const LayoutGraph& graph)
+    : graph_(graph)
+  {
+    if (graph.edge_count() != 0)
+      length_ = graph.edge(0).len;
+    for (const auto& edge : graph.edges())
+      uniform_ = uniform_ && edge.len == length_;
+  }
+
+  /** sets `distances` to those from `source`, `unreachable` if none. */
+  void from(uint32_t source, std::vector<double>& distances)
+  {
+    distances.assign(graph_.node_count(), unreachable);
+    distances[source] = 0.;
+
+    const auto each_neighbour = [&](uint32_t node, auto&& func) {
+      for (auto edge : graph_.out_edges(node))
+        func(graph_.edge(edge).target, graph_.edge(edge).len);
+      for (auto edge : graph_.in_edges(node))
+        func(graph_.edge(edge).source, graph_.edge(edge).len);
+    };
+
+    if (uniform_) {
+      queue_.assign(1, source);
+      for (std::size_t i = 0; i < queue_.size(); ++i) {
+        const auto node = queue_[i];
+        each_neighbour(node, [&](uint32_t other, double) {
+          if (distances[other] == unreachable) {
+            distances[other] = distances[node] + length_;
+            queue_.push_back(other);
+          }
+        });
+      }
+      return;
+    }
+
+    heap_.assign(1, Entry{ 0., source });
+    while (!heap_.empty()) {
+      std::pop_heap(heap_.begin(), heap_.end(), std::greater<Entry>{});
+      const auto [distance, node] = heap_.back();
+      heap_.pop_back();
+      if (distance > distances[node])
+        continue;
+
+      each_neighbour(node, [&](uint32_t other, double length) {
+        const double through = distance + std::max(length, 0.);
+        if (through < distances[other]) {
+          distances[other] = through;
+          heap_.emplace_back(through, other);
+          std::push_heap(heap_.begin(), heap_.end(), std::greater<Entry>{});
+        }
+      });
+    }
+  }
+};
+
+/** pairs of nodes to be their ideal distance apart, row by row, each
+ *  pair being in the rows of both.
+ *
+ * pairs are weighted by the inverse square of their distance, so that
+ * near nodes matter as much as far ones relative to it.
+ */
+struct StressTerms final {
+  std::vector<uint32_t> offsets{ 0 };
+  std::vector<uint32_t> others{};
+  std::vector<double>   distances{};
+  std::vector<double>   weights{};
+
+  std::size_t node_count() const noexcept { return offsets.size() - 1; }
+};
+
+inline double default_distance(const LayoutGraph& graph,
+                               const StressOptions& options)
+{
+  if (options.defaultdist > 0.)
+    return options.defaultdist;
+
+  double length = 1.;
+  if (graph.edge_count() != 0) {
+    length = 0.;
+    for (const auto& edge : graph.edges())
+      length += edge.len;
+    length /= double(graph.edge_count());
+  }
+  return 1. + length * std::sqrt(double(graph.node_count()));
+}
+
+/** for the mds model, distances between linked nodes are their `len`. */
+inline void link_lengths(const LayoutGraph& graph, uint32_t node,
+                         std::vector<double>& distances)
+{
+  for (auto edge : graph.out_edges(node))
+    if (graph.edge(edge).target != node)
+      distances[graph.edge(edge).target] = graph.edge(edge).len;
+  for (auto edge : graph.in_edges(node))
+    if (graph.edge(edge).source != node)
+      distances[graph.edge(edge).source] = graph.edge(edge).len;
+}
+
+/** terms of all pairs of nodes, of distances found from each node
+ *  across threads.
+ */
+inline StressTerms full_terms(const LayoutGraph& graph,
+                              const StressOptions& options)
+{
+  const std::size_t count   = graph.node_count();
+  const double      outside = default_distance(graph, options);
+
+  StressTerms terms{};
+  terms.offsets.resize(count + 1);
+  for (std::size_t node = 0; node <= count; ++node)
+    terms.offsets[node] = uint32_t(node * (count - 1));
+  terms.others.resize(count * (count - 1));
+  terms.distances.resize(terms.others.size());
+  terms.weights.resize(terms.others.size());
+
+  parallel::parallel_for(count, [&](std::size_t begin, std::size_t end) {
+    PathFinder          paths(graph);
+    std::vector<double> distances{};
+
+    for (auto node = uint32_t(begin); node < end; ++node) {
+      paths.from(node, distances);
+      if (options.model == StressModel::mds)
+        link_lengths(graph, node, distances);
+
+      auto at = terms.offsets[node];
+      for (uint32_t other = 0; other < count; ++other) {
+        if (other == node)
+          continue;
+
+        const double distance =
+          distances[other] == unreachable ? outside : distances[other];
+        terms.others[at]    = other;
+        terms.distances[at] = distance;
+        terms.weights[at]   = distance > 0. ? 1. / (distance * distance)
+                                            : 0.;
+        ++at;
+      }
+    }
+  }, 16, options.threads);
+
+  // heavier edges hold their ends closer to their length.
+  for (const auto& edge : graph.edges()) {
+    if (edge.source == edge.target || edge.weight == 1.)
+      continue;
+
+    const auto scale = [&](uint32_t node, uint32_t other) {
+      const auto idx = terms.offsets[node] + other - (other > node ? 1 : 0);
+      terms.weights[idx] *= edge.weight;
+    };
+    scale(edge.source, edge.target);
+    scale(edge.target, edge.source);
+  }
+  return terms;
+}
+
+/** distances from pivots chosen farthest from those before, the first
+ *  one at random, as rows of `distances`.
+ */
+inline std::vector<uint32_t>
+choose_pivots(const LayoutGraph& graph, std::size_t count, uint32_t seed,
+              double outside, std::vector<std::vector<double>>& distances)
+{
+  const std::size_t node_count = graph.node_count();
+  count = std::min(count, node_count);
+
+  std::vector<uint32_t> pivots{};
+  distances.assign(count, {});
+  if (count == 0)
+    return pivots;
+
+  std::mt19937 random(seed);
+  std::vector<double> nearest(node_count, unreachable);
+  PathFinder paths(graph);
+
+  auto pivot = uint32_t(std::uniform_int_distribution<std::size_t>(
+    0, node_count - 1)(random));
+  for (std::size_t i = 0; i < count; ++i) {
+    pivots.push_back(pivot);
+    paths.from(pivot, distances[i]);
+
+    // nodes of other parts are farthest of all until one is a pivot.
+    for (std::size_t node = 0; node < node_count; ++node)
+      nearest[node] = std::min(nearest[node], distances[i][node]);
+
+    pivot = uint32_t(std::max_element(nearest.begin(), nearest.end())
+                     - nearest.begin());
+    for (auto& distance : distances[i])
+      if (distance == unreachable)
+        distance = outside;
+  }
+  return pivots;
+}
+
+/** terms of linked nodes and of each node with each pivot, weighted by
+ *  the count of nodes nearest to the pivot, as described by Ortmann et
+ *  al. in "A Sparse Stress Model".
+ */
+inline StressTerms sparse_terms(const LayoutGraph& graph,
+                                const std::vector<uint32_t>& pivots,
+                                const std::vector<std::vector<double>>& rows)
+{
+  const std::size_t count = graph.node_count();
+
+  std::vector<double> region(pivots.size(), 0.);
+  for (std::size_t node = 0; node < count; ++node) {
+    std::size_t nearest = 0;
+    for (std::size_t i = 1; i < pivots.size(); ++i)
+      if (rows[i][node] < rows[nearest][node])
+        nearest = i;
+    region[nearest] += 1.;
+  }
+
+  struct Term final {
+    uint32_t node, other;
+    double   distance, weight;
+  };
+  std::vector<Term> pairs{};
+  pairs.reserve(2 * graph.edge_count() + 2 * count * pivots.size());
+
+  const auto add = [&](uint32_t node, uint32_t other, double distance,
+                       double weight) {
+    if (node == other || !(distance > 0.))
+      return;
+    weight /= distance * distance;
+    pairs.push_back(Term{ node, other, distance, weight });
+    pairs.push_back(Term{ other, node, distance, weight });
+  };
+
+  for (const auto& edge : graph.edges())
+    add(edge.source, edge.target, edge.len, edge.weight);
+  for (std::size_t i = 0; i < pivots.size(); ++i)
+    for (auto node = uint32_t(0); node < count; ++node)
+      add(node, pivots[i], rows[i][node], region[i]);
+
+  std::sort(pairs.begin(), pairs.end(), [](const Term& lhs, const Term& rhs) {
+    return lhs.node != rhs.node ? lhs.node < rhs.node : lhs.other < rhs.other;
+  });
+
+  StressTerms terms{};
+  terms.offsets.assign(count + 1, 0);
+  for (std::size_t i = 0; i < pairs.size(); ++i) {
+    const auto& pair = pairs[i];
+
+    // repeated pairs, of parallel edges or edges to pivots, merge.
+    if (i != 0 && pairs[i - 1].node == pair.node
+        && pairs[i - 1].other == pair.other) {
+      terms.distances.back() = std::min(terms.distances.back(),
+                                        pair.distance);
+      terms.weights.back() += pair.weight;
+      continue;
+    }
+    terms.others.push_back(pair.other);
+    terms.distances.push_back(pair.distance);
+    terms.weights.push_back(pair.weight);
+    ++terms.offsets[pair.node + 1];
+  }
+  for (std::size_t node = 0; node < count; ++node)
+    terms.offsets[node + 1] += terms.offsets[node];
+  return terms;
+}
+
+/** positions of nodes by pivot MDS, as described by Brandes and Pich in
+ *  "Eigensolver Methods for Progressive Multidimensional Scaling of
+ *  Large Data": classical scaling of distances to pivots only.
+ */
+template <std::size_t D>
+Coords<D> pivot_mds(const std::vector<std::vector<double>>& rows,
+                    std::size_t count, uint32_t seed)
+{
+  const std::size_t k = rows.size();
+
+  // double centered squared distances, a column per pivot.
+  std::vector<double> centered(count * k);
+  std::vector<double> row_means(count, 0.), column_means(k, 0.);
+  double mean = 0.;
+  for (std::size_t j = 0; j < k; ++j)
+    for (std::size_t i = 0; i < count; ++i) {
+      const double square = rows[j][i] * rows[j][i];
+      centered[i * k + j] = square;
+      row_means[i]    += square / double(k);
+      column_means[j] += square / double(count);
+      mean            += square / double(count * k);
+    }
+  for (std::size_t i = 0; i < count; ++i)
+    for (std::size_t j = 0; j < k; ++j)
+      centered[i * k + j] = -.5 * (centered[i * k + j] - row_means[i]
+                                   - column_means[j] + mean);
+
+  std::vector<double> product(k * k, 0.);
+  for (std::size_t i = 0; i < count; ++i)
+    for (std::size_t a = 0; a < k; ++a)
+      for (std::size_t b = 0; b < k; ++b)
+        product[a * k + b] += centered[i * k + a] * centered[i * k + b];
+
+  // leading eigenvectors of the product by power iteration, each kept
+  // orthogonal to those before.
+  std::mt19937 random(seed);
+  std::uniform_real_distribution<double> unit(-1., 1.);
+  std::array<std::vector<double>, D> vectors{};
+  Coords<D> coords{};
+
+  for (std::size_t axis = 0; axis < D; ++axis) {
+    auto& vector = vectors[axis];
+    vector.resize(k);
+    for (auto& value : vector)
+      value = unit(random);
+
+    std::vector<double> next(k);
+    for (int iteration = 0; iteration < 100; ++iteration) {
+      for (std::size_t a = 0; a < k; ++a) {
+        next[a] = 0.;
+        for (std::size_t b = 0; b < k; ++b)
+          next[a] += product[a * k + b] * vector[b];
+      }
+      for (std::size_t prev = 0; prev < axis; ++prev) {
+        const double along = std::inner_product(
+          next.begin(), next.end(), vectors[prev].begin(), 0.);
+        for (std::size_t a = 0; a < k; ++a)
+          next[a] -= along * vectors[prev][a];
+      }
+
+      const double norm = std::sqrt(std::inner_product(
+        next.begin(), next.end(), next.begin(), 0.));
+      if (!(norm > 0.))
+        break;
+      for (std::size_t a = 0; a < k; ++a)
+        vector[a] = next[a] / norm;
+    }
+
+    coords[axis].assign(count, 0.);
+    for (std::size_t i = 0; i < count; ++i)
+      for (std::size_t a = 0; a < k; ++a)
+        coords[axis][i] += centered[i * k + a] * vector[a];
+  }
+  return coords;
+}
+
+/** positions on a circle, or a helix in 3 dimensions, `spacing` apart. */
+template <std::size_t D>
+Coords<D> regular_coords(std::size_t count, double spacing)
+{
+  constexpr double pi = 3.14159265358979323846;
+  const double radius = spacing * double(count) / (2. * pi);
+
+  Coords<D> coords{};
+  for (auto& axis : coords)
+    axis.resize(count);
+  for (std::size_t i = 0; i < count; ++i) {
+    const double angle = 2. * pi * double(i) / double(count);
+    coords[0][i] = radius * std::cos(angle);
+    coords[1][i] = radius * std::sin(angle);
+    if constexpr (D == 3)
+      coords[2][i] = spacing * double(i) / double(count);
+  }
+  return coords;
+}
+
+template <std::size_t D>
+double pair_distance(const Coords<D>& coords, uint32_t lhs, uint32_t rhs)
+{
+  double distance2 = 0.;
+  for (std::size_t axis = 0; axis < D; ++axis) {
+    const double delta = coords[axis][lhs] - coords[axis][rhs];
+    distance2 += delta * delta;
+  }
+  return std::sqrt(distance2);
+}
+
+/** weighted sum of squared differences between distances in `coords`
+ *  and those of `terms`, each pair counted from both ends.
+ */
+template <std::size_t D>
+double stress_of(const StressTerms& terms, const Coords<D>& coords,
+                 unsigned threads)
+{
+  return parallel_sum(terms.node_count(), [&](std::size_t node) {
+    double sum = 0.;
+    for (auto i = terms.offsets[node]; i < terms.offsets[node + 1]; ++i) {
+      const double error =
+        pair_distance<D>(coords, uint32_t(node), terms.others[i])
+        - terms.distances[i];
+      sum += terms.weights[i] * error * error;
+    }
+    return sum;
+  }, threads);
+}
+
+/** scales `coords` by what minimizes stress along rays from the origin,
+ *  so that a start of any size is as good as it can be.
+ */
+template <std::size_t D>
+void fit_scale(const StressTerms& terms, Coords<D>& coords, unsigned threads)
+{
+  const auto sum = [&](bool squared) {
+    return parallel_sum(terms.node_count(), [&](std::size_t node) {
+      double sum = 0.;
+      for (auto i = terms.offsets[node]; i < terms.offsets[node + 1]; ++i) {
+        const double distance =
+          pair_distance<D>(coords, uint32_t(node), terms.others[i]);
+        sum += terms.weights[i]
+             * (squared ? distance * distance
+                        : distance * terms.distances[i]);
+      }
+      return sum;
+    }, threads);
+  };
+
+  const double squares = sum(true);
+  if (!(squares > 0.))
+    return;
+
+  const double scale = sum(false) / squares;
+  for (auto& axis : coords)
+    for (auto& value : axis)
+      value *= scale;
+}
+
+/** solves `multiply(x) = b` for a symmetric positive semidefinite
+ *  operator by conjugate gradient, from `x` as given, preconditioned by
+ *  the inverse of its diagonal.
+ *
+ * @returns count of iterations made.
+ */
+template <typename F>
+std::size_t conjugate_gradient(F&& multiply, const std::vector<double>& b,
+                               const std::vector<double>& inverse_diagonal,
+                               std::vector<double>& x, double tolerance,
+                               std::size_t max_iterations, unsigned threads)
+{
+  const std::size_t count = b.size();
+
+  const auto dot = [&](const std::vector<double>& lhs,
+                       const std::vector<double>& rhs) {
+    return parallel_sum(count, [&](std::size_t i) { return lhs[i] * rhs[i]; },
+                        threads);
+  };
+  const auto update = [&](auto&& func) {
+    parallel::parallel_for(count, [&](std::size_t begin, std::size_t end) {
+      for (std::size_t i = begin; i < end; ++i)
+        func(i);
+    }, 4096, threads);
+  };
+
+  const double limit = tolerance * tolerance * dot(b, b);
+  if (!(limit > 0.))
+    return 0;
+
+  std::vector<double> residual(count), direction(count), product(count);
+  std::vector<double> preconditioned(count);
+  multiply(x, product);
+  update([&](std::size_t i) {
+    residual[i]       = b[i] - product[i];
+    preconditioned[i] = residual[i] * inverse_diagonal[i];
+    direction[i]      = preconditioned[i];
+  });
+
+  double squared = dot(residual, residual);
+  double along   = dot(residual, preconditioned);
+  std::size_t iteration = 0;
+  while (iteration < max_iterations && squared > limit) {
+    ++iteration;
+
+    multiply(direction, product);
+    const double curvature = dot(direction, product);
+    if (!(curvature > 0.))
+      break;
+
+    const double step = along / curvature;
+    update([&](std::size_t i) {
+      x[i]              += step * direction[i];
+      residual[i]       -= step * product[i];
+      preconditioned[i]  = residual[i] * inverse_diagonal[i];
+    });
+
+    squared = dot(residual, residual);
+    const double next = dot(residual, preconditioned);
+    const double beta = next / along;
+    along = next;
+    update([&](std::size_t i) {
+      direction[i] = preconditioned[i] + beta * direction[i];
+    });
+  }
+  return iteration;
+}
+
+/** moves nodes at `coords` by stress majorization, as described by
+ *  Gansner et al. in "Graph Drawing by Stress Majorization": each
+ *  iteration solves the weighted Laplacian against the current layout's
+ *  distances for each axis.
+ *
+ * @returns count of iterations made.
+ */
+template <std::size_t D>
+std::size_t majorize(const StressTerms& terms, Coords<D>& coords,
+                     const StressOptions& options)
+{
+  const std::size_t count   = terms.node_count();
+  const unsigned    threads = options.threads;
+  const double      epsilon =
+    options.epsilon.value_or(default_stress_epsilon);
+  const auto maxiter = std::size_t(
+    std::max(options.maxiter.value_or(default_stress_maxiter), 0));
+
+  // the weighted Laplacian, its diagonal being sums of rows' weights.
+  std::vector<double> diagonal(count), inverse_diagonal(count);
+  for (std::size_t node = 0; node < count; ++node) {
+    diagonal[node] = std::accumulate(
+      terms.weights.begin() + terms.offsets[node],
+      terms.weights.begin() + terms.offsets[node + 1], 0.);
+    inverse_diagonal[node] = diagonal[node] > 0. ? 1. / diagonal[node] : 0.;
+  }
+
+  const auto laplacian = [&](const std::vector<double>& in,
+                             std::vector<double>& out) {
+    parallel::parallel_for(count, [&](std::size_t begin, std::size_t end) {
+      for (std::size_t node = begin; node < end; ++node) {
+        double sum = 0.;
+        for (auto i = terms.offsets[node]; i < terms.offsets[node + 1]; ++i)
+          sum += terms.weights[i] * in[terms.others[i]];
+        out[node] = diagonal[node] * in[node] - sum;
+      }
+    }, 1024, threads);
+  };
+
+  std::vector<double> right(count);
+  std::vector<double> lengths(terms.others.size());
+  double stress = stress_of<D>(terms, coords, threads);
+
+  std::size_t iteration = 0;
+  while (iteration < maxiter) {
+    ++iteration;
+
+    // current distances, the same for all axes.
+    parallel::parallel_for(count, [&](std::size_t begin, std::size_t end) {
+      for (std::size_t node = begin; node < end; ++node)
+        for (auto i = terms.offsets[node]; i < terms.offsets[node + 1]; ++i)
+          lengths[i] = pair_distance<D>(coords, uint32_t(node),
+                                        terms.others[i]);
+    }, 1024, threads);
+
+    for (std::size_t axis = 0; axis < D; ++axis) {
+      const auto& values = coords[axis];
+      parallel::parallel_for(count, [&](std::size_t begin, std::size_t end) {
+        for (std::size_t node = begin; node < end; ++node) {
+          double sum = 0.;
+          for (auto i = terms.offsets[node]; i < terms.offsets[node + 1];
+               ++i)
+            if (lengths[i] > 0.)
+              sum += terms.weights[i] * terms.distances[i]
+                   * (values[node] - values[terms.others[i]]) / lengths[i];
+          right[node] = sum;
+        }
+      }, 1024, threads);
+
+      conjugate_gradient(laplacian, right, inverse_diagonal, coords[axis],
+                         solver_tolerance, solver_maxiter, threads);
+    }
+
+    const double next = stress_of<D>(terms, coords, threads);
+    const bool   done = stress - next < epsilon * stress;
+    stress = next;
+    if (done)
+      break;
+  }
+  return iteration;
+}
+
+template <std::size_t D>
+Layout stress(const LayoutGraph& graph, const StressOptions& options)
+{
+  const std::size_t count = graph.node_count();
+  if (count == 0)
+    return Layout{};
+
+  const double outside = default_distance(graph, options);
+  const auto   seed    = uint32_t(options.start.seed);
+
+  std::vector<std::vector<double>> rows{};
+  const auto pivots = choose_pivots(graph, std::max<std::size_t>(
+                                      options.pivots, D + 1),
+                                    seed, outside, rows);
+
+  const auto terms = count > options.sparse_threshold
+                   ? sparse_terms(graph, pivots, rows)
+                   : full_terms(graph, options);
+
+  Coords<D> coords{};
+  switch (options.start.style) {
+    case attrtypes::StartTypeStyle::random:
+      coords = random_coords<D>(count, 1., seed);
+      break;
+    case attrtypes::StartTypeStyle::regular:
+      coords = regular_coords<D>(count, 1.);
+      break;
+    default:
+      coords = pivot_mds<D>(rows, count, seed);
+  }
+  rows.clear();
+
+  fit_scale<D>(terms, coords, options.threads);
+  majorize<D>(terms, coords, options);
+  return make_layout<D>(graph, coords);
+}
+
+}  // namespace detail
+
+/** lays out `graph` by stress majorization, in the manner of neato's
+ *  default mode: nodes are placed so that their distances match those
+ *  of the graph, weighted by their inverse square.
+ *
+ * up to `sparse_threshold` nodes, distances between all pairs are found
+ * by a search from each node across threads. beyond that, only those to
+ * a few pivots are, and the sparse stress model approximates the rest,
+ * taking memory and time linear in the count of nodes times pivots.
+ * nodes start where pivot MDS puts them unless `start` says otherwise.
+ *
+ * node positions are centers in points, the lower left corner of the
+ * drawing at the origin. edges are left straight.
+ *
+ * @throws std::invalid_argument if `dim` is neither 2 nor 3.
+ */
+inline Layout stress(const LayoutGraph& graph,
+                     const StressOptions& options = {})
+{
+  detail::check_dimensions(options.dim);
+  return options.dim == 3 ? detail::stress<3>(graph, options)
+                          : detail::stress<2>(graph, options);
+}
+
+/** lays out `graph` by `stress`, setting `pos` of its nodes.
+ *  graph attributes are given in `options`, see `make_layout_input`.
+ */
+template <typename GraphT>
+void stress_layout(GraphT& graph, const StressOptions& options = {})
+{
+  const auto input = make_layout_input(graph);
+  write_layout(graph, input, stress(input.graph, options));
+}
+
+}  // namespace gviz::layout
+
+#endif  // GVIZARD_LAYOUT_STRESS_HPP_
@@ -0,0 +1,112 @@
+#ifndef GVIZARD_PARALLEL_PARALLEL_FOR_HPP_
+#define GVIZARD_PARALLEL_PARALLEL_FOR_HPP_
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace gviz::parallel {
+
+/** count of threads to use when none is specified, at least 1. */
+inline unsigned default_concurrency() noexcept
+{
+  const auto count = std::thread::hardware_concurrency();
+  return count ? count : 1;
+}
+
+/** calls `func(begin, end)` on disjoint blocks covering [0, count).
+ *
+ * blocks of `grain` indices are handed out dynamically to at most
+ * `threads` workers (calling thread included), so uneven blocks
+ * still balance out. runs inline if a single block covers the range.
+ *
+ * the first exception thrown by `func` is rethrown after all workers
+ * are done, remaining blocks are skipped.
+ *
+ * @param count   size of index range.
+ * @param func    a callable taking a pair of `std::size_t` as [begin, end).
+ * @param grain   minimum count of indices given to `func` at once.
+ * @param threads maximum count of workers, 0 means default_concurrency().
+ */
+template <typename F>
+void parallel_for(std::size_t count, F&& func,
+                  std::size_t grain = 1024, unsigned threads = 0)
+{
+  if (count == 0)
+    return;
+
+  grain = std::max<std::size_t>(grain, 1);
+  threads = threads ? threads : default_concurrency();
+
+  const std::size_t blocks = (count + grain - 1) / grain;
+  const std::size_t workers_count = std::min<std::size_t>(blocks, threads);
+
+  if (workers_count <= 1) {
+    func(std::size_t(0), count);
+    return;
+  }
+
+  std::atomic<std::size_t> next{0};
+  std::atomic<bool>        failed{false};
+  std::exception_ptr       error{};
+  std::mutex               error_mutex{};
+
+  const auto worker = [&]() {
+    while (!failed.load(std::memory_order_relaxed)) {
+      const std::size_t begin = next.fetch_add(grain);
+      if (begin >= count)
+        return;
+
+      try {
+        func(begin, std::min(begin + grain, count));
+      }
+      catch (...) {
+        std::lock_guard<std::mutex> lock(error_mutex);
+        if (!error)
+          error = std::current_exception();
+        failed = true;
+      }
+    }
+  };
+
+  std::vector<std::thread> workers{};
+  workers.reserve(workers_count - 1);
+  for (std::size_t i = 1; i < workers_count; ++i)
+    workers.emplace_back(worker);
+
+  worker();
+
+  for (auto& thread : workers)
+    thread.join();
+
+  if (error)
+    std::rethrow_exception(error);
+}
+
+/** calls `func(index)` for each index in [0, count) across threads.
+ *
+ * @see parallel_for
+ */
+template <typename F>
+void parallel_for_each_index(std::size_t count, F&& func,
+                             std::size_t grain = 1024, unsigned threads = 0)
+{
+  parallel_for(
+    count,
+    [&func](std::size_t begin, std::size_t end) {
+      for (std::size_t i = begin; i < end; ++i)
+        func(i);
+    },
+    grain,
+    threads
+  );
+}
+
+}  // namespace gviz::parallel
+
+#endif  // GVIZARD_PARALLEL_PARALLEL_FOR_HPP_
@@ -0,0 +1,527 @@
+#ifndef GVIZARD_PASSES_BOUNDING_BOX_HPP_
+#define GVIZARD_PASSES_BOUNDING_BOX_HPP_
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <utility>
+#include <variant>
+#include <vector>
+
+#include "gvizard/attrtypes/point.hpp"
+#include "gvizard/attrtypes/rect.hpp"
+#include "gvizard/layout/layout_graph.hpp"
+#include "gvizard/parallel/parallel_for.hpp"
+#include "gvizard/simd/vec.hpp"
+
+#include "gvizard/attrs/boundingbox.hpp"
+#include "gvizard/attrs/height.hpp"
+#include "gvizard/attrs/pos.hpp"
+#include "gvizard/attrs/width.hpp"
+
+namespace gviz::passes {
+
+/** result of `compute_bounding_boxes`, boxes in points.
+ *
+ * items are sorted by entity, empty clusters and entities without
+ * `pos` being left out.
+ */
+template <typename EntityT>
+struct BoundingBoxes final {
+  struct Item final {
+    EntityT     entity;
+    layout::Box box;
+  };
+
+  /** box of everything drawn, if anything is. */
+  std::optional<layout::Box> graph{};
+
+  std::vector<Item> clusters{};
+  std::vector<Item> nodes{};
+  std::vector<Item> edges{};
+
+  /** box of `entity` among `items`, std::nullopt if it has none. */
+  static std::optional<layout::Box> find(const std::vector<Item>& items,
+                                         EntityT entity)
+  {
+    const auto iter = std::lower_bound(
+      items.begin(), items.end(), entity,
+      [](const Item& item, EntityT key) { return item.entity < key; });
+
+    if (iter == items.end() || iter->entity != entity)
+      return std::nullopt;
+    return iter->box;
+  }
+};
+
+namespace detail {
+
+constexpr std::size_t bezier_lanes = 4;
+
+using f64v  = simd::Vec<double, bezier_lanes>;
+using maskv = f64v::mask_type;
+
+// the kernel only pays off if a whole vector of doubles fits a register.
+constexpr bool use_kernels =
+  simd::has_native_vectors && simd::full_vector_bytes >= sizeof(f64v);
+
+// below this, the leading coefficient of a derivative is taken as 0.
+constexpr double tiny_coefficient = 1e-12;
+
+constexpr layout::Box no_box{ std::numeric_limits<double>::infinity(),
+                              std::numeric_limits<double>::infinity(),
+                              -std::numeric_limits<double>::infinity(),
+                              -std::numeric_limits<double>::infinity() };
+
+inline bool has_box(const layout::Box& box) noexcept
+{
+  return box.llx <= box.urx && box.lly <= box.ury;
+}
+
+inline void add_box(layout::Box& box, const layout::Box& other) noexcept
+{
+  box.llx = std::min(box.llx, other.llx);
+  box.lly = std::min(box.lly, other.lly);
+  box.urx = std::max(box.urx, other.urx);
+  box.ury = std::max(box.ury, other.ury);
+}
+
+/** x and y of `point`, without visiting it when it's 2D. */
+inline std::pair<double, double>
+xy_of(const attrtypes::PointType<double>& point) noexcept
+{
+  if (const auto *at = std::get_if<attrtypes::Point2D<double>>(&point.point))
+    return { at->x, at->y };
+
+  const auto& at = *std::get_if<attrtypes::Point3D<double>>(&point.point);
+  return { at.x, at.y };
+}
+
+inline void add_point(layout::Box& box,
+                      const attrtypes::PointType<double>& point) noexcept
+{
+  const auto [x, y] = xy_of(point);
+  box.llx = std::min(box.llx, x);
+  box.lly = std::min(box.lly, y);
+  box.urx = std::max(box.urx, x);
+  box.ury = std::max(box.ury, y);
+}
+
+/** least and greatest values of cubic Béziers of control values `p0` to
+ *  `p3` over [0, 1], one per lane.
+ *
+ * beside the ends, extrema are where the derivative, `3 (a t^2 + b t +
+ * c)`, is 0 within (0, 1), found by the quadratic formula, or the
+ * linear one where `a` vanishes. as the value at any `t` in [0, 1] is
+ * on the curve, roots are clamped to it instead of being checked, and
+ * a negative discriminant to 0, so that no lane needs a branch.
+ */
+template <std::size_t N>
+inline void cubic_extent(const simd::Vec<double, N>& p0,
+                         const simd::Vec<double, N>& p1,
+                         const simd::Vec<double, N>& p2,
+                         const simd::Vec<double, N>& p3,
+                         simd::Vec<double, N>& low,
+                         simd::Vec<double, N>& high) noexcept
+{
+  using vec_type  = simd::Vec<double, N>;
+  using mask_type = typename vec_type::mask_type;
+
+  const vec_type zero  = vec_type::broadcast(0.);
+  const vec_type one   = vec_type::broadcast(1.);
+  const vec_type two   = vec_type::broadcast(2.);
+  const vec_type three = vec_type::broadcast(3.);
+
+  const vec_type a = p3 - p0 + (p1 - p2) * three;
+  const vec_type b = (p0 - p1 * two + p2) * two;
+  const vec_type c = p1 - p0;
+
+  low  = simd::min(p0, p3);
+  high = simd::max(p0, p3);
+
+  // the curve is `((a t + 3 b / 2) t + 3 c) t + p0`. NaN is clamped
+  // to 0, as `max` picks its second argument unless the first is
+  // greater.
+  const vec_type b_term = b * vec_type::broadcast(1.5);
+  const vec_type c_term = c * three;
+  const auto consider = [&](const vec_type& t) {
+    const vec_type at = simd::min(simd::max(t, zero), one);
+    const vec_type value = ((a * at + b_term) * at + c_term) * at + p0;
+    low  = simd::min(low, value);
+    high = simd::max(high, value);
+  };
+
+  const vec_type scale = simd::max(simd::max(zero - a, a),
+                                   simd::max(simd::max(zero - b, b),
+                                             simd::max(zero - c, c)));
+  const mask_type quadratic =
+    simd::max(zero - a, a) > scale * vec_type::broadcast(tiny_coefficient);
+
+  const vec_type disc = b * b - a * c * vec_type::broadcast(4.);
+  const vec_type root = simd::sqrt(simd::max(disc, zero));
+  const vec_type half = one / simd::select(quadratic, a * two, one);
+
+  consider((zero - b + root) * half);
+  consider((zero - b - root) * half);
+  consider((zero - c) / simd::select(b != zero, b, one));
+}
+
+/** `cubic_extent` of a single Bézier, for targets without the vectors. */
+inline void cubic_extent(double p0, double p1, double p2, double p3,
+                         double& low, double& high) noexcept
+{
+  low  = std::min(p0, p3);
+  high = std::max(p0, p3);
+
+  // curves stay within the hull of their control values, so between
+  // their ends if the inner two are.
+  if (std::min(p1, p2) >= low && std::max(p1, p2) <= high)
+    return;
+
+  const double a = p3 - p0 + (p1 - p2) * 3.;
+  const double b = (p0 - p1 * 2. + p2) * 2.;
+  const double c = p1 - p0;
+
+  // the curve is `((a t + 3 b / 2) t + 3 c) t + p0`.
+  const auto consider = [&](double t) {
+    t = std::min(std::max(0., t), 1.);
+    const double value = ((a * t + b * 1.5) * t + c * 3.) * t + p0;
+    low  = std::min(low, value);
+    high = std::max(high, value);
+  };
+
+  const double scale = std::max({ std::abs(a), std::abs(b), std::abs(c) });
+  if (std::abs(a) > scale * tiny_coefficient) {
+    const double root = std::sqrt(std::max(b * b - a * c * 4., 0.));
+    const double half = .5 / a;
+    consider((-b + root) * half);
+    consider((-b - root) * half);
+  }
+  else if (b != 0.) {
+    consider(-c / b);
+  }
+}
+
+/** box of the segment of control points `points`, x and y solved
+ *  together in a vector of 2 doubles, which is native to every target
+ *  with vectors at all.
+ */
+inline layout::Box segment_box(const double (&points)[4][2]) noexcept
+{
+  if constexpr (simd::has_native_vectors) {
+    using f64x2 = simd::Vec<double, 2>;
+    f64x2 low{}, high{};
+    cubic_extent(f64x2::load(points[0]), f64x2::load(points[1]),
+                 f64x2::load(points[2]), f64x2::load(points[3]), low,
+                 high);
+    return layout::Box{ low[0], low[1], high[0], high[1] };
+  }
+  else {
+    layout::Box box{};
+    cubic_extent(points[0][0], points[1][0], points[2][0], points[3][0],
+                 box.llx, box.urx);
+    cubic_extent(points[0][1], points[1][1], points[2][1], points[3][1],
+                 box.lly, box.ury);
+    return box;
+  }
+}
+
+/** control points of cubic Bézier segments, one array per coordinate of
+ *  each of the 4 points, padded to a multiple of `bezier_lanes`.
+ */
+struct BezierSoA final {
+  std::array<std::vector<double>, 4> xs{};
+  std::array<std::vector<double>, 4> ys{};
+
+  void resize(std::size_t count)
+  {
+    const std::size_t padded =
+      (count + bezier_lanes - 1) / bezier_lanes * bezier_lanes;
+    for (auto& axis : xs)
+      axis.assign(padded, 0.);
+    for (auto& axis : ys)
+      axis.assign(padded, 0.);
+  }
+
+  std::size_t padded_size() const noexcept { return xs[0].size(); }
+};
+
+/** boxes of the curves of segments `[begin, end)` of `segments`, both a
+ *  multiple of `bezier_lanes`, into `out`, `bezier_lanes` at a time.
+ */
+inline void bezier_boxes_kernel(const BezierSoA& segments,
+                                std::size_t begin, std::size_t end,
+                                layout::Box *out) noexcept
+{
+  std::array<double, bezier_lanes> llx{}, lly{}, urx{}, ury{};
+  for (std::size_t i = begin; i < end; i += bezier_lanes) {
+    f64v low{}, high{};
+    cubic_extent(f64v::load(segments.xs[0].data() + i),
+                 f64v::load(segments.xs[1].data() + i),
+                 f64v::load(segments.xs[2].data() + i),
+                 f64v::load(segments.xs[3].data() + i), low, high);
+    low.store(llx.data());
+    high.store(urx.data());
+
+    cubic_extent(f64v::load(segments.ys[0].data() + i),
+                 f64v::load(segments.ys[1].data() + i),
+                 f64v::load(segments.ys[2].data() + i),
+                 f64v::load(segments.ys[3].data() + i), low, high);
+    low.store(lly.data());
+    high.store(ury.data());
+
+    for (std::size_t lane = 0; lane < bezier_lanes; ++lane)
+      out[i + lane] = layout::Box{ llx[lane], lly[lane], urx[lane],
+                                   ury[lane] };
+  }
+}
+
+/** `bezier_boxes_kernel` one segment at a time. */
+inline void bezier_boxes_scalar(const BezierSoA& segments,
+                                std::size_t begin, std::size_t end,
+                                layout::Box *out) noexcept
+{
+  for (std::size_t i = begin; i < end; ++i) {
+    auto& box = out[i];
+    cubic_extent(segments.xs[0][i], segments.xs[1][i], segments.xs[2][i],
+                 segments.xs[3][i], box.llx, box.urx);
+    cubic_extent(segments.ys[0][i], segments.ys[1][i], segments.ys[2][i],
+                 segments.ys[3][i], box.lly, box.ury);
+  }
+}
+
+inline void bezier_boxes(const BezierSoA& segments, std::size_t begin,
+                         std::size_t end, layout::Box *out) noexcept
+{
+  if constexpr (use_kernels)
+    bezier_boxes_kernel(segments, begin, end, out);
+  else
+    bezier_boxes_scalar(segments, begin, end, out);
+}
+
+}  // namespace detail
+
+/** computes bounding boxes of nodes, edges, clusters and the whole of
+ *  `graph`, as drawn where `pos` puts them.
+ *
+ * nodes span their `width` and `height` around their point. edges span
+ * the curves of their splines, tight at their extrema rather than their
+ * control points, and their arrow ends. clusters span their nodes and
+ * edges between those, and the graph spans clusters and everything
+ * outside them.
+ *
+ * where the target has vectors of 4 doubles, control points of
+ * segments are gathered into one array per coordinate, a block of
+ * edges at a time, and their extrema found several segments at a
+ * time. elsewhere each segment is solved as it's read, its x and y
+ * together. edges are processed in parallel over blocks. the graph
+ * must not be modified during the pass.
+ *
+ * @param threads maximum count of threads, 0 means default.
+ */
+template <typename GraphT>
+auto compute_bounding_boxes(const GraphT& graph, unsigned threads = 0)
+  -> BoundingBoxes<typename GraphT::entity_type>
+{
+  using entity_type = typename GraphT::entity_type;
+  using result_type = BoundingBoxes<entity_type>;
+  using item_type   = typename result_type::Item;
+  using splines_type = attrtypes::SplineType<std::vector>;
+
+  constexpr std::size_t grain = 4096;
+  constexpr std::size_t segments_per_block = 512;
+  constexpr auto none = std::numeric_limits<uint32_t>::max();
+
+  // each view walks all entities, so the one of clusters only if
+  // there are any. views of ordered maps are sorted already.
+  std::vector<entity_type> nodes{}, edges{}, clusters{};
+  nodes.reserve(graph.node_count());
+  edges.reserve(graph.edge_count());
+  for (auto node : graph.nodes_view())
+    nodes.push_back(node);
+  for (auto edge : graph.edges_view())
+    edges.push_back(edge);
+  if (graph.cluster_count() > 0)
+    for (auto cluster : graph.clusters_view())
+      clusters.push_back(cluster);
+
+  for (auto *ids : { &nodes, &edges, &clusters })
+    if (!std::is_sorted(ids->begin(), ids->end()))
+      std::sort(ids->begin(), ids->end());
+
+  const auto index_of = [](const std::vector<entity_type>& ids,
+                           entity_type id) {
+    return uint32_t(std::lower_bound(ids.begin(), ids.end(), id)
+                    - ids.begin());
+  };
+
+  // nodes, and the clusters they're in.
+  std::vector<layout::Box> node_boxes(nodes.size(), detail::no_box);
+  std::vector<uint32_t>    node_clusters(nodes.size(), none);
+  parallel::parallel_for_each_index(nodes.size(), [&](std::size_t i) {
+    if (const auto cluster = clusters.empty()
+                           ? std::nullopt : graph.get_node_cluster(nodes[i]))
+      node_clusters[i] = index_of(clusters, *cluster);
+
+    const auto pos = graph.template get_entity_attr<attrs::Pos>(nodes[i]);
+    if (!pos || !pos->get_value())
+      return;
+    const auto *point =
+      std::get_if<attrtypes::PointType<double>>(&*pos->get_value());
+    if (!point)
+      return;
+
+    const auto [x, y] = detail::xy_of(*point);
+    const double hx = layout::detail::get_or_default<attrs::Width>(
+                        graph, nodes[i]) * layout::points_per_inch / 2.;
+    const double hy = layout::detail::get_or_default<attrs::Height>(
+                        graph, nodes[i]) * layout::points_per_inch / 2.;
+    node_boxes[i] = layout::Box{ x - hx, y - hy, x + hx, y + hy };
+  }, grain, threads);
+
+  // edges, their segments gathered a block at a time into arrays small
+  // enough to stay in cache, boxed together and folded into the boxes
+  // of their edges.
+  std::vector<layout::Box> edge_boxes(edges.size(), detail::no_box);
+  std::vector<uint32_t>    edge_clusters(edges.size(), none);
+  parallel::parallel_for(edges.size(),
+                         [&](std::size_t begin, std::size_t end) {
+    // without the kernel, segments are boxed where they're read.
+    constexpr std::size_t block =
+      detail::use_kernels ? segments_per_block : 0;
+    detail::BezierSoA        segments{};
+    std::vector<uint32_t>    owners(block);
+    std::vector<layout::Box> boxes(block);
+    std::size_t used = 0;
+    segments.resize(block);
+
+    const auto flush = [&] {
+      if (used == 0)
+        return;
+      const std::size_t padded = (used + detail::bezier_lanes - 1)
+                               / detail::bezier_lanes * detail::bezier_lanes;
+      detail::bezier_boxes(segments, 0, padded, boxes.data());
+      for (std::size_t s = 0; s < used; ++s)
+        detail::add_box(edge_boxes[owners[s]], boxes[s]);
+      used = 0;
+    };
+
+    for (std::size_t i = begin; i < end; ++i) {
+      if (const auto ends = clusters.empty()
+                          ? std::nullopt : graph.get_edge_nodes(edges[i])) {
+        const auto tail = node_clusters[index_of(nodes, ends->first)];
+        if (tail == node_clusters[index_of(nodes, ends->second)])
+          edge_clusters[i] = tail;
+      }
+
+      const auto pos = graph.template get_entity_attr<attrs::Pos>(edges[i]);
+      const auto *splines = pos && pos->get_value()
+                          ? std::get_if<splines_type>(&*pos->get_value())
+                          : nullptr;
+      if (!splines)
+        continue;
+
+      for (const auto& spline : splines->splines) {
+        detail::add_point(edge_boxes[i], spline.point);
+        if (spline.startp)
+          detail::add_point(edge_boxes[i], *spline.startp);
+        if (spline.endp)
+          detail::add_point(edge_boxes[i], *spline.endp);
+
+        auto previous = detail::xy_of(spline.point);
+        for (const auto& [first, second, third] : spline.triples) {
+          const auto p1 = detail::xy_of(first);
+          const auto p2 = detail::xy_of(second);
+          const auto p3 = detail::xy_of(third);
+          const double points[4][2] = {
+            { previous.first, previous.second }, { p1.first, p1.second },
+            { p2.first, p2.second }, { p3.first, p3.second } };
+          previous = p3;
+
+          if constexpr (detail::use_kernels) {
+            if (used == block)
+              flush();
+            for (std::size_t k = 0; k < 4; ++k) {
+              segments.xs[k][used] = points[k][0];
+              segments.ys[k][used] = points[k][1];
+            }
+            owners[used++] = uint32_t(i);
+          }
+          else {
+            detail::add_box(edge_boxes[i], detail::segment_box(points));
+          }
+        }
+      }
+    }
+    flush();
+  }, grain, threads);
+
+  // clusters from their nodes and edges, the graph from clusters and
+  // what is outside them.
+  std::vector<layout::Box> cluster_boxes(clusters.size(), detail::no_box);
+  layout::Box whole = detail::no_box;
+
+  const auto add_to = [&](const layout::Box& box, uint32_t cluster) {
+    if (!detail::has_box(box))
+      return;
+    detail::add_box(cluster == none ? whole : cluster_boxes[cluster], box);
+  };
+  for (std::size_t i = 0; i < nodes.size(); ++i)
+    add_to(node_boxes[i], node_clusters[i]);
+  for (std::size_t i = 0; i < edges.size(); ++i)
+    add_to(edge_boxes[i], edge_clusters[i]);
+  for (const auto& box : cluster_boxes)
+    add_to(box, none);
+
+  result_type result{};
+  if (detail::has_box(whole))
+    result.graph = whole;
+
+  const auto collect = [](const std::vector<entity_type>& ids,
+                          const std::vector<layout::Box>& boxes,
+                          std::vector<item_type>& out) {
+    out.reserve(ids.size());
+    for (std::size_t i = 0; i < ids.size(); ++i)
+      if (detail::has_box(boxes[i]))
+        out.push_back(item_type{ ids[i], boxes[i] });
+  };
+  collect(clusters, cluster_boxes, result.clusters);
+  collect(nodes, node_boxes, result.nodes);
+  collect(edges, edge_boxes, result.edges);
+  return result;
+}
+
+/** sets `bb` of clusters of `graph` by `compute_bounding_boxes`,
+ *  unsetting it for clusters with nothing drawn.
+ *
+ * `attrtypes::Rect` holds no negative values, so clusters reaching
+ * below the origin are left unset as well. as there are no graph
+ * attributes, the box of the whole graph is returned with the rest.
+ */
+template <typename GraphT>
+auto set_bounding_boxes(GraphT& graph, unsigned threads = 0)
+  -> BoundingBoxes<typename GraphT::entity_type>
+{
+  auto result = compute_bounding_boxes(graph, threads);
+
+  for (auto cluster : graph.clusters_view()) {
+    const auto box = result.find(result.clusters, cluster);
+    const auto rect = box ? attrtypes::Rect::make(box->llx, box->lly,
+                                                  box->urx, box->ury)
+                          : std::nullopt;
+    if (rect)
+      graph.template set_entity_attr<attrs::BoundingBox>(
+        cluster, attrs::BoundingBox(rect));
+    else
+      graph.template remove_entity_attr<attrs::BoundingBox>(cluster);
+  }
+  return result;
+}
+
+}  // namespace gviz::passes
+
+#endif  // GVIZARD_PASSES_BOUNDING_BOX_HPP_
@@ -0,0 +1,313 @@
+#ifndef GVIZARD_PASSES_EXPAND_LABELS_HPP_
+#define GVIZARD_PASSES_EXPAND_LABELS_HPP_
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "gvizard/attrtypes/escstring.hpp"
+#include "gvizard/parallel/parallel_for.hpp"
+
+#include "gvizard/attrs/head_related.hpp"
+#include "gvizard/attrs/label_related.hpp"
+#include "gvizard/attrs/tail_related.hpp"
+#include "gvizard/attrs/xlabel.hpp"
+
+namespace gviz::passes {
+
+/** label-like attributes that are expanded by `expand_labels`. */
+enum class LabelKind : uint8_t { label = 0, xlabel, headlabel, taillabel };
+
+/** result of `expand_labels`, all expanded strings of a graph
+ *  residing in one arena.
+ *
+ * items are sorted by entity and then by kind.
+ */
+template <typename EntityT>
+class ExpandedLabels final {
+ public:
+  struct Item final {
+    EntityT     entity;
+    LabelKind   kind;
+    std::size_t offset;
+    std::size_t size;
+  };
+
+ private:
+  std::unique_ptr<char[]> arena_{};
+  std::size_t             arena_size_ = 0;
+  std::vector<Item>       items_{};
+
+ public:
+  ExpandedLabels() = default;
+
+  ExpandedLabels(std::unique_ptr<char[]> arena, std::size_t arena_size,
+                 std::vector<Item> items)
+    : arena_(std::move(arena))
+    , arena_size_(arena_size)
+    , items_(std::move(items))
+  {}
+
+  const std::vector<Item>& items() const noexcept { return items_; }
+
+  std::size_t size()       const noexcept { return items_.size(); }
+  std::size_t arena_size() const noexcept { return arena_size_;   }
+
+  std::string_view str(const Item& item) const noexcept
+  {
+    return std::string_view(arena_.get() + item.offset, item.size);
+  }
+
+  /** expanded string of given entity's label of `kind`.
+   *
+   * @returns an optional containing the expanded string if entity had
+   *          that label set at expansion time, otherwise std::nullopt.
+   */
+  std::optional<std::string_view> find(EntityT entity, LabelKind kind) const
+  {
+    const auto iter = std::lower_bound(
+        items_.begin(), items_.end(), std::pair{entity, kind},
+        [](const Item& item, const std::pair<EntityT, LabelKind>& key) {
+          return item.entity < key.first
+              || (item.entity == key.first && item.kind < key.second);
+        }
+    );
+
+    if (iter == items_.end() || iter->entity != entity || iter->kind != kind)
+      return std::nullopt;
+
+    return str(*iter);
+  }
+};
+
+namespace detail {
+
+template <typename GraphT, typename Attr>
+std::optional<std::string_view>
+get_label_format(const GraphT& graph, typename GraphT::entity_type entity)
+{
+  const auto attr = graph.template get_entity_attr<Attr>(entity);
+  if (!attr)
+    return std::nullopt;
+
+  const auto& value = attr->get_value();
+  using value_type = std::decay_t<decltype(value)>;
+
+  if constexpr (std::is_convertible_v<const value_type&, std::string_view>)
+    return std::string_view(value);
+  else
+    return std::string_view(value.get_format_ref());
+}
+
+template <typename GraphT>
+std::optional<std::string_view>
+get_label_format(const GraphT& graph, typename GraphT::entity_type entity,
+                 LabelKind kind)
+{
+  switch (kind) {
+    case LabelKind::label:
+      if (auto format = get_label_format<GraphT, attrs::Label>(graph, entity))
+        return format;
+      return get_label_format<GraphT, attrs::LabelView>(graph, entity);
+    case LabelKind::xlabel:
+      return get_label_format<GraphT, attrs::XLabel>(graph, entity);
+    case LabelKind::headlabel:
+      return get_label_format<GraphT, attrs::HeadLabel>(graph, entity);
+    case LabelKind::taillabel:
+      return get_label_format<GraphT, attrs::TailLabel>(graph, entity);
+  }
+
+  return std::nullopt;
+}
+
+constexpr LabelKind label_kinds[] = {
+  LabelKind::label, LabelKind::xlabel,
+  LabelKind::headlabel, LabelKind::taillabel
+};
+
+struct ExpandJob final {
+  std::string_view format{};
+  std::string_view label{};
+  std::string_view first{};   // node name, or edge's tail name.
+  std::string_view second{};  // edge's head name.
+  std::size_t      offset = 0;
+  std::size_t      size   = 0;
+  LabelKind        kind   = LabelKind::label;
+  bool             is_edge = false;
+};
+
+}  // namespace detail
+
+/** expands `\G`, `\N`, `\E`, `\L`, `\H` and `\T` escapes of all
+ *  Label, XLabel, HeadLabel and TailLabel attributes of nodes and edges.
+ *
+ * each entity's EscNameSetRef is built from `node_name` and `graph_name`,
+ * an edge is named "tail->head" (or "tail--head" on undirected graphs),
+ * and `\L` refers to the entity's unexpanded Label (or LabelView).
+ *
+ * attribute lookups, sizing, and expansion run in parallel over
+ * the entities, writing into a single shared arena.
+ * the graph must not be modified during the pass.
+ *
+ * @param graph      graph to expand labels of.
+ * @param node_name  a callable taking a NodeId and returning a
+ *                   `std::string_view` of the name of that node, which
+ *                   must stay valid until the pass returns.
+ * @param graph_name name substituted for `\G`.
+ * @param threads    maximum count of threads, 0 means default.
+ * @returns expanded strings of all the entities' labels.
+ */
+template <typename GraphT, typename NameF>
+auto expand_labels(const GraphT& graph, NameF&& node_name,
+                   std::string_view graph_name = {}, unsigned threads = 0)
+  -> ExpandedLabels<typename GraphT::entity_type>
+{
+  using entity_type = typename GraphT::entity_type;
+  using result_type = ExpandedLabels<entity_type>;
+  using item_type   = typename result_type::Item;
+
+  // names are kept as views while jobs are sized and expanded, so a
+  // returned std::string would be gone by then.
+  static_assert(
+    std::is_same_v<std::invoke_result_t<NameF&, typename GraphT::NodeId>,
+                   std::string_view>,
+    "node_name must return a std::string_view");
+
+  constexpr std::size_t grain = 4096;
+  constexpr std::string_view edge_op = GraphT::is_directed() ? "->" : "--";
+
+  // gather entities in sorted order so jobs come out sorted as well.
+  std::vector<std::pair<entity_type, bool>> entities{};
+  entities.reserve(graph.node_count() + graph.edge_count());
+
+  for (auto node_id : graph.nodes_view())
+    entities.emplace_back(node_id, false);
+
+  for (auto edge_id : graph.edges_view())
+    entities.emplace_back(edge_id, true);
+
+  std::sort(entities.begin(), entities.end());
+
+  // which labels each entity has, as bitmask of LabelKind.
+  std::vector<uint8_t>     masks(entities.size(), 0);
+  std::vector<std::size_t> first_job(entities.size() + 1, 0);
+
+  parallel::parallel_for_each_index(entities.size(), [&](std::size_t i) {
+    uint8_t mask = 0;
+    for (auto kind : detail::label_kinds)
+      if (detail::get_label_format(graph, entities[i].first, kind))
+        mask |= uint8_t(1u << uint8_t(kind));
+
+    masks[i] = mask;
+  }, grain, threads);
+
+  for (std::size_t i = 0; i < entities.size(); ++i) {
+    std::size_t count = 0;
+    for (uint8_t mask = masks[i]; mask; mask &= mask - 1)
+      ++count;
+
+    first_job[i+1] = first_job[i] + count;
+  }
+
+  std::vector<detail::ExpandJob> jobs(first_job.back());
+
+  const auto make_nameset =
+    [&](const detail::ExpandJob& job, std::string& scratch) {
+      auto nameset = attrtypes::EscNameSetRef{}.set_graph_str(graph_name)
+                                               .set_label_str(job.label);
+      if (!job.is_edge)
+        return nameset.set_node_str(job.first);
+
+      scratch.assign(job.first).append(edge_op).append(job.second);
+
+      return nameset.set_edge_str(scratch)
+                    .set_tail_str(job.first)
+                    .set_head_str(job.second);
+    };
+
+  // fill jobs and their upper bound sizes.
+  parallel::parallel_for(entities.size(),
+    [&](std::size_t begin, std::size_t end) {
+      std::string scratch{};
+
+      for (std::size_t i = begin; i < end; ++i) {
+        const auto [entity, is_edge] = entities[i];
+
+        detail::ExpandJob proto{};
+        proto.is_edge = is_edge;
+        proto.label =
+          detail::get_label_format(graph, entity, LabelKind::label)
+            .value_or(std::string_view{});
+
+        if (is_edge) {
+          const auto [tail_id, head_id] = *graph.get_edge_nodes(entity);
+          proto.first  = node_name(tail_id);
+          proto.second = node_name(head_id);
+        }
+        else {
+          proto.first = node_name(entity);
+        }
+
+        auto job_idx = first_job[i];
+        for (auto kind : detail::label_kinds) {
+          if (!(masks[i] & (1u << uint8_t(kind))))
+            continue;
+
+          auto& job = jobs[job_idx++];
+          job = proto;
+          job.kind = kind;
+          job.format = *detail::get_label_format(graph, entity, kind);
+          job.size = attrtypes::EscString<std::string_view>(job.format)
+                       .apply_size(make_nameset(job, scratch));
+        }
+      }
+    },
+    grain, threads
+  );
+
+  std::size_t arena_size = 0;
+  for (auto& job : jobs) {
+    job.offset = arena_size;
+    arena_size += job.size;
+  }
+
+  auto arena = std::make_unique<char[]>(arena_size ? arena_size : 1);
+
+  std::vector<item_type> items(jobs.size());
+
+  // expand each job into its own reserved region of the arena.
+  parallel::parallel_for(entities.size(),
+    [&](std::size_t begin, std::size_t end) {
+      std::string scratch{};
+
+      for (std::size_t i = begin; i < end; ++i) {
+        for (auto j = first_job[i]; j < first_job[i+1]; ++j) {
+          const auto& job = jobs[j];
+          const auto escstring =
+            attrtypes::EscString<std::string_view>(job.format);
+
+          char *out = arena.get() + job.offset;
+          char *out_end = escstring.apply_to(out, make_nameset(job, scratch));
+
+          items[j] = item_type{
+            entities[i].first, job.kind, job.offset, std::size_t(out_end - out)
+          };
+        }
+      }
+    },
+    grain, threads
+  );
+
+  return result_type(std::move(arena), arena_size, std::move(items));
+}
+
+}  // namespace gviz::passes
+
+#endif  // GVIZARD_PASSES_EXPAND_LABELS_HPP_
@@ -0,0 +1,638 @@
+#ifndef GVIZARD_PASSES_TRANSFORM_HPP_
+#define GVIZARD_PASSES_TRANSFORM_HPP_
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <variant>
+#include <vector>
+
+#include "gvizard/attrtypes/point.hpp"
+#include "gvizard/attrtypes/spline.hpp"
+#include "gvizard/layout/layout_graph.hpp"
+#include "gvizard/parallel/parallel_for.hpp"
+#include "gvizard/passes/bounding_box.hpp"
+#include "gvizard/simd/vec.hpp"
+#include "gvizard/utils.hpp"
+
+#include "gvizard/attrs/height.hpp"
+#include "gvizard/attrs/margin.hpp"
+#include "gvizard/attrs/normalize.hpp"
+#include "gvizard/attrs/pad.hpp"
+#include "gvizard/attrs/pos.hpp"
+#include "gvizard/attrs/ratio.hpp"
+#include "gvizard/attrs/size.hpp"
+#include "gvizard/attrs/width.hpp"
+
+namespace gviz::passes {
+
+namespace detail {
+
+constexpr double degree = 3.14159265358979323846 / 180.;
+
+}  // namespace detail
+
+/** an affine map of the plane, taking `(x, y)` to
+ *  `(xx x + xy y + dx, yx x + yy y + dy)`.
+ */
+struct Affine final {
+  double xx = 1., xy = 0., dx = 0.;
+  double yx = 0., yy = 1., dy = 0.;
+
+  static Affine translation(double x, double y) noexcept
+  {
+    return Affine{ 1., 0., x, 0., 1., y };
+  }
+
+  static Affine scaling(double x, double y) noexcept
+  {
+    return Affine{ x, 0., 0., 0., y, 0. };
+  }
+
+  /** rotation by `degrees` counterclockwise around the origin, exact
+   *  for multiples of 90.
+   */
+  static Affine rotation(double degrees) noexcept
+  {
+    const double turns = degrees / 90.;
+    double cos = std::cos(degrees * detail::degree);
+    double sin = std::sin(degrees * detail::degree);
+    if (turns == std::floor(turns)) {
+      const auto quarter = (long long)(std::fmod(turns, 4.) + 4.) % 4;
+      cos = quarter == 0 ? 1. : quarter == 2 ? -1. : 0.;
+      sin = quarter == 1 ? 1. : quarter == 3 ? -1. : 0.;
+    }
+    return Affine{ cos, -sin, 0., sin, cos, 0. };
+  }
+
+  /** this map followed by `next`. */
+  Affine then(const Affine& next) const noexcept
+  {
+    return Affine{ next.xx * xx + next.xy * yx,
+                   next.xx * xy + next.xy * yy,
+                   next.xx * dx + next.xy * dy + next.dx,
+                   next.yx * xx + next.yy * yx,
+                   next.yx * xy + next.yy * yy,
+                   next.yx * dx + next.yy * dy + next.dy };
+  }
+
+  std::pair<double, double> operator()(double x, double y) const noexcept
+  {
+    return { xx * x + xy * y + dx, yx * x + yy * y + dy };
+  }
+};
+
+/** positions of laid out nodes and the points of edges' splines, one
+ *  array per coordinate so that they are transformed several at a
+ *  time, as `gather_geometry` collects them.
+ *
+ * the points of an entity are `[begin, end)` of its span. nodes come
+ * first, a point each, then edges, their splines' points in order:
+ * `point`, those of `triples`, then `startp` and `endp` if set. writers
+ * may read points from here rather than from `pos`.
+ */
+template <typename EntityT>
+struct GeometryBuffer final {
+  struct Span final {
+    EntityT  entity;
+    uint32_t begin;
+    uint32_t end;
+  };
+
+  std::vector<double> xs{};
+  std::vector<double> ys{};
+
+  /** third coordinates, if any node is 3D, otherwise empty. 2D points
+   *  have 0.
+   */
+  std::vector<double> zs{};
+
+  /** spans of nodes and edges with positions, sorted by entity. */
+  std::vector<Span> nodes{};
+  std::vector<Span> edges{};
+
+  std::size_t size() const noexcept { return xs.size(); }
+
+  /** count of points of nodes, which are the first ones. */
+  std::size_t node_points() const noexcept { return nodes.size(); }
+
+  /** span of `entity` among `spans`, nullptr if it has none. */
+  static const Span *find(const std::vector<Span>& spans, EntityT entity)
+  {
+    const auto iter = std::lower_bound(
+      spans.begin(), spans.end(), entity,
+      [](const Span& span, EntityT key) { return span.entity < key; });
+
+    if (iter == spans.end() || iter->entity != entity)
+      return nullptr;
+    return &*iter;
+  }
+
+  /** applies `map` to all points, several at a time. */
+  void apply(const Affine& map, unsigned threads = 0);
+
+  /** box of the points as `map` puts them, grown around the first
+   *  points by `halves_x` and `halves_y` if given, std::nullopt if
+   *  there are none.
+   */
+  std::optional<layout::Box>
+  extent(const Affine& map = Affine{},
+         const std::vector<double>& halves_x = {},
+         const std::vector<double>& halves_y = {},
+         unsigned threads = 0) const;
+};
+
+namespace detail {
+
+// points given to a thread at once.
+constexpr std::size_t transform_grain = 1 << 14;
+
+/** applies `map` to points `[begin, end)` of `xs` and `ys`. */
+inline void affine_points(double *xs, double *ys, std::size_t begin,
+                          std::size_t end, const Affine& map) noexcept
+{
+  std::size_t i = begin;
+  if constexpr (use_kernels) {
+    const f64v xx = f64v::broadcast(map.xx), xy = f64v::broadcast(map.xy);
+    const f64v yx = f64v::broadcast(map.yx), yy = f64v::broadcast(map.yy);
+    const f64v dx = f64v::broadcast(map.dx), dy = f64v::broadcast(map.dy);
+
+    for (; i + f64v::size <= end; i += f64v::size) {
+      const f64v x = f64v::load(xs + i);
+      const f64v y = f64v::load(ys + i);
+      (xx * x + xy * y + dx).store(xs + i);
+      (yx * x + yy * y + dy).store(ys + i);
+    }
+  }
+  for (; i < end; ++i)
+    std::tie(xs[i], ys[i]) = map(xs[i], ys[i]);
+}
+
+/** box of points `[begin, end)` as `map` puts them, grown by `hx` and
+ *  `hy` if not null, which are indexed from `begin`.
+ */
+inline layout::Box mapped_extent(const double *xs, const double *ys,
+                                 const double *hx, const double *hy,
+                                 std::size_t begin, std::size_t end,
+                                 const Affine& map) noexcept
+{
+  layout::Box box = no_box;
+  std::size_t i = begin;
+  if constexpr (use_kernels) {
+    const f64v xx = f64v::broadcast(map.xx), xy = f64v::broadcast(map.xy);
+    const f64v yx = f64v::broadcast(map.yx), yy = f64v::broadcast(map.yy);
+    const f64v dx = f64v::broadcast(map.dx), dy = f64v::broadcast(map.dy);
+    const f64v zero = f64v::broadcast(0.);
+
+    f64v llx = f64v::broadcast(no_box.llx), lly = f64v::broadcast(no_box.lly);
+    f64v urx = f64v::broadcast(no_box.urx), ury = f64v::broadcast(no_box.ury);
+    for (; i + f64v::size <= end; i += f64v::size) {
+      const f64v x  = f64v::load(xs + i);
+      const f64v y  = f64v::load(ys + i);
+      const f64v mx = xx * x + xy * y + dx;
+      const f64v my = yx * x + yy * y + dy;
+      const f64v wx = hx ? f64v::load(hx + (i - begin)) : zero;
+      const f64v wy = hy ? f64v::load(hy + (i - begin)) : zero;
+      llx = simd::min(llx, mx - wx);
+      urx = simd::max(urx, mx + wx);
+      lly = simd::min(lly, my - wy);
+      ury = simd::max(ury, my + wy);
+    }
+    for (std::size_t lane = 0; lane < f64v::size; ++lane)
+      add_box(box, layout::Box{ llx[lane], lly[lane], urx[lane],
+                                ury[lane] });
+  }
+  for (; i < end; ++i) {
+    const auto [x, y] = map(xs[i], ys[i]);
+    const double wx = hx ? hx[i - begin] : 0.;
+    const double wy = hy ? hy[i - begin] : 0.;
+    add_box(box, layout::Box{ x - wx, y - wy, x + wx, y + wy });
+  }
+  return box;
+}
+
+/** calls `func` with each point of `splines`, in the order of
+ *  `GeometryBuffer`.
+ */
+template <typename SplinesT, typename F>
+void for_each_spline_point(SplinesT& splines, F&& func)
+{
+  for (auto& spline : splines.splines) {
+    func(spline.point);
+    for (auto& [first, second, third] : spline.triples) {
+      func(first);
+      func(second);
+      func(third);
+    }
+    if (spline.startp)
+      func(*spline.startp);
+    if (spline.endp)
+      func(*spline.endp);
+  }
+}
+
+inline std::size_t spline_point_count(
+  const attrtypes::SplineType<std::vector>& splines) noexcept
+{
+  std::size_t count = 0;
+  for (const auto& spline : splines.splines)
+    count += 1 + spline.triples.size() * 3 + bool(spline.startp)
+           + bool(spline.endp);
+  return count;
+}
+
+inline void set_xy(attrtypes::PointType<double>& point, double x,
+                   double y) noexcept
+{
+  if (auto *at = std::get_if<attrtypes::Point2D<double>>(&point.point)) {
+    at->x = x;
+    at->y = y;
+  }
+  else {
+    auto& at3 = *std::get_if<attrtypes::Point3D<double>>(&point.point);
+    at3.x = x;
+    at3.y = y;
+  }
+}
+
+/** x and y of a value of `pad`, `margin` or `size`, in inches. */
+inline std::pair<double, double>
+inches_of(const std::variant<double, attrtypes::PointType<double>>& value)
+{
+  return utils::LambdaVisit(
+    value,
+    [](double both) { return std::make_pair(both, both); },
+    [](const attrtypes::PointType<double>& point) {
+      const auto at = attrtypes::Point2D<double>(point);
+      return std::make_pair(at.x, at.y);
+    });
+}
+
+}  // namespace detail
+
+template <typename EntityT>
+void GeometryBuffer<EntityT>::apply(const Affine& map, unsigned threads)
+{
+  parallel::parallel_for(size(), [&](std::size_t begin, std::size_t end) {
+    detail::affine_points(xs.data(), ys.data(), begin, end, map);
+  }, detail::transform_grain, threads);
+}
+
+template <typename EntityT>
+std::optional<layout::Box>
+GeometryBuffer<EntityT>::extent(const Affine& map,
+                                const std::vector<double>& halves_x,
+                                const std::vector<double>& halves_y,
+                                unsigned threads) const
+{
+  // boxes by block, as blocks start at multiples of the grain, merged
+  // in order so that the result doesn't depend on threads.
+  const std::size_t grain = detail::transform_grain;
+  std::vector<layout::Box> blocks((size() + grain - 1) / grain,
+                                  detail::no_box);
+
+  parallel::parallel_for(size(), [&](std::size_t begin, std::size_t end) {
+    auto& box = blocks[begin / grain];
+    const std::size_t halved =
+      std::clamp(std::min(halves_x.size(), halves_y.size()), begin, end);
+    if (begin < halved)
+      box = detail::mapped_extent(xs.data(), ys.data(),
+                                  halves_x.data() + begin,
+                                  halves_y.data() + begin, begin, halved,
+                                  map);
+    detail::add_box(box, detail::mapped_extent(xs.data(), ys.data(),
+                                               nullptr, nullptr, halved,
+                                               end, map));
+  }, grain, threads);
+
+  layout::Box whole = detail::no_box;
+  for (const auto& box : blocks)
+    detail::add_box(whole, box);
+  if (!detail::has_box(whole))
+    return std::nullopt;
+  return whole;
+}
+
+/** collects positions of nodes and points of edges' splines of
+ *  `graph` by `pos` into a `GeometryBuffer`.
+ *
+ * nodes without a point and edges without splines are left out. the
+ * graph must not be modified during the pass.
+ *
+ * @param threads maximum count of threads, 0 means default.
+ */
+template <typename GraphT>
+auto gather_geometry(const GraphT& graph, unsigned threads = 0)
+  -> GeometryBuffer<typename GraphT::entity_type>
+{
+  using entity_type  = typename GraphT::entity_type;
+  using buffer_type  = GeometryBuffer<entity_type>;
+  using span_type    = typename buffer_type::Span;
+  using splines_type = attrtypes::SplineType<std::vector>;
+  using found_type   = std::pair<entity_type, const attrs::PosType *>;
+
+  constexpr std::size_t grain = 4096;
+
+  // values of `pos` are looked up once, then read in order of entity.
+  std::vector<found_type> nodes{}, edges{};
+  bool three_d = false;
+  for (auto node : graph.nodes_view()) {
+    const auto pos = graph.template get_entity_attr<attrs::Pos>(node);
+    if (!pos || !pos->get_value())
+      continue;
+    const auto *point =
+      std::get_if<attrtypes::PointType<double>>(&*pos->get_value());
+    if (!point)
+      continue;
+    nodes.emplace_back(node, &pos->get_value());
+    three_d = three_d || point->point.index() == 1;
+  }
+  for (auto edge : graph.edges_view()) {
+    const auto pos = graph.template get_entity_attr<attrs::Pos>(edge);
+    if (pos && pos->get_value()
+        && std::holds_alternative<splines_type>(*pos->get_value()))
+      edges.emplace_back(edge, &pos->get_value());
+  }
+
+  const auto by_entity = [](const found_type& lhs, const found_type& rhs) {
+    return lhs.first < rhs.first;
+  };
+  std::sort(nodes.begin(), nodes.end(), by_entity);
+  std::sort(edges.begin(), edges.end(), by_entity);
+
+  const auto splines_of = [&](std::size_t i) -> const splines_type& {
+    return std::get<splines_type>(**edges[i].second);
+  };
+
+  // counts of points of edges, then their offsets.
+  buffer_type buffer{};
+  buffer.nodes.resize(nodes.size());
+  buffer.edges.resize(edges.size());
+  parallel::parallel_for_each_index(edges.size(), [&](std::size_t i) {
+    buffer.edges[i] = span_type{
+      edges[i].first, 0,
+      uint32_t(detail::spline_point_count(splines_of(i))) };
+  }, grain, threads);
+
+  uint32_t offset = 0;
+  for (std::size_t i = 0; i < nodes.size(); ++i) {
+    buffer.nodes[i] = span_type{ nodes[i].first, offset, offset + 1 };
+    ++offset;
+  }
+  for (auto& span : buffer.edges) {
+    span.begin = offset;
+    offset += span.end;
+    span.end = offset;
+  }
+
+  buffer.xs.resize(offset);
+  buffer.ys.resize(offset);
+  if (three_d)
+    buffer.zs.assign(offset, 0.);
+
+  const auto put = [&](std::size_t at,
+                       const attrtypes::PointType<double>& point) {
+    std::tie(buffer.xs[at], buffer.ys[at]) = detail::xy_of(point);
+    if (three_d)
+      if (const auto *at3 =
+            std::get_if<attrtypes::Point3D<double>>(&point.point))
+        buffer.zs[at] = at3->z;
+  };
+
+  parallel::parallel_for_each_index(nodes.size(), [&](std::size_t i) {
+    put(i, std::get<attrtypes::PointType<double>>(**nodes[i].second));
+  }, grain, threads);
+
+  parallel::parallel_for_each_index(edges.size(), [&](std::size_t i) {
+    std::size_t at = buffer.edges[i].begin;
+    detail::for_each_spline_point(
+      splines_of(i),
+      [&](const attrtypes::PointType<double>& point) { put(at++, point); });
+  }, grain, threads);
+
+  return buffer;
+}
+
+/** writes x and y of points of `buffer` back to `pos` of the nodes and
+ *  edges they were gathered from, whose points must not have been
+ *  added or removed since.
+ *
+ * @param threads maximum count of threads, 0 means default.
+ */
+template <typename GraphT>
+void scatter_geometry(GraphT& graph,
+                      const GeometryBuffer<typename GraphT::entity_type>&
+                        buffer,
+                      unsigned threads = 0)
+{
+  using splines_type = attrtypes::SplineType<std::vector>;
+
+  constexpr std::size_t grain = 4096;
+
+  const auto pos_of = [&](auto entity) {
+    return &*graph.template get_entity_attr<attrs::Pos>(entity)
+                  ->get_value();
+  };
+
+  parallel::parallel_for_each_index(buffer.nodes.size(), [&](std::size_t i) {
+    const auto& span = buffer.nodes[i];
+    detail::set_xy(
+      std::get<attrtypes::PointType<double>>(*pos_of(span.entity)),
+      buffer.xs[span.begin], buffer.ys[span.begin]);
+  }, grain, threads);
+
+  parallel::parallel_for_each_index(buffer.edges.size(), [&](std::size_t i) {
+    const auto& span = buffer.edges[i];
+    std::size_t at = span.begin;
+    detail::for_each_spline_point(
+      std::get<splines_type>(*pos_of(span.entity)),
+      [&](attrtypes::PointType<double>& point) {
+        detail::set_xy(point, buffer.xs[at], buffer.ys[at]);
+        ++at;
+      });
+  }, grain, threads);
+}
+
+/** parameters of `transform_layout`, defaults being those of the graph
+ *  attributes they're named after.
+ */
+struct TransformOptions final {
+  /** angle in degrees the first edge is turned to, none if false. */
+  attrs::NormalizeType normalize = attrs::Normalize::get_default_value();
+
+  /** wanted height to width ratio, or "fill" or "expand" with `size`.
+   *  "compress" and "auto" need the layout redone and are ignored.
+   */
+  attrs::RatioType ratio = attrs::Ratio::get_default_value();
+
+  /** most width and height of the drawing in inches. */
+  attrs::SizeType size = attrs::Size::get_default_value();
+
+  /** the drawing is turned by 90 degrees if 90. */
+  int rotate = 0;
+
+  /** same as `rotate` of 90 if true. */
+  bool landscape = false;
+
+  /** space left around the drawing in inches. */
+  attrs::PadType pad = attrs::Pad::get_default_value();
+
+  /** space left around the drawing in inches, beside `pad`. */
+  attrs::MarginType margin = attrs::Margin::get_default_value();
+
+  /** maximum count of threads, 0 means default_concurrency(). */
+  unsigned threads = 0;
+};
+
+/** finishes a layout of `graph` as graphviz does after laying out:
+ *  turned by `normalize`, scaled by `ratio` and `size`, turned by
+ *  `rotate`, and moved so that its box is `pad` and `margin` off the
+ *  origin.
+ *
+ * points of nodes and splines are gathered into a `GeometryBuffer`,
+ * the transforms composed into a single map and applied to all of
+ * them several at a time, and the results written back to `pos`. nodes
+ * keep their sizes, only their positions being scaled, as graphviz's
+ * `ratio` does. `bb` of clusters isn't updated, see
+ * `set_bounding_boxes`.
+ *
+ * @returns the map applied to all points.
+ */
+template <typename GraphT>
+Affine transform_layout(GraphT& graph, const TransformOptions& options)
+{
+  auto buffer = gather_geometry(graph, options.threads);
+  if (buffer.size() == 0)
+    return Affine{};
+
+  std::vector<double> halves_x(buffer.node_points());
+  std::vector<double> halves_y(buffer.node_points());
+  for (std::size_t i = 0; i < buffer.nodes.size(); ++i) {
+    const auto node = buffer.nodes[i].entity;
+    halves_x[i] = layout::detail::get_or_default<attrs::Width>(graph, node)
+                * layout::points_per_inch / 2.;
+    halves_y[i] = layout::detail::get_or_default<attrs::Height>(graph, node)
+                * layout::points_per_inch / 2.;
+  }
+
+  // turned around the tail of the first edge whose ends are placed
+  // apart, edges being in order of creation.
+  Affine map{};
+  const auto angle = utils::LambdaVisit(
+    options.normalize,
+    [](bool on) { return on ? std::optional<double>(0.) : std::nullopt; },
+    [](double degrees) { return std::optional<double>(degrees); });
+  if (angle) {
+    std::vector<typename GraphT::entity_type> edges{};
+    for (auto edge : graph.edges_view())
+      edges.push_back(edge);
+    std::sort(edges.begin(), edges.end());
+
+    for (const auto edge : edges) {
+      const auto ends = graph.get_edge_nodes(edge);
+      const auto *tail = ends ? buffer.find(buffer.nodes, ends->first)
+                              : nullptr;
+      const auto *head = ends ? buffer.find(buffer.nodes, ends->second)
+                              : nullptr;
+      if (!tail || !head)
+        continue;
+
+      const double x = buffer.xs[tail->begin];
+      const double y = buffer.ys[tail->begin];
+      const double ex = buffer.xs[head->begin] - x;
+      const double ey = buffer.ys[head->begin] - y;
+      if (ex == 0. && ey == 0.)
+        continue;
+
+      const double current = std::atan2(ey, ex) / detail::degree;
+      map = Affine::translation(-x, -y)
+              .then(Affine::rotation(*angle - current))
+              .then(Affine::translation(x, y));
+      break;
+    }
+  }
+
+  // scaled from the origin by factors of the box so far.
+  const auto box = *buffer.extent(map, halves_x, halves_y, options.threads);
+  const double width  = box.width();
+  const double height = box.height();
+  const auto size = options.size
+                  ? std::optional(detail::inches_of(*options.size))
+                  : std::nullopt;
+  double sx = 1., sy = 1.;
+
+  const auto to_ratio = [&](double wanted) {
+    if (!(wanted > 0.) || !(width > 0.) || !(height > 0.))
+      return;
+    const double actual = height / width;
+    if (actual < wanted)
+      sy = wanted / actual;
+    else
+      sx = actual / wanted;
+  };
+
+  if (options.ratio)
+    utils::LambdaVisit(
+      *options.ratio,
+      [&](double wanted) { to_ratio(wanted); },
+      [&](const std::string& mode) {
+        if (!size || !(width > 0.) || !(height > 0.))
+          return;
+        const double wide = size->first * layout::points_per_inch;
+        const double high = size->second * layout::points_per_inch;
+        if (mode == "fill") {
+          if (wide > width && high > height) {
+            sx = wide / width;
+            sy = high / height;
+          }
+          else {
+            to_ratio(high / wide);
+          }
+        }
+        else if (mode == "expand") {
+          const double scale = std::min(wide / width, high / height);
+          if (scale > 1.)
+            sx = sy = scale;
+        }
+      });
+
+  if (size && width > 0. && height > 0.) {
+    const double scale =
+      std::min(size->first * layout::points_per_inch / (width * sx),
+               size->second * layout::points_per_inch / (height * sy));
+    if (scale > 0. && scale < 1.) {
+      sx *= scale;
+      sy *= scale;
+    }
+  }
+  map = map.then(Affine::scaling(sx, sy));
+
+  if (options.landscape || options.rotate == 90)
+    map = map.then(Affine::rotation(90.));
+
+  // moved to leave pad and margin below and left of the box.
+  const auto placed =
+    *buffer.extent(map, halves_x, halves_y, options.threads);
+  auto [pad_x, pad_y] = detail::inches_of(options.pad);
+  if (options.margin) {
+    const auto [margin_x, margin_y] = detail::inches_of(*options.margin);
+    pad_x += margin_x;
+    pad_y += margin_y;
+  }
+  map = map.then(
+    Affine::translation(pad_x * layout::points_per_inch - placed.llx,
+                        pad_y * layout::points_per_inch - placed.lly));
+
+  buffer.apply(map, options.threads);
+  scatter_geometry(graph, buffer, options.threads);
+  return map;
+}
+
+}  // namespace gviz::passes
+
+#endif  // GVIZARD_PASSES_TRANSFORM_HPP_
@@ -0,0 +1,387 @@
+#ifndef GVIZARD_RENDER_GEOMETRY_HPP_
+#define GVIZARD_RENDER_GEOMETRY_HPP_
+
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <limits>
+#include <utility>
+
+#include "gvizard/attrtypes/arrowtype.hpp"
+#include "gvizard/attrtypes/point.hpp"
+#include "gvizard/attrtypes/shape.hpp"
+
+namespace gviz::render {
+
+/** a point in graph coordinates, in points with y growing upwards. */
+using Point = attrtypes::Point2D<double>;
+
+/** axis aligned box in graph coordinates, empty until expanded. */
+struct Box final {
+  double llx =  std::numeric_limits<double>::infinity();
+  double lly =  std::numeric_limits<double>::infinity();
+  double urx = -std::numeric_limits<double>::infinity();
+  double ury = -std::numeric_limits<double>::infinity();
+
+  constexpr static Box around(const Point& center,
+                              double half_width, double half_height) noexcept
+  {
+    return Box{ center.x - half_width, center.y - half_height,
+                center.x + half_width, center.y + half_height };
+  }
+
+  constexpr bool empty() const noexcept { return llx > urx || lly > ury; }
+
+  constexpr double width()  const noexcept { return empty() ? 0. : urx - llx; }
+  constexpr double height() const noexcept { return empty() ? 0. : ury - lly; }
+
+  constexpr Box& expand(const Point& point) noexcept
+  {
+    llx = point.x < llx ? point.x : llx;
+    lly = point.y < lly ? point.y : lly;
+    urx = point.x > urx ? point.x : urx;
+    ury = point.y > ury ? point.y : ury;
+    return *this;
+  }
+
+  constexpr Box& expand(const Box& other) noexcept
+  {
+    if (!other.empty()) {
+      expand(Point{ other.llx, other.lly });
+      expand(Point{ other.urx, other.ury });
+    }
+    return *this;
+  }
+
+  constexpr Box& pad(double margin) noexcept
+  {
+    if (!empty()) {
+      llx -= margin;
+      lly -= margin;
+      urx += margin;
+      ury += margin;
+    }
+    return *this;
+  }
+
+  constexpr bool intersects(const Box& other) const noexcept
+  {
+    return llx <= other.urx && other.llx <= urx
+        && lly <= other.ury && other.lly <= ury;
+  }
+
+  constexpr bool operator==(const Box& other) const noexcept
+  {
+    return llx == other.llx && lly == other.lly
+        && urx == other.urx && ury == other.ury;
+  }
+
+  constexpr bool operator!=(const Box& other) const noexcept
+  {
+    return !(*this == other);
+  }
+};
+
+// node outlines
+
+enum class OutlineKind : uint8_t { none = 0, ellipse, polygon };
+
+/** how a node shape is drawn, polygon vertices are counter clockwise
+ *  and span [-1, 1] on both axes, to be scaled by half the node's size.
+ */
+struct Outline final {
+  OutlineKind  kind        = OutlineKind::none;
+  const Point *vertices    = nullptr;
+  std::size_t  count       = 0;
+  int          peripheries = 1;  // shape's default count of peripheries
+};
+
+/** gap between a node's peripheries, as graphviz's. */
+constexpr double periphery_gap = 4.;
+
+namespace detail {
+
+template <std::size_t N>
+using Polygon = std::array<Point, N>;
+
+/** stretches `polygon` to span [-1, 1] on both axes. */
+template <std::size_t N>
+Polygon<N> normalized(Polygon<N> polygon)
+{
+  Box box{};
+  for (const auto& point : polygon)
+    box.expand(point);
+
+  for (auto& point : polygon)
+    point = Point{ (2. * point.x - box.llx - box.urx) / box.width(),
+                   (2. * point.y - box.lly - box.ury) / box.height() };
+
+  return polygon;
+}
+
+/** regular polygon standing on a horizontal edge. */
+template <std::size_t N>
+Polygon<N> regular()
+{
+  const double pi = std::acos(-1.);
+
+  Polygon<N> polygon{};
+  for (std::size_t i = 0; i < N; ++i) {
+    const double angle =
+      -pi / 2. + pi / double(N) + 2. * pi * double(i) / double(N);
+    polygon[i] = Point{ std::cos(angle), std::sin(angle) };
+  }
+
+  return normalized(polygon);
+}
+
+template <std::size_t N>
+Polygon<N> flipped(Polygon<N> polygon)
+{
+  // flipping upside down turns the winding, so order is reversed too.
+  Polygon<N> ret{};
+  for (std::size_t i = 0; i < N; ++i)
+    ret[i] = Point{ polygon[N - 1 - i].x, -polygon[N - 1 - i].y };
+
+  return ret;
+}
+
+struct OutlineTables final {
+  Polygon<4>  box{ { { -1., -1. }, { 1., -1. }, { 1., 1. }, { -1., 1. } } };
+  Polygon<4>  diamond{ { { 0., -1. }, { 1., 0. }, { 0., 1. }, { -1., 0. } } };
+  Polygon<4>  trapezium{
+    { { -1., -1. }, { 1., -1. }, { .5, 1. }, { -.5, 1. } } };
+  Polygon<4>  parallelogram{
+    { { -1., -1. }, { .5, -1. }, { 1., 1. }, { -.5, 1. } } };
+  Polygon<5>  house{
+    { { -1., -1. }, { 1., -1. }, { 1., .2 }, { 0., 1. }, { -1., .2 } } };
+  Polygon<3>  triangle     = regular<3>();
+  Polygon<5>  pentagon     = regular<5>();
+  Polygon<6>  hexagon      = regular<6>();
+  Polygon<7>  septagon     = regular<7>();
+  Polygon<8>  octagon      = regular<8>();
+  Polygon<3>  invtriangle  = flipped(triangle);
+  Polygon<4>  invtrapezium = flipped(trapezium);
+  Polygon<5>  invhouse     = flipped(house);
+  Polygon<10> star         = make_star();
+
+  static Polygon<10> make_star()
+  {
+    const double pi = std::acos(-1.);
+
+    Polygon<10> polygon{};
+    for (std::size_t i = 0; i < 10; ++i) {
+      const double angle  = pi / 2. + pi * double(i) / 5.;
+      const double radius = i % 2 == 0 ? 1. : .382;
+      polygon[i] = Point{ radius * std::cos(angle), radius * std::sin(angle) };
+    }
+
+    return normalized(polygon);
+  }
+};
+
+inline const OutlineTables& outline_tables()
+{
+  static const OutlineTables tables{};
+  return tables;
+}
+
+template <std::size_t N>
+Outline polygon_outline(const Polygon<N>& polygon, int peripheries = 1)
+{
+  return Outline{ OutlineKind::polygon, polygon.data(), N, peripheries };
+}
+
+}  // namespace detail
+
+/** outline of `shape`.
+ *
+ * shapes without a polygon of their own (records, cylinders, notes,
+ * the synthetic biology ones...) are drawn as boxes, and `plaintext`,
+ * `plain`, `none` and `underline` have no outline.
+ */
+inline Outline outline_of(attrtypes::ShapeType shape)
+{
+  using attrtypes::ShapeType;
+  using detail::polygon_outline;
+
+  const auto& tables = detail::outline_tables();
+
+  switch (shape) {
+    case ShapeType::ellipse:
+    case ShapeType::oval:
+    case ShapeType::circle:
+    case ShapeType::point:
+    case ShapeType::egg:
+    case ShapeType::Mcircle:
+      return Outline{ OutlineKind::ellipse };
+    case ShapeType::doublecircle:
+      return Outline{ OutlineKind::ellipse, nullptr, 0, 2 };
+
+    case ShapeType::none:
+    case ShapeType::plaintext:
+    case ShapeType::plain:
+    case ShapeType::underline:
+      return Outline{ OutlineKind::none, nullptr, 0, 0 };
+
+    case ShapeType::traingle:      return polygon_outline(tables.triangle);
+    case ShapeType::invtriangle:   return polygon_outline(tables.invtriangle);
+    case ShapeType::diamond:
+    case ShapeType::Mdiamond:      return polygon_outline(tables.diamond);
+    case ShapeType::trapezium:     return polygon_outline(tables.trapezium);
+    case ShapeType::invtrapezium:  return polygon_outline(tables.invtrapezium);
+    case ShapeType::parallelogram: return polygon_outline(tables.parallelogram);
+    case ShapeType::house:         return polygon_outline(tables.house);
+    case ShapeType::invhouse:      return polygon_outline(tables.invhouse);
+    case ShapeType::pentagon:      return polygon_outline(tables.pentagon);
+    case ShapeType::hexagon:       return polygon_outline(tables.hexagon);
+    case ShapeType::septagon:      return polygon_outline(tables.septagon);
+    case ShapeType::octagon:       return polygon_outline(tables.octagon);
+    case ShapeType::doubleoctagon: return polygon_outline(tables.octagon, 2);
+    case ShapeType::tripleoctagon: return polygon_outline(tables.octagon, 3);
+    case ShapeType::star:          return polygon_outline(tables.star);
+
+    default:
+      return polygon_outline(tables.box);
+  }
+}
+
+// arrowheads
+
+/** length of a single arrow shape at arrowsize 1, as graphviz's. */
+constexpr double arrow_length = 10.;
+
+/** half width of an arrow shape relative to its length. */
+constexpr double arrow_width = .35;
+
+enum class PartKind : uint8_t { polygon = 0, polyline, ellipse };
+
+/** a primitive of an arrowhead, in graph coordinates.
+ *
+ * ellipses are given by their center and radii as first two points.
+ */
+struct ArrowPart final {
+  PartKind             kind   = PartKind::polygon;
+  bool                 filled = true;
+  std::array<Point, 4> points{};
+  std::size_t          count  = 0;
+};
+
+/** calls `emit(const ArrowPart&)` for each primitive of `arrow`, drawn
+ *  from `base`, where the edge ends, to `tip` touching the node.
+ *
+ * its shapes are stacked starting at the tip, as graphviz does. `curve`
+ * and `icurve` are approximated by polylines.
+ */
+template <typename F>
+void for_each_arrow_part(const attrtypes::ArrowType& arrow,
+                         const Point& base, const Point& tip,
+                         double arrowsize, F&& emit)
+{
+  using attrtypes::ArrowPrimaryShape;
+  using attrtypes::ArrowSide;
+
+  const double dx  = base.x - tip.x;
+  const double dy  = base.y - tip.y;
+  const double len = std::hypot(dx, dy);
+  if (!(len > 0.))
+    return;
+
+  // unit vector from tip towards base, and its left normal.
+  const Point along{ dx / len, dy / len };
+  const Point normal{ -along.y, along.x };
+
+  const double length = arrow_length * arrowsize;
+  const double width  = arrow_width * length;
+
+  double offset = 0.;
+
+  for (const auto& shape : arrow.as_array()) {
+    if (shape.shape == ArrowPrimaryShape::none)
+      break;
+
+    const auto side   = shape.modifier.side;
+    const bool filled = shape.modifier.open == attrtypes::ArrowOpen::none;
+
+    // from (distance from tip, offset to the left) to graph coordinates,
+    // a side modifier keeps only that half of the shape.
+    const auto at = [&](double t, double s) {
+      if (side == ArrowSide::left)  s = s < 0. ? 0. : s;
+      if (side == ArrowSide::right) s = s > 0. ? 0. : s;
+
+      t += offset;
+      return Point{ tip.x + t * along.x + s * normal.x,
+                    tip.y + t * along.y + s * normal.y };
+    };
+
+    const auto polygon = [&](std::initializer_list<Point> local,
+                             bool fill = true) {
+      ArrowPart part{ PartKind::polygon, filled && fill };
+      for (const auto& point : local)
+        part.points[part.count++] = at(point.x, point.y);
+      emit(std::as_const(part));
+    };
+
+    const auto polyline = [&](std::initializer_list<Point> local) {
+      ArrowPart part{ PartKind::polyline, false };
+      for (const auto& point : local)
+        part.points[part.count++] = at(point.x, point.y);
+      emit(std::as_const(part));
+    };
+
+    const double l = length;
+    const double w = width;
+
+    switch (shape.shape) {
+      case ArrowPrimaryShape::normal:
+        polygon({ { 0., 0. }, { l, -w }, { l, w } });
+        break;
+      case ArrowPrimaryShape::inv:
+        polygon({ { l, 0. }, { 0., w }, { 0., -w } });
+        break;
+      case ArrowPrimaryShape::box:
+        polygon({ { 0., -w }, { l, -w }, { l, w }, { 0., w } });
+        break;
+      case ArrowPrimaryShape::diamond:
+        polygon({ { 0., 0. }, { l / 2., -w }, { l, 0. }, { l / 2., w } });
+        break;
+      case ArrowPrimaryShape::vee:
+        polygon({ { 0., 0. }, { l, -w }, { .75 * l, 0. }, { l, w } });
+        break;
+      case ArrowPrimaryShape::crow:
+        polygon({ { l, 0. }, { 0., w }, { .25 * l, 0. }, { 0., -w } });
+        break;
+      case ArrowPrimaryShape::tee:
+        polygon({ { .1 * l, -w }, { .3 * l, -w }, { .3 * l, w },
+                  { .1 * l, w } });
+        polyline({ { 0., 0. }, { l, 0. } });
+        break;
+      case ArrowPrimaryShape::curve:
+        polyline({ { .6 * l, -w }, { .2 * l, 0. }, { .6 * l, w } });
+        polyline({ { 0., 0. }, { l, 0. } });
+        break;
+      case ArrowPrimaryShape::icurve:
+        polyline({ { .2 * l, -w }, { .6 * l, 0. }, { .2 * l, w } });
+        polyline({ { 0., 0. }, { l, 0. } });
+        break;
+      case ArrowPrimaryShape::dot: {
+        ArrowPart part{ PartKind::ellipse, filled };
+        part.points[0] = at(l / 2., 0.);
+        part.points[1] = Point{ .4 * l, .4 * l };
+        part.count     = 2;
+        emit(std::as_const(part));
+        break;
+      }
+      default:
+        break;
+    }
+
+    offset += length;
+  }
+}
+
+}  // namespace gviz::render
+
+#endif  // GVIZARD_RENDER_GEOMETRY_HPP_
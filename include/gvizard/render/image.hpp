@@ -0,0 +1,267 @@
+#ifndef GVIZARD_RENDER_IMAGE_HPP_
+#define GVIZARD_RENDER_IMAGE_HPP_
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+// PNG data is deflated by zlib if the build found it (see CMakeLists.txt),
+// otherwise it is stored uncompressed, which any decoder reads as well.
+#if defined(GVIZARD_HAS_ZLIB)
+# include <zlib.h>
+#endif
+
+#include "gvizard/colors/rgba.hpp"
+
+namespace gviz::render {
+
+/** a bitmap of RGBA pixels, rows from top to bottom.
+ *
+ * pixels are packed in `RGBA::to_binary` layout, see `PackedColor`.
+ */
+class Image final {
+  std::size_t           width_  = 0;
+  std::size_t           height_ = 0;
+  std::vector<uint32_t> pixels_{};
+
+ public:
+  Image() = default;
+
+  Image(std::size_t width, std::size_t height,
+        const colors::RGBA& fill = colors::RGBA{ 255, 255, 255, 255 })
+    : width_(width)
+    , height_(height)
+    , pixels_(width * height, fill.to_binary())
+  {}
+
+  std::size_t width()  const noexcept { return width_; }
+  std::size_t height() const noexcept { return height_; }
+
+  uint32_t       *data()       noexcept { return pixels_.data(); }
+  const uint32_t *data() const noexcept { return pixels_.data(); }
+
+  uint32_t       *row(std::size_t y)       noexcept
+  {
+    return pixels_.data() + y * width_;
+  }
+  const uint32_t *row(std::size_t y) const noexcept
+  {
+    return pixels_.data() + y * width_;
+  }
+
+  colors::RGBA at(std::size_t x, std::size_t y) const noexcept
+  {
+    return colors::RGBA::from_binary(row(y)[x]);
+  }
+
+  void fill(const colors::RGBA& color)
+  {
+    pixels_.assign(pixels_.size(), color.to_binary());
+  }
+};
+
+namespace detail {
+
+constexpr auto crc32_table = []() {
+  std::array<uint32_t, 256> table{};
+  for (uint32_t i = 0; i < 256; ++i) {
+    uint32_t crc = i;
+    for (int bit = 0; bit < 8; ++bit)
+      crc = crc & 1 ? 0xedb88320u ^ (crc >> 1) : crc >> 1;
+    table[i] = crc;
+  }
+  return table;
+}();
+
+inline uint32_t crc32(uint32_t crc, const uint8_t *data,
+                      std::size_t size) noexcept
+{
+  crc = ~crc;
+  for (std::size_t i = 0; i < size; ++i)
+    crc = crc32_table[(crc ^ data[i]) & 0xff] ^ (crc >> 8);
+  return ~crc;
+}
+
+inline uint32_t adler32(const uint8_t *data, std::size_t size) noexcept
+{
+  // largest count of bytes summed before the sums can overflow.
+  constexpr std::size_t block = 5552;
+
+  uint32_t lo = 1, hi = 0;
+  while (size != 0) {
+    const std::size_t count = size < block ? size : block;
+    for (std::size_t i = 0; i < count; ++i) {
+      lo += data[i];
+      hi += lo;
+    }
+    lo %= 65521;
+    hi %= 65521;
+    data += count;
+    size -= count;
+  }
+  return (hi << 16) | lo;
+}
+
+inline void put_be32(std::vector<uint8_t>& out, uint32_t value)
+{
+  out.push_back(uint8_t(value >> 24));
+  out.push_back(uint8_t(value >> 16));
+  out.push_back(uint8_t(value >> 8));
+  out.push_back(uint8_t(value));
+}
+
+/** zlib stream of `data` made of stored (uncompressed) deflate blocks. */
+inline std::vector<uint8_t> zlib_stored(const std::vector<uint8_t>& data)
+{
+  constexpr std::size_t max_block = 65535;
+
+  std::vector<uint8_t> out{ 0x78, 0x01 };
+  out.reserve(data.size() + data.size() / max_block * 5 + 16);
+
+  std::size_t done = 0;
+  do {
+    const std::size_t size = std::min(max_block, data.size() - done);
+    const bool        last = done + size == data.size();
+
+    out.push_back(uint8_t(last));
+    out.push_back(uint8_t(size));
+    out.push_back(uint8_t(size >> 8));
+    out.push_back(uint8_t(~size));
+    out.push_back(uint8_t(~size >> 8));
+    out.insert(out.end(), data.begin() + std::ptrdiff_t(done),
+               data.begin() + std::ptrdiff_t(done + size));
+    done += size;
+  } while (done != data.size());
+
+  put_be32(out, adler32(data.data(), data.size()));
+  return out;
+}
+
+inline std::vector<uint8_t> zlib_compress(const std::vector<uint8_t>& data,
+                                          int level)
+{
+#if defined(GVIZARD_HAS_ZLIB)
+  if (level != 0) {
+    auto size = compressBound(uLong(data.size()));
+    std::vector<uint8_t> out(size);
+    if (compress2(out.data(), &size, data.data(), uLong(data.size()),
+                  level < 0 ? Z_DEFAULT_COMPRESSION : level) == Z_OK) {
+      out.resize(size);
+      return out;
+    }
+  }
+#else
+  static_cast<void>(level);
+#endif
+  return zlib_stored(data);
+}
+
+inline void write_png_chunk(std::ostream& out, const char (&type)[5],
+                            const std::vector<uint8_t>& data)
+{
+  std::vector<uint8_t> head{};
+  put_be32(head, uint32_t(data.size()));
+  head.insert(head.end(), type, type + 4);
+
+  uint32_t crc = crc32(0, head.data() + 4, 4);
+  crc = crc32(crc, data.data(), data.size());
+
+  std::vector<uint8_t> tail{};
+  put_be32(tail, crc);
+
+  out.write(reinterpret_cast<const char *>(head.data()), 8);
+  out.write(reinterpret_cast<const char *>(data.data()),
+            std::streamsize(data.size()));
+  out.write(reinterpret_cast<const char *>(tail.data()), 4);
+}
+
+}  // namespace detail
+
+/** writes `image` as binary PPM (P6), which has no alpha channel, so
+ *  pixels are blended over white.
+ */
+inline void write_ppm(std::ostream& out, const Image& image)
+{
+  const std::string header = "P6\n" + std::to_string(image.width()) + ' '
+                           + std::to_string(image.height()) + "\n255\n";
+  out.write(header.data(), std::streamsize(header.size()));
+
+  std::vector<char> line(image.width() * 3);
+
+  for (std::size_t y = 0; y < image.height(); ++y) {
+    const uint32_t *row = image.row(y);
+    for (std::size_t x = 0; x < image.width(); ++x) {
+      const uint32_t pixel = row[x];
+      const uint32_t alpha = pixel >> 24;
+      const uint32_t white = 255 * (255 - alpha);
+
+      for (int channel = 0; channel < 3; ++channel) {
+        const uint32_t value = (pixel >> (16 - 8 * channel)) & 0xff;
+        line[x * 3 + std::size_t(channel)] =
+          char((value * alpha + white + 127) / 255);
+      }
+    }
+    out.write(line.data(), std::streamsize(line.size()));
+  }
+}
+
+/** true if `write_png` compresses, otherwise it stores pixels as is. */
+#if defined(GVIZARD_HAS_ZLIB)
+inline constexpr bool has_png_compression = true;
+#else
+inline constexpr bool has_png_compression = false;
+#endif
+
+/** writes `image` as 8 bit RGBA PNG.
+ *
+ * @param out   stream to write to, opened in binary mode.
+ * @param image image to write.
+ * @param level zlib compression level, -1 for zlib's default and 0 to
+ *              store pixels uncompressed, which is what is done anyway
+ *              without zlib (see `has_png_compression`).
+ * @throws std::invalid_argument if image is empty.
+ */
+inline void write_png(std::ostream& out, const Image& image, int level = -1)
+{
+  if (image.width() == 0 || image.height() == 0)
+    throw std::invalid_argument("png of empty image");
+
+  constexpr char signature[] = "\x89PNG\r\n\x1a\n";
+  out.write(signature, 8);
+
+  std::vector<uint8_t> header{};
+  detail::put_be32(header, uint32_t(image.width()));
+  detail::put_be32(header, uint32_t(image.height()));
+  header.insert(header.end(), { 8, 6, 0, 0, 0 });  // 8 bit RGBA
+  detail::write_png_chunk(out, "IHDR", header);
+
+  // each row is led by its filter type, none.
+  const std::size_t stride = image.width() * 4 + 1;
+  std::vector<uint8_t> raw(stride * image.height());
+
+  for (std::size_t y = 0; y < image.height(); ++y) {
+    uint8_t        *dst = raw.data() + y * stride;
+    const uint32_t *row = image.row(y);
+
+    *dst++ = 0;
+    for (std::size_t x = 0; x < image.width(); ++x) {
+      const uint32_t pixel = row[x];
+      *dst++ = uint8_t(pixel >> 16);
+      *dst++ = uint8_t(pixel >> 8);
+      *dst++ = uint8_t(pixel);
+      *dst++ = uint8_t(pixel >> 24);
+    }
+  }
+
+  detail::write_png_chunk(out, "IDAT", detail::zlib_compress(raw, level));
+  detail::write_png_chunk(out, "IEND", {});
+}
+
+}  // namespace gviz::render
+
+#endif  // GVIZARD_RENDER_IMAGE_HPP_
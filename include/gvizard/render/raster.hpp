@@ -0,0 +1,929 @@
+#ifndef GVIZARD_RENDER_RASTER_HPP_
+#define GVIZARD_RENDER_RASTER_HPP_
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <stdexcept>
+#include <string_view>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include "gvizard/attrtypes/rect.hpp"
+#include "gvizard/colors/batch.hpp"
+#include "gvizard/colors/gradient.hpp"
+#include "gvizard/colors/rgba.hpp"
+#include "gvizard/parallel/parallel_for.hpp"
+#include "gvizard/render/geometry.hpp"
+#include "gvizard/render/image.hpp"
+#include "gvizard/render/visuals.hpp"
+#include "gvizard/simd/vec.hpp"
+
+namespace gviz::render {
+
+struct RasterOptions final {
+  /** pixels per inch, graph coordinates are in points (1/72 inch). */
+  double dpi = 96.;
+
+  /** if not 0, the image is scaled down as needed to fit these. */
+  std::size_t max_width  = 0;
+  std::size_t max_height = 0;
+
+  /** whether edges of shapes are blended by how much of a pixel they
+   *  cover, otherwise pixels are either drawn or not.
+   */
+  bool antialias = true;
+
+  colors::RGBA background{ 255, 255, 255, 255 };
+
+  /** margin around the drawing, in points. */
+  double pad = 4.;
+
+  /** drawing's box (`bb`), by default the box of everything drawn. */
+  std::optional<attrtypes::Rect> bb{};
+
+  /** side of the square tiles rendered in parallel, in pixels. */
+  std::size_t tile_size = 64;
+
+  /** maximum count of threads, 0 means default_concurrency(). */
+  unsigned threads = 0;
+};
+
+namespace detail {
+
+/** a point in pixels, y growing downwards. */
+struct PixelPoint final {
+  float x = 0.f;
+  float y = 0.f;
+};
+
+/** a non horizontal line of a path's outline, from its top to its bottom. */
+struct RasterEdge final {
+  float   top;
+  float   bottom;
+  float   x;        // at top
+  float   slope;    // dx / dy
+  int32_t winding;  // +1 if the outline runs downwards, otherwise -1
+};
+
+/** how a path is painted, either in a solid color or by a gradient's
+ *  table, at t = (x - ox) * sx + (y - oy) * sy if linear, or at the length
+ *  of ((x - ox) * sx, (y - oy) * sy) if radial.
+ */
+struct RasterPaint final {
+  uint32_t color    = 0;    // packed RGBA
+  float    opacity  = 1.f;  // scales coverage, for lines thinner than a pixel
+  int32_t  gradient = -1;   // index of table, if any
+  bool     radial   = false;
+  float    ox = 0.f, oy = 0.f, sx = 0.f, sy = 0.f;
+};
+
+/** an outline filled by the nonzero rule, its edges and bounding box. */
+struct RasterPath final {
+  std::size_t first = 0;
+  std::size_t count = 0;
+  float       x0 = 0.f, y0 = 0.f, x1 = 0.f, y1 = 0.f;
+  RasterPaint paint{};
+};
+
+constexpr std::size_t gradient_steps = 256;
+
+using GradientTable = std::array<uint32_t, gradient_steps>;
+
+/** rows of a pixel sampled by anti-aliasing, horizontal coverage is exact. */
+constexpr int aa_samples = 4;
+
+/** count of lines curves are flattened to, at most a quarter pixel off. */
+inline std::size_t flatten_steps(float deviation) noexcept
+{
+  return std::size_t(std::clamp(std::ceil(std::sqrt(3.f * deviation)),
+                                1.f, 64.f));
+}
+
+}  // namespace detail
+
+/** draws visuals into an `Image` with a scanline rasterizer.
+ *
+ * shapes, lines and arrows are turned into outlines in pixels as they are
+ * drawn, each filled by the nonzero rule in a solid color or gradient.
+ * `render` then bins them into square tiles, which are rasterized in
+ * parallel, each painting its outlines in drawing order. coverage of a
+ * row is gathered first and blended into the image in SIMD lanes.
+ *
+ * labels aren't drawn.
+ */
+class RasterCanvas final {
+  using f32v = colors::batch::detail::f32v;
+  using i32v = colors::batch::detail::i32v;
+
+  constexpr static std::size_t lanes = colors::batch::detail::lanes;
+
+  using PixelPoint = detail::PixelPoint;
+  using Paint      = detail::RasterPaint;
+
+  Box         view_;
+  double      scale_;
+  std::size_t width_;
+  std::size_t height_;
+  bool        antialias_;
+
+  std::vector<detail::RasterEdge>    edges_{};
+  std::vector<detail::RasterPath>    paths_{};
+  std::vector<detail::GradientTable> gradients_{};
+
+  RGBAList                last_fill_{};  // colors of last gradient's table
+  std::vector<PixelPoint> points_{};     // outline being drawn
+
+ public:
+  /** a canvas showing `view` of the drawing in `width` x `height` pixels.
+   *
+   * @param view      part of the drawing shown, in graph coordinates.
+   * @param width     width of the image, in pixels.
+   * @param height    height of the image, in pixels.
+   * @param antialias whether edges of shapes are blended.
+   */
+  RasterCanvas(const Box& view, std::size_t width, std::size_t height,
+               bool antialias = true)
+    : view_(view)
+    , scale_(view.width() > 0. ? double(width) / view.width() : 1.)
+    , width_(width)
+    , height_(height)
+    , antialias_(antialias)
+  {}
+
+  std::size_t width()  const noexcept { return width_; }
+  std::size_t height() const noexcept { return height_; }
+
+  /** pixels per point. */
+  double scale() const noexcept { return scale_; }
+
+  /** count of outlines drawn so far. */
+  std::size_t path_count() const noexcept { return paths_.size(); }
+
+  PixelPoint to_pixels(const Point& point) const noexcept
+  {
+    return PixelPoint{ float((point.x - view_.llx) * scale_),
+                       float((view_.ury - point.y) * scale_) };
+  }
+
+  void draw_node(const NodeVisual& node)
+  {
+    const PixelPoint center = to_pixels(node.center);
+    const double     half_width  = node.width / 2. * scale_;
+    const double     half_height = node.height / 2. * scale_;
+
+    // as in SvgWriter, only the first periphery is filled.
+    const int rings = std::max(node.peripheries, 1);
+    for (int ring = 0; ring < rings; ++ring) {
+      const double gap = periphery_gap * double(ring) * scale_;
+
+      points_.clear();
+      if (node.outline.kind == OutlineKind::ellipse) {
+        add_ellipse(center, half_width + gap, half_height + gap);
+      }
+      else if (node.outline.kind == OutlineKind::polygon) {
+        for (std::size_t i = 0; i < node.outline.count; ++i) {
+          const auto& vertex = node.outline.vertices[i];
+          points_.push_back(PixelPoint{
+            float(center.x + vertex.x * (half_width + gap)),
+            float(center.y - vertex.y * (half_height + gap)) });
+        }
+      }
+      else {
+        return;
+      }
+
+      if (ring == 0 && !node.fill.empty())
+        fill(fill_paint(node.fill, node.radial, center,
+                        float(half_width), float(half_height)));
+
+      if (node.peripheries > 0)
+        stroke(true, node.penwidth * scale_, node.line, solid(node.pen));
+    }
+  }
+
+  void draw_edge(const EdgeVisual& edge)
+  {
+    if (!edge.splines)
+      return;
+
+    const Paint pen = solid(edge.pen);
+
+    for (const auto& spline : edge.splines->splines) {
+      points_.clear();
+      points_.push_back(to_pixels(Point(spline.point)));
+
+      for (const auto& [first, second, third] : spline.triples)
+        add_cubic(to_pixels(Point(first)), to_pixels(Point(second)),
+                  to_pixels(Point(third)));
+
+      stroke(false, edge.penwidth * scale_, edge.line, pen);
+
+      const Point last = spline.triples.empty()
+                       ? Point(spline.point)
+                       : Point(std::get<2>(spline.triples.back()));
+
+      if (spline.endp)
+        draw_arrow(edge, edge.head, last, Point(*spline.endp));
+      if (spline.startp)
+        draw_arrow(edge, edge.tail, Point(spline.point),
+                   Point(*spline.startp));
+    }
+  }
+
+  /** rasterizes everything drawn into `image`, over what it shows.
+   *
+   * @param image   image of the canvas' size.
+   * @param tile    side of tiles rendered in parallel, in pixels.
+   * @param threads maximum count of threads, 0 means default_concurrency().
+   * @throws std::invalid_argument if image isn't of the canvas' size.
+   */
+  void render(Image& image, std::size_t tile = 64, unsigned threads = 0) const
+  {
+    if (image.width() != width_ || image.height() != height_)
+      throw std::invalid_argument("image and canvas differ in size");
+
+    if (width_ == 0 || height_ == 0)
+      return;
+
+    tile = std::max<std::size_t>(tile, lanes);
+
+    const std::size_t columns = (width_ + tile - 1) / tile;
+    const std::size_t rows    = (height_ + tile - 1) / tile;
+
+    // paths overlapping each tile, in drawing order.
+    std::vector<std::vector<uint32_t>> bins(columns * rows);
+
+    const auto tile_of = [&](float pos, std::size_t count) {
+      const float index = std::floor(pos / float(tile));
+      return std::size_t(std::clamp(index, 0.f, float(count - 1)));
+    };
+
+    for (std::size_t i = 0; i < paths_.size(); ++i) {
+      const auto& path = paths_[i];
+      if (path.x1 <= 0.f || path.y1 <= 0.f
+          || path.x0 >= float(width_) || path.y0 >= float(height_))
+        continue;
+
+      const std::size_t col_end = tile_of(path.x1, columns);
+      const std::size_t row_end = tile_of(path.y1, rows);
+
+      for (std::size_t row = tile_of(path.y0, rows); row <= row_end; ++row)
+        for (std::size_t col = tile_of(path.x0, columns); col <= col_end;
+             ++col)
+          bins[row * columns + col].push_back(uint32_t(i));
+    }
+
+    parallel::parallel_for(bins.size(),
+      [&](std::size_t begin, std::size_t end) {
+        TileScratch scratch(tile);
+        for (std::size_t i = begin; i < end; ++i)
+          render_tile(image, (i % columns) * tile, (i / columns) * tile,
+                      tile, bins[i], scratch);
+      },
+      1, threads);
+  }
+
+ private:
+  struct Crossing final {
+    float   x;
+    int32_t winding;
+  };
+
+  /** buffers of a worker, reused across the tiles it renders. */
+  struct TileScratch final {
+    std::vector<float>                     coverage;
+    std::vector<const detail::RasterEdge*> active{};
+    std::vector<Crossing>                  crossings{};
+
+    explicit TileScratch(std::size_t tile)
+      : coverage(tile + lanes + 1, 0.f)
+    {}
+  };
+
+  // -- building outlines
+
+  static Paint solid(const colors::RGBA& color) noexcept
+  {
+    Paint paint{};
+    paint.color = color.to_binary();
+    return paint;
+  }
+
+  /** paint of a node's fill, a gradient across its box if it has several
+   *  colors, as SvgWriter's.
+   */
+  Paint fill_paint(const RGBAList& fill, bool radial, PixelPoint center,
+                   float half_width, float half_height)
+  {
+    if (fill.size() < 2)
+      return solid(fill.front().get_color());
+
+    // nodes usually share their fills, so consecutive ones share tables.
+    const bool same = fill.size() == last_fill_.size()
+      && std::equal(fill.begin(), fill.end(), last_fill_.begin(),
+                    [](const auto& lhs, const auto& rhs) {
+                      return lhs.get_color() == rhs.get_color()
+                          && lhs.get_weight() == rhs.get_weight();
+                    });
+
+    if (!same) {
+      gradients_.emplace_back();
+      colors::Gradient(fill).sample(detail::gradient_steps,
+                                    gradients_.back().data());
+      last_fill_ = fill;
+    }
+
+    Paint paint{};
+    paint.gradient = int32_t(gradients_.size() - 1);
+    paint.radial   = radial;
+
+    const float safe_width  = std::max(half_width, 1e-3f);
+    const float safe_height = std::max(half_height, 1e-3f);
+
+    if (radial) {
+      paint.ox = center.x;
+      paint.oy = center.y;
+      paint.sx = 1.f / safe_width;
+      paint.sy = 1.f / safe_height;
+    }
+    else {
+      paint.ox = center.x - safe_width;
+      paint.sx = .5f / safe_width;
+    }
+
+    return paint;
+  }
+
+  void add_ellipse(PixelPoint center, double rx, double ry)
+  {
+    constexpr double pi = 3.14159265358979323846;
+
+    const double radius = std::max(rx, ry);
+    const auto   steps  = std::size_t(
+      std::clamp(std::ceil(pi * std::sqrt(2. * radius)), 8., 256.));
+
+    // the unit vector is turned step by step instead of evaluating sines.
+    const double turn_cos = std::cos(2. * pi / double(steps));
+    const double turn_sin = std::sin(2. * pi / double(steps));
+
+    double cos = 1.;
+    double sin = 0.;
+    for (std::size_t i = 0; i < steps; ++i) {
+      points_.push_back(PixelPoint{ float(center.x + rx * cos),
+                                    float(center.y - ry * sin) });
+
+      const double next = cos * turn_cos - sin * turn_sin;
+      sin = sin * turn_cos + cos * turn_sin;
+      cos = next;
+    }
+  }
+
+  /** appends a bezier from the last point through `p1` and `p2` to `p3`. */
+  void add_cubic(PixelPoint p1, PixelPoint p2, PixelPoint p3)
+  {
+    const PixelPoint p0 = points_.back();
+
+    const float deviation = std::max(
+      std::hypot(p0.x - 2.f * p1.x + p2.x, p0.y - 2.f * p1.y + p2.y),
+      std::hypot(p1.x - 2.f * p2.x + p3.x, p1.y - 2.f * p2.y + p3.y));
+
+    const std::size_t steps = detail::flatten_steps(deviation);
+    for (std::size_t i = 1; i <= steps; ++i) {
+      const float t = float(i) / float(steps);
+      const float u = 1.f - t;
+
+      const float a = u * u * u;
+      const float b = 3.f * u * u * t;
+      const float c = 3.f * u * t * t;
+      const float d = t * t * t;
+
+      points_.push_back(PixelPoint{ a * p0.x + b * p1.x + c * p2.x + d * p3.x,
+                                    a * p0.y + b * p1.y + c * p2.y
+                                      + d * p3.y });
+    }
+  }
+
+  void add_line(PixelPoint from, PixelPoint to)
+  {
+    if (from.y == to.y || !std::isfinite(from.x + from.y + to.x + to.y))
+      return;
+
+    const int32_t winding = from.y < to.y ? 1 : -1;
+    if (winding < 0)
+      std::swap(from, to);
+
+    edges_.push_back(detail::RasterEdge{
+      from.y, to.y, from.x, (to.x - from.x) / (to.y - from.y), winding });
+  }
+
+  /** adds a closed outline, turned counter clockwise if `orient`, so
+   *  that overlapping pieces of a line don't cancel each other out.
+   */
+  void add_contour(const PixelPoint *points, std::size_t count,
+                   bool orient = false)
+  {
+    double area = 0.;
+    for (std::size_t i = 0; i < count; ++i) {
+      const auto& a = points[i];
+      const auto& b = points[(i + 1) % count];
+      area += double(a.x) * b.y - double(b.x) * a.y;
+    }
+
+    const bool reverse = orient && area < 0.;
+    for (std::size_t i = 0; i < count; ++i) {
+      const auto& a = points[i];
+      const auto& b = points[(i + 1) % count];
+      if (reverse)
+        add_line(b, a);
+      else
+        add_line(a, b);
+    }
+  }
+
+  /** turns edges added since `first` into a path painted by `paint`. */
+  void end_path(std::size_t first, const Paint& paint)
+  {
+    if (first == edges_.size())
+      return;
+
+    detail::RasterPath path{ first, edges_.size() - first };
+    path.x0 = path.y0 =  std::numeric_limits<float>::infinity();
+    path.x1 = path.y1 = -std::numeric_limits<float>::infinity();
+
+    for (std::size_t i = first; i < edges_.size(); ++i) {
+      const auto& edge = edges_[i];
+      const float x_end = edge.x + (edge.bottom - edge.top) * edge.slope;
+
+      path.x0 = std::min({ path.x0, edge.x, x_end });
+      path.x1 = std::max({ path.x1, edge.x, x_end });
+      path.y0 = std::min(path.y0, edge.top);
+      path.y1 = std::max(path.y1, edge.bottom);
+    }
+
+    path.paint = paint;
+    paths_.push_back(path);
+  }
+
+  /** fills the outline in `points_`. */
+  void fill(const Paint& paint)
+  {
+    if (paint.gradient < 0 && (paint.color >> 24) == 0)
+      return;
+
+    const std::size_t first = edges_.size();
+    add_contour(points_.data(), points_.size());
+    end_path(first, paint);
+  }
+
+  /** strokes the line through `points_`, as a quad per segment and
+   *  bevels where segments meet, all filled as one outline.
+   */
+  void stroke(bool closed, double width, LineStyle line, Paint paint)
+  {
+    if ((paint.color >> 24) == 0 || points_.size() < 2)
+      return;
+
+    // lines thinner than a pixel are drawn a pixel wide, but fainter.
+    if (width < 1.) {
+      if (antialias_)
+        paint.opacity *= float(std::max(width, .1));
+      width = 1.;
+    }
+
+    const float half = float(width / 2.);
+
+    // on and off lengths of dashes, as SvgWriter's dasharray.
+    float dash[2] = { 0.f, 0.f };
+    if (line == LineStyle::dashed) {
+      dash[0] = float(5. * scale_);
+      dash[1] = float(2. * scale_);
+    }
+    else if (line == LineStyle::dotted) {
+      dash[0] = float(1. * scale_);
+      dash[1] = float(5. * scale_);
+    }
+    bool dashed = dash[0] > 0.f && dash[1] > 0.f;
+
+    // dashes shorter than pixels just make the line fainter.
+    if (dashed && dash[0] + dash[1] < 2.f) {
+      paint.opacity *= dash[0] / (dash[0] + dash[1]);
+      dashed = false;
+    }
+
+    const std::size_t first = edges_.size();
+    const std::size_t count = points_.size() - !closed;
+
+    const auto normal_of = [&](PixelPoint from, PixelPoint to) {
+      const float len = std::hypot(to.x - from.x, to.y - from.y);
+      return len > 0.f
+        ? PixelPoint{ (from.y - to.y) / len * half,
+                      (to.x - from.x) / len * half }
+        : PixelPoint{};
+    };
+
+    const auto quad = [&](PixelPoint from, PixelPoint to, PixelPoint n) {
+      const PixelPoint corners[] = {
+        { from.x + n.x, from.y + n.y }, { to.x + n.x, to.y + n.y },
+        { to.x - n.x, to.y - n.y },     { from.x - n.x, from.y - n.y } };
+      add_contour(corners, 4, true);
+    };
+
+    // gaps between segments of lines up to a pixel or two don't show.
+    const bool bevels = half >= 1.f;
+
+    const auto bevel = [&](PixelPoint at, PixelPoint n0, PixelPoint n1) {
+      if (!bevels)
+        return;
+
+      const PixelPoint outer[] = {
+        at, { at.x + n0.x, at.y + n0.y }, { at.x + n1.x, at.y + n1.y } };
+      const PixelPoint inner[] = {
+        at, { at.x - n0.x, at.y - n0.y }, { at.x - n1.x, at.y - n1.y } };
+      add_contour(outer, 3, true);
+      add_contour(inner, 3, true);
+    };
+
+    int        phase   = 0;          // on or off
+    float      left    = dash[0];    // of current dash or gap
+    PixelPoint normal0 {};
+    bool       joined  = false;      // whether a bevel is due at a vertex
+
+    for (std::size_t i = 0; i < count; ++i) {
+      const PixelPoint from = points_[i];
+      const PixelPoint to   = points_[(i + 1) % points_.size()];
+      const PixelPoint n    = normal_of(from, to);
+
+      if (n.x == 0.f && n.y == 0.f)
+        continue;
+
+      if (joined && (!dashed || phase == 0))
+        bevel(from, normal0, n);
+
+      if (!dashed) {
+        quad(from, to, n);
+      }
+      else {
+        const float len = std::hypot(to.x - from.x, to.y - from.y);
+        float done = 0.f;
+
+        while (done < len) {
+          const float step = std::min(left, len - done);
+          if (phase == 0) {
+            const float t0 = done / len;
+            const float t1 = (done + step) / len;
+            quad(PixelPoint{ from.x + (to.x - from.x) * t0,
+                             from.y + (to.y - from.y) * t0 },
+                 PixelPoint{ from.x + (to.x - from.x) * t1,
+                             from.y + (to.y - from.y) * t1 },
+                 n);
+          }
+
+          done += step;
+          left -= step;
+          if (left <= 0.f) {
+            phase ^= 1;
+            left   = dash[phase];
+          }
+        }
+      }
+
+      normal0 = n;
+      joined  = true;
+    }
+
+    if (closed && joined && !dashed)
+      bevel(points_.front(), normal0, normal_of(points_[0], points_[1]));
+
+    end_path(first, paint);
+  }
+
+  void draw_arrow(const EdgeVisual& edge, const attrtypes::ArrowType& arrow,
+                  const Point& base, const Point& tip)
+  {
+    const Paint pen = solid(edge.pen);
+
+    for_each_arrow_part(arrow, base, tip, edge.arrowsize,
+      [&](const ArrowPart& part) {
+        points_.clear();
+
+        if (part.kind == PartKind::ellipse) {
+          add_ellipse(to_pixels(part.points[0]),
+                      part.points[1].x * scale_, part.points[1].y * scale_);
+        }
+        else {
+          for (std::size_t i = 0; i < part.count; ++i)
+            points_.push_back(to_pixels(part.points[i]));
+        }
+
+        if (part.filled)
+          fill(pen);
+
+        stroke(part.kind != PartKind::polyline, edge.penwidth * scale_,
+               LineStyle::solid, pen);
+      });
+  }
+
+  // -- rasterizing
+
+  /** adds coverage of a row's span [`from`, `to`) of pixels, within
+   *  [`lo`, `hi`), weighted by `weight`, to `coverage`, indexed from
+   *  the tile's left.
+   *
+   * @returns the range of pixels covered.
+   */
+  std::pair<std::size_t, std::size_t> cover(float *coverage, float from,
+                                            float to, float lo, float hi,
+                                            float weight) const noexcept
+  {
+    from = std::max(from, lo);
+    to   = std::min(to, hi);
+    if (!(from < to))
+      return { 0, 0 };
+
+    if (!antialias_) {
+      // pixels whose centers are within the span.
+      const auto first = std::size_t(std::ceil(from - .5f) - lo);
+      const auto last  = std::size_t(std::ceil(to - .5f) - lo);
+      fill_span(coverage, first, last, weight);
+      return { first, last };
+    }
+
+    const float first_px = std::floor(from);
+    const float last_px  = std::floor(to);
+    const auto  first    = std::size_t(first_px - lo);
+    const auto  last     = std::size_t(last_px - lo);
+
+    if (first == last) {
+      coverage[first] += (to - from) * weight;
+      return { first, first + 1 };
+    }
+
+    coverage[first] += (first_px + 1.f - from) * weight;
+    fill_span(coverage, first + 1, last, weight);
+    coverage[last] += (to - last_px) * weight;
+
+    return { first, std::min(last + 1, std::size_t(hi - lo)) };
+  }
+
+  /** adds `weight` to all of [`first`, `last`) of `coverage`. */
+  static void fill_span(float *coverage, std::size_t first, std::size_t last,
+                        float weight) noexcept
+  {
+    const f32v add = f32v::broadcast(weight);
+
+    std::size_t i = first;
+    for (; i + lanes <= last; i += lanes) {
+      const f32v sum =
+        f32v::generate([&](std::size_t lane) { return coverage[i + lane]; })
+        + add;
+      for (std::size_t lane = 0; lane < lanes; ++lane)
+        coverage[i + lane] = sum[lane];
+    }
+
+    for (; i < last; ++i)
+      coverage[i] += weight;
+  }
+
+  /** blends `paint` by coverage of [`first`, `last`) over `row` of
+   *  pixels and clears that coverage.
+   */
+  void blend(uint32_t *row, float *coverage, std::size_t first,
+             std::size_t last, float x, float y, const Paint& paint) const
+  {
+    const f32v zero  = f32v::broadcast(0.f);
+    const f32v one   = f32v::broadcast(1.f);
+    const f32v half  = f32v::broadcast(.5f);
+    const f32v octet = f32v::broadcast(255.f);
+    const i32v mask  = i32v::broadcast(0xff);
+
+    const auto *table = paint.gradient >= 0
+                      ? gradients_[std::size_t(paint.gradient)].data()
+                      : nullptr;
+
+    const float  step_scale = float(detail::gradient_steps - 1);
+    const f32v   opacity    = f32v::broadcast(paint.opacity / 255.f);
+
+    for (std::size_t i = first; i < last; i += lanes) {
+      const std::size_t todo = std::min(lanes, last - i);
+
+      const f32v cover = simd::min(
+        f32v::generate([&](std::size_t lane) {
+          return lane < todo ? coverage[i + lane] : 0.f;
+        }), one);
+
+      for (std::size_t lane = 0; lane < todo; ++lane)
+        coverage[i + lane] = 0.f;
+
+      const auto drawn = cover > zero;
+
+      i32v src = i32v::broadcast(int32_t(paint.color));
+      if (table) {
+        // gradient sampled at pixel centers.
+        const f32v px = f32v::generate([&](std::size_t lane) {
+          return x + float(i + lane) + .5f;
+        });
+        const f32v u = (px - f32v::broadcast(paint.ox))
+                     * f32v::broadcast(paint.sx);
+        const f32v v = f32v::broadcast((y + .5f - paint.oy) * paint.sy);
+
+        f32v t = u + v;
+        if (paint.radial)
+          t = f32v::generate([&](std::size_t lane) {
+            return std::sqrt(u[lane] * u[lane] + v[lane] * v[lane]);
+          });
+
+        const i32v index = (simd::min(simd::max(t, zero), one)
+                            * f32v::broadcast(step_scale) + half)
+                           .as<int32_t>();
+        src = i32v::generate([&](std::size_t lane) {
+          return int32_t(table[index[lane]]);
+        });
+      }
+
+      const i32v dst = i32v::generate([&](std::size_t lane) {
+        return lane < todo ? int32_t(row[i + lane]) : 0;
+      });
+
+      const auto channel = [&](const i32v& packed, int shift) {
+        return ((packed >> shift) & mask).as<float>();
+      };
+
+      // source over destination, neither premultiplied.
+      const f32v src_alpha = cover * channel(src, 24) * opacity;
+      const f32v dst_alpha = channel(dst, 24) / octet;
+      const f32v dst_part  = dst_alpha * (one - src_alpha);
+      const f32v alpha     = src_alpha + dst_part;
+      const f32v inv_alpha = one / simd::max(alpha, f32v::broadcast(1e-6f));
+
+      const auto mix = [&](int shift) {
+        return ((channel(src, shift) * src_alpha
+                 + channel(dst, shift) * dst_part) * inv_alpha + half)
+               .as<int32_t>();
+      };
+
+      const i32v out = ((alpha * octet + half).as<int32_t>() << 24)
+                     | (mix(16) << 16) | (mix(8) << 8) | mix(0);
+      const i32v result = simd::select(drawn, out, dst);
+
+      for (std::size_t lane = 0; lane < todo; ++lane)
+        row[i + lane] = uint32_t(result[lane]);
+    }
+  }
+
+  void render_tile(Image& image, std::size_t left, std::size_t top,
+                   std::size_t tile, const std::vector<uint32_t>& bin,
+                   TileScratch& scratch) const
+  {
+    const std::size_t right  = std::min(left + tile, width_);
+    const std::size_t bottom = std::min(top + tile, height_);
+
+    const int   samples = antialias_ ? detail::aa_samples : 1;
+    const float weight  = 1.f / float(samples);
+
+    auto& active    = scratch.active;
+    auto& crossings = scratch.crossings;
+    float *coverage = scratch.coverage.data();
+
+    for (const auto index : bin) {
+      const auto& path = paths_[index];
+
+      const auto row_begin = std::max(
+        top, std::size_t(std::max(std::floor(path.y0), 0.f)));
+      const auto row_end = std::min(
+        bottom, std::size_t(std::max(std::ceil(path.y1), 0.f)));
+
+      const float lo = float(left);
+      const float hi = std::min(float(right), std::ceil(path.x1));
+
+      if (row_begin >= row_end || !(std::floor(path.x0) < hi))
+        continue;
+
+      // edges crossing the tile's rows, including those left of it,
+      // which still count towards the winding.
+      active.clear();
+      for (std::size_t i = path.first; i < path.first + path.count; ++i) {
+        const auto& edge = edges_[i];
+        if (edge.bottom > float(row_begin) && edge.top < float(row_end))
+          active.push_back(&edge);
+      }
+
+      if (active.size() < 2)
+        continue;
+
+      for (std::size_t y = row_begin; y < row_end; ++y) {
+        std::size_t first = tile;
+        std::size_t last  = 0;
+
+        for (int sample = 0; sample < samples; ++sample) {
+          const float sy = float(y) + (float(sample) + .5f) * weight;
+
+          crossings.clear();
+          for (const auto *edge : active)
+            if (edge->top <= sy && sy < edge->bottom)
+              crossings.push_back(Crossing{
+                edge->x + (sy - edge->top) * edge->slope, edge->winding });
+
+          if (crossings.size() < 2)
+            continue;
+
+          // few crossings, mostly in order.
+          for (std::size_t i = 1; i < crossings.size(); ++i)
+            for (std::size_t j = i;
+                 j > 0 && crossings[j].x < crossings[j - 1].x; --j)
+              std::swap(crossings[j], crossings[j - 1]);
+
+          int32_t winding = 0;
+          float   start   = 0.f;
+
+          for (const auto& crossing : crossings) {
+            const int32_t before = winding;
+            winding += crossing.winding;
+
+            if (before == 0 && winding != 0) {
+              start = crossing.x;
+            }
+            else if (before != 0 && winding == 0) {
+              const auto [from, to] =
+                cover(coverage, start, crossing.x, lo, hi, weight);
+              if (from < to) {
+                first = std::min(first, from);
+                last  = std::max(last, to);
+              }
+            }
+          }
+        }
+
+        if (first < last)
+          blend(image.row(y) + left, coverage, first, last, lo, float(y),
+                path.paint);
+      }
+    }
+  }
+};
+
+/** renders a laid out graph into an image.
+ *
+ * nodes and edges are drawn as `write_svg` draws them (see `node_visual`
+ * and `edge_visual`), edges below nodes, apart from labels. the image
+ * shows the drawing at `options.dpi`, scaled down to fit `max_width`
+ * and `max_height` if those are set.
+ *
+ * @param graph   graph whose nodes and edges have been positioned.
+ * @param options resolution, anti-aliasing, background and parallelism.
+ * @returns the image, to be written by `write_png` or `write_ppm`.
+ */
+template <typename GraphT>
+Image rasterize(const GraphT& graph, const RasterOptions& options = {})
+{
+  const auto drawing =
+    collect_drawing(graph, [](auto) { return std::string_view{}; });
+
+  Box view = drawing.bounds;
+  if (options.bb)
+    view = Box{ options.bb->llx(), options.bb->lly(),
+                options.bb->urx(), options.bb->ury() };
+
+  if (view.empty())
+    view = Box{ 0., 0., 0., 0. };
+
+  view.pad(options.pad);
+
+  double scale = options.dpi > 0. ? options.dpi / points_per_inch : 1.;
+  if (options.max_width && view.width() * scale > double(options.max_width))
+    scale = double(options.max_width) / view.width();
+  if (options.max_height
+      && view.height() * scale > double(options.max_height))
+    scale = double(options.max_height) / view.height();
+
+  // the box is widened to whole pixels, keeping the scale.
+  const auto width  = std::size_t(std::max(std::ceil(view.width() * scale),
+                                           1.));
+  const auto height = std::size_t(std::max(std::ceil(view.height() * scale),
+                                           1.));
+  view.urx = view.llx + double(width) / scale;
+  view.lly = view.ury - double(height) / scale;
+
+  RasterCanvas canvas(view, width, height, options.antialias);
+
+  for (const auto& edge : drawing.edges)
+    if (edge.bounds().intersects(view))
+      canvas.draw_edge(edge);
+
+  for (const auto& node : drawing.nodes)
+    if (node.bounds().intersects(view))
+      canvas.draw_node(node);
+
+  Image image(width, height, options.background);
+  canvas.render(image, options.tile_size, options.threads);
+  return image;
+}
+
+}  // namespace gviz::render
+
+#endif  // GVIZARD_RENDER_RASTER_HPP_
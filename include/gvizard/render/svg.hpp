@@ -0,0 +1,681 @@
+#ifndef GVIZARD_RENDER_SVG_HPP_
+#define GVIZARD_RENDER_SVG_HPP_
+
+#include <algorithm>
+#include <charconv>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <optional>
+#include <ostream>
+#include <string_view>
+#include <tuple>
+#include <utility>
+#include <variant>
+#include <vector>
+
+#include "gvizard/attrtypes/rect.hpp"
+#include "gvizard/attrtypes/viewport.hpp"
+#include "gvizard/colors/format.hpp"
+#include "gvizard/colors/gradient.hpp"
+#include "gvizard/passes/expand_labels.hpp"
+#include "gvizard/render/geometry.hpp"
+#include "gvizard/render/visuals.hpp"
+
+namespace gviz::render {
+
+struct SvgOptions final {
+  /** decimals of written coordinates, within [0, 6]. */
+  int precision = 2;
+
+  /** size of the buffer output is gathered in before being written. */
+  std::size_t buffer_size = std::size_t(1) << 16;
+
+  /** margin around the drawing, in points. */
+  double pad = 4.;
+
+  /** drawing's box (`bb`), by default the box of everything drawn. */
+  std::optional<attrtypes::Rect> bb{};
+
+  /** part of the drawing to render (`viewport`), anything outside
+   *  of it is culled.
+   */
+  std::optional<attrtypes::ViewPortType> viewport{};
+};
+
+namespace detail {
+
+constexpr int64_t powers_of_ten[] = { 1, 10, 100, 1000, 10000, 100000,
+                                      1000000 };
+
+/** output gathered in a fixed buffer and written to a stream in large
+ *  chunks, numbers are formatted right into it.
+ */
+class SvgBuffer final {
+  std::ostream&           out_;
+  std::unique_ptr<char[]> data_;
+  std::size_t             capacity_;
+  std::size_t             size_ = 0;
+  int                     precision_;
+
+ public:
+  SvgBuffer(std::ostream& out, int precision, std::size_t capacity)
+    : out_(out)
+    , data_(std::make_unique<char[]>(std::max<std::size_t>(capacity, 64)))
+    , capacity_(std::max<std::size_t>(capacity, 64))
+    , precision_(std::clamp(precision, 0, 6))
+  {}
+
+  void flush()
+  {
+    if (size_ != 0)
+      out_.write(data_.get(), std::streamsize(size_));
+    size_ = 0;
+  }
+
+  /** pointer to at least `count` <= 64 free chars, to be committed. */
+  char *reserve(std::size_t count)
+  {
+    if (capacity_ - size_ < count)
+      flush();
+    return data_.get() + size_;
+  }
+
+  void commit(char *end) noexcept { size_ = std::size_t(end - data_.get()); }
+
+  void put(char chr) { *reserve(1) = chr; ++size_; }
+
+  void put(std::string_view str)
+  {
+    if (capacity_ - size_ < str.size()) {
+      flush();
+      if (str.size() > capacity_) {
+        out_.write(str.data(), std::streamsize(str.size()));
+        return;
+      }
+    }
+
+    std::memcpy(data_.get() + size_, str.data(), str.size());
+    size_ += str.size();
+  }
+
+  void put_int(int64_t value)
+  {
+    char *ptr = reserve(24);
+    commit(std::to_chars(ptr, ptr + 24, value).ptr);
+  }
+
+  /** writes `value` rounded to `precision` decimals, without trailing
+   *  zeros, as a scaled integer so no floating point formatting is done.
+   */
+  void put_fixed(double value, int precision)
+  {
+    const int64_t scale = powers_of_ten[precision];
+
+    double scaled = std::isfinite(value) ? std::round(value * double(scale))
+                                         : 0.;
+    scaled = std::clamp(scaled, -9e15, 9e15);
+
+    auto fixed = int64_t(scaled);
+    char *ptr = reserve(32);
+
+    if (fixed < 0) {
+      *ptr++ = '-';
+      fixed  = -fixed;
+    }
+
+    ptr = std::to_chars(ptr, ptr + 20, fixed / scale).ptr;
+
+    if (auto frac = fixed % scale) {
+      *ptr++ = '.';
+      for (int i = precision - 1; i >= 0; --i, frac /= 10)
+        ptr[i] = char('0' + frac % 10);
+
+      ptr += precision;
+      while (ptr[-1] == '0')
+        --ptr;
+    }
+
+    commit(ptr);
+  }
+
+  void put_number(double value) { put_fixed(value, precision_); }
+
+  /** writes a point, flipping y as svg's grows downwards. */
+  void put_point(const Point& point)
+  {
+    put_number(point.x);
+    put(',');
+    put_number(-point.y);
+  }
+
+  void put_color(const colors::RGBA& color)
+  {
+    char *ptr = reserve(colors::max_color_length);
+    commit(colors::format_to(ptr, ptr + colors::max_color_length,
+                             colors::RGB{ color.r, color.g, color.b }).ptr);
+  }
+
+  /** writes `str` escaped for xml text and attribute values. */
+  void put_escaped(std::string_view str)
+  {
+    std::size_t done = 0;
+    for (std::size_t i = 0; i < str.size(); ++i) {
+      std::string_view entity{};
+      switch (str[i]) {
+        case '&':  entity = "&amp;";  break;
+        case '<':  entity = "&lt;";   break;
+        case '>':  entity = "&gt;";   break;
+        case '"':  entity = "&quot;"; break;
+        case '\'': entity = "&#39;";  break;
+        default: continue;
+      }
+
+      put(str.substr(done, i - done));
+      put(entity);
+      done = i + 1;
+    }
+
+    put(str.substr(done));
+  }
+};
+
+}  // namespace detail
+
+/** streams visuals as SVG to an output stream.
+ *
+ * all output goes through one reused buffer and numbers are formatted
+ * in place, so writing allocates nothing but gradients' stops.
+ * graph coordinates grow upwards, so y is negated in the document.
+ */
+class SvgWriter final {
+  detail::SvgBuffer buffer_;
+  std::size_t       gradients_ = 0;
+
+ public:
+  explicit SvgWriter(std::ostream& out, int precision = 2,
+                     std::size_t buffer_size = std::size_t(1) << 16)
+    : buffer_(out, precision, buffer_size)
+  {}
+
+  SvgWriter(const SvgWriter&) = delete;
+  SvgWriter& operator=(const SvgWriter&) = delete;
+
+  ~SvgWriter()
+  {
+    try { buffer_.flush(); } catch (...) {}
+  }
+
+  /** writes the document's header.
+   *
+   * @param view   part of the drawing shown, in graph coordinates.
+   * @param width  width of the document, in points.
+   * @param height height of the document, in points.
+   */
+  void begin(const Box& view, double width, double height)
+  {
+    auto& out = buffer_;
+
+    out.put("<?xml version=\"1.0\" encoding=\"UTF-8\" standalone=\"no\"?>\n"
+            "<svg xmlns=\"http://www.w3.org/2000/svg\" width=\"");
+    out.put_number(width);
+    out.put("pt\" height=\"");
+    out.put_number(height);
+    out.put("pt\" viewBox=\"");
+    out.put_number(view.llx);
+    out.put(' ');
+    out.put_number(-view.ury);
+    out.put(' ');
+    out.put_number(view.width());
+    out.put(' ');
+    out.put_number(view.height());
+    out.put("\">\n");
+  }
+
+  /** closes the document and writes out what is buffered. */
+  void end()
+  {
+    buffer_.put("</svg>\n");
+    buffer_.flush();
+  }
+
+  void write_node(const NodeVisual& node)
+  {
+    auto& out = buffer_;
+
+    out.put("<g class=\"node\">");
+
+    const auto fill_id = write_gradient(node.fill, node.radial);
+
+    const double half_width  = node.width / 2.;
+    const double half_height = node.height / 2.;
+
+    // peripheries beyond the first are outer rings, only the first is
+    // filled, and a node without any is just filled.
+    const int rings = std::max(node.peripheries, 1);
+    for (int ring = 0; ring < rings; ++ring) {
+      const double gap = periphery_gap * double(ring);
+
+      switch (node.outline.kind) {
+        case OutlineKind::ellipse:
+          out.put("<ellipse");
+          break;
+        case OutlineKind::polygon:
+          out.put("<polygon");
+          break;
+        default:
+          continue;
+      }
+
+      if (ring == 0)
+        put_fill(node.fill, fill_id);
+      else
+        out.put(" fill=\"none\"");
+
+      if (node.peripheries > 0)
+        put_stroke(node.pen, node.penwidth, node.line);
+      else
+        out.put(" stroke=\"none\"");
+
+      if (node.outline.kind == OutlineKind::ellipse) {
+        out.put(" cx=\"");
+        out.put_number(node.center.x);
+        out.put("\" cy=\"");
+        out.put_number(-node.center.y);
+        out.put("\" rx=\"");
+        out.put_number(half_width + gap);
+        out.put("\" ry=\"");
+        out.put_number(half_height + gap);
+        out.put("\"/>");
+      }
+      else {
+        out.put(" points=\"");
+        for (std::size_t i = 0; i < node.outline.count; ++i) {
+          const auto& vertex = node.outline.vertices[i];
+          if (i != 0)
+            out.put(' ');
+          out.put_point(Point{
+            node.center.x + vertex.x * (half_width + gap),
+            node.center.y + vertex.y * (half_height + gap) });
+        }
+        out.put("\"/>");
+      }
+    }
+
+    if (!node.label.empty())
+      write_label(node);
+
+    out.put("</g>\n");
+  }
+
+  void write_edge(const EdgeVisual& edge)
+  {
+    auto& out = buffer_;
+
+    if (!edge.splines)
+      return;
+
+    out.put("<g class=\"edge\">");
+
+    for (const auto& spline : edge.splines->splines) {
+      out.put("<path fill=\"none\"");
+      put_stroke(edge.pen, edge.penwidth, edge.line);
+      out.put(" d=\"M");
+      out.put_point(Point(spline.point));
+
+      if (!spline.triples.empty()) {
+        out.put('C');
+        for (std::size_t i = 0; i < spline.triples.size(); ++i) {
+          const auto& [first, second, third] = spline.triples[i];
+          if (i != 0)
+            out.put(' ');
+          out.put_point(Point(first));
+          out.put(' ');
+          out.put_point(Point(second));
+          out.put(' ');
+          out.put_point(Point(third));
+        }
+      }
+      out.put("\"/>");
+
+      const Point last = spline.triples.empty()
+                       ? Point(spline.point)
+                       : Point(std::get<2>(spline.triples.back()));
+
+      if (spline.endp)
+        write_arrow(edge, edge.head, last, Point(*spline.endp));
+      if (spline.startp)
+        write_arrow(edge, edge.tail, Point(spline.point),
+                    Point(*spline.startp));
+    }
+
+    out.put("</g>\n");
+  }
+
+ private:
+  void put_paint(std::string_view name, const colors::RGBA& color)
+  {
+    auto& out = buffer_;
+
+    out.put(' ');
+    out.put(name);
+    if (color.a == 0) {
+      out.put("=\"none\"");
+      return;
+    }
+
+    out.put("=\"");
+    out.put_color(color);
+    out.put('"');
+
+    if (color.a != 255) {
+      out.put(' ');
+      out.put(name);
+      out.put("-opacity=\"");
+      out.put_fixed(color.a / 255., 3);
+      out.put('"');
+    }
+  }
+
+  void put_fill(const RGBAList& fill, std::optional<std::size_t> gradient)
+  {
+    auto& out = buffer_;
+
+    if (gradient) {
+      out.put(" fill=\"url(#g");
+      out.put_int(int64_t(*gradient));
+      out.put(")\"");
+    }
+    else if (fill.empty()) {
+      out.put(" fill=\"none\"");
+    }
+    else {
+      put_paint("fill", fill.front().get_color());
+    }
+  }
+
+  void put_stroke(const colors::RGBA& pen, double penwidth, LineStyle line)
+  {
+    auto& out = buffer_;
+
+    put_paint("stroke", pen);
+
+    if (penwidth != 1.) {
+      out.put(" stroke-width=\"");
+      out.put_number(penwidth);
+      out.put('"');
+    }
+
+    if (line == LineStyle::dashed)
+      out.put(" stroke-dasharray=\"5,2\"");
+    else if (line == LineStyle::dotted)
+      out.put(" stroke-dasharray=\"1,5\"");
+  }
+
+  /** defines a gradient of `fill` if it has several colors.
+   *
+   * @returns its id, or std::nullopt if `fill` is a single color.
+   */
+  std::optional<std::size_t> write_gradient(const RGBAList& fill, bool radial)
+  {
+    auto& out = buffer_;
+
+    if (fill.size() < 2)
+      return std::nullopt;
+
+    const colors::Gradient gradient(fill);
+    const std::size_t id = gradients_++;
+
+    out.put(radial ? "<defs><radialGradient id=\"g"
+                   : "<defs><linearGradient id=\"g");
+    out.put_int(int64_t(id));
+    out.put("\">");
+
+    for (std::size_t i = 0; i < fill.size(); ++i) {
+      out.put("<stop offset=\"");
+      out.put_fixed(gradient.stop_position(i), 3);
+      out.put('"');
+      put_paint("stop-color", fill[i].get_color());
+      out.put("/>");
+    }
+
+    out.put(radial ? "</radialGradient></defs>" : "</linearGradient></defs>");
+    return id;
+  }
+
+  /** end of label's line starting at `begin`, lines end at "\n", "\l"
+   *  or "\r" escapes (centered, left or right justified) or at its end.
+   */
+  static std::pair<std::size_t, char> label_line(std::string_view label,
+                                                 std::size_t begin) noexcept
+  {
+    for (std::size_t end = begin; end + 1 < label.size(); ++end)
+      if (label[end] == '\\') {
+        const char next = label[end + 1];
+        if (next == 'n' || next == 'l' || next == 'r')
+          return { end, next };
+        ++end;
+      }
+
+    return { label.size(), 'n' };
+  }
+
+  void write_label(const NodeVisual& node)
+  {
+    auto& out = buffer_;
+
+    const auto& label = node.label;
+
+    std::size_t lines = 0;
+    for (std::size_t begin = 0; begin < label.size();
+         begin = label_line(label, begin).first + 2)
+      ++lines;
+
+    const double line_height = node.fontsize * 1.2;
+    double baseline = node.center.y + double(lines - 1) * line_height / 2.
+                    - .3 * node.fontsize;
+
+    for (std::size_t begin = 0; begin < label.size(); ) {
+      const auto [end, justify] = label_line(label, begin);
+
+      const double inset = node.width / 2. - periphery_gap;
+      const double x = justify == 'l' ? node.center.x - inset
+                     : justify == 'r' ? node.center.x + inset
+                     : node.center.x;
+
+      out.put("<text text-anchor=\"");
+      out.put(justify == 'l' ? "start" : justify == 'r' ? "end" : "middle");
+      out.put("\" x=\"");
+      out.put_number(x);
+      out.put("\" y=\"");
+      out.put_number(-baseline);
+      out.put("\" font-family=\"");
+      out.put_escaped(node.fontname);
+      out.put("\" font-size=\"");
+      out.put_number(node.fontsize);
+      out.put('"');
+      put_paint("fill", node.fontcolor);
+      out.put('>');
+
+      // other escapes just stand for the escaped char.
+      const auto line = label.substr(begin, end - begin);
+      std::size_t done = 0;
+      for (std::size_t i = 0; i + 1 < line.size(); ++i)
+        if (line[i] == '\\') {
+          out.put_escaped(line.substr(done, i - done));
+          done = ++i;
+        }
+      out.put_escaped(line.substr(done));
+
+      out.put("</text>");
+
+      begin     = end + 2;
+      baseline -= line_height;
+    }
+  }
+
+  void write_arrow(const EdgeVisual& edge, const attrtypes::ArrowType& arrow,
+                   const Point& base, const Point& tip)
+  {
+    auto& out = buffer_;
+
+    for_each_arrow_part(arrow, base, tip, edge.arrowsize,
+      [&](const ArrowPart& part) {
+        switch (part.kind) {
+          case PartKind::polygon:  out.put("<polygon");  break;
+          case PartKind::polyline: out.put("<polyline"); break;
+          case PartKind::ellipse:  out.put("<ellipse");  break;
+        }
+
+        if (part.filled)
+          put_paint("fill", edge.pen);
+        else
+          out.put(" fill=\"none\"");
+
+        put_stroke(edge.pen, edge.penwidth, LineStyle::solid);
+
+        if (part.kind == PartKind::ellipse) {
+          out.put(" cx=\"");
+          out.put_number(part.points[0].x);
+          out.put("\" cy=\"");
+          out.put_number(-part.points[0].y);
+          out.put("\" rx=\"");
+          out.put_number(part.points[1].x);
+          out.put("\" ry=\"");
+          out.put_number(part.points[1].y);
+          out.put("\"/>");
+          return;
+        }
+
+        out.put(" points=\"");
+        for (std::size_t i = 0; i < part.count; ++i) {
+          if (i != 0)
+            out.put(' ');
+          out.put_point(part.points[i]);
+        }
+        out.put("\"/>");
+      });
+  }
+};
+
+namespace detail {
+
+/** text drawn in a node: its expanded label if given, otherwise its
+ *  label as is, or its name if it has none (graphviz's default "\N").
+ */
+template <typename GraphT>
+std::string_view node_label(
+    const GraphT& graph, typename GraphT::NodeId node,
+    const passes::ExpandedLabels<typename GraphT::entity_type> *labels)
+{
+  using passes::LabelKind;
+
+  if (labels)
+    if (const auto label = labels->find(node, LabelKind::label))
+      return *label;
+
+  const auto format = passes::detail::get_label_format(
+      graph, node, LabelKind::label);
+  if (format && *format != "\\N")
+    return *format;
+
+  return graph.get_node_name(node).value_or(std::string_view{});
+}
+
+/** part of the drawing `viewport` shows and its size, if it is set. */
+template <typename GraphT>
+auto viewport_view(const GraphT& graph,
+                   const attrtypes::ViewPortType& viewport,
+                   const Box& drawing)
+  -> std::optional<std::pair<Box, Point>>
+{
+  const auto [size, zoom] = std::visit([](const auto& alt) {
+    return std::pair{ Point(alt.size), alt.zoom > 0. ? alt.zoom : 1. };
+  }, viewport);
+
+  if (!(size.x > 0.) || !(size.y > 0.))
+    return std::nullopt;
+
+  Point center{ (drawing.llx + drawing.urx) / 2.,
+                (drawing.lly + drawing.ury) / 2. };
+
+  if (const auto *xy = std::get_if<attrtypes::ViewPortXY>(&viewport)) {
+    center = Point(xy->center);
+  }
+  else if (const auto node =
+             graph.find_node(std::get<attrtypes::ViewPortS>(viewport).center))
+  {
+    if (const auto visual = node_visual(graph, *node))
+      center = visual->center;
+  }
+
+  return std::pair{
+    Box::around(center, size.x / zoom / 2., size.y / zoom / 2.), size };
+}
+
+}  // namespace detail
+
+/** renders a laid out graph as SVG, streaming it to `out`.
+ *
+ * nodes with a point `Pos` and edges with a spline `Pos` are drawn by
+ * their shape, size, colors, style and arrows (see `node_visual` and
+ * `edge_visual`), edges below nodes. nodes are labeled by their expanded
+ * labels if `labels` is given, otherwise by their unexpanded ones.
+ *
+ * if a `viewport` is given, only the part of the drawing it shows is
+ * written and everything outside of it is culled.
+ *
+ * @param out     stream to write to.
+ * @param graph   graph whose nodes and edges have been positioned.
+ * @param options precision, bounding box and viewport.
+ * @param labels  optional result of `passes::expand_labels`.
+ */
+template <typename GraphT>
+void write_svg(
+    std::ostream& out, const GraphT& graph, const SvgOptions& options = {},
+    const passes::ExpandedLabels<typename GraphT::entity_type> *labels =
+      nullptr)
+{
+  auto [nodes, edges, drawing] = collect_drawing(graph, [&](auto node) {
+    return detail::node_label(graph, node, labels);
+  });
+
+  if (options.bb)
+    drawing = Box{ options.bb->llx(), options.bb->lly(),
+                   options.bb->urx(), options.bb->ury() };
+
+  if (drawing.empty())
+    drawing = Box{ 0., 0., 0., 0. };
+
+  drawing.pad(options.pad);
+
+  Box   view = drawing;
+  Point size{ drawing.width(), drawing.height() };
+  bool  cull = false;
+
+  if (options.viewport)
+    if (const auto shown =
+          detail::viewport_view(graph, *options.viewport, drawing)) {
+      std::tie(view, size) = *shown;
+      cull = true;
+    }
+
+  SvgWriter writer(out, options.precision, options.buffer_size);
+  writer.begin(view, size.x, size.y);
+
+  for (const auto& edge : edges)
+    if (!cull || edge.bounds().intersects(view))
+      writer.write_edge(edge);
+
+  for (const auto& node : nodes)
+    if (!cull || node.bounds().intersects(view))
+      writer.write_node(node);
+
+  writer.end();
+}
+
+}  // namespace gviz::render
+
+#endif  // GVIZARD_RENDER_SVG_HPP_
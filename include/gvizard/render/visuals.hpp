@@ -0,0 +1,449 @@
+#ifndef GVIZARD_RENDER_VISUALS_HPP_
+#define GVIZARD_RENDER_VISUALS_HPP_
+
+#include <algorithm>
+#include <cstdint>
+#include <optional>
+#include <string_view>
+#include <utility>
+#include <variant>
+#include <vector>
+
+#include "gvizard/utils.hpp"
+#include "gvizard/attrtypes/arrowtype.hpp"
+#include "gvizard/attrtypes/color.hpp"
+#include "gvizard/attrtypes/shape.hpp"
+#include "gvizard/attrtypes/spline.hpp"
+#include "gvizard/attrtypes/style.hpp"
+#include "gvizard/colors/converter.hpp"
+#include "gvizard/colors/rgba.hpp"
+#include "gvizard/render/geometry.hpp"
+
+#include "gvizard/attrs/arrow_related.hpp"
+#include "gvizard/attrs/color.hpp"
+#include "gvizard/attrs/fillcolor.hpp"
+#include "gvizard/attrs/font_related.hpp"
+#include "gvizard/attrs/height.hpp"
+#include "gvizard/attrs/penwidth.hpp"
+#include "gvizard/attrs/peripheries.hpp"
+#include "gvizard/attrs/pos.hpp"
+#include "gvizard/attrs/shape.hpp"
+#include "gvizard/attrs/style.hpp"
+#include "gvizard/attrs/width.hpp"
+
+namespace gviz::render {
+
+/** points per inch, `width` and `height` are given in inches. */
+constexpr double points_per_inch = 72.;
+
+using RGBAList = attrtypes::ColorList<colors::RGBA>;
+
+enum class LineStyle : uint8_t { solid = 0, dashed, dotted };
+
+/** the parts of `style` renderers care about. */
+struct StyleFlags final {
+  LineStyle line   = LineStyle::solid;
+  bool      filled = false;
+  bool      radial = false;
+  bool      invis  = false;
+  bool      bold   = false;
+};
+
+/** a node's attributes resolved to what is drawn, in points. */
+struct NodeVisual final {
+  Point            center{};
+  double           width       = 54.;
+  double           height      = 36.;
+  Outline          outline{ OutlineKind::ellipse };
+  int              peripheries = 1;
+  double           penwidth    = 1.;
+  LineStyle        line        = LineStyle::solid;
+  colors::RGBA     pen{ 0, 0, 0, 255 };
+  RGBAList         fill{};  // empty if not filled
+  bool             radial      = false;
+  std::string_view label{};
+  double           fontsize    = 14.;
+  std::string_view fontname    = "Times-Roman";
+  colors::RGBA     fontcolor{ 0, 0, 0, 255 };
+
+  /** box covering everything drawn of the node. */
+  Box bounds() const noexcept
+  {
+    const double extra =
+      double(std::max(peripheries - 1, 0)) * periphery_gap + penwidth / 2.;
+
+    return Box::around(center, width / 2. + extra, height / 2. + extra);
+  }
+};
+
+/** an edge's attributes resolved to what is drawn, in points.
+ *
+ * splines are referenced, they live as long as edge's `Pos` does.
+ */
+struct EdgeVisual final {
+  using splines_type = attrtypes::SplineType<std::vector>;
+
+  const splines_type   *splines   = nullptr;
+  double                penwidth  = 1.;
+  LineStyle             line      = LineStyle::solid;
+  colors::RGBA          pen{ 0, 0, 0, 255 };
+  attrtypes::ArrowType  head      = attrs::ArrowHead::get_default_value();
+  attrtypes::ArrowType  tail      = attrs::ArrowTail::get_default_value();
+  double                arrowsize = 1.;
+
+  /** box covering everything drawn of the edge, its curves are within
+   *  their control points' box.
+   */
+  Box bounds() const noexcept
+  {
+    Box box{};
+    if (!splines)
+      return box;
+
+    for (const auto& spline : splines->splines) {
+      box.expand(Point(spline.point));
+      for (const auto& [first, second, third] : spline.triples) {
+        box.expand(Point(first));
+        box.expand(Point(second));
+        box.expand(Point(third));
+      }
+      if (spline.endp)
+        box.expand(Point(*spline.endp));
+      if (spline.startp)
+        box.expand(Point(*spline.startp));
+    }
+
+    return box.pad(arrow_width * arrow_length * arrowsize + penwidth / 2.);
+  }
+};
+
+namespace detail {
+
+template <typename ColorT>
+colors::RGBA to_rgba(const ColorT& color)
+{
+  return utils::Converter<ColorT, colors::RGBA>::convert(color);
+}
+
+template <typename ColorT>
+RGBAList to_rgba_list(
+    const std::variant<ColorT, attrtypes::ColorList<ColorT>>& value)
+{
+  RGBAList list{};
+
+  if (const auto *color = std::get_if<ColorT>(&value)) {
+    list.emplace_back(to_rgba(*color), 0.);
+    return list;
+  }
+
+  for (const auto& weighted : std::get<attrtypes::ColorList<ColorT>>(value))
+    list.emplace_back(to_rgba(weighted.get_color()), weighted.get_weight());
+
+  return list;
+}
+
+/** value of a color attribute stored either as `Attr` or `PackedAttr`. */
+template <typename Attr, typename PackedAttr, typename GraphT,
+          typename EntityT>
+std::optional<RGBAList> get_colors(const GraphT& graph, EntityT entity)
+{
+  if (const auto attr = graph.template get_entity_attr<Attr>(entity))
+    return to_rgba_list(attr->get_value());
+
+  if (const auto attr = graph.template get_entity_attr<PackedAttr>(entity))
+    return to_rgba_list(attr->get_value());
+
+  return std::nullopt;
+}
+
+template <typename Attr, typename GraphT, typename EntityT>
+auto get_or_default(const GraphT& graph, EntityT entity)
+  -> typename Attr::value_type
+{
+  if (const auto attr = graph.template get_entity_attr<Attr>(entity))
+    return attr->get_value();
+
+  return Attr::get_default_value();
+}
+
+inline void apply_style(StyleFlags& flags, attrtypes::CommonStyle style)
+{
+  using attrtypes::CommonStyle;
+
+  switch (style) {
+    case CommonStyle::dashed: flags.line = LineStyle::dashed; break;
+    case CommonStyle::dotted: flags.line = LineStyle::dotted; break;
+    case CommonStyle::solid:  flags.line = LineStyle::solid;  break;
+    case CommonStyle::invis:  flags.invis = true;             break;
+    case CommonStyle::bold:   flags.bold = true;              break;
+    default: break;
+  }
+}
+
+inline void apply_style(StyleFlags& flags, attrtypes::NodeStyleOnly style)
+{
+  using attrtypes::NodeStyleOnly;
+
+  flags.filled = flags.filled
+    || style == NodeStyleOnly::filled  || style == NodeStyleOnly::striped
+    || style == NodeStyleOnly::wedged  || style == NodeStyleOnly::radial;
+  flags.radial = flags.radial || style == NodeStyleOnly::radial;
+}
+
+inline void apply_style(StyleFlags& flags, attrtypes::ClusterStyleOnly style)
+{
+  using attrtypes::ClusterStyleOnly;
+
+  flags.filled = flags.filled
+    || style == ClusterStyleOnly::filled || style == ClusterStyleOnly::striped
+    || style == ClusterStyleOnly::radial;
+  flags.radial = flags.radial || style == ClusterStyleOnly::radial;
+}
+
+inline void apply_style(StyleFlags&, attrtypes::EdgeStyleOnly) {}
+
+}  // namespace detail
+
+/** reads the renderer relevant parts of `style`, both builtin and
+ *  custom items are recognized by their names.
+ */
+inline StyleFlags parse_style(const attrtypes::Style& style)
+{
+  StyleFlags flags{};
+
+  for (const auto& item : style.items) {
+    using attrtypes::BuiltinStyleItem;
+
+    if (const auto *builtin = std::get_if<BuiltinStyleItem>(&item)) {
+      std::visit([&](auto name) { detail::apply_style(flags, name); },
+                 builtin->name);
+      continue;
+    }
+
+    const std::string_view name = std::get<attrtypes::StyleItem>(item).name;
+
+    using attrtypes::CommonStyle;
+    using attrtypes::NodeStyleOnly;
+
+    if (name == "dashed")
+      detail::apply_style(flags, CommonStyle::dashed);
+    else if (name == "dotted")
+      detail::apply_style(flags, CommonStyle::dotted);
+    else if (name == "solid")
+      detail::apply_style(flags, CommonStyle::solid);
+    else if (name == "invis")
+      detail::apply_style(flags, CommonStyle::invis);
+    else if (name == "bold")
+      detail::apply_style(flags, CommonStyle::bold);
+    else if (name == "filled")
+      detail::apply_style(flags, NodeStyleOnly::filled);
+    else if (name == "striped")
+      detail::apply_style(flags, NodeStyleOnly::striped);
+    else if (name == "wedged")
+      detail::apply_style(flags, NodeStyleOnly::wedged);
+    else if (name == "radial")
+      detail::apply_style(flags, NodeStyleOnly::radial);
+  }
+
+  return flags;
+}
+
+/** resolves what is drawn of a node, attributes it doesn't have take
+ *  their default values.
+ *
+ * @param graph graph of the node.
+ * @param node  node's id.
+ * @param label text drawn in the node, already expanded.
+ * @returns a NodeVisual if the node has a point `Pos` and isn't
+ *          invisible, otherwise std::nullopt.
+ */
+template <typename GraphT>
+auto node_visual(const GraphT& graph, typename GraphT::NodeId node,
+                 std::string_view label = {})
+  -> std::optional<NodeVisual>
+{
+  using attrtypes::ShapeType;
+  using point_type = attrtypes::PointType<double>;
+
+  const auto pos = graph.template get_entity_attr<attrs::Pos>(node);
+  if (!pos || !pos->get_value())
+    return std::nullopt;
+
+  const auto *point = std::get_if<point_type>(&*pos->get_value());
+  if (!point)
+    return std::nullopt;
+
+  StyleFlags flags{};
+  if (const auto style = graph.template get_entity_attr<attrs::Style>(node))
+    flags = parse_style(style->get_value());
+
+  if (flags.invis)
+    return std::nullopt;
+
+  NodeVisual visual{};
+  visual.center = Point(*point);
+
+  const auto shape = detail::get_or_default<attrs::Shape>(graph, node);
+  visual.outline = outline_of(shape);
+
+  const auto width  = graph.template get_entity_attr<attrs::Width>(node);
+  const auto height = graph.template get_entity_attr<attrs::Height>(node);
+
+  visual.width  = points_per_inch
+    * (width  ? width->get_value()  : attrs::Width::get_default_value());
+  visual.height = points_per_inch
+    * (height ? height->get_value() : attrs::Height::get_default_value());
+
+  auto pen = detail::get_colors<attrs::Color, attrs::PackedColor>(graph, node);
+  if (pen && pen->empty())
+    pen.reset();
+  if (pen)
+    visual.pen = pen->front().get_color();
+
+  if (shape == ShapeType::point) {
+    // points are small, round and always filled with their color.
+    const double size = width || height
+                      ? std::min(visual.width, visual.height)
+                      : .05 * points_per_inch;
+
+    visual.width  = size;
+    visual.height = size;
+    flags.filled  = true;
+    label = {};
+  }
+  else if (shape == ShapeType::circle || shape == ShapeType::doublecircle
+           || shape == ShapeType::Mcircle) {
+    visual.width  = std::max(visual.width, visual.height);
+    visual.height = visual.width;
+  }
+
+  visual.peripheries =
+    graph.template has_entity_attr<attrs::Peripheries>(node)
+    ? detail::get_or_default<attrs::Peripheries>(graph, node)
+    : visual.outline.peripheries;
+
+  visual.penwidth = detail::get_or_default<attrs::PenWidth>(graph, node);
+  if (flags.bold)
+    visual.penwidth = std::max(visual.penwidth, 2.);
+
+  visual.line   = flags.line;
+  visual.radial = flags.radial;
+
+  if (flags.filled) {
+    auto fill =
+      detail::get_colors<attrs::FillColor, attrs::PackedFillColor>(graph, node);
+
+    if (fill)
+      visual.fill = std::move(*fill);
+    else if (pen && shape != ShapeType::point)
+      visual.fill = *pen;
+    else if (shape == ShapeType::point)
+      visual.fill = RGBAList{ { visual.pen, 0. } };
+    else
+      visual.fill =
+        detail::to_rgba_list(attrs::FillColor::get_default_value());
+  }
+
+  visual.label = label;
+
+  if (const auto font = graph.template get_entity_attr<attrs::FontName>(node))
+    visual.fontname = font->get_value();
+
+  visual.fontsize = detail::get_or_default<attrs::FontSize>(graph, node);
+
+  if (const auto color =
+        graph.template get_entity_attr<attrs::FontColor>(node))
+    visual.fontcolor = detail::to_rgba(color->get_value());
+  else if (const auto packed =
+             graph.template get_entity_attr<attrs::PackedFontColor>(node))
+    visual.fontcolor = detail::to_rgba(packed->get_value());
+
+  return visual;
+}
+
+/** resolves what is drawn of an edge, attributes it doesn't have take
+ *  their default values. arrows are drawn where its splines have an
+ *  end or a start point.
+ *
+ * @returns an EdgeVisual if the edge has a spline `Pos` and isn't
+ *          invisible, otherwise std::nullopt.
+ */
+template <typename GraphT>
+auto edge_visual(const GraphT& graph, typename GraphT::EdgeId edge)
+  -> std::optional<EdgeVisual>
+{
+  using splines_type = EdgeVisual::splines_type;
+
+  const auto pos = graph.template get_entity_attr<attrs::Pos>(edge);
+  if (!pos || !pos->get_value())
+    return std::nullopt;
+
+  const auto *splines = std::get_if<splines_type>(&*pos->get_value());
+  if (!splines)
+    return std::nullopt;
+
+  StyleFlags flags{};
+  if (const auto style = graph.template get_entity_attr<attrs::Style>(edge))
+    flags = parse_style(style->get_value());
+
+  if (flags.invis)
+    return std::nullopt;
+
+  EdgeVisual visual{};
+  visual.splines = splines;
+  visual.line    = flags.line;
+
+  visual.penwidth = detail::get_or_default<attrs::PenWidth>(graph, edge);
+  if (flags.bold)
+    visual.penwidth = std::max(visual.penwidth, 2.);
+
+  const auto pen =
+    detail::get_colors<attrs::Color, attrs::PackedColor>(graph, edge);
+  if (pen && !pen->empty())
+    visual.pen = pen->front().get_color();
+
+  visual.head      = detail::get_or_default<attrs::ArrowHead>(graph, edge);
+  visual.tail      = detail::get_or_default<attrs::ArrowTail>(graph, edge);
+  visual.arrowsize = detail::get_or_default<attrs::ArrowSize>(graph, edge);
+
+  return visual;
+}
+
+/** visuals of a graph's drawn nodes and edges, and the box around them. */
+struct Drawing final {
+  std::vector<NodeVisual> nodes{};
+  std::vector<EdgeVisual> edges{};
+  Box                     bounds{};
+};
+
+/** resolves visuals of all nodes and edges of `graph` that are drawn.
+ *
+ * @param graph    graph whose nodes and edges have been positioned.
+ * @param label_of a callable giving a node's label as `std::string_view`.
+ */
+template <typename GraphT, typename LabelF>
+Drawing collect_drawing(const GraphT& graph, LabelF&& label_of)
+{
+  Drawing drawing{};
+
+  drawing.nodes.reserve(graph.node_count());
+  drawing.edges.reserve(graph.edge_count());
+
+  for (auto node : graph.nodes_view())
+    if (auto visual = node_visual(graph, node, label_of(node))) {
+      drawing.bounds.expand(visual->bounds());
+      drawing.nodes.push_back(std::move(*visual));
+    }
+
+  for (auto edge : graph.edges_view())
+    if (auto visual = edge_visual(graph, edge)) {
+      drawing.bounds.expand(visual->bounds());
+      drawing.edges.push_back(std::move(*visual));
+    }
+
+  return drawing;
+}
+
+}  // namespace gviz::render
+
+#endif  // GVIZARD_RENDER_VISUALS_HPP_
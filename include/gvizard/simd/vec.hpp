@@ -0,0 +1,341 @@
+#ifndef GVIZARD_SIMD_VEC_HPP_
+#define GVIZARD_SIMD_VEC_HPP_
+
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+#if defined(__SSE2__)
+# include <immintrin.h>
+#endif
+
+// passing native vectors wider than the enabled instruction set by value
+// is fine within one translation unit, gcc warns about its ABI anyway.
+#if defined(__GNUC__) && !defined(__clang__)
+# pragma GCC diagnostic push
+# pragma GCC diagnostic ignored "-Wpsabi"
+#endif
+
+namespace gviz::simd {
+
+/** true if `Vec` maps to the compiler's native vector types, which are
+ *  lowered to whatever SIMD the target has (SSE4, AVX2, NEON, ...).
+ *  otherwise `Vec` is a plain array processed lane by lane.
+ */
+#if defined(__GNUC__) || defined(__clang__)
+inline constexpr bool has_native_vectors = true;
+#else
+inline constexpr bool has_native_vectors = false;
+#endif
+
+/** size in bytes of the widest vectors the target handles as whole
+ *  registers, with lane-wise multiply, min/max and conversions, or 0
+ *  where wider `Vec`s are split up and partly processed lane by lane,
+ *  so that they are slower than plain scalar code.
+ */
+#if defined(__AVX512F__)
+inline constexpr std::size_t full_vector_bytes = 64;
+#elif defined(__AVX2__)
+inline constexpr std::size_t full_vector_bytes = 32;
+#else
+inline constexpr std::size_t full_vector_bytes = 0;
+#endif
+
+/** integer type of the same size as `T`, used for lane masks. */
+template <typename T>
+using mask_lane_t =
+  std::conditional_t<sizeof(T) == 8, int64_t,
+    std::conditional_t<sizeof(T) == 4, int32_t,
+      std::conditional_t<sizeof(T) == 2, int16_t, int8_t>>>;
+
+/** a fixed count of lanes of arithmetic type `T`, operated on at once.
+ *
+ * comparisons return masks with all bits of a lane set where true,
+ * to be used with `select`.
+ */
+template <typename T, std::size_t N>
+struct Vec final {
+  static_assert(std::is_arithmetic_v<T>, "lanes must be arithmetic");
+  static_assert((N & (N - 1)) == 0, "lane count must be power of two");
+
+#if defined(__GNUC__) || defined(__clang__)
+  typedef T native_type __attribute__((vector_size(sizeof(T) * N)));
+#else
+  using native_type = std::array<T, N>;
+#endif
+
+  using value_type = T;
+  using mask_type  = Vec<mask_lane_t<T>, N>;
+
+  constexpr static std::size_t size = N;
+
+  native_type data;
+
+  static Vec broadcast(T value) noexcept
+  {
+    Vec ret;
+    for (std::size_t i = 0; i < N; ++i)
+      ret.data[i] = value;
+    return ret;
+  }
+
+  template <typename F>
+  static Vec generate(F&& func)
+  {
+    Vec ret;
+    // unrolled, so lanes are inserted in registers instead of being
+    // stored one by one and reloaded as a vector.
+#if defined(__clang__)
+# pragma unroll
+#elif defined(__GNUC__)
+# pragma GCC unroll 64
+#endif
+    for (std::size_t i = 0; i < N; ++i)
+      ret.data[i] = func(i);
+    return ret;
+  }
+
+  /** the `N` values at `values`, which needn't be aligned. */
+  static Vec load(const T *values) noexcept
+  {
+    Vec ret;
+    std::memcpy(&ret.data, values, sizeof(ret.data));
+    return ret;
+  }
+
+  /** writes lanes to `out`, which needn't be aligned. */
+  void store(T *out) const noexcept
+  {
+    std::memcpy(out, &data, sizeof(data));
+  }
+
+  T operator[](std::size_t idx) const noexcept { return data[idx]; }
+
+  /** converts each lane to `U`, floating point values are truncated. */
+  template <typename U>
+  Vec<U, N> as() const noexcept
+  {
+    Vec<U, N> ret;
+#if defined(__GNUC__) || defined(__clang__)
+    ret.data = __builtin_convertvector(data, typename Vec<U, N>::native_type);
+#else
+    for (std::size_t i = 0; i < N; ++i)
+      ret.data[i] = U(data[i]);
+#endif
+    return ret;
+  }
+
+  /** applies `op(out, lhs, rhs)` lane-wise, `op` is called with whole
+   *  native vectors when those are available, otherwise once per lane.
+   */
+  template <typename RetT, typename F>
+  static RetT apply(const Vec& lhs, const Vec& rhs, F&& op) noexcept
+  {
+    RetT ret;
+#if defined(__GNUC__) || defined(__clang__)
+    op(ret.data, lhs.data, rhs.data);
+#else
+    for (std::size_t i = 0; i < N; ++i)
+      op(ret.data[i], lhs.data[i], rhs.data[i]);
+#endif
+    return ret;
+  }
+
+  /** stores a comparison result as lane mask, native comparisons
+   *  already are one.
+   */
+  template <typename OutT, typename U>
+  constexpr static void assign_mask(OutT& out, const U& cmp) noexcept
+  {
+    if constexpr (std::is_same_v<U, bool>)
+      out = cmp ? -1 : 0;
+    else
+      out = cmp;
+  }
+
+  friend Vec operator+(const Vec& lhs, const Vec& rhs) noexcept
+  {
+    return apply<Vec>(lhs, rhs, [](auto& out, const auto& a, const auto& b) {
+      out = a + b;
+    });
+  }
+
+  friend Vec operator-(const Vec& lhs, const Vec& rhs) noexcept
+  {
+    return apply<Vec>(lhs, rhs, [](auto& out, const auto& a, const auto& b) {
+      out = a - b;
+    });
+  }
+
+  friend Vec operator*(const Vec& lhs, const Vec& rhs) noexcept
+  {
+    return apply<Vec>(lhs, rhs, [](auto& out, const auto& a, const auto& b) {
+      out = a * b;
+    });
+  }
+
+  friend Vec operator/(const Vec& lhs, const Vec& rhs) noexcept
+  {
+    return apply<Vec>(lhs, rhs, [](auto& out, const auto& a, const auto& b) {
+      out = a / b;
+    });
+  }
+
+  friend mask_type operator==(const Vec& lhs, const Vec& rhs) noexcept
+  {
+    return apply<mask_type>(
+      lhs, rhs, [](auto& out, const auto& a, const auto& b) {
+        assign_mask(out, a == b);
+      });
+  }
+
+  friend mask_type operator!=(const Vec& lhs, const Vec& rhs) noexcept
+  {
+    return apply<mask_type>(
+      lhs, rhs, [](auto& out, const auto& a, const auto& b) {
+        assign_mask(out, a != b);
+      });
+  }
+
+  friend mask_type operator<(const Vec& lhs, const Vec& rhs) noexcept
+  {
+    return apply<mask_type>(
+      lhs, rhs, [](auto& out, const auto& a, const auto& b) {
+        assign_mask(out, a < b);
+      });
+  }
+
+  friend mask_type operator>(const Vec& lhs, const Vec& rhs) noexcept
+  {
+    return apply<mask_type>(
+      lhs, rhs, [](auto& out, const auto& a, const auto& b) {
+        assign_mask(out, a > b);
+      });
+  }
+
+  // bitwise operations, integer lanes only.
+
+  friend Vec operator&(const Vec& lhs, const Vec& rhs) noexcept
+  {
+    return apply<Vec>(lhs, rhs, [](auto& out, const auto& a, const auto& b) {
+      out = a & b;
+    });
+  }
+
+  friend Vec operator|(const Vec& lhs, const Vec& rhs) noexcept
+  {
+    return apply<Vec>(lhs, rhs, [](auto& out, const auto& a, const auto& b) {
+      out = a | b;
+    });
+  }
+
+  friend Vec operator<<(const Vec& lhs, int shift) noexcept
+  {
+    return apply<Vec>(lhs, broadcast(T(shift)),
+                      [](auto& out, const auto& a, const auto& b) {
+                        out = a << b;
+                      });
+  }
+
+  friend Vec operator>>(const Vec& lhs, int shift) noexcept
+  {
+    return apply<Vec>(lhs, broadcast(T(shift)),
+                      [](auto& out, const auto& a, const auto& b) {
+                        out = a >> b;
+                      });
+  }
+
+  friend Vec operator~(const Vec& vec) noexcept
+  {
+    static_assert(std::is_integral_v<T>, "bitwise ops need integer lanes");
+    return apply<Vec>(vec, vec, [](auto& out, const auto& a, const auto&) {
+      out = ~a;
+    });
+  }
+};
+
+/** picks lanes of `if_true` where `mask` is set, otherwise of `if_false`. */
+template <typename T, std::size_t N>
+Vec<T, N> select(const Vec<mask_lane_t<T>, N>& mask,
+                 const Vec<T, N>& if_true,
+                 const Vec<T, N>& if_false) noexcept
+{
+  if constexpr (std::is_integral_v<T>) {
+    const auto mask_t = mask.template as<T>();
+    return (if_true & mask_t) | (if_false & ~mask_t);
+  }
+  else {
+#if defined(__GNUC__) || defined(__clang__)
+    // floating point lanes are picked by their bits, casts between
+    // native vectors of the same size keeping those.
+    using bits_type = typename Vec<mask_lane_t<T>, N>::native_type;
+    const auto true_bits  = (bits_type)if_true.data;
+    const auto false_bits = (bits_type)if_false.data;
+
+    Vec<T, N> ret;
+    ret.data = (typename Vec<T, N>::native_type)(
+      (true_bits & mask.data) | (false_bits & ~mask.data));
+    return ret;
+#else
+    return Vec<T, N>::generate(
+      [&](std::size_t i) { return mask[i] ? if_true[i] : if_false[i]; }
+    );
+#endif
+  }
+}
+
+/** square root of each lane, by the target's instruction where there's
+ *  one for the whole vector.
+ */
+template <typename T, std::size_t N>
+Vec<T, N> sqrt(const Vec<T, N>& vec) noexcept
+{
+  static_assert(std::is_floating_point_v<T>, "sqrt needs float lanes");
+
+  [[maybe_unused]] Vec<T, N> ret;
+#if defined(__AVX__)
+  if constexpr (std::is_same_v<T, double> && N == 4) {
+    ret.data = _mm256_sqrt_pd(vec.data);
+    return ret;
+  }
+  if constexpr (std::is_same_v<T, float> && N == 8) {
+    ret.data = _mm256_sqrt_ps(vec.data);
+    return ret;
+  }
+#endif
+#if defined(__SSE2__)
+  if constexpr (std::is_same_v<T, double> && N == 2) {
+    ret.data = _mm_sqrt_pd(vec.data);
+    return ret;
+  }
+  if constexpr (std::is_same_v<T, float> && N == 4) {
+    ret.data = _mm_sqrt_ps(vec.data);
+    return ret;
+  }
+#endif
+  return Vec<T, N>::generate(
+    [&](std::size_t i) { return std::sqrt(vec[i]); });
+}
+
+template <typename T, std::size_t N>
+Vec<T, N> min(const Vec<T, N>& lhs, const Vec<T, N>& rhs) noexcept
+{
+  return select(lhs < rhs, lhs, rhs);
+}
+
+template <typename T, std::size_t N>
+Vec<T, N> max(const Vec<T, N>& lhs, const Vec<T, N>& rhs) noexcept
+{
+  return select(lhs > rhs, lhs, rhs);
+}
+
+}  // namespace gviz::simd
+
+#if defined(__GNUC__) && !defined(__clang__)
+# pragma GCC diagnostic pop
+#endif
+
+#endif  // GVIZARD_SIMD_VEC_HPP_
@@ -0,0 +1,58 @@
+#ifndef GVIZARD_STRINGS_HASH_HPP_
+#define GVIZARD_STRINGS_HASH_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+namespace gviz::strings {
+
+inline constexpr uint64_t fnv1a_offset_basis = 0xcbf29ce484222325ull;
+inline constexpr uint64_t fnv1a_prime        = 0x100000001b3ull;
+
+/** 64-bit FNV-1a hash of `str`, usable at compile time.
+ *
+ * @param str  string to hash.
+ * @param seed value mixed into the offset basis, to get independent
+ *             hash functions out of the same algorithm.
+ */
+constexpr uint64_t fnv1a(std::string_view str, uint64_t seed = 0) noexcept
+{
+  uint64_t hash = fnv1a_offset_basis ^ seed;
+
+  for (const char cur : str) {
+    hash ^= uint8_t(cur);
+    hash *= fnv1a_prime;
+  }
+
+  return hash;
+}
+
+/** same as `fnv1a` but ascii letters are hashed as lowercase. */
+constexpr uint64_t fnv1a_icase(std::string_view str, uint64_t seed = 0) noexcept
+{
+  uint64_t hash = fnv1a_offset_basis ^ seed;
+
+  for (const char cur : str) {
+    hash ^= uint8_t(('A' <= cur && cur <= 'Z') ? cur - 'A' + 'a' : cur);
+    hash *= fnv1a_prime;
+  }
+
+  return hash;
+}
+
+/** transparent hasher of string-like types, to be used with maps
+ *  keyed by strings so they can be looked up by `std::string_view`.
+ */
+struct StringHash final {
+  using is_transparent = void;
+
+  constexpr std::size_t operator()(std::string_view str) const noexcept
+  {
+    return std::size_t(fnv1a(str));
+  }
+};
+
+}  // namespace gviz::strings
+
+#endif  // GVIZARD_STRINGS_HASH_HPP_
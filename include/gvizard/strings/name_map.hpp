@@ -0,0 +1,177 @@
+#ifndef GVIZARD_STRINGS_NAME_MAP_HPP_
+#define GVIZARD_STRINGS_NAME_MAP_HPP_
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "gvizard/strings/hash.hpp"
+
+namespace gviz::strings {
+
+/** an open-addressing map from names to values of type `ValueT`.
+ *
+ * keys are kept as `std::string_view`s, so their storage must outlive
+ * the map (e.g. interned into a StringPool), lookups by
+ * `std::string_view` never allocate.
+ * empty names are not accepted as keys.
+ *
+ * erased slots are marked as tombstones and reclaimed on next rehash.
+ */
+template <typename ValueT>
+class NameMap final {
+  enum class SlotState : uint8_t { empty = 0, used, erased };
+
+  struct Slot final {
+    const char *data  = nullptr;
+    uint32_t    size  = 0;
+    uint32_t    hash  = 0;  // low bits of the full hash.
+    SlotState   state = SlotState::empty;
+    ValueT      value{};
+  };
+
+  std::vector<Slot> slots_{};
+  std::size_t       count_   = 0;
+  std::size_t       erased_  = 0;
+
+ public:
+  using value_type = ValueT;
+
+  /** maps `name` to `value`, unless `name` is already mapped.
+   *
+   * @param name  a non-empty name, its storage must outlive the map.
+   * @param value value to be mapped.
+   * @returns true if inserted, false if `name` was empty or already mapped.
+   */
+  bool insert(std::string_view name, ValueT value)
+  {
+    if (name.empty())
+      return false;
+
+    if ((count_ + erased_ + 1) * 2 > slots_.size())
+      rehash(std::max<std::size_t>(count_ * 4, 64));
+
+    const auto hash = uint32_t(fnv1a(name));
+    const auto [idx, found] = probe(name, hash);
+    if (found)
+      return false;
+
+    auto& slot = slots_[idx];
+    if (slot.state == SlotState::erased)
+      --erased_;
+
+    slot = Slot{ name.data(), uint32_t(name.size()), hash,
+                 SlotState::used, std::move(value) };
+    ++count_;
+
+    return true;
+  }
+
+  /** removes mapping of `name` if there is one.
+   *
+   * @returns true if `name` was mapped, otherwise false.
+   */
+  bool erase(std::string_view name) noexcept
+  {
+    if (name.empty() || slots_.empty())
+      return false;
+
+    const auto [idx, found] = probe(name, uint32_t(fnv1a(name)));
+    if (!found)
+      return false;
+
+    slots_[idx].state = SlotState::erased;
+    --count_;
+    ++erased_;
+
+    return true;
+  }
+
+  /** looks up `name`.
+   *
+   * @returns an optional containing mapped value if `name` is mapped,
+   *          otherwise std::nullopt.
+   */
+  std::optional<ValueT> find(std::string_view name) const noexcept
+  {
+    if (name.empty() || slots_.empty())
+      return std::nullopt;
+
+    const auto [idx, found] = probe(name, uint32_t(fnv1a(name)));
+    if (!found)
+      return std::nullopt;
+
+    return slots_[idx].value;
+  }
+
+  bool contains(std::string_view name) const noexcept
+  {
+    return find(name).has_value();
+  }
+
+  /** count of mapped names. */
+  std::size_t size() const noexcept { return count_; }
+
+  bool empty() const noexcept { return count_ == 0; }
+
+  void clear() noexcept
+  {
+    slots_.clear();
+    count_ = erased_ = 0;
+  }
+
+ private:
+  /** finds slot of `name`, or the slot it should be inserted at. */
+  std::pair<std::size_t, bool>
+  probe(std::string_view name, uint32_t hash) const noexcept
+  {
+    const std::size_t mask = slots_.size() - 1;
+    std::optional<std::size_t> first_erased{};
+
+    for (std::size_t idx = hash & mask; ; idx = (idx + 1) & mask) {
+      const auto& slot = slots_[idx];
+
+      if (slot.state == SlotState::empty)
+        return { first_erased.value_or(idx), false };
+
+      if (slot.state == SlotState::erased) {
+        if (!first_erased)
+          first_erased = idx;
+        continue;
+      }
+
+      if (slot.hash == hash && std::string_view(slot.data, slot.size) == name)
+        return { idx, true };
+    }
+  }
+
+  void rehash(std::size_t capacity)
+  {
+    std::size_t pow2 = 64;
+    while (pow2 < capacity)
+      pow2 *= 2;
+
+    std::vector<Slot> old = std::exchange(slots_, std::vector<Slot>(pow2));
+    erased_ = 0;
+
+    const std::size_t mask = pow2 - 1;
+    for (auto& slot : old) {
+      if (slot.state != SlotState::used)
+        continue;
+
+      auto idx = slot.hash & mask;
+      while (slots_[idx].state != SlotState::empty)
+        idx = (idx + 1) & mask;
+
+      slots_[idx] = std::move(slot);
+    }
+  }
+};
+
+}  // namespace gviz::strings
+
+#endif  // GVIZARD_STRINGS_NAME_MAP_HPP_
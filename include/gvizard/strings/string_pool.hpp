@@ -0,0 +1,243 @@
+#ifndef GVIZARD_STRINGS_STRING_POOL_HPP_
+#define GVIZARD_STRINGS_STRING_POOL_HPP_
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "gvizard/strings/hash.hpp"
+
+namespace gviz::strings {
+
+/** a bump allocator of characters that gives out stable string views.
+ *
+ * strings are copied back to back into big blocks, blocks are never
+ * reallocated or freed until the arena is destroyed or cleared,
+ * so returned views stay valid as long as the arena does (moving
+ * the arena keeps them valid too).
+ */
+class StringArena final {
+  std::vector<std::unique_ptr<char[]>> blocks_{};
+
+  char        *cursor_     = nullptr;
+  std::size_t  remaining_  = 0;
+  std::size_t  block_size_ = default_block_size;
+  std::size_t  used_       = 0;
+  std::size_t  reserved_   = 0;
+
+ public:
+  constexpr static std::size_t default_block_size = 64 * 1024;
+
+  explicit StringArena(std::size_t block_size = default_block_size) noexcept
+    : block_size_(std::max<std::size_t>(block_size, 1))
+  {}
+
+  StringArena(const StringArena&) = delete;
+  StringArena& operator=(const StringArena&) = delete;
+
+  StringArena(StringArena&& other) noexcept { swap(other); }
+  StringArena& operator=(StringArena&& other) noexcept
+  {
+    StringArena(std::move(other)).swap(*this);
+    return *this;
+  }
+
+  /** copies `str` into arena.
+   *
+   * @returns a view to the copy which lives as long as arena.
+   */
+  std::string_view store(std::string_view str)
+  {
+    if (str.empty())
+      return std::string_view{};
+
+    char *dest = allocate(str.size());
+    std::memcpy(dest, str.data(), str.size());
+
+    return std::string_view(dest, str.size());
+  }
+
+  /** count of bytes stored so far. */
+  std::size_t used() const noexcept { return used_; }
+
+  /** count of bytes allocated for blocks. */
+  std::size_t reserved() const noexcept { return reserved_; }
+
+  /** frees all blocks, invalidating all views given out so far. */
+  void clear() noexcept
+  {
+    blocks_.clear();
+    cursor_ = nullptr;
+    remaining_ = used_ = reserved_ = 0;
+  }
+
+  void swap(StringArena& other) noexcept
+  {
+    using std::swap;
+    swap(blocks_,     other.blocks_);
+    swap(cursor_,     other.cursor_);
+    swap(remaining_,  other.remaining_);
+    swap(block_size_, other.block_size_);
+    swap(used_,       other.used_);
+    swap(reserved_,   other.reserved_);
+  }
+
+ private:
+  char *allocate(std::size_t size)
+  {
+    used_ += size;
+
+    if (size <= remaining_) {
+      char *ret = cursor_;
+      cursor_ += size;
+      remaining_ -= size;
+      return ret;
+    }
+
+    // strings larger than a quarter of a block get their own block,
+    // so the current block isn't abandoned with lots of free space.
+    if (size > block_size_ / 4) {
+      blocks_.emplace_back(new char[size]);
+      reserved_ += size;
+      return blocks_.back().get();
+    }
+
+    blocks_.emplace_back(new char[block_size_]);
+    reserved_ += block_size_;
+
+    cursor_ = blocks_.back().get() + size;
+    remaining_ = block_size_ - size;
+
+    return blocks_.back().get();
+  }
+};
+
+/** a string interner, storing each distinct string once in an arena.
+ *
+ * interning the same string twice returns the same view, so interned
+ * strings can be compared by their data pointer.
+ * lookups use an open-addressing table with no per-string allocation.
+ *
+ * NOTE: not thread-safe, concurrent reads through `find` are fine as
+ *       long as nothing is interned meanwhile.
+ */
+class StringPool final {
+  struct Slot final {
+    const char *data = nullptr;
+    uint32_t    size = 0;
+    uint32_t    hash = 0;  // low bits of the full hash.
+  };
+
+  StringArena       arena_;
+  std::vector<Slot> slots_{};
+  std::size_t       count_ = 0;
+
+ public:
+  explicit StringPool(
+      std::size_t block_size = StringArena::default_block_size) noexcept
+    : arena_(block_size)
+  {}
+
+  StringPool(StringPool&&) noexcept = default;
+  StringPool& operator=(StringPool&&) noexcept = default;
+
+  /** stores `str` if it isn't already in pool.
+   *
+   * @returns a view to the pooled string equal to `str`, which lives
+   *          as long as the pool.
+   */
+  std::string_view intern(std::string_view str)
+  {
+    if (str.empty())
+      return std::string_view{};
+
+    if ((count_ + 1) * 2 > slots_.size())
+      rehash(std::max<std::size_t>(slots_.size() * 2, 64));
+
+    const auto hash = uint32_t(fnv1a(str));
+    auto& slot = slots_[probe(str, hash)];
+
+    if (!slot.data) {
+      const auto stored = arena_.store(str);
+      slot = Slot{ stored.data(), uint32_t(stored.size()), hash };
+      ++count_;
+    }
+
+    return std::string_view(slot.data, slot.size);
+  }
+
+  /** looks up `str` without storing it.
+   *
+   * @returns view to the pooled string if `str` was interned before,
+   *          otherwise an empty view.
+   */
+  std::string_view find(std::string_view str) const noexcept
+  {
+    if (str.empty() || slots_.empty())
+      return std::string_view{};
+
+    const auto& slot = slots_[probe(str, uint32_t(fnv1a(str)))];
+    return std::string_view(slot.data, slot.size);
+  }
+
+  bool contains(std::string_view str) const noexcept
+  {
+    return !find(str).empty();
+  }
+
+  /** count of distinct strings interned. */
+  std::size_t size() const noexcept { return count_; }
+
+  bool empty() const noexcept { return count_ == 0; }
+
+  const StringArena& arena() const noexcept { return arena_; }
+
+  /** removes all strings, invalidating all views given out so far. */
+  void clear() noexcept
+  {
+    arena_.clear();
+    slots_.clear();
+    count_ = 0;
+  }
+
+ private:
+  std::size_t probe(std::string_view str, uint32_t hash) const noexcept
+  {
+    const std::size_t mask = slots_.size() - 1;
+
+    for (std::size_t idx = hash & mask; ; idx = (idx + 1) & mask) {
+      const auto& slot = slots_[idx];
+      if (!slot.data)
+        return idx;
+
+      if (slot.hash == hash && std::string_view(slot.data, slot.size) == str)
+        return idx;
+    }
+  }
+
+  void rehash(std::size_t capacity)
+  {
+    std::vector<Slot> old = std::exchange(slots_, std::vector<Slot>(capacity));
+
+    const std::size_t mask = capacity - 1;
+    for (const auto& slot : old) {
+      if (!slot.data)
+        continue;
+
+      auto idx = slot.hash & mask;
+      while (slots_[idx].data)
+        idx = (idx + 1) & mask;
+
+      slots_[idx] = slot;
+    }
+  }
+};
+
+}  // namespace gviz::strings
+
+#endif  // GVIZARD_STRINGS_STRING_POOL_HPP_
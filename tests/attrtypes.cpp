@@ -1,3 +1,7 @@
+#include <cstring>
+#include <string>
+#include <string_view>
+
 #include <catch2/catch.hpp>
 
 #include <gvizard/attrtypes/addible.hpp>
@@ -61,6 +65,48 @@ TEST_CASE("[attrtypes::EscString]")
   REQUIRE(empty_escstring.apply() == "");
   REQUIRE(empty_escstring.apply(escnameset) == "");
   REQUIRE(empty_escstring.get_occurences().sum() == 0);
+
+  SECTION("apply_to writes the same output without returning a string")
+  {
+    char buffer[128] = {};
+    REQUIRE(escstring.apply_size(escnameset) < sizeof(buffer));
+
+    const char *end = escstring.apply_to(buffer, escnameset);
+    REQUIRE(std::string_view(buffer, end - buffer) == expected_result);
+
+    std::string strbuf = "prefix: ";
+    REQUIRE(escstring.apply_to(strbuf, escnameset)
+            == std::strlen(expected_result));
+    REQUIRE(strbuf == std::string("prefix: ") + expected_result);
+  }
+
+  SECTION("escaped backslashes and unknown escapes are kept literal")
+  {
+    const EscString<> escaped = "a\\\\Gb \\x \\N\\";
+
+    REQUIRE(escaped.get_occurences().graph == 0);
+    REQUIRE(escaped.get_occurences().node  == 1);
+    REQUIRE(escaped.apply(escnameset) == "a\\Gb \\x A Node\\");
+    REQUIRE(escaped.apply(escnameset).size()
+            <= escaped.apply_size(escnameset));
+  }
+
+  SECTION("long formats with sparse escapes")
+  {
+    std::string format(8192, '-');
+    format.replace(100, 2, "\\N");
+    format.replace(5000, 2, "\\E");
+
+    const EscString<> long_escstring = format;
+
+    std::string expected = format;
+    expected.replace(5000, 2, "An Edge");
+    expected.replace(100, 2, "A Node");
+
+    REQUIRE(long_escstring.get_occurences().sum() == 2);
+    REQUIRE(long_escstring.apply(escnameset) == expected);
+    REQUIRE(long_escstring.apply_size(escnameset) == expected.size());
+  }
 }
 
 TEST_CASE("[attrtypes::PackMode]")
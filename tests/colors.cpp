@@ -1,10 +1,20 @@
 #include "gvizard/colors/rgb.hpp"
 #include "gvizard/colors/x11.hpp"
+#include <algorithm>
+#include <iterator>
 #include <string_view>
+#include <vector>
 #include <catch2/catch.hpp>
 
+#include <gvizard/colors/batch.hpp>
+#include <gvizard/colors/brewer.hpp>
 #include <gvizard/colors/color.hpp>
 #include <gvizard/colors/converter.hpp>
+#include <gvizard/colors/format.hpp>
+#include <gvizard/colors/gradient.hpp>
+#include <gvizard/colors/names.hpp>
+#include <gvizard/colors/nearest.hpp>
+#include <gvizard/colors/packed.hpp>
 #include <gvizard/utils.hpp>
 
 namespace c = gviz::colors;
@@ -153,3 +163,415 @@ TEST_CASE("[colors::x11]")
   REQUIRE(brown.get_name() == std::string_view("brown"));
 }
 
+
+TEST_CASE("[colors::names]")
+{
+  static_assert(c::find_x11_color("lightgoldenrodyellow")
+                == c::X11ColorEnum::lightgoldenrodyellow);
+
+  SECTION("every name of both tables is found")
+  {
+    for (std::size_t i = 0; i < std::size(c::X11Color::list); ++i)
+      REQUIRE(c::find_x11_color(c::X11Color::list[i].name)
+              == c::X11ColorEnum(i));
+
+    for (std::size_t i = 0; i < std::size(c::SVGColor::list); ++i)
+      REQUIRE(c::find_svg_color(c::SVGColor::list[i].name)
+              == c::SVGColorEnum(i));
+  }
+
+  SECTION("case-insensitive, unknown names are rejected")
+  {
+    REQUIRE(c::find_x11_color("AliceBlue") == c::X11ColorEnum::aliceblue);
+    REQUIRE(c::find_svg_color("FUCHSIA") == c::SVGColorEnum::fuchsia);
+
+    REQUIRE_FALSE(c::find_x11_color("").has_value());
+    REQUIRE_FALSE(c::find_x11_color("fuchsia").has_value()); // svg only
+    REQUIRE_FALSE(c::find_svg_color("azure1").has_value());  // x11 only
+    REQUIRE_FALSE(c::find_x11_color("aliceblu").has_value());
+  }
+
+  SECTION("scheme resolution")
+  {
+    const auto x11_gray = c::resolve_color_name("gray");
+    const auto svg_gray = c::resolve_color_name("gray", c::SchemeEnum::SVG);
+
+    REQUIRE(x11_gray->scheme == c::SchemeEnum::X11);
+    REQUIRE(x11_gray->color == c::RGB{ 190, 190, 190 });
+    REQUIRE(svg_gray->scheme == c::SchemeEnum::SVG);
+    REQUIRE(svg_gray->color == c::RGB{ 128, 128, 128 });
+
+    REQUIRE(c::resolve_color_name("/svg/gray", c::SchemeEnum::X11)
+            == svg_gray);
+    REQUIRE(c::resolve_color_name("/X11/gray", c::SchemeEnum::SVG)
+            == x11_gray);
+    REQUIRE(c::resolve_color_name("//gray", c::SchemeEnum::SVG) == x11_gray);
+
+    REQUIRE_FALSE(c::resolve_color_name("/nope/gray").has_value());
+    REQUIRE_FALSE(c::resolve_color_name("/svg/azure1").has_value());
+  }
+}
+
+TEST_CASE("[colors::PackedColor]")
+{
+  static_assert(sizeof(c::PackedColor) == sizeof(uint64_t));
+
+  constexpr c::PackedColor red_rgb = c::RGB{ 255, 0, 0 };
+  constexpr c::PackedColor red_x11 = c::X11ColorEnum::red;
+  constexpr c::PackedColor red_svg = c::SVGColorEnum::red;
+
+  static_assert(red_rgb == red_x11);
+  static_assert(red_x11.get_name() == "red");
+
+  REQUIRE_FALSE(red_rgb.is_named());
+  REQUIRE(red_x11.get_x11_enum() == c::X11ColorEnum::red);
+  REQUIRE(red_svg.get_svg_enum() == c::SVGColorEnum::red);
+  REQUIRE_FALSE(red_svg.get_x11_enum().has_value());
+
+  REQUIRE(red_x11.rgba() == c::RGBA{ 255, 0, 0, 255 });
+  REQUIRE(red_x11.unnamed().bits() == red_rgb.bits());
+  REQUIRE(c::PackedColorHash{}(red_x11) == c::PackedColorHash{}(red_svg));
+
+  REQUIRE(c::PackedColor(c::RGBA{ 255, 0, 0, 128 }) != red_rgb);
+
+  SECTION("conversion from and to Color")
+  {
+    const c::Color colors[] = {
+      c::RGB{ 1, 2, 3 },
+      c::RGBA{ 1, 2, 3, 4 },
+      c::X11ColorEnum::lightgoldenrodyellow,
+      c::SVGColor(c::SVGColorEnum::teal),
+      c::SchemeColor<c::RGB>{ "navy", c::RGB{ 0, 0, 128 }, c::SchemeEnum::SVG },
+    };
+
+    for (const auto& color : colors) {
+      const auto packed = Converter<c::Color, c::PackedColor>::convert(color);
+
+      REQUIRE(packed.rgba() == color.as<c::RGBA>());
+      REQUIRE(Converter<c::PackedColor, c::RGB>::convert(packed)
+              == color.as<c::RGB>());
+    }
+
+    const auto navy =
+      Converter<c::Color, c::PackedColor>::convert(colors[4]);
+    REQUIRE(navy.get_svg_enum() == c::SVGColorEnum::navy);
+
+    // a name which doesn't match its color isn't kept.
+    const auto fake = c::PackedColor::from(
+        c::SchemeColor<c::RGB>{ "navy", c::RGB{ 1, 1, 1 }, c::SchemeEnum::SVG });
+    REQUIRE_FALSE(fake.is_named());
+  }
+}
+
+TEST_CASE("[colors::batch]")
+{
+  std::vector<c::RGB> rgbs{};
+  for (int r = 0; r < 256; r += 5)
+    for (int g = 0; g < 256; g += 3)
+      for (int b = 0; b < 256; b += 7)
+        rgbs.emplace_back(uint8_t(r), uint8_t(g), uint8_t(b));
+
+  // grays and a count which isn't a multiple of the lanes.
+  for (int v = 0; v < 256; v += 15)
+    rgbs.emplace_back(uint8_t(v), uint8_t(v), uint8_t(v));
+  REQUIRE(rgbs.size() % c::batch::detail::lanes != 0);
+
+  std::vector<c::HSV> hsvs{};
+  for (const auto& rgb : rgbs)
+    hsvs.push_back(Converter<c::RGB, c::HSV>::convert(rgb));
+
+  SECTION("RGB to HSV")
+  {
+    REQUIRE(c::batch::convert<c::HSV>(rgbs) == hsvs);
+
+    // kernels are checked directly, as convert() only uses them on
+    // targets with wide enough vectors.
+    for (std::size_t i = 0; i + c::batch::detail::lanes <= rgbs.size();
+         i += c::batch::detail::lanes)
+    {
+      std::vector<c::HSV> block{};
+      c::batch::detail::rgb_to_hsv_block(
+          rgbs.data() + i, c::batch::detail::lanes, std::back_inserter(block));
+
+      REQUIRE(std::equal(block.begin(), block.end(), hsvs.begin() + i));
+    }
+  }
+
+  SECTION("HSV to RGBA")
+  {
+    std::vector<c::RGBA> rgbas{};
+    for (const auto& hsv : hsvs)
+      rgbas.push_back(Converter<c::HSV, c::RGBA>::convert(hsv));
+
+    REQUIRE(c::batch::convert<c::RGBA>(hsvs) == rgbas);
+
+    for (std::size_t i = 0; i + c::batch::detail::lanes <= hsvs.size();
+         i += c::batch::detail::lanes)
+    {
+      std::vector<c::RGBA> block{};
+      c::batch::detail::hsv_to_rgb_block<c::RGBA>(
+          hsvs.data() + i, c::batch::detail::lanes, std::back_inserter(block));
+
+      REQUIRE(std::equal(block.begin(), block.end(), rgbas.begin() + i));
+    }
+  }
+
+  SECTION("grays keep their value")
+  {
+    REQUIRE(Converter<c::RGB, c::HSV>::convert(c::RGB{ 128, 128, 128 })
+            == c::HSV(0., 0., 128. / 255.));
+    REQUIRE(Converter<c::HSV, c::RGB>::convert(c::HSV(0.5, 0., 128. / 255.))
+            == c::RGB{ 128, 128, 128 });
+  }
+}
+
+TEST_CASE("[colors::Gradient]")
+{
+  using Weighted = c::WeightedColor<c::RGBA>;
+
+  const auto packed = [](const c::RGBA& color) { return color.to_binary(); };
+
+  const std::vector<Weighted> list = {
+    { c::RGBA{ 255, 0, 0, 255 }, 0. },
+    { c::RGBA{ 0, 255, 0, 128 }, 0. },
+    { c::RGBA{ 0, 0, 255, 0 }, 0. },
+  };
+
+  SECTION("stops and bands")
+  {
+    const c::Gradient gradient(list);
+
+    REQUIRE(gradient.at(0.f)  == packed(list[0].get_color()));
+    REQUIRE(gradient.at(.5f)  == packed(list[1].get_color()));
+    REQUIRE(gradient.at(1.f)  == packed(list[2].get_color()));
+    REQUIRE(gradient.at(.25f) == packed(c::RGBA{ 128, 128, 0, 192 }));
+    REQUIRE(gradient.at(-1.f) == gradient.at(0.f));
+
+    REQUIRE(gradient.band_at(0.f)  == 0);
+    REQUIRE(gradient.band_at(.5f)  == 1);
+    REQUIRE(gradient.band_at(.9f)  == 2);
+    REQUIRE(gradient.band_at(1.f)  == 2);
+
+    // zero weights share what the given ones leave.
+    const c::Gradient weighted(std::vector<Weighted>{
+        { c::RGBA{ 0, 0, 0, 255 }, .5 },
+        { c::RGBA{ 0, 0, 0, 255 }, 0. },
+        { c::RGBA{ 0, 0, 0, 255 }, 0. } });
+
+    REQUIRE(weighted.band_at(.49f) == 0);
+    REQUIRE(weighted.band_at(.51f) == 1);
+    REQUIRE(weighted.band_at(.76f) == 2);
+
+    REQUIRE_THROWS_AS(c::Gradient(std::vector<Weighted>{}),
+                      std::invalid_argument);
+  }
+
+  SECTION("sampling matches single lookups")
+  {
+    for (const auto space : { c::GradientSpace::RGB, c::GradientSpace::HSV })
+      for (const std::size_t count : { 1, 2, 7, 8, 100, 1001 }) {
+        const c::Gradient gradient(list, space);
+
+        std::vector<uint32_t> samples(count);
+        gradient.sample(count, samples.data());
+
+        for (std::size_t i = 0; i < count; ++i)
+          REQUIRE(samples[i]
+                  == gradient.at(count > 1 ? i / float(count - 1) : 0.f));
+      }
+  }
+
+  SECTION("HSV takes the shorter way around")
+  {
+    // red to magenta passes neither green nor yellow.
+    const c::Gradient gradient(std::vector<Weighted>{
+        { c::RGBA{ 255, 0, 0, 255 }, 0. },
+        { c::RGBA{ 255, 0, 255, 255 }, 0. } }, c::GradientSpace::HSV);
+
+    std::vector<uint32_t> samples(64);
+    gradient.sample(samples.size(), samples.data());
+
+    for (const auto sample : samples)
+      REQUIRE(((sample >> 8) & 0xff) == 0);
+
+    // stops are as lossy as Converter<HSV, RGBA>.
+    const auto magenta = Converter<c::RGBA, c::HSV>::convert(
+        c::RGBA{ 255, 0, 255, 255 });
+    REQUIRE(samples.back()
+            == packed(Converter<c::HSV, c::RGBA>::convert(magenta)));
+  }
+}
+
+TEST_CASE("[colors::format_to]")
+{
+  char buffer[64];
+
+  const auto format = [&](const auto& color,
+                          c::SchemeEnum scheme = c::SchemeEnum::X11) {
+    const auto [ptr, ec] =
+      c::format_to(buffer, buffer + sizeof(buffer), color, scheme);
+
+    REQUIRE(ec == std::errc{});
+    return std::string_view(buffer, std::size_t(ptr - buffer));
+  };
+
+  REQUIRE(format(c::RGB{ 0, 128, 255 }) == "#0080ff");
+  REQUIRE(format(c::RGBA{ 0xde, 0xad, 0xbe, 0xef }) == "#deadbeef");
+  REQUIRE(format(c::HSV(0., 0.5, 1.)) == "0.000,0.500,1.000");
+
+  REQUIRE(format(c::X11ColorEnum::lightgoldenrodyellow)
+          == "lightgoldenrodyellow");
+  REQUIRE(format(c::SVGColor(c::SVGColorEnum::teal)) == "/svg/teal");
+  REQUIRE(format(c::SVGColorEnum::teal, c::SchemeEnum::SVG) == "teal");
+  REQUIRE(format(c::X11ColorEnum::red, c::SchemeEnum::SVG) == "/x11/red");
+
+  REQUIRE(format(c::SchemeColor<c::RGB>{ "navy", c::RGB{ 0, 0, 128 },
+                                         c::SchemeEnum::X11 }) == "navy");
+  REQUIRE(format(c::SchemeColor<c::RGB>{ nullptr, c::RGB{ 0, 0, 128 },
+                                         c::SchemeEnum::X11 }) == "#000080");
+
+  SECTION("Color and PackedColor")
+  {
+    REQUIRE(format(c::Color{ c::RGB{ 1, 2, 3 } }) == "#010203");
+    REQUIRE(format(c::Color{ c::X11ColorEnum::red }) == "red");
+
+    REQUIRE(format(c::PackedColor(c::X11ColorEnum::red)) == "red");
+    REQUIRE(format(c::PackedColor(c::RGB{ 255, 0, 0 })) == "#ff0000");
+    REQUIRE(format(c::PackedColor(c::RGBA{ 255, 0, 0, 16 })) == "#ff000010");
+  }
+
+  SECTION("weighted colors")
+  {
+    const std::vector<c::WeightedColor<c::Color>> list = {
+      { c::X11ColorEnum::red, 0.25 },
+      { c::RGB{ 0, 0, 255 }, 0.5 },
+      { c::SVGColorEnum::green, 1. },
+    };
+
+    REQUIRE(format(list) == "red;0.25:#0000ff;0.5:/svg/green;1");
+    auto first = list[0];
+    REQUIRE(format(first.set_weight(0.)) == "red;0");
+  }
+
+  SECTION("buffer too small")
+  {
+    const auto [ptr, ec] =
+      c::format_to(buffer, buffer + 6, c::RGB{ 0, 128, 255 });
+
+    REQUIRE(ec == std::errc::value_too_large);
+    REQUIRE(ptr == buffer + 6);
+  }
+}
+
+TEST_CASE("[colors::nearest_named]")
+{
+  static_assert(c::nearest_named(c::RGB{ 255, 0, 0 }, c::SchemeEnum::X11)
+                  .color == c::RGB{ 255, 0, 0 });
+
+  SECTION("exact reverse lookup")
+  {
+    for (const auto& named : c::X11Color::list) {
+      const auto found = c::find_color_name(named.color, c::SchemeEnum::X11);
+
+      REQUIRE(found.has_value());
+      REQUIRE(found->color == named.color);
+    }
+
+    // of equal colors, the first of table is found.
+    REQUIRE(std::string_view(
+              c::find_color_name(c::RGB{ 127, 255, 212 }, c::SchemeEnum::X11)
+                ->name) == "aquamarine");
+    REQUIRE(std::string_view(
+              c::find_color_name(c::RGB{ 0, 128, 128 }, c::SchemeEnum::SVG)
+                ->name) == "teal");
+
+    REQUIRE_FALSE(
+      c::find_color_name(c::RGB{ 1, 2, 3 }, c::SchemeEnum::SVG).has_value());
+  }
+
+  SECTION("nearest matches a linear scan")
+  {
+    const auto scan = [](const auto& list, const c::RGB& color) {
+      std::size_t best = 0;
+      for (std::size_t i = 1; i < std::size(list); ++i)
+        if (c::color_distance(color, list[i].color)
+            < c::color_distance(color, list[best].color))
+          best = i;
+
+      return list[best];
+    };
+
+    for (int r = 0; r < 256; r += 15)
+      for (int g = 0; g < 256; g += 15)
+        for (int b = 0; b < 256; b += 15) {
+          const c::RGB color{ uint8_t(r), uint8_t(g), uint8_t(b) };
+
+          REQUIRE(c::nearest_named(color, c::SchemeEnum::X11)
+                  == scan(c::X11Color::list, color));
+          REQUIRE(c::nearest_named(color, c::SchemeEnum::SVG)
+                  == scan(c::SVGColor::list, color));
+        }
+  }
+}
+
+TEST_CASE("[colors::BrewerColor]")
+{
+  static_assert(c::BrewerColor(c::SchemeEnum::blues9, 9).get_color().color
+                == c::RGB{ 8, 48, 107 });
+  static_assert(c::is_brewer_scheme(c::SchemeEnum::set312));
+  static_assert(!c::is_brewer_scheme(c::SchemeEnum::SVG));
+
+  REQUIRE(c::BrewerColor::find(c::SchemeEnum::set312, 12)->color
+          == c::RGB{ 255, 237, 111 });
+  REQUIRE_FALSE(c::BrewerColor::find(c::SchemeEnum::set312, 13).has_value());
+  REQUIRE_FALSE(c::BrewerColor::find(c::SchemeEnum::set312, 0).has_value());
+  REQUIRE_FALSE(c::BrewerColor::find(c::SchemeEnum::X11, 1).has_value());
+  REQUIRE_THROWS_AS(c::BrewerColor(c::SchemeEnum::accent3, 4),
+                    std::invalid_argument);
+
+  // every scheme's colors are its own and in range.
+  for (const auto& info : c::BrewerColor::schemes) {
+    const auto scheme = c::parse_scheme(info.name);
+    REQUIRE(scheme.has_value());
+    REQUIRE(c::scheme_name(*scheme) == info.name);
+
+    for (std::size_t i = 0; i < info.size; ++i)
+      REQUIRE(c::BrewerColor::list[info.offset + i].scheme == *scheme);
+  }
+
+  SECTION("names")
+  {
+    const auto blue = c::resolve_color_name("/blues9/9");
+    REQUIRE(blue.has_value());
+    REQUIRE(blue->color == c::RGB{ 8, 48, 107 });
+
+    REQUIRE(c::find_named_color("3", c::SchemeEnum::accent3).has_value());
+    REQUIRE_FALSE(c::find_named_color("4", c::SchemeEnum::accent3));
+    REQUIRE_FALSE(c::find_named_color("x", c::SchemeEnum::accent3));
+    REQUIRE_FALSE(c::parse_scheme("blues10").has_value());
+    REQUIRE(c::parse_scheme("BrBG11") == c::SchemeEnum::brbg11);
+  }
+
+  SECTION("packing and formatting")
+  {
+    const c::BrewerColor color{ c::SchemeEnum::rdylgn5, 2 };
+
+    const auto packed = c::PackedColor::from(color);
+    REQUIRE(packed.get_scheme() == c::SchemeEnum::rdylgn5);
+    REQUIRE(packed.get_name() == "2");
+    REQUIRE(packed.rgb() == color.get_color().color);
+
+    REQUIRE(c::PackedColor::from(c::Color{ color }).get_scheme()
+            == c::SchemeEnum::rdylgn5);
+
+    char buffer[c::max_color_length];
+    const auto [ptr, ec] =
+      c::format_to(buffer, buffer + sizeof(buffer), packed);
+    REQUIRE(ec == std::errc{});
+    REQUIRE(std::string_view(buffer, std::size_t(ptr - buffer))
+            == "/rdylgn5/2");
+
+    REQUIRE(c::nearest_named(c::RGB{ 250, 250, 250 }, c::SchemeEnum::greys3)
+              .color == c::RGB{ 240, 240, 240 });
+  }
+}
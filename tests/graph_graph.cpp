@@ -1,4 +1,6 @@
 #include <cstddef>
+#include <string>
+#include <string_view>
 #include <utility>
 
 #include <catch2/catch.hpp>
@@ -249,3 +251,71 @@ TEST_CASE("[graph::Graph::undirected]")
     REQUIRE(graph.cluster_count() == 2);
   }
 }
+
+TEST_CASE("[graph::Graph::node_names]")
+{
+  using Graph =
+    graph::Graph<registry::EnTTRegistry, graph::GraphDir::directed>;
+
+  Graph graph;
+
+  auto node_a = graph.create_node();
+  auto node_b = graph.create_node();
+
+  REQUIRE(graph.get_node_name(node_a) == std::string_view{});
+  REQUIRE_FALSE(graph.find_node("a").has_value());
+
+  REQUIRE(graph.set_node_name(node_a, "a"));
+  REQUIRE(graph.set_node_name(node_b, std::string("b")));
+  REQUIRE_FALSE(graph.set_node_name(node_b, "a")); // taken by node_a
+
+  REQUIRE(graph.get_node_name(node_a) == std::string_view("a"));
+  REQUIRE(graph.find_node("a") == node_a);
+  REQUIRE(graph.find_node("b") == node_b);
+
+  SECTION("renaming frees the old name")
+  {
+    REQUIRE(graph.set_node_name(node_a, "c"));
+    REQUIRE_FALSE(graph.find_node("a").has_value());
+    REQUIRE(graph.find_node("c") == node_a);
+
+    REQUIRE(graph.set_node_name(node_b, "a"));
+    REQUIRE(graph.find_node("a") == node_b);
+
+    REQUIRE(graph.set_node_name(node_b, ""));
+    REQUIRE_FALSE(graph.find_node("a").has_value());
+  }
+
+  SECTION("remove_node keeps index consistent")
+  {
+    REQUIRE(graph.remove_node(node_a));
+    REQUIRE_FALSE(graph.find_node("a").has_value());
+    REQUIRE(graph.find_node("b") == node_b);
+
+    auto node_c = graph.get_or_create_node("a");
+    REQUIRE(node_c != node_b);
+    REQUIRE(graph.find_node("a") == node_c);
+    REQUIRE(graph.get_or_create_node("a") == node_c);
+    REQUIRE(graph.node_count() == 2);
+  }
+
+  SECTION("many names")
+  {
+    for (int i = 0; i < 5000; ++i)
+      graph.get_or_create_node("n" + std::to_string(i));
+
+    for (int i = 0; i < 5000; i += 2)
+      REQUIRE(graph.remove_node(*graph.find_node("n" + std::to_string(i))));
+
+    for (int i = 0; i < 5000; ++i) {
+      const auto name = "n" + std::to_string(i);
+      const auto node_id = graph.find_node(name);
+
+      REQUIRE(node_id.has_value() == (i % 2 == 1));
+      if (node_id)
+        REQUIRE(graph.get_node_name(*node_id) == std::string_view(name));
+    }
+
+    REQUIRE(graph.node_count() == 2 + 2500);
+  }
+}
@@ -0,0 +1,1739 @@
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <numeric>
+#include <random>
+#include <set>
+#include <stdexcept>
+#include <variant>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+#include <gvizard/graph/graph.hpp>
+#include <gvizard/layout/barnes_hut.hpp>
+#include <gvizard/layout/circular.hpp>
+#include <gvizard/layout/clusters.hpp>
+#include <gvizard/layout/coarsening.hpp>
+#include <gvizard/layout/components.hpp>
+#include <gvizard/layout/disjoint_sets.hpp>
+#include <gvizard/layout/force_directed.hpp>
+#include <gvizard/layout/layered.hpp>
+#include <gvizard/layout/layout_graph.hpp>
+#include <gvizard/layout/network_simplex.hpp>
+#include <gvizard/layout/osage.hpp>
+#include <gvizard/layout/overlap.hpp>
+#include <gvizard/layout/packing.hpp>
+#include <gvizard/layout/patchwork.hpp>
+#include <gvizard/layout/radial.hpp>
+#include <gvizard/layout/routing.hpp>
+#include <gvizard/layout/spatial_index.hpp>
+#include <gvizard/layout/stress.hpp>
+#include <gvizard/registry/entt_registry.hpp>
+
+#include <gvizard/attrs/area.hpp>
+#include <gvizard/attrs/boundingbox.hpp>
+#include <gvizard/attrs/height.hpp>
+#include <gvizard/attrs/pack.hpp>
+#include <gvizard/attrs/pos.hpp>
+#include <gvizard/attrs/rank.hpp>
+#include <gvizard/attrs/root.hpp>
+#include <gvizard/attrs/shape.hpp>
+#include <gvizard/attrs/sortv.hpp>
+#include <gvizard/attrs/splines.hpp>
+#include <gvizard/attrs/width.hpp>
+
+using namespace gviz;
+
+namespace {
+
+using Graph = graph::Graph<registry::EnTTRegistry, graph::GraphDir::directed>;
+
+using layout::LayoutEdge;
+using layout::LayoutGraph;
+using layout::LayoutNode;
+
+LayoutGraph make_graph(std::size_t node_count,
+                       const std::vector<std::pair<uint32_t, uint32_t>>& pairs)
+{
+  std::vector<LayoutEdge> edges{};
+  for (const auto& [source, target] : pairs)
+    edges.push_back(LayoutEdge{ source, target });
+  return LayoutGraph(std::vector<LayoutNode>(node_count), edges);
+}
+
+bool overlap(const layout::Point& lhs, const layout::Point& rhs,
+             double width, double height)
+{
+  return std::abs(lhs.x - rhs.x) < width && std::abs(lhs.y - rhs.y) < height;
+}
+
+}  // namespace
+
+TEST_CASE("[layout::LayoutGraph]")
+{
+  const auto graph = make_graph(3, { { 0, 1 }, { 0, 2 }, { 2, 1 } });
+
+  REQUIRE(graph.node_count() == 3);
+  REQUIRE(graph.edge_count() == 3);
+  REQUIRE(graph.node(0).width == 54.);
+
+  REQUIRE(std::vector<uint32_t>(graph.out_edges(0).begin(),
+                                graph.out_edges(0).end())
+          == std::vector<uint32_t>{ 0, 1 });
+  REQUIRE(std::vector<uint32_t>(graph.in_edges(1).begin(),
+                                graph.in_edges(1).end())
+          == std::vector<uint32_t>{ 0, 2 });
+  REQUIRE(graph.in_edges(0).empty());
+  REQUIRE(graph.opposite(2, 1) == 2);
+
+  REQUIRE_THROWS_AS(make_graph(2, { { 0, 2 } }), std::out_of_range);
+
+  SECTION("of a graph")
+  {
+    Graph source{};
+    auto a = source.create_node();
+    auto b = source.create_node();
+    auto e = source.create_edge(b, a).value();
+    source.set_entity_attr<attrs::Width>(b, attrs::Width(2.));
+
+    const auto input = layout::make_layout_input(source);
+    REQUIRE(input.nodes == std::vector<Graph::NodeId>{ a, b });
+    REQUIRE(input.edges == std::vector<Graph::EdgeId>{ e });
+    REQUIRE(input.graph.node(1).width == 144.);
+    REQUIRE(input.graph.edge(0).source == 1);
+    REQUIRE(input.graph.edge(0).target == 0);
+  }
+}
+
+TEST_CASE("[layout::DisjointSets]")
+{
+  layout::DisjointSets sets(5);
+  REQUIRE(sets.count() == 5);
+
+  sets.unite(0, 1);
+  sets.unite(3, 4);
+  sets.unite(1, 4);
+
+  REQUIRE(sets.count() == 2);
+  REQUIRE(sets.same(0, 3));
+  REQUIRE_FALSE(sets.same(0, 2));
+  REQUIRE(sets.size_of(4) == 4);
+}
+
+TEST_CASE("[layout::NetworkSimplex]")
+{
+  using Edge = layout::NetworkSimplex::Edge;
+
+  SECTION("pulls sources towards their heads")
+  {
+    // longest path ranking leaves node 5 at rank 0.
+    layout::NetworkSimplex simplex(6, { Edge{ 0, 1 }, Edge{ 1, 2 },
+                                        Edge{ 2, 3 }, Edge{ 3, 4 },
+                                        Edge{ 5, 4 } });
+    simplex.solve();
+    REQUIRE(simplex.ranks() == std::vector<int>{ 0, 1, 2, 3, 4, 3 });
+  }
+
+  SECTION("weights and minimum lengths")
+  {
+    layout::NetworkSimplex simplex(4, { Edge{ 0, 1, 2 }, Edge{ 1, 2 },
+                                        Edge{ 0, 3, 1, 1. },
+                                        Edge{ 3, 2, 1, 5. } });
+    simplex.solve();
+
+    const auto& ranks = simplex.ranks();
+    REQUIRE(ranks[1] - ranks[0] == 2);
+    REQUIRE(ranks[2] - ranks[3] == 1);
+    for (std::size_t edge = 0; edge < simplex.edges().size(); ++edge)
+      REQUIRE(simplex.slack(edge) >= 0);
+  }
+
+  SECTION("disconnected and cyclic graphs")
+  {
+    layout::NetworkSimplex parts(4, { Edge{ 0, 1 }, Edge{ 3, 2, 3 } });
+    parts.solve();
+    REQUIRE(parts.ranks()[1] - parts.ranks()[0] == 1);
+    REQUIRE(parts.ranks()[2] - parts.ranks()[3] == 3);
+
+    layout::NetworkSimplex cycle(2, { Edge{ 0, 1 }, Edge{ 1, 0 } });
+    REQUIRE_THROWS_AS(cycle.solve(), std::invalid_argument);
+  }
+}
+
+TEST_CASE("[layout::layered]")
+{
+  SECTION("ranks and separation")
+  {
+    // a diamond under a cycle closed by its bottom.
+    const auto graph = make_graph(5, { { 0, 1 }, { 0, 2 }, { 1, 3 },
+                                       { 2, 3 }, { 3, 0 }, { 0, 4 },
+                                       { 4, 3 }, { 1, 1 } });
+    const auto result = layout::layered(graph);
+
+    REQUIRE(result.positions.size() == 5);
+    REQUIRE(result.splines.size() == 8);
+
+    const auto& pos = result.positions;
+    REQUIRE(pos[0].y > pos[1].y);
+    REQUIRE(pos[1].y == pos[2].y);
+    REQUIRE(pos[2].y == pos[4].y);
+    REQUIRE(pos[1].y > pos[3].y);
+
+    // default size and separation, 0.75x0.5in nodes 0.25in apart.
+    for (std::size_t i = 0; i < pos.size(); ++i)
+      for (std::size_t j = i + 1; j < pos.size(); ++j)
+        REQUIRE_FALSE(overlap(pos[i], pos[j], 54. + 18., 36.));
+
+    REQUIRE(pos[0].y - pos[1].y == Approx(36. + 36.));
+
+    for (const auto& splines : result.splines) {
+      REQUIRE(splines.splines.size() == 1);
+      REQUIRE(splines.splines[0].endp);
+      REQUIRE_FALSE(splines.splines[0].triples.empty());
+    }
+
+    // the edge closing the cycle still points at node 0, from below.
+    const auto tip = std::get<attrtypes::Point2D<double>>(
+      result.splines[4].splines[0].endp->point);
+    REQUIRE(tip.y < pos[0].y);
+    REQUIRE(std::hypot((tip.x - pos[0].x) / 27., (tip.y - pos[0].y) / 18.)
+            == Approx(1.));
+  }
+
+  SECTION("options")
+  {
+    const auto graph = make_graph(4, { { 0, 1 }, { 1, 2 }, { 0, 3 } });
+
+    layout::LayeredOptions options{};
+    options.rankdir  = attrtypes::RankDir::left_right;
+    options.directed = false;
+    options.rank_groups.push_back(
+      layout::RankGroup{ attrtypes::RankType::same, { 2, 3 } });
+
+    const auto result = layout::layered(graph, options);
+    const auto& pos = result.positions;
+
+    REQUIRE(pos[0].x < pos[1].x);
+    REQUIRE(pos[1].x < pos[2].x);
+    REQUIRE(pos[2].x == pos[3].x);
+    REQUIRE(pos[0].x == 27.);
+    REQUIRE_FALSE(result.splines[0].splines[0].endp);
+
+    options.rank_groups = { layout::RankGroup{ attrtypes::RankType::max,
+                                               { 3 } } };
+    options.threads = 1;
+    const auto sunk = layout::layered(graph, options);
+    REQUIRE(sunk.positions[3].x == sunk.positions[2].x);
+  }
+
+  SECTION("no overlaps in random graphs")
+  {
+    // nodes of a rank overlap if any alignment mirrors part of a block.
+    std::mt19937 random(11);
+    for (int seed = 0; seed < 20; ++seed) {
+      const std::size_t count = 100 + random() % 150;
+      std::uniform_int_distribution<uint32_t> pick(0, uint32_t(count - 1));
+      std::vector<std::pair<uint32_t, uint32_t>> pairs{};
+      for (std::size_t i = 0; i < count * 3 / 2; ++i)
+        pairs.emplace_back(pick(random), pick(random));
+      const auto graph = make_graph(count, pairs);
+
+      for (auto rankdir : { attrtypes::RankDir::top_bottom,
+                            attrtypes::RankDir::left_right }) {
+        layout::LayeredOptions options{};
+        options.rankdir = rankdir;
+        const auto pos = layout::layered(graph, options).positions;
+        std::size_t overlaps = 0;
+        for (std::size_t i = 0; i < pos.size(); ++i)
+          for (std::size_t j = i + 1; j < pos.size(); ++j)
+            overlaps += overlap(pos[i], pos[j], 54. - 1e-6, 36. - 1e-6);
+        REQUIRE(overlaps == 0);
+      }
+    }
+  }
+
+  SECTION("a graph")
+  {
+    Graph graph{};
+    auto a = graph.create_node();
+    auto b = graph.create_node();
+    auto c = graph.create_node();
+    auto d = graph.create_node();
+    auto ab = graph.create_edge(a, b).value();
+    graph.create_edge(a, c);
+    graph.create_edge(a, d);
+
+    auto cluster = graph.create_cluster();
+    graph.add_to_cluster(cluster, b);
+    graph.add_to_cluster(cluster, a);
+    graph.set_entity_attr<attrs::Rank>(cluster,
+                                       attrs::Rank(attrtypes::RankType::same));
+
+    layout::layered_layout(graph);
+
+    const auto point_of = [&](auto node) {
+      const auto& pos = graph.get_entity_attr<attrs::Pos>(node)->get_value();
+      return std::get<attrtypes::Point2D<double>>(
+        std::get<attrtypes::PointType<double>>(*pos).point);
+    };
+
+    REQUIRE(point_of(a).y == point_of(b).y);
+    REQUIRE(point_of(c).y == point_of(d).y);
+    REQUIRE(point_of(a).y > point_of(c).y);
+
+    const auto& pos = graph.get_entity_attr<attrs::Pos>(ab)->get_value();
+    REQUIRE(std::holds_alternative<attrtypes::SplineType<std::vector>>(*pos));
+  }
+}
+
+TEST_CASE("[layout::BarnesHut]")
+{
+  std::mt19937 random(7);
+  std::uniform_real_distribution<double> coord(-10., 10.);
+
+  layout::Coords<3> coords{};
+  std::vector<double> masses{};
+  for (int i = 0; i < 300; ++i) {
+    for (auto& axis : coords)
+      axis.push_back(coord(random));
+    masses.push_back(1. + i % 3);
+  }
+
+  // exact repulsion, of inverse distance.
+  layout::Coords<3> exact{};
+  for (auto& axis : exact)
+    axis.assign(300, 0.);
+  for (std::size_t i = 0; i < 300; ++i)
+    for (std::size_t j = 0; j < 300; ++j) {
+      double distance2 = 0.;
+      for (std::size_t axis = 0; axis < 3; ++axis)
+        distance2 += std::pow(coords[axis][i] - coords[axis][j], 2.);
+      if (i == j)
+        continue;
+      for (std::size_t axis = 0; axis < 3; ++axis)
+        exact[axis][i] += (coords[axis][i] - coords[axis][j])
+                          * masses[i] * masses[j] / distance2;
+    }
+
+  layout::BarnesHut<3> tree{};
+  tree.build(coords, masses);
+  REQUIRE(tree.leaf_count() > 1);
+
+  const auto repulsion = [&](double theta) {
+    layout::Coords<3> forces{};
+    for (auto& axis : forces)
+      axis.assign(300, 0.);
+    tree.add_repulsion(forces, 1., 1., theta, 2);
+    return forces;
+  };
+
+  const auto exactly = repulsion(0.);
+  for (std::size_t axis = 0; axis < 3; ++axis)
+    for (std::size_t i = 0; i < 300; ++i)
+      REQUIRE(exactly[axis][i] == Approx(exact[axis][i]).margin(1e-9));
+
+  // far cells by their center of mass err by a few percent.
+  const auto roughly = repulsion(.5);
+  double error = 0., norm = 0.;
+  for (std::size_t axis = 0; axis < 3; ++axis)
+    for (std::size_t i = 0; i < 300; ++i) {
+      error += std::pow(roughly[axis][i] - exact[axis][i], 2.);
+      norm  += std::pow(exact[axis][i], 2.);
+    }
+  REQUIRE(std::sqrt(error / norm) < .05);
+}
+
+TEST_CASE("[layout::coarsen]")
+{
+  // a grid of 20 by 20, with a heavier row.
+  std::vector<LayoutEdge> edges{};
+  for (uint32_t row = 0; row < 20; ++row)
+    for (uint32_t col = 0; col < 20; ++col) {
+      if (col + 1 < 20)
+        edges.push_back(LayoutEdge{ row * 20 + col, row * 20 + col + 1,
+                                    row == 5 ? 4. : 1. });
+      if (row + 1 < 20)
+        edges.push_back(LayoutEdge{ row * 20 + col, (row + 1) * 20 + col });
+    }
+  const LayoutGraph grid(std::vector<LayoutNode>(400), edges);
+
+  const auto check = [](const LayoutGraph& graph,
+                        const std::vector<layout::CoarseLevel>& levels,
+                        const layout::CoarseningOptions& options) {
+    REQUIRE(!levels.empty());
+    REQUIRE(levels.back().graph.node_count() <= options.min_nodes);
+
+    const LayoutGraph *finer = &graph;
+    double weight = 0.;
+    for (const auto& edge : graph.edges())
+      weight += edge.weight;
+
+    for (const auto& level : levels) {
+      const auto& coarse = level.graph;
+      REQUIRE(level.parents.size() == finer->node_count());
+      REQUIRE(coarse.node_count()
+              <= options.max_ratio * double(finer->node_count()));
+
+      // groups are linked, and so are groups of linked nodes.
+      std::vector<double> internal(coarse.node_count(), 0.);
+      for (const auto& edge : finer->edges()) {
+        const auto source = level.parents[edge.source];
+        const auto target = level.parents[edge.target];
+        if (source == target)
+          internal[source] += edge.weight;
+      }
+      double sum = 0.;
+      for (std::size_t node = 0; node < coarse.node_count(); ++node) {
+        sum += internal[node];
+        REQUIRE(level.masses[node] >= 1.);
+      }
+      for (const auto& edge : coarse.edges()) {
+        REQUIRE(edge.source < edge.target);
+        sum += edge.weight;
+      }
+      REQUIRE(sum == Approx(weight));
+      weight = sum - std::accumulate(internal.begin(), internal.end(), 0.);
+
+      double mass = 0.;
+      for (auto value : level.masses)
+        mass += value;
+      REQUIRE(mass == 400.);
+      finer = &coarse;
+    }
+  };
+
+  layout::CoarseningOptions options{};
+  options.threads = 1;
+  const auto matched = layout::coarsen(grid, options);
+  check(grid, matched, options);
+
+  // nodes pair up along heavier edges first.
+  std::size_t along = 0;
+  for (uint32_t col = 0; col + 1 < 20; ++col)
+    along += matched[0].parents[100 + col] == matched[0].parents[101 + col];
+  REQUIRE(along >= 9);
+
+  options.threads = 4;
+  const auto threaded = layout::coarsen(grid, options);
+  REQUIRE(threaded.size() == matched.size());
+  for (std::size_t level = 0; level < matched.size(); ++level)
+    REQUIRE(threaded[level].parents == matched[level].parents);
+
+  options.scheme = layout::CoarseningScheme::independent_set;
+  check(grid, layout::coarsen(grid, options), options);
+
+  // small graphs aren't coarsened.
+  REQUIRE(layout::coarsen(make_graph(50, { { 0, 1 } })).empty());
+
+  SECTION("stars")
+  {
+    // matching merges one leaf at a time, so the hub gathers them.
+    std::vector<std::pair<uint32_t, uint32_t>> pairs{};
+    for (uint32_t leaf = 1; leaf < 200; ++leaf)
+      pairs.emplace_back(0, leaf);
+    const auto star = layout::coarsen(make_graph(200, pairs));
+    REQUIRE(star.size() == 1);
+    REQUIRE(star[0].graph.node_count() == 1);
+    REQUIRE(star[0].masses[0] == 200.);
+  }
+
+  SECTION("prolong")
+  {
+    const auto& level = matched[0];
+    layout::Coords<2> coarse{};
+    for (std::size_t node = 0; node < level.graph.node_count(); ++node) {
+      coarse[0].push_back(double(node));
+      coarse[1].push_back(-double(node));
+    }
+
+    const auto fine = layout::prolong<2>(level, coarse, .1);
+    REQUIRE(fine[0].size() == 400);
+    for (std::size_t node = 0; node < 400; ++node) {
+      const auto parent = level.parents[node];
+      REQUIRE(std::abs(fine[0][node] - coarse[0][parent]) <= .1);
+      REQUIRE(std::abs(fine[1][node] - coarse[1][parent]) <= .1);
+    }
+    REQUIRE(fine[0][100] != fine[0][101]);
+  }
+}
+
+TEST_CASE("[layout::force_directed]")
+{
+  // a ring of 12 with spokes to a hub.
+  std::vector<std::pair<uint32_t, uint32_t>> pairs{};
+  for (uint32_t i = 0; i < 12; ++i) {
+    pairs.emplace_back(i, (i + 1) % 12);
+    pairs.emplace_back(12, i);
+  }
+  const auto graph = make_graph(13, pairs);
+
+  layout::ForceOptions options{};
+  options.threads = 1;
+  const auto result = layout::force_directed(graph, options);
+
+  const auto& pos = result.positions;
+  REQUIRE(pos.size() == 13);
+  REQUIRE(result.z.empty());
+
+  // the hub ends up amid the ring, linked nodes nearer than others.
+  layout::Point center{ 0., 0. };
+  for (std::size_t i = 0; i < 12; ++i)
+    center = center + pos[i];
+  REQUIRE(std::hypot(center.x / 12. - pos[12].x, center.y / 12. - pos[12].y)
+          < std::hypot(pos[0].x - pos[12].x, pos[0].y - pos[12].y) / 4.);
+  for (std::size_t i = 0; i < 12; ++i)
+    REQUIRE(std::hypot(pos[i].x - pos[(i + 1) % 12].x,
+                       pos[i].y - pos[(i + 1) % 12].y)
+            < std::hypot(pos[i].x - pos[(i + 6) % 12].x,
+                         pos[i].y - pos[(i + 6) % 12].y));
+
+  double left = pos[0].x, bottom = pos[0].y;
+  for (const auto& point : pos) {
+    left   = std::min(left, point.x);
+    bottom = std::min(bottom, point.y);
+  }
+  REQUIRE(left == Approx(27.));
+  REQUIRE(bottom == Approx(18.));
+
+  options.threads = 4;
+  const auto threaded = layout::force_directed(graph, options);
+  for (std::size_t i = 0; i < pos.size(); ++i) {
+    REQUIRE(threaded.positions[i].x == pos[i].x);
+    REQUIRE(threaded.positions[i].y == pos[i].y);
+  }
+
+  options.dim = 4;
+  REQUIRE_THROWS_AS(layout::force_directed(graph, options),
+                    std::invalid_argument);
+
+  SECTION("in 3 dimensions")
+  {
+    Graph source{};
+    auto a = source.create_node();
+    auto b = source.create_node();
+    auto c = source.create_node();
+    source.create_edge(a, b);
+    source.create_edge(b, c);
+
+    layout::ForceOptions in_space{};
+    in_space.dim = 3;
+    layout::force_directed_layout(source, in_space);
+
+    for (auto node : { a, b, c }) {
+      const auto& pos = source.get_entity_attr<attrs::Pos>(node)->get_value();
+      const auto& point = std::get<attrtypes::PointType<double>>(*pos).point;
+      REQUIRE(std::holds_alternative<attrtypes::Point3D<double>>(point));
+    }
+  }
+}
+
+TEST_CASE("[layout::stress]")
+{
+  const auto distance = [](const layout::Point& lhs,
+                           const layout::Point& rhs) {
+    return std::hypot(lhs.x - rhs.x, lhs.y - rhs.y);
+  };
+
+  // a path lies straight, nodes an inch apart.
+  const auto path = make_graph(5, { { 0, 1 }, { 1, 2 }, { 2, 3 }, { 3, 4 } });
+  layout::StressOptions options{};
+  options.threads = 1;
+
+  const auto straight = layout::stress(path, options);
+  REQUIRE(straight.positions.size() == 5);
+  for (uint32_t i = 0; i < 5; ++i)
+    for (uint32_t j = i + 1; j < 5; ++j)
+      REQUIRE(distance(straight.positions[i], straight.positions[j])
+              == Approx(72. * (j - i)).epsilon(.01));
+
+  // a grid keeps its shape, by all pairs or by pivots only.
+  std::vector<std::pair<uint32_t, uint32_t>> pairs{};
+  for (uint32_t row = 0; row < 8; ++row)
+    for (uint32_t col = 0; col < 8; ++col) {
+      if (col + 1 < 8)
+        pairs.emplace_back(row * 8 + col, row * 8 + col + 1);
+      if (row + 1 < 8)
+        pairs.emplace_back(row * 8 + col, (row + 1) * 8 + col);
+    }
+  const auto grid = make_graph(64, pairs);
+
+  // graph distances of diagonals are longer than drawn ones, so a grid
+  // grows a little beyond an inch per edge.
+  const auto check_grid = [&](const layout::Layout& result) {
+    double mean = 0.;
+    for (const auto& [source, target] : pairs)
+      mean += distance(result.positions[source], result.positions[target]);
+    mean /= double(pairs.size());
+    REQUIRE(mean == Approx(80.).epsilon(.15));
+
+    for (const auto& [source, target] : pairs)
+      REQUIRE(distance(result.positions[source], result.positions[target])
+              == Approx(mean).epsilon(.25));
+    REQUIRE(distance(result.positions[0], result.positions[63])
+            == Approx(mean * 7. * std::sqrt(2.)).epsilon(.1));
+  };
+
+  const auto full = layout::stress(grid, options);
+  check_grid(full);
+
+  options.threads = 4;
+  const auto threaded = layout::stress(grid, options);
+  for (std::size_t i = 0; i < 64; ++i) {
+    REQUIRE(threaded.positions[i].x == full.positions[i].x);
+    REQUIRE(threaded.positions[i].y == full.positions[i].y);
+  }
+
+  options.sparse_threshold = 0;
+  options.pivots = 10;
+  check_grid(layout::stress(grid, options));
+
+  options.sparse_threshold = 1000;
+  options.start = attrtypes::StartType(attrtypes::StartTypeStyle::random, 7);
+  check_grid(layout::stress(grid, options));
+  options.start = attrtypes::StartType(attrtypes::StartTypeStyle::regular);
+  options.maxiter = 1000;
+  options.epsilon = 1e-6;
+  check_grid(layout::stress(grid, options));
+
+  options.dim = 1;
+  REQUIRE_THROWS_AS(layout::stress(grid, options), std::invalid_argument);
+
+  SECTION("lengths and models")
+  {
+    // a triangle with a long side, and a node apart from it.
+    std::vector<LayoutEdge> edges{ LayoutEdge{ 0, 1 }, LayoutEdge{ 1, 2 },
+                                   LayoutEdge{ 0, 2 } };
+    edges[2].len = 3.;
+    const LayoutGraph triangle(std::vector<LayoutNode>(4), edges);
+
+    layout::StressOptions lengths{};
+    lengths.defaultdist = 5.;
+    auto result = layout::stress(triangle, lengths);
+    REQUIRE(distance(result.positions[0], result.positions[2])
+            == Approx(144.).epsilon(.1));
+    REQUIRE(distance(result.positions[0], result.positions[3])
+            > distance(result.positions[0], result.positions[2]));
+    const double by_path = distance(result.positions[0], result.positions[2]);
+
+    lengths.model = layout::to_stress_model("mds");
+    REQUIRE(lengths.model == layout::StressModel::mds);
+    REQUIRE(layout::to_stress_model("circuit")
+            == layout::StressModel::shortpath);
+    result = layout::stress(triangle, lengths);
+    REQUIRE(distance(result.positions[0], result.positions[2])
+            > by_path * 1.05);
+  }
+
+  SECTION("in 3 dimensions")
+  {
+    Graph source{};
+    auto a = source.create_node();
+    auto b = source.create_node();
+    auto c = source.create_node();
+    source.create_edge(a, b);
+    source.create_edge(b, c);
+
+    layout::StressOptions in_space{};
+    in_space.dim = 3;
+    layout::stress_layout(source, in_space);
+
+    for (auto node : { a, b, c }) {
+      const auto& pos = source.get_entity_attr<attrs::Pos>(node)->get_value();
+      const auto& point = std::get<attrtypes::PointType<double>>(*pos).point;
+      REQUIRE(std::holds_alternative<attrtypes::Point3D<double>>(point));
+    }
+  }
+}
+
+TEST_CASE("[layout::Components]")
+{
+  const auto graph = make_graph(7, { { 4, 0 }, { 2, 5 }, { 0, 6 } });
+  const layout::Components components(graph);
+
+  REQUIRE(components.count() == 4);
+  REQUIRE(components.component_of(0) == 0);
+  REQUIRE(components.component_of(6) == 0);
+  REQUIRE(components.component_of(1) == 1);
+  REQUIRE(components.component_of(5) == 2);
+  REQUIRE(components.component_of(3) == 3);
+
+  const auto first = components.nodes(0);
+  REQUIRE(std::vector<uint32_t>(first.begin(), first.end())
+          == std::vector<uint32_t>{ 0, 4, 6 });
+  const auto edges = components.edges(0);
+  REQUIRE(std::vector<uint32_t>(edges.begin(), edges.end())
+          == std::vector<uint32_t>{ 0, 2 });
+  REQUIRE(components.edges(1).empty());
+}
+
+TEST_CASE("[layout::radial]")
+{
+  const auto distance = [](const layout::Point& lhs,
+                           const layout::Point& rhs) {
+    return std::hypot(lhs.x - rhs.x, lhs.y - rhs.y);
+  };
+
+  // a hub with 8 spokes of 2 nodes, centered on the hub.
+  std::vector<std::pair<uint32_t, uint32_t>> pairs{};
+  for (uint32_t spoke = 0; spoke < 8; ++spoke) {
+    pairs.emplace_back(1 + 2 * spoke, 2 + 2 * spoke);
+    pairs.emplace_back(1 + 2 * spoke, 0);
+  }
+  const auto star = make_graph(17, pairs);
+
+  layout::RadialOptions options{};
+  auto result = layout::radial(star, options);
+  auto pos = result.positions;
+  REQUIRE(pos.size() == 17);
+  for (uint32_t spoke = 0; spoke < 8; ++spoke) {
+    REQUIRE(distance(pos[0], pos[1 + 2 * spoke]) == Approx(72.));
+    REQUIRE(distance(pos[0], pos[2 + 2 * spoke]) == Approx(144.));
+
+    // spokes are straight, and evenly spread.
+    REQUIRE(distance(pos[1 + 2 * spoke], pos[2 + 2 * spoke])
+            == Approx(72.));
+    REQUIRE(distance(pos[1 + 2 * spoke], pos[1 + 2 * ((spoke + 1) % 8)])
+            == Approx(2. * 72. * std::sin(3.14159265358979 / 8.)));
+  }
+
+  // rings apart by a list, from a given root.
+  options.ranksep = std::vector<double>{ .5, 2. };
+  options.roots   = { 2 };
+  result = layout::radial(star, options);
+  pos = result.positions;
+  REQUIRE(distance(pos[2], pos[1]) == Approx(36.));
+  REQUIRE(distance(pos[2], pos[0]) == Approx(180.));
+  REQUIRE(distance(pos[2], pos[4]) == Approx(468.));
+
+  // leaves below each node share its sector, so branches don't cross.
+  const auto tree = make_graph(7, { { 0, 1 }, { 0, 2 }, { 1, 3 }, { 1, 4 },
+                                    { 2, 5 }, { 2, 6 } });
+  options = layout::RadialOptions{};
+  options.roots = { 0 };
+  pos = layout::radial(tree, options).positions;
+  REQUIRE(pos[1].y > pos[0].y);
+  REQUIRE(pos[2].y < pos[0].y);
+  for (uint32_t leaf = 3; leaf < 7; ++leaf) {
+    REQUIRE(distance(pos[0], pos[leaf]) == Approx(144.));
+    REQUIRE((pos[leaf].y > pos[0].y) == (leaf < 5));
+  }
+
+  // components are packed a margin apart.
+  pos = layout::radial(make_graph(4, { { 0, 1 }, { 2, 3 } })).positions;
+  for (uint32_t lhs : { 0, 1 })
+    for (uint32_t rhs : { 2, 3 })
+      REQUIRE_FALSE(overlap(pos[lhs], pos[rhs], 54. + 8., 36. + 8.));
+  REQUIRE(std::min({ pos[0].x, pos[1].x, pos[2].x, pos[3].x })
+          == Approx(27.));
+  REQUIRE(std::min({ pos[0].y, pos[1].y, pos[2].y, pos[3].y })
+          == Approx(18.));
+
+  SECTION("roots of attributes")
+  {
+    Graph source{};
+    auto a = source.create_node();
+    auto b = source.create_node();
+    auto c = source.create_node();
+    source.create_edge(a, b);
+    source.create_edge(b, c);
+    source.set_entity_attr<attrs::Root>(c, attrs::RootType("true"));
+
+    layout::radial_layout(source);
+
+    const auto at = [&](auto node) {
+      const auto& pos = source.get_entity_attr<attrs::Pos>(node)->get_value();
+      const auto& point = std::get<attrtypes::PointType<double>>(*pos).point;
+      const auto& flat = std::get<attrtypes::Point2D<double>>(point);
+      return layout::Point{ flat.x, flat.y };
+    };
+    REQUIRE(distance(at(c), at(b)) == Approx(72.));
+    REQUIRE(distance(at(c), at(a)) == Approx(144.));
+  }
+}
+
+TEST_CASE("[layout::circular]")
+{
+  const auto distance = [](const layout::Point& lhs,
+                           const layout::Point& rhs) {
+    return std::hypot(lhs.x - rhs.x, lhs.y - rhs.y);
+  };
+
+  // neighbours on circles are the widest node and mindist apart.
+  constexpr double spacing = (.75 + 1.) * 72.;
+
+  // a cycle is drawn as a regular polygon, in its order.
+  std::vector<std::pair<uint32_t, uint32_t>> pairs{};
+  for (uint32_t i = 0; i < 6; ++i)
+    pairs.emplace_back(i, (i + 1) % 6);
+  auto pos = layout::circular(make_graph(6, pairs)).positions;
+  for (uint32_t i = 0; i < 6; ++i) {
+    REQUIRE(distance(pos[i], pos[(i + 1) % 6]) == Approx(spacing));
+    REQUIRE(distance(pos[i], pos[(i + 3) % 6]) == Approx(2. * spacing));
+  }
+
+  // two triangles joined at a node, and a tail off one of them.
+  const auto bowtie = make_graph(7, { { 0, 1 }, { 1, 2 }, { 2, 0 },
+                                      { 2, 3 }, { 3, 4 }, { 4, 2 },
+                                      { 4, 5 }, { 5, 6 } });
+  std::vector<uint32_t> discovery(7, layout::detail::no_node), lows(7);
+  const auto blocks = layout::detail::find_blocks(bowtie, 0, discovery,
+                                                  lows);
+  REQUIRE(blocks.count() == 4);
+  for (std::size_t block = 0; block < blocks.count(); ++block)
+    REQUIRE(blocks[block].size() == (block < 2 ? 2 : 3));
+
+  layout::CircularOptions options{};
+  options.mindist = .5;
+  pos = layout::circular(bowtie, options).positions;
+  const double closer = (.75 + .5) * 72.;
+  for (const auto& edge : bowtie.edges()) {
+    // the second triangle is pushed off node 2 to fit with its tail.
+    const double length = distance(pos[edge.source], pos[edge.target]);
+    if (edge.source == 2 || edge.target == 2)
+      REQUIRE(length >= closer - 1e-6);
+    else
+      REQUIRE(length == Approx(closer));
+  }
+  for (uint32_t lhs = 0; lhs < 7; ++lhs)
+    for (uint32_t rhs = lhs + 1; rhs < 7; ++rhs)
+      REQUIRE(distance(pos[lhs], pos[rhs]) >= closer - 1e-6);
+
+  // many blocks joined at a node are pushed out until they fit: a star,
+  // a fan of triangles and a binary tree.
+  std::vector<std::pair<std::size_t, decltype(pairs)>> crowded(3);
+  crowded[0].first = 31;
+  for (uint32_t i = 1; i <= 30; ++i)
+    crowded[0].second.emplace_back(0, i);
+  crowded[1].first = 21;
+  for (uint32_t i = 1; i <= 20; i += 2)
+    crowded[1].second.insert(crowded[1].second.end(),
+                             { { 0, i }, { i, i + 1 }, { i + 1, 0 } });
+  crowded[2].first = 63;
+  for (uint32_t i = 1; i < 63; ++i)
+    crowded[2].second.emplace_back((i - 1) / 2, i);
+  for (const auto& [count, edges] : crowded) {
+    pos = layout::circular(make_graph(count, edges)).positions;
+    std::size_t overlaps = 0;
+    for (std::size_t lhs = 0; lhs < count; ++lhs)
+      for (std::size_t rhs = lhs + 1; rhs < count; ++rhs)
+        overlaps += overlap(pos[lhs], pos[rhs], 54., 36.);
+    REQUIRE(overlaps == 0);
+  }
+
+  // components, a node alone among them, are packed apart.
+  options = layout::CircularOptions{};
+  options.pack = 20;
+  pos = layout::circular(make_graph(4, { { 0, 1 }, { 1, 2 }, { 2, 0 } }),
+                         options)
+          .positions;
+  for (uint32_t i = 0; i < 3; ++i)
+    REQUIRE_FALSE(overlap(pos[i], pos[3], 54. + 20., 36. + 20.));
+
+  SECTION("of a graph")
+  {
+    Graph source{};
+    auto a = source.create_node();
+    auto b = source.create_node();
+    source.create_edge(a, b);
+    layout::circular_layout(source);
+    REQUIRE(source.get_entity_attr<attrs::Pos>(a));
+    REQUIRE(source.get_entity_attr<attrs::Pos>(b));
+  }
+}
+
+TEST_CASE("[layout::Clusters]")
+{
+  Graph graph{};
+  const auto first  = graph.create_cluster();
+  const auto second = graph.create_cluster();
+  const auto a = graph.create_node();
+  const auto b = *graph.create_node_in(second);
+  const auto c = *graph.create_node_in(first);
+  const auto d = *graph.create_node_in(second);
+  graph.create_node();
+  (void)a, (void)b, (void)c, (void)d;
+
+  const auto input    = layout::make_layout_input(graph);
+  const auto clusters = layout::make_clusters(graph, input);
+
+  REQUIRE(input.clusters.size() == 2);
+  REQUIRE(clusters.count() == 2);
+  REQUIRE(clusters.cluster_of(0) == 2);
+  REQUIRE(clusters.cluster_of(1) == 1);
+  REQUIRE(clusters.cluster_of(2) == 0);
+
+  const auto nodes = clusters.nodes(1);
+  REQUIRE(std::vector<uint32_t>(nodes.begin(), nodes.end())
+          == std::vector<uint32_t>{ 1, 3 });
+  const auto loose = clusters.loose();
+  REQUIRE(std::vector<uint32_t>(loose.begin(), loose.end())
+          == std::vector<uint32_t>{ 0, 4 });
+}
+
+TEST_CASE("[layout::pack_array]")
+{
+  using attrtypes::PackModeArrayFlag;
+  using attrtypes::PackModeEnum;
+
+  const auto check = [](const std::vector<layout::Point>& corners,
+                        const std::vector<std::pair<double, double>>& at) {
+    REQUIRE(corners.size() == at.size());
+    for (std::size_t i = 0; i < at.size(); ++i) {
+      REQUIRE(corners[i].x == Approx(at[i].first));
+      REQUIRE(corners[i].y == Approx(at[i].second));
+    }
+  };
+
+  REQUIRE(layout::pack_margin(attrs::PackType(true)) == 8.);
+  REQUIRE(layout::pack_margin(attrs::PackType(-1)) == 8.);
+  REQUIRE(layout::pack_margin(attrs::PackType(3)) == 3.);
+
+  // rows from the top, as many as the square root of the count.
+  const std::vector<LayoutNode> squares(4, LayoutNode{ 10., 10. });
+  const attrtypes::PackMode array{ PackModeEnum::array };
+  check(layout::pack_array(squares, {}, array, 2.),
+        { { 0., 12. }, { 12., 12. }, { 0., 0. }, { 12., 0. } });
+
+  // columns, smaller boxes centered in their cells.
+  const std::vector<LayoutNode> sizes{ { 10., 10. }, { 20., 4. },
+                                       { 4., 20. } };
+  check(layout::pack_array(
+          sizes, {}, { PackModeEnum::array, PackModeArrayFlag::column, 2 },
+          0.),
+        { { 5., 9. }, { 0., 0. }, { 20., 4. } });
+
+  // aligned to a side in one row.
+  check(layout::pack_array(
+          sizes, {}, { PackModeEnum::array, PackModeArrayFlag::top, 3 }, 1.),
+        { { 0., 10. }, { 11., 16. }, { 32., 0. } });
+  check(layout::pack_array(
+          sizes, {}, { PackModeEnum::array, PackModeArrayFlag::bottom, 3 },
+          1.),
+        { { 0., 0. }, { 11., 0. }, { 32., 0. } });
+
+  // in the user's order.
+  check(layout::pack_array(
+          squares, { 3, 2, 1, 0 },
+          { PackModeEnum::array, PackModeArrayFlag::user, 4 }, 0.),
+        { { 30., 0. }, { 20., 0. }, { 10., 0. }, { 0., 0. } });
+
+  REQUIRE(layout::pack_array({}, {}, array, 2.).empty());
+}
+
+TEST_CASE("[layout::patchwork]")
+{
+  const auto area = [](const layout::Box& box) {
+    return box.width() * box.height();
+  };
+  const auto inside = [](const layout::Box& inner,
+                         const layout::Box& outer) {
+    constexpr double slack = 1e-9;
+    return inner.llx >= outer.llx - slack && inner.lly >= outer.lly - slack
+        && inner.urx <= outer.urx + slack && inner.ury <= outer.ury + slack;
+  };
+  const auto apart = [](const layout::Box& lhs, const layout::Box& rhs) {
+    constexpr double slack = 1e-9;
+    return lhs.urx <= rhs.llx + slack || rhs.urx <= lhs.llx + slack
+        || lhs.ury <= rhs.lly + slack || rhs.ury <= lhs.lly + slack;
+  };
+
+  // the example of Bruls et al.
+  const std::vector<double> areas{ 6., 6., 4., 3., 2., 2., 1. };
+  const layout::Box whole{ 0., 0., 6., 4. };
+  const auto boxes = layout::detail::squarify(areas, whole);
+  REQUIRE(boxes.size() == areas.size());
+  for (std::size_t i = 0; i < boxes.size(); ++i) {
+    REQUIRE(area(boxes[i]) == Approx(areas[i]));
+    REQUIRE(inside(boxes[i], whole));
+    for (std::size_t j = i + 1; j < boxes.size(); ++j)
+      REQUIRE(apart(boxes[i], boxes[j]));
+  }
+  REQUIRE(boxes[0].width() == Approx(3.));
+  REQUIRE(boxes[0].height() == Approx(2.));
+
+  // two clusters, one of them empty, and two nodes in none.
+  const auto graph = make_graph(6, { { 0, 1 }, { 2, 5 } });
+  const layout::Clusters clusters({ 0, 2, 0, 0, 2, 0 }, 2);
+  layout::PatchworkOptions options{};
+  options.areas         = { 1., 2., 3., 4. };
+  options.cluster_areas = { 100., 5. };
+
+  const auto result = layout::patchwork(graph, clusters, options);
+  constexpr double square = 72. * 72.;
+  REQUIRE(result.clusters.size() == 2);
+  REQUIRE(area(result.clusters[0]) == Approx(9. * square));
+  REQUIRE(area(result.clusters[1]) == Approx(5. * square));
+  REQUIRE(apart(result.clusters[0], result.clusters[1]));
+
+  const std::vector<double> expected{ 1., 2., 3., 4., 1., 1. };
+  for (uint32_t node = 0; node < 6; ++node) {
+    const auto& pos  = result.positions[node];
+    const auto& size = result.sizes[node];
+    const layout::Box box{ pos.x - size.width / 2., pos.y - size.height / 2.,
+                           pos.x + size.width / 2.,
+                           pos.y + size.height / 2. };
+    REQUIRE(area(box) == Approx(expected[node] * square));
+    REQUIRE(inside(box, layout::Box{ 0., 0., 72. * std::sqrt(17.),
+                                     72. * std::sqrt(17.) }));
+    if (clusters.cluster_of(node) == 0)
+      REQUIRE(inside(box, result.clusters[0]));
+    else
+      for (const auto& cluster : result.clusters)
+        REQUIRE(apart(box, cluster));
+  }
+
+  SECTION("of a graph")
+  {
+    Graph source{};
+    const auto cluster = source.create_cluster();
+    const auto a = *source.create_node_in(cluster);
+    const auto b = *source.create_node_in(cluster);
+    const auto c = source.create_node();
+    source.set_entity_attr<attrs::Area>(a, 2.);
+    source.set_entity_attr<attrs::Area>(c, 3.);
+
+    layout::patchwork_layout(source);
+
+    const auto bb = source.get_entity_attr<attrs::BoundingBox>(cluster)
+                      ->get_value();
+    REQUIRE(bb);
+    REQUIRE((bb->urx() - bb->llx()) * (bb->ury() - bb->lly())
+            == Approx(3. * square));
+    for (auto [node, expected_area] :
+         { std::make_pair(a, 2.), std::make_pair(b, 1.),
+           std::make_pair(c, 3.) }) {
+      REQUIRE(source.get_entity_attr<attrs::Pos>(node));
+      REQUIRE(source.get_entity_attr<attrs::Width>(node)->get_value()
+                * source.get_entity_attr<attrs::Height>(node)->get_value()
+              == Approx(expected_area));
+    }
+  }
+}
+
+TEST_CASE("[layout::osage]")
+{
+  const auto box_of = [](const layout::Point& pos, const LayoutNode& size) {
+    return layout::Box{ pos.x - size.width / 2., pos.y - size.height / 2.,
+                        pos.x + size.width / 2., pos.y + size.height / 2. };
+  };
+  const auto apart = [](const layout::Box& lhs, const layout::Box& rhs) {
+    return lhs.urx <= rhs.llx || rhs.urx <= lhs.llx
+        || lhs.ury <= rhs.lly || rhs.ury <= lhs.lly;
+  };
+
+  // two clusters of 4 and 1 nodes, and 2 nodes in none.
+  const auto graph = make_graph(7, { { 0, 1 }, { 1, 6 } });
+  const layout::Clusters clusters({ 0, 0, 1, 0, 2, 0, 2 }, 2);
+
+  layout::OsageOptions options{};
+  options.cluster_packs = { attrs::PackType(4) };
+  const auto result = layout::osage(graph, clusters, options);
+
+  // a cluster of 4 is a square array, padded by its margin.
+  REQUIRE(result.clusters[0].width() == Approx(2. * 54. + 3. * 4.));
+  REQUIRE(result.clusters[0].height() == Approx(2. * 36. + 3. * 4.));
+  REQUIRE(result.clusters[1].width() == Approx(54. + 2. * 8.));
+
+  std::vector<layout::Box> boxes{};
+  for (uint32_t node = 0; node < 7; ++node) {
+    const auto box = box_of(result.positions[node], result.sizes[node]);
+    REQUIRE(box.llx >= 0.);
+    REQUIRE(box.lly >= 0.);
+    for (const auto& other : boxes)
+      REQUIRE(apart(box, other));
+    boxes.push_back(box);
+
+    const auto cluster = clusters.cluster_of(node);
+    if (cluster < 2) {
+      const auto& outer = result.clusters[cluster];
+      const double margin = cluster == 0 ? 4. : 8.;
+      REQUIRE(box.llx >= outer.llx + margin - 1e-9);
+      REQUIRE(box.lly >= outer.lly + margin - 1e-9);
+      REQUIRE(box.urx <= outer.urx - margin + 1e-9);
+      REQUIRE(box.ury <= outer.ury - margin + 1e-9);
+    }
+    else {
+      for (const auto& outer : result.clusters)
+        REQUIRE(apart(box, outer));
+    }
+  }
+  REQUIRE(apart(result.clusters[0], result.clusters[1]));
+
+  SECTION("of a graph")
+  {
+    Graph source{};
+    const auto cluster = source.create_cluster();
+    const auto a = *source.create_node_in(cluster);
+    const auto b = *source.create_node_in(cluster);
+    source.set_entity_attr<attrs::Pack>(cluster, attrs::PackType(20));
+    source.set_entity_attr<attrs::PackMode>(
+      cluster,
+      attrtypes::PackMode{ attrtypes::PackModeEnum::array,
+                           attrtypes::PackModeArrayFlag::user, 2 });
+    source.set_entity_attr<attrs::SortV>(a, 1);
+
+    layout::osage_layout(source);
+
+    const auto bb = source.get_entity_attr<attrs::BoundingBox>(cluster)
+                      ->get_value();
+    REQUIRE(bb);
+    REQUIRE(bb->urx() - bb->llx() == Approx(2. * 54. + 3. * 20.));
+
+    const auto x_of = [&](auto node) {
+      const auto& pos = source.get_entity_attr<attrs::Pos>(node)->get_value();
+      const auto& point = std::get<attrtypes::PointType<double>>(*pos).point;
+      return std::get<attrtypes::Point2D<double>>(point).x;
+    };
+    REQUIRE(x_of(b) < x_of(a));
+    REQUIRE(source.get_entity_attr<attrs::Width>(a)->get_value() == .75);
+  }
+}
+
+TEST_CASE("[layout::pack_components]")
+{
+  using attrtypes::PackModeEnum;
+
+  const auto box_of = [](const layout::Point& pos) {
+    return layout::Box{ pos.x - 27., pos.y - 18., pos.x + 27., pos.y + 18. };
+  };
+  const auto apart = [](const layout::Box& lhs, const layout::Box& rhs,
+                        double margin) {
+    constexpr double slack = 1e-9;
+    return lhs.urx + margin <= rhs.llx + slack
+        || rhs.urx + margin <= lhs.llx + slack
+        || lhs.ury + margin <= rhs.lly + slack
+        || rhs.ury + margin <= lhs.lly + slack;
+  };
+
+  SECTION("subgraphs")
+  {
+    const auto graph = make_graph(5, { { 3, 1 }, { 0, 2 }, { 1, 4 } });
+    const layout::Components components(graph);
+    const auto subgraph = layout::make_subgraph(graph, components, 1);
+
+    REQUIRE(subgraph.nodes == std::vector<uint32_t>{ 1, 3, 4 });
+    REQUIRE(subgraph.edges == std::vector<uint32_t>{ 0, 2 });
+    REQUIRE(subgraph.graph.node_count() == 3);
+    REQUIRE(subgraph.graph.edge(0).source == 1);
+    REQUIRE(subgraph.graph.edge(0).target == 0);
+    REQUIRE(subgraph.graph.edge(1).source == 0);
+    REQUIRE(subgraph.graph.edge(1).target == 2);
+  }
+
+  SECTION("polyominoes")
+  {
+    // an L and a square fitting in its bend.
+    layout::Polyomino ell(1.), square(1.);
+    ell.add_box(layout::Box{ 0., 0., 2.5, .5 });
+    ell.add_box(layout::Box{ 0., 0., .5, 2.5 });
+    square.add_box(layout::Box{ 0., 0., 1.5, 1.5 });
+    square.add_segment(layout::Point{ 0., 0. }, layout::Point{ 1., 1. });
+
+    const auto offsets = layout::pack_polyominoes({ ell, square }, 1.);
+    std::set<std::pair<int, int>> cells{};
+    for (auto [part, offset] : { std::make_pair(&ell, offsets[0]),
+                                 std::make_pair(&square, offsets[1]) })
+      for (auto [x, y] : part->cells()) {
+        cells.emplace(x + int(offset.x), y + int(offset.y));
+      }
+    REQUIRE(cells.size() == 5 + 4);
+    REQUIRE(offsets[1].x - offsets[0].x == 1.);
+    REQUIRE(offsets[1].y - offsets[0].y == 1.);
+
+    REQUIRE(layout::grid_step({}, 8.) == 1.);
+    REQUIRE(layout::grid_step({ layout::Box{ 0., 0., 992., 992. } }, 8.)
+            == 111.);
+  }
+
+  // a path, a star around node 3 and a node alone, laid out in a row
+  // over one another.
+  const auto graph = make_graph(8, { { 0, 1 }, { 1, 2 }, { 3, 4 },
+                                     { 3, 5 }, { 3, 6 } });
+  const layout::Components components(graph);
+  layout::Layout stacked{};
+  for (uint32_t node = 0; node < 8; ++node)
+    stacked.positions.push_back(layout::Point{ 60. * node, 0. });
+
+  for (auto mode : { PackModeEnum::node, PackModeEnum::graph,
+                     PackModeEnum::array }) {
+    layout::PackOptions options{};
+    options.pack     = 10;
+    options.packmode = attrtypes::PackMode{ mode };
+    const auto packed = layout::pack_components(graph, components, stacked,
+                                                options);
+
+    double left = packed.positions[0].x, bottom = packed.positions[0].y;
+    for (uint32_t node = 0; node < 8; ++node) {
+      left   = std::min(left, packed.positions[node].x - 27.);
+      bottom = std::min(bottom, packed.positions[node].y - 18.);
+
+      // components move as a whole, and apart from one another.
+      const auto component = components.component_of(node);
+      const auto first     = components.nodes(component)[0];
+      REQUIRE(packed.positions[node].x - packed.positions[first].x
+              == Approx(60. * (double(node) - double(first))));
+      REQUIRE(packed.positions[node].y == packed.positions[first].y);
+
+      for (uint32_t other = 0; other < node; ++other)
+        if (components.component_of(other) != component)
+          REQUIRE(apart(box_of(packed.positions[node]),
+                        box_of(packed.positions[other]), 10.));
+    }
+    REQUIRE(left == Approx(0.).margin(1e-9));
+    REQUIRE(bottom == Approx(0.).margin(1e-9));
+  }
+
+  SECTION("by engines")
+  {
+    std::vector<std::pair<uint32_t, uint32_t>> pairs{};
+    for (uint32_t i = 0; i + 1 < 30; ++i)
+      pairs.emplace_back(i, i + 1);
+    for (uint32_t i = 30; i < 90; i += 2)
+      pairs.emplace_back(i, i + 1);
+    const auto many = make_graph(91, pairs);
+
+    // the path is too large to share threads, the rest take one each.
+    std::atomic<std::size_t> calls{ 0 }, fitting{ 0 };
+    layout::PackOptions options{};
+    options.threads = 4;
+    const auto result = layout::layout_components(
+      many,
+      [&](const LayoutGraph& part, unsigned threads) {
+        ++calls;
+        if (threads == (part.node_count() == 30 ? 4u : 1u))
+          ++fitting;
+        layout::StressOptions stress{};
+        stress.threads = threads;
+        return layout::stress(part, stress);
+      },
+      options);
+
+    REQUIRE(calls == 32);
+    REQUIRE(fitting == 32);
+    REQUIRE(result.positions.size() == 91);
+    const layout::Components parts(many);
+    for (uint32_t lhs = 0; lhs < 91; ++lhs)
+      for (uint32_t rhs = 0; rhs < lhs; ++rhs)
+        if (parts.component_of(lhs) != parts.component_of(rhs))
+          REQUIRE(apart(box_of(result.positions[lhs]),
+                        box_of(result.positions[rhs]), 8.));
+  }
+}
+
+TEST_CASE("[layout::overlap]")
+{
+  using layout::OverlapMode;
+  using layout::to_overlap_mode;
+
+  REQUIRE(to_overlap_mode(true) == OverlapMode::retain);
+  REQUIRE(to_overlap_mode(false) == OverlapMode::prism);
+  REQUIRE(to_overlap_mode(std::string("scalexy")) == OverlapMode::scalexy);
+  REQUIRE(to_overlap_mode(std::string("voronoi")) == OverlapMode::voronoi);
+  REQUIRE(to_overlap_mode(std::string("prism20")) == OverlapMode::prism);
+  REQUIRE(to_overlap_mode(std::string("vpsc")) == OverlapMode::prism);
+  REQUIRE(to_overlap_mode(std::string("0")) == OverlapMode::prism);
+  REQUIRE(to_overlap_mode(std::string("2")) == OverlapMode::retain);
+
+  // nodes are 54 by 36 points, 62 by 44 with the default margin.
+  const auto overlapping = [](const layout::Layout& result, double width,
+                              double height) {
+    constexpr double slack = 1e-6;
+    const auto& pos = result.positions;
+    std::size_t count = 0;
+    for (std::size_t lhs = 0; lhs < pos.size(); ++lhs)
+      for (std::size_t rhs = 0; rhs < lhs; ++rhs)
+        count += overlap(pos[lhs], pos[rhs], width - slack, height - slack);
+    return count;
+  };
+
+  // a path of 300 nodes crowded in a square.
+  std::vector<std::pair<uint32_t, uint32_t>> pairs{};
+  for (uint32_t i = 0; i + 1 < 300; ++i)
+    pairs.emplace_back(i, i + 1);
+  const auto graph = make_graph(300, pairs);
+
+  std::mt19937 random(7);
+  std::uniform_real_distribution<double> unit(0., 300.);
+  layout::Layout crowded{};
+  for (std::size_t i = 0; i < 300; ++i)
+    crowded.positions.push_back(layout::Point{ unit(random), unit(random) });
+  crowded.positions[1] = crowded.positions[0];
+  REQUIRE(overlapping(crowded, 62., 44.) > 0);
+
+  layout::OverlapOptions options{};
+  options.threads = 1;
+  const auto kept = layout::remove_overlaps(graph, crowded, options);
+  REQUIRE(kept.positions == crowded.positions);
+
+  for (const char *mode : { "false", "prism5", "scale", "scalexy",
+                            "voronoi" }) {
+    options.overlap = std::string(mode);
+    const auto result = layout::remove_overlaps(graph, crowded, options);
+    REQUIRE(overlapping(result, 62., 44.) == 0);
+
+    double left = result.positions[0].x, bottom = result.positions[0].y;
+    for (const auto& point : result.positions) {
+      left   = std::min(left, point.x);
+      bottom = std::min(bottom, point.y);
+    }
+    REQUIRE(left == Approx(27.));
+    REQUIRE(bottom == Approx(18.));
+  }
+
+  options.overlap = false;
+  const auto prism = layout::remove_overlaps(graph, crowded, options);
+  options.threads = 4;
+  REQUIRE(layout::remove_overlaps(graph, crowded, options).positions
+          == prism.positions);
+
+  SECTION("margins")
+  {
+    options.sep = attrtypes::AddDouble(.5);
+    REQUIRE(overlapping(layout::remove_overlaps(graph, crowded, options),
+                        81., 54.) == 0);
+
+    options.sep = attrtypes::Addible<attrtypes::PointType<double>>(
+      attrtypes::PointType<double>(20., 2.), attrtypes::AddibleSign::addible);
+    REQUIRE(overlapping(layout::remove_overlaps(graph, crowded, options),
+                        94., 40.) == 0);
+  }
+
+  SECTION("scaling axes apart")
+  {
+    // a row overlapping only along x is stretched along x alone.
+    const auto row = make_graph(5, {});
+    layout::Layout pressed{};
+    for (std::size_t i = 0; i < 5; ++i)
+      pressed.positions.push_back(layout::Point{ 27. + 10. * double(i), 18. });
+
+    options.overlap = std::string("scalexy");
+    const auto result = layout::remove_overlaps(row, pressed, options);
+    for (std::size_t i = 0; i < 5; ++i) {
+      REQUIRE(result.positions[i].y == Approx(18.));
+      REQUIRE(result.positions[i].x == Approx(27. + 62. * double(i)));
+    }
+  }
+
+  SECTION("shrinking")
+  {
+    // nodes far apart are drawn together, no nearer than their margins.
+    const auto loose = make_graph(16, {});
+    layout::Layout spread{};
+    for (std::size_t i = 0; i < 16; ++i)
+      spread.positions.push_back(
+        layout::Point{ 1000. * double(i % 4), 1000. * double(i / 4) });
+
+    const auto result = layout::remove_overlaps(loose, spread, options);
+    REQUIRE(overlapping(result, 62., 44.) == 0);
+    for (const auto& point : result.positions)
+      REQUIRE(point.x < 500.);
+
+    options.overlap_shrink = 0.;
+    const auto unshrunk = layout::remove_overlaps(loose, spread, options);
+    REQUIRE(unshrunk.positions.back().x > 3000.);
+  }
+
+  SECTION("of a graph")
+  {
+    Graph source{};
+    std::vector<Graph::NodeId> nodes{};
+    for (int i = 0; i < 3; ++i) {
+      nodes.push_back(source.create_node());
+      source.set_entity_attr<attrs::Pos>(
+        nodes.back(), attrs::PosType(attrtypes::PointType<double>(5., 5.)));
+    }
+    const auto edge = source.create_edge(nodes[0], nodes[1]);
+    source.set_entity_attr<attrs::Pos>(
+      *edge, attrs::PosType(attrtypes::PointType<double>(5., 5.)));
+
+    options.overlap = std::string("scale");
+    layout::remove_overlaps_layout(source, options);
+
+    layout::Layout result{};
+    for (auto node : nodes) {
+      const auto& pos = source.get_entity_attr<attrs::Pos>(node)->get_value();
+      const auto& point = std::get<attrtypes::PointType<double>>(*pos).point;
+      const auto at = std::get<attrtypes::Point2D<double>>(point);
+      result.positions.push_back(layout::Point{ at.x, at.y });
+    }
+    REQUIRE(overlapping(result, 62., 44.) == 0);
+    REQUIRE(!source.has_entity_attr<attrs::Pos>(*edge));
+  }
+}
+
+TEST_CASE("[layout::route_edges]")
+{
+  using layout::EdgeRouting;
+  using layout::to_edge_routing;
+
+  REQUIRE(to_edge_routing(std::nullopt) == EdgeRouting::spline);
+  REQUIRE(to_edge_routing(false) == EdgeRouting::line);
+  REQUIRE(to_edge_routing(std::string("")) == EdgeRouting::none);
+  REQUIRE(to_edge_routing(std::string("polyline")) == EdgeRouting::polyline);
+  REQUIRE(to_edge_routing(std::string("ortho")) == EdgeRouting::ortho);
+  REQUIRE(to_edge_routing(std::string("curved")) == EdgeRouting::spline);
+
+  const auto point_of = [](const attrtypes::spline_point_type& point) {
+    return std::get<attrtypes::Point2D<double>>(point.point);
+  };
+
+  // ends of the Bézier segments of an edge.
+  const auto ends = [&](const layout::Layout& result, std::size_t edge) {
+    const auto& spline = result.splines[edge].splines.at(0);
+    std::vector<attrtypes::Point2D<double>> out{ point_of(spline.point) };
+    for (const auto& triple : spline.triples)
+      out.push_back(point_of(std::get<2>(triple)));
+    return out;
+  };
+
+  // whether an edge comes nearer to center than the 54 by 36 points
+  // ellipse around it, sampling its Bézier segments.
+  const auto enters = [&](const layout::Layout& result, std::size_t edge,
+                          const layout::Point& center) {
+    const auto& spline = result.splines[edge].splines.at(0);
+    auto from = point_of(spline.point);
+    for (const auto& triple : spline.triples) {
+      const auto a = point_of(std::get<0>(triple));
+      const auto b = point_of(std::get<1>(triple));
+      const auto to = point_of(std::get<2>(triple));
+      for (int i = 0; i <= 32; ++i) {
+        const double t = double(i) / 32., u = 1. - t;
+        const double x = u * u * u * from.x + 3. * u * u * t * a.x
+                       + 3. * u * t * t * b.x + t * t * t * to.x;
+        const double y = u * u * u * from.y + 3. * u * u * t * a.y
+                       + 3. * u * t * t * b.y + t * t * t * to.y;
+        if (std::hypot((x - center.x) / 27., (y - center.y) / 18.) < 1.)
+          return true;
+      }
+      from = to;
+    }
+    return false;
+  };
+
+  // a node between the ends of an edge, and one looping.
+  const auto graph = make_graph(3, { { 0, 2 }, { 1, 1 } });
+  layout::Layout row{};
+  for (double x : { 0., 100., 200. })
+    row.positions.push_back(layout::Point{ x, 0. });
+
+  layout::RouteOptions options{};
+  options.threads = 1;
+
+  SECTION("around nodes")
+  {
+    for (const char *mode : { "polyline", "spline", "ortho" }) {
+      options.splines = std::string(mode);
+      const auto result = layout::route_edges(graph, row, options);
+      REQUIRE(result.positions == row.positions);
+      REQUIRE(result.splines.size() == 2);
+      REQUIRE(ends(result, 0).size() > 2);
+      REQUIRE_FALSE(enters(result, 0, row.positions[1]));
+      REQUIRE(result.splines[1].splines.at(0).endp);
+    }
+
+    options.splines = std::string("ortho");
+    const auto points = ends(layout::route_edges(graph, row, options), 0);
+    for (std::size_t i = 0; i + 1 < points.size(); ++i)
+      REQUIRE((points[i].x == Approx(points[i + 1].x)
+               || points[i].y == Approx(points[i + 1].y)));
+
+    options.splines = std::nullopt;
+
+    // splines start on the ellipse of their tail, pointing at their head.
+    const auto result = layout::route_edges(graph, row, options);
+    const auto& spline = result.splines[0].splines.at(0);
+    const auto start = point_of(spline.point);
+    REQUIRE(std::hypot(start.x / 27., start.y / 18.) == Approx(1.));
+    const auto tip = point_of(*spline.endp);
+    REQUIRE(std::hypot((tip.x - 200.) / 27., tip.y / 18.) == Approx(1.));
+    REQUIRE(spline.triples.size() > 1);
+  }
+
+  SECTION("straight or not at all")
+  {
+    options.splines = false;
+    options.directed = false;
+    const auto line = layout::route_edges(graph, row, options);
+    REQUIRE(line.splines[0].splines.at(0).triples.size() == 1);
+    REQUIRE_FALSE(line.splines[0].splines.at(0).endp);
+    REQUIRE(point_of(line.splines[0].splines[0].point).x == Approx(27.));
+
+    options.splines = std::string("none");
+    REQUIRE(layout::route_edges(graph, row, options).splines.empty());
+  }
+
+  SECTION("shapes")
+  {
+    // boxes are left at their sides, and a node inside one is reached.
+    options.shapes.assign(3, attrtypes::ShapeType::box);
+    options.splines = std::string("polyline");
+    auto nested = row;
+    nested.positions[2] = layout::Point{ 100., 0. };
+    const auto result = layout::route_edges(graph, nested, options);
+    REQUIRE(point_of(result.splines[0].splines.at(0).point).x == Approx(27.));
+    REQUIRE(ends(result, 0).size() == 2);
+  }
+
+  SECTION("threads")
+  {
+    std::vector<std::pair<uint32_t, uint32_t>> pairs{};
+    std::mt19937 random(3);
+    std::uniform_int_distribution<uint32_t> pick(0, 99);
+    for (int i = 0; i < 300; ++i)
+      pairs.emplace_back(pick(random), pick(random));
+    const auto crowd = make_graph(100, pairs);
+
+    layout::Layout scattered{};
+    for (std::size_t i = 0; i < 100; ++i)
+      scattered.positions.push_back(
+        layout::Point{ 90. * double(i % 10), 60. * double(i / 10) });
+
+    for (const char *mode : { "spline", "ortho" }) {
+      options.splines = std::string(mode);
+      options.threads = 1;
+      const auto single = layout::route_edges(crowd, scattered, options);
+      options.threads = 4;
+      REQUIRE(layout::route_edges(crowd, scattered, options).splines
+              == single.splines);
+    }
+  }
+
+  SECTION("crowded")
+  {
+    // edges across a 20 by 20 grid meet more nodes than are searched
+    // among at once, and still go around them.
+    std::vector<std::pair<uint32_t, uint32_t>> pairs{};
+    std::mt19937 random(7);
+    std::uniform_int_distribution<uint32_t> pick(0, 399);
+    while (pairs.size() < 300)
+      if (const auto lhs = pick(random), rhs = pick(random); lhs != rhs)
+        pairs.emplace_back(lhs, rhs);
+    const auto crowd = make_graph(400, pairs);
+
+    layout::Layout grid{};
+    for (std::size_t i = 0; i < 400; ++i)
+      grid.positions.push_back(
+        layout::Point{ 200. * double(i % 20), 150. * double(i / 20) });
+
+    for (const char *mode : { "polyline", "ortho" }) {
+      options.splines = std::string(mode);
+      const auto result = layout::route_edges(crowd, grid, options);
+      std::size_t slanted = 0, entering = 0;
+      for (std::size_t edge = 0; edge < pairs.size(); ++edge) {
+        const auto points = ends(result, edge);
+        for (std::size_t i = 0; i + 1 < points.size(); ++i)
+          slanted += points[i].x != Approx(points[i + 1].x)
+                  && points[i].y != Approx(points[i + 1].y);
+        for (uint32_t node = 0; node < 400; ++node)
+          entering += node != pairs[edge].first
+                   && node != pairs[edge].second
+                   && enters(result, edge, grid.positions[node]);
+      }
+      REQUIRE(entering == 0);
+      if (std::string(mode) == "ortho")
+        REQUIRE(slanted == 0);
+    }
+  }
+
+  SECTION("of a graph")
+  {
+    Graph source{};
+    std::vector<Graph::NodeId> nodes{};
+    for (double x : { 0., 100., 200. }) {
+      nodes.push_back(source.create_node());
+      source.set_entity_attr<attrs::Pos>(
+        nodes.back(), attrs::PosType(attrtypes::PointType<double>(x, 0.)));
+      source.set_entity_attr<attrs::Shape>(nodes.back(),
+                                           attrtypes::ShapeType::box);
+    }
+    const auto edge = source.create_edge(nodes[0], nodes[2]).value();
+
+    options.splines = std::string("ortho");
+    layout::route_edges_layout(source, options);
+
+    const auto& pos = source.get_entity_attr<attrs::Pos>(edge)->get_value();
+    const auto& splines =
+      std::get<attrtypes::SplineType<std::vector>>(*pos).splines;
+    REQUIRE(splines.at(0).endp);
+    REQUIRE(point_of(splines[0].point).y != Approx(0.));
+
+    options.splines = std::string("none");
+    layout::route_edges_layout(source, options);
+    REQUIRE_FALSE(source.has_entity_attr<attrs::Pos>(edge));
+  }
+}
+
+TEST_CASE("[layout::SpatialIndex]")
+{
+  using layout::Box;
+  using layout::SpatialItem;
+  using Kind = SpatialItem::Kind;
+
+  // 3000 nodes of random sizes, and edges as splines between them.
+  std::mt19937 random(11);
+  std::uniform_real_distribution<double> place(0., 2000.), size(1., 40.);
+
+  layout::Layout placed{};
+  std::vector<LayoutNode> nodes{};
+  for (int i = 0; i < 3000; ++i) {
+    placed.positions.push_back(layout::Point{ place(random), place(random) });
+    nodes.push_back(LayoutNode{ size(random), size(random) });
+  }
+
+  std::vector<LayoutEdge> edges{};
+  for (uint32_t i = 0; i + 1 < 3000; i += 3) {
+    edges.push_back(LayoutEdge{ i, i + 1 });
+
+    attrtypes::Spline<> spline{};
+    const auto& from = placed.positions[i];
+    const auto& to = placed.positions[i + 1];
+    spline.set_point(attrtypes::spline_point_type(from.x, from.y));
+    spline.add_triples({ attrtypes::spline_point_type(from.x, to.y),
+                         attrtypes::spline_point_type(to.x, from.y),
+                         attrtypes::spline_point_type(to.x, to.y) });
+    placed.splines.emplace_back();
+    placed.splines.back().add_spline(spline);
+  }
+  const LayoutGraph graph(nodes, edges);
+
+  // boxes of all items, checked one by one.
+  std::vector<std::pair<SpatialItem, Box>> all{};
+  for (uint32_t i = 0; i < 3000; ++i) {
+    const auto& at = placed.positions[i];
+    all.emplace_back(SpatialItem{ Kind::node, i },
+                     Box{ at.x - nodes[i].width / 2.,
+                          at.y - nodes[i].height / 2.,
+                          at.x + nodes[i].width / 2.,
+                          at.y + nodes[i].height / 2. });
+  }
+  for (uint32_t i = 0; i < edges.size(); ++i) {
+    const auto& from = placed.positions[edges[i].source];
+    const auto& to = placed.positions[edges[i].target];
+    all.emplace_back(SpatialItem{ Kind::edge, i },
+                     Box{ std::min(from.x, to.x), std::min(from.y, to.y),
+                          std::max(from.x, to.x), std::max(from.y, to.y) });
+  }
+
+  const auto brute_in = [&](const Box& area) {
+    std::vector<SpatialItem> found{};
+    for (const auto& [item, box] : all)
+      if (box.llx <= area.urx && area.llx <= box.urx
+          && box.lly <= area.ury && area.lly <= box.ury)
+        found.push_back(item);
+    std::sort(found.begin(), found.end());
+    return found;
+  };
+
+  const auto distance = [](const Box& box, const layout::Point& point) {
+    const double dx = std::max({ box.llx - point.x, 0., point.x - box.urx });
+    const double dy = std::max({ box.lly - point.y, 0., point.y - box.ury });
+    return dx * dx + dy * dy;
+  };
+
+  const auto check = [&](const layout::SpatialIndex& index) {
+    REQUIRE(index.size() == all.size());
+    for (int i = 0; i < 50; ++i) {
+      const double x = place(random), y = place(random);
+      const Box area{ x, y, x + 4. * size(random), y + 4. * size(random) };
+      REQUIRE(index.in(area) == brute_in(area));
+      REQUIRE(index.at(layout::Point{ x, y }) == brute_in(Box{ x, y, x, y }));
+
+      const layout::Point point{ x, y };
+      const auto nearest = index.nearest(point, 10);
+      REQUIRE(nearest.size() == 10);
+
+      std::vector<double> distances{};
+      for (const auto& entry : all)
+        distances.push_back(distance(entry.second, point));
+      std::sort(distances.begin(), distances.end());
+      for (std::size_t k = 0; k < nearest.size(); ++k)
+        REQUIRE(distance(index.box(nearest[k]), point) == distances[k]);
+    }
+  };
+
+  layout::SpatialIndex index(graph, placed);
+  REQUIRE(index.contains(SpatialItem{ Kind::edge, 0 }));
+  check(index);
+
+  SECTION("updates")
+  {
+    // moves, removals and new items, more than are left loose.
+    for (int i = 0; i < 500; ++i) {
+      auto& [item, box] = all[std::size_t(i) * 5];
+      const double dx = place(random) - box.llx, dy = place(random) - box.lly;
+      box = Box{ box.llx + dx, box.lly + dy, box.urx + dx, box.ury + dy };
+      index.update(item, box);
+    }
+    for (int i = 0; i < 300; ++i) {
+      index.remove(all.back().first);
+      all.pop_back();
+    }
+    for (uint32_t i = 0; i < 400; ++i) {
+      const double x = place(random), y = place(random);
+      all.emplace_back(SpatialItem{ Kind::node, 3000 + i },
+                       Box{ x, y, x + 10., y + 10. });
+      index.update(all.back().first, all.back().second);
+    }
+    REQUIRE_FALSE(index.contains(SpatialItem{ Kind::edge, 999 }));
+    check(index);
+
+    index.rebuild();
+    check(index);
+  }
+
+  SECTION("threads")
+  {
+    const layout::SpatialIndex single(graph, placed, 1);
+    const Box area{ 500., 500., 800., 700. };
+    REQUIRE(single.in(area) == index.in(area));
+    REQUIRE(single.nearest(layout::Point{ 10., 10. }, 20)
+            == index.nearest(layout::Point{ 10., 10. }, 20));
+    REQUIRE(layout::SpatialIndex{}.in(area).empty());
+  }
+
+  SECTION("of a graph")
+  {
+    Graph source{};
+    std::vector<Graph::NodeId> ids{};
+    for (double x : { 0., 100., 200. }) {
+      ids.push_back(source.create_node());
+      source.set_entity_attr<attrs::Pos>(
+        ids.back(), attrs::PosType(attrtypes::PointType<double>(x, 0.)));
+    }
+    const auto unplaced = source.create_node();
+    const auto edge = source.create_edge(ids[0], ids[2]).value();
+    layout::route_edges_layout(source);
+    source.remove_entity_attr<attrs::Pos>(unplaced);
+
+    const auto has = [](const std::vector<Graph::NodeId>& found,
+                        Graph::NodeId id) {
+      return std::find(found.begin(), found.end(), id) != found.end();
+    };
+
+    layout::GraphSpatialIndex<Graph> spatial(source);
+    REQUIRE(spatial.index().size() == 4);
+    REQUIRE(has(spatial.at(layout::Point{ 100., 10. }), ids[1]));
+    REQUIRE(has(spatial.in(Box{ -100., -50., 300., 50. }), edge));
+    REQUIRE(spatial.nearest(layout::Point{ 210., 0. }, 1)
+            == std::vector<Graph::NodeId>{ ids[2] });
+
+    source.set_entity_attr<attrs::Pos>(
+      ids[1], attrs::PosType(attrtypes::PointType<double>(100., 300.)));
+    source.set_entity_attr<attrs::Pos>(
+      unplaced, attrs::PosType(attrtypes::PointType<double>(100., 0.)));
+    spatial.update(source, ids[1]);
+    spatial.update(source, unplaced);
+    REQUIRE(has(spatial.at(layout::Point{ 100., 10. }), unplaced));
+    REQUIRE_FALSE(has(spatial.at(layout::Point{ 100., 10. }), ids[1]));
+    REQUIRE(spatial.at(layout::Point{ 100., 300. })
+            == std::vector<Graph::NodeId>{ ids[1] });
+
+    source.remove_entity_attr<attrs::Pos>(edge);
+    spatial.update(source, edge);
+    REQUIRE(spatial.index().size() == 4);
+    REQUIRE_FALSE(has(spatial.in(Box{ -100., -50., 300., 50. }), edge));
+  }
+}
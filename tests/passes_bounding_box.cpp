@@ -0,0 +1,201 @@
+#include <algorithm>
+#include <cstddef>
+#include <random>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+#include <gvizard/graph/graph.hpp>
+#include <gvizard/registry/entt_registry.hpp>
+#include <gvizard/passes/bounding_box.hpp>
+
+#include <gvizard/attrs/boundingbox.hpp>
+#include <gvizard/attrs/height.hpp>
+#include <gvizard/attrs/pos.hpp>
+#include <gvizard/attrs/width.hpp>
+
+using namespace gviz;
+
+namespace {
+
+using Graph = graph::Graph<registry::EnTTRegistry, graph::GraphDir::directed>;
+
+attrs::PosType point_at(double x, double y)
+{
+  return attrs::PosType(attrtypes::PointType<double>(x, y));
+}
+
+attrs::PosType curve(const std::vector<std::pair<double, double>>& points)
+{
+  attrtypes::Spline<> spline{};
+  spline.set_point(attrtypes::spline_point_type(points[0].first,
+                                                points[0].second));
+  for (std::size_t i = 1; i + 2 < points.size(); i += 3)
+    spline.add_triples(
+      { attrtypes::spline_point_type(points[i].first, points[i].second),
+        attrtypes::spline_point_type(points[i + 1].first,
+                                     points[i + 1].second),
+        attrtypes::spline_point_type(points[i + 2].first,
+                                     points[i + 2].second) });
+
+  attrtypes::SplineType<std::vector> splines{};
+  splines.add_spline(spline);
+  return attrs::PosType(splines);
+}
+
+}  // namespace
+
+TEST_CASE("[passes::compute_bounding_boxes::extrema]")
+{
+  // an arch, whose top is at 3/4 of its control points' height.
+  std::vector<layout::Box> boxes(4);
+  passes::detail::BezierSoA segments{};
+  segments.resize(2);
+  const double arch[2][4][2] = {
+    { { 0., 0. }, { 0., 100. }, { 100., 100. }, { 100., 0. } },
+    { { 0., 0. }, { 30., 0. }, { 60., 0. }, { 90., 0. } } };
+  for (std::size_t s = 0; s < 2; ++s)
+    for (std::size_t k = 0; k < 4; ++k) {
+      segments.xs[k][s] = arch[s][k][0];
+      segments.ys[k][s] = arch[s][k][1];
+    }
+  passes::detail::bezier_boxes(segments, 0, 4, boxes.data());
+
+  REQUIRE(boxes[0].llx == Approx(0.));
+  REQUIRE(boxes[0].urx == Approx(100.));
+  REQUIRE(boxes[0].lly == Approx(0.));
+  REQUIRE(boxes[0].ury == Approx(75.));
+  REQUIRE(boxes[1].urx == Approx(90.));
+  REQUIRE(boxes[1].ury == Approx(0.));
+
+  // random curves, within their boxes and reaching their sides.
+  std::mt19937 random(5);
+  std::uniform_real_distribution<double> place(-100., 100.);
+  segments.resize(1000);
+  for (std::size_t s = 0; s < 1000; ++s)
+    for (std::size_t k = 0; k < 4; ++k) {
+      segments.xs[k][s] = place(random);
+      segments.ys[k][s] = place(random);
+    }
+  boxes.resize(1000);
+  passes::detail::bezier_boxes(segments, 0, 1000, boxes.data());
+
+  // both ways of finding them agree, whichever the target takes.
+  std::vector<layout::Box> kernel(1000), scalar(1000);
+  passes::detail::bezier_boxes_kernel(segments, 0, 1000, kernel.data());
+  passes::detail::bezier_boxes_scalar(segments, 0, 1000, scalar.data());
+  for (std::size_t s = 0; s < 1000; ++s) {
+    REQUIRE(kernel[s].llx == Approx(scalar[s].llx));
+    REQUIRE(kernel[s].lly == Approx(scalar[s].lly));
+    REQUIRE(kernel[s].urx == Approx(scalar[s].urx));
+    REQUIRE(kernel[s].ury == Approx(scalar[s].ury));
+
+    double points[4][2];
+    for (std::size_t k = 0; k < 4; ++k) {
+      points[k][0] = segments.xs[k][s];
+      points[k][1] = segments.ys[k][s];
+    }
+    const auto pair = passes::detail::segment_box(points);
+    REQUIRE(pair.llx == Approx(scalar[s].llx));
+    REQUIRE(pair.lly == Approx(scalar[s].lly));
+    REQUIRE(pair.urx == Approx(scalar[s].urx));
+    REQUIRE(pair.ury == Approx(scalar[s].ury));
+  }
+
+  for (std::size_t s = 0; s < 1000; ++s) {
+    layout::Box sampled = passes::detail::no_box;
+    for (int i = 0; i <= 4000; ++i) {
+      const double t = double(i) / 4000., u = 1. - t;
+      const auto at = [&](const auto& axis) {
+        return u * u * u * axis[0][s] + 3. * u * u * t * axis[1][s]
+             + 3. * u * t * t * axis[2][s] + t * t * t * axis[3][s];
+      };
+      const double x = at(segments.xs), y = at(segments.ys);
+      sampled.llx = std::min(sampled.llx, x);
+      sampled.lly = std::min(sampled.lly, y);
+      sampled.urx = std::max(sampled.urx, x);
+      sampled.ury = std::max(sampled.ury, y);
+    }
+
+    REQUIRE(boxes[s].llx <= sampled.llx + 1e-9);
+    REQUIRE(boxes[s].lly <= sampled.lly + 1e-9);
+    REQUIRE(boxes[s].urx >= sampled.urx - 1e-9);
+    REQUIRE(boxes[s].ury >= sampled.ury - 1e-9);
+    REQUIRE(boxes[s].llx == Approx(sampled.llx).margin(1e-3));
+    REQUIRE(boxes[s].lly == Approx(sampled.lly).margin(1e-3));
+    REQUIRE(boxes[s].urx == Approx(sampled.urx).margin(1e-3));
+    REQUIRE(boxes[s].ury == Approx(sampled.ury).margin(1e-3));
+  }
+}
+
+TEST_CASE("[passes::compute_bounding_boxes]")
+{
+  Graph graph;
+
+  // a and b in a cluster, joined by an arch, and c outside it.
+  auto node_a = graph.create_node();
+  auto node_b = graph.create_node();
+  auto node_c = graph.create_node();
+  auto unplaced = graph.create_node();
+
+  graph.set_entity_attr<attrs::Pos>(node_a, point_at(50., 50.));
+  graph.set_entity_attr<attrs::Pos>(node_b, point_at(150., 50.));
+  graph.set_entity_attr<attrs::Pos>(node_c, point_at(400., 300.));
+  graph.set_entity_attr<attrs::Width>(node_c, attrs::Width(2.));
+
+  auto cluster = graph.create_cluster();
+  graph.add_to_cluster(cluster, node_a);
+  graph.add_to_cluster(cluster, node_b);
+  auto empty = graph.create_cluster();
+  graph.add_to_cluster(empty, unplaced);
+
+  auto edge_a_b = graph.create_edge(node_a, node_b).value();
+  auto edge_b_c = graph.create_edge(node_b, node_c).value();
+  graph.set_entity_attr<attrs::Pos>(
+    edge_a_b, curve({ { 50., 68. }, { 50., 268. }, { 150., 268. },
+                      { 150., 68. } }));
+  graph.set_entity_attr<attrs::Pos>(
+    edge_b_c, curve({ { 150., 32. }, { 250., -60. }, { 300., 0. },
+                      { 400., 282. } }));
+
+  const auto boxes = passes::set_bounding_boxes(graph);
+  using Result = decltype(boxes);
+
+  const auto arch = *Result::find(boxes.edges, edge_a_b);
+  REQUIRE(arch.ury == Approx(218.));
+  REQUIRE(arch.llx == Approx(50.));
+
+  const auto node_box = *Result::find(boxes.nodes, node_c);
+  REQUIRE(node_box.llx == Approx(328.));
+  REQUIRE(node_box.urx == Approx(472.));
+  REQUIRE_FALSE(Result::find(boxes.nodes, unplaced));
+
+  // the cluster spans a, b and the arch, but not the edge leaving it.
+  const auto inner = *Result::find(boxes.clusters, cluster);
+  REQUIRE(inner.llx == Approx(23.));
+  REQUIRE(inner.lly == Approx(32.));
+  REQUIRE(inner.urx == Approx(177.));
+  REQUIRE(inner.ury == Approx(218.));
+  REQUIRE_FALSE(Result::find(boxes.clusters, empty));
+
+  const auto bb = graph.get_entity_attr<attrs::BoundingBox>(cluster);
+  REQUIRE(bb);
+  REQUIRE(bb->get_value()->ury() == Approx(218.));
+  REQUIRE_FALSE(graph.has_entity_attr<attrs::BoundingBox>(empty));
+
+  // the graph spans everything, the dip of the leaving edge included.
+  REQUIRE(boxes.graph);
+  REQUIRE(boxes.graph->llx == Approx(23.));
+  REQUIRE(boxes.graph->urx == Approx(472.));
+  REQUIRE(boxes.graph->ury == Approx(318.));
+  REQUIRE(boxes.graph->lly < 0.);
+  REQUIRE(boxes.graph->lly > -60.);
+
+  SECTION("same output regardless of thread count")
+  {
+    const auto single = passes::compute_bounding_boxes(graph, 1);
+    REQUIRE(single.edges.size() == boxes.edges.size());
+    for (std::size_t i = 0; i < single.edges.size(); ++i)
+      REQUIRE(single.edges[i].box.lly == boxes.edges[i].box.lly);
+  }
+}
@@ -0,0 +1,124 @@
+#include <string>
+#include <string_view>
+
+#include <catch2/catch.hpp>
+
+#include <gvizard/graph/graph.hpp>
+#include <gvizard/registry/entt_registry.hpp>
+#include <gvizard/passes/expand_labels.hpp>
+#include <gvizard/parallel/parallel_for.hpp>
+
+using namespace gviz;
+
+namespace {
+
+struct NodeName { std::string str; };
+
+template <typename GraphT>
+auto name_getter(const GraphT& graph)
+{
+  return [&graph](typename GraphT::NodeId node_id) {
+    const auto name = graph.template get_entity_attr<NodeName>(node_id);
+    return name ? std::string_view(name->str) : std::string_view{};
+  };
+}
+
+}  // namespace
+
+TEST_CASE("[parallel::parallel_for]")
+{
+  std::vector<int> values(10000, 0);
+
+  parallel::parallel_for_each_index(values.size(), [&](std::size_t i) {
+    values[i] = int(i);
+  }, 64, 4);
+
+  for (std::size_t i = 0; i < values.size(); ++i)
+    REQUIRE(values[i] == int(i));
+
+  REQUIRE_THROWS_AS(
+    parallel::parallel_for(100, [](std::size_t, std::size_t) {
+      throw std::runtime_error("failure");
+    }, 10, 4),
+    std::runtime_error
+  );
+}
+
+TEST_CASE("[passes::expand_labels]")
+{
+  using Graph = graph::Graph<registry::EnTTRegistry, graph::GraphDir::directed>;
+  using passes::LabelKind;
+
+  Graph graph;
+
+  auto node_a = graph.create_node();
+  auto node_b = graph.create_node();
+  auto node_c = graph.create_node();
+
+  graph.set_entity_attr<NodeName>(node_a, NodeName{"a"});
+  graph.set_entity_attr<NodeName>(node_b, NodeName{"b"});
+  graph.set_entity_attr<NodeName>(node_c, NodeName{"c"});
+
+  auto edge_a_b = graph.create_edge(node_a, node_b).value();
+  auto edge_b_c = graph.create_edge(node_b, node_c).value();
+
+  graph.set_entity_attr<attrs::Label>(
+      node_a, attrs::Label(attrtypes::Label<>("node \\N of \\G")));
+  graph.set_entity_attr<attrs::XLabel>(node_a, attrs::XLabel("x: \\L"));
+  graph.set_entity_attr<attrs::Label>(
+      edge_a_b, attrs::Label(attrtypes::Label<>("\\E")));
+  graph.set_entity_attr<attrs::HeadLabel>(
+      edge_a_b, attrs::HeadLabel(attrtypes::Label<>("to \\H")));
+  graph.set_entity_attr<attrs::TailLabel>(
+      edge_b_c, attrs::TailLabel(attrtypes::Label<>("from \\T")));
+  graph.set_entity_attr<attrs::LabelView>(
+      node_c, attrs::LabelView(
+        attrtypes::Label<std::string_view>(graph.intern("\\N view"))));
+
+  const auto labels = passes::expand_labels(graph, name_getter(graph), "G");
+
+  REQUIRE(labels.size() == 6);
+
+  REQUIRE(labels.find(node_a, LabelKind::label) == "node a of G");
+  REQUIRE(labels.find(node_a, LabelKind::xlabel) == "x: node \\N of \\G");
+  REQUIRE(labels.find(edge_a_b, LabelKind::label) == "a->b");
+  REQUIRE(labels.find(edge_a_b, LabelKind::headlabel) == "to b");
+  REQUIRE(labels.find(edge_b_c, LabelKind::taillabel) == "from b");
+  REQUIRE(labels.find(node_c, LabelKind::label) == "c view");
+
+  REQUIRE_FALSE(labels.find(node_b, LabelKind::label).has_value());
+  REQUIRE_FALSE(labels.find(edge_b_c, LabelKind::label).has_value());
+
+  SECTION("same output regardless of thread count")
+  {
+    const auto single = passes::expand_labels(graph, name_getter(graph), "G", 1);
+
+    REQUIRE(single.size() == labels.size());
+    for (std::size_t i = 0; i < single.size(); ++i)
+      REQUIRE(single.str(single.items()[i]) == labels.str(labels.items()[i]));
+  }
+}
+
+TEST_CASE("[passes::expand_labels::many]")
+{
+  using Graph = graph::Graph<registry::EnTTRegistry>;
+  using passes::LabelKind;
+
+  Graph graph;
+
+  std::vector<Graph::NodeId> nodes{};
+  for (int i = 0; i < 20000; ++i) {
+    auto node_id = graph.create_node();
+    graph.set_entity_attr<NodeName>(node_id, NodeName{"n" + std::to_string(i)});
+    graph.set_entity_attr<attrs::Label>(
+        node_id, attrs::Label(attrtypes::Label<>("\\N!")));
+    nodes.push_back(node_id);
+  }
+
+  const auto labels = passes::expand_labels(graph, name_getter(graph), {}, 4);
+
+  REQUIRE(labels.size() == nodes.size());
+  for (std::size_t i = 0; i < nodes.size(); i += 997)
+    REQUIRE(labels.find(nodes[i], LabelKind::label)
+            == "n" + std::to_string(i) + "!");
+}
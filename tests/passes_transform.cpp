@@ -0,0 +1,197 @@
+#include <cstddef>
+#include <random>
+#include <cmath>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+#include <gvizard/graph/graph.hpp>
+#include <gvizard/registry/entt_registry.hpp>
+#include <gvizard/passes/transform.hpp>
+
+#include <gvizard/attrs/pos.hpp>
+
+using namespace gviz;
+
+namespace {
+
+using Graph = graph::Graph<registry::EnTTRegistry, graph::GraphDir::directed>;
+
+attrs::PosType point_at(double x, double y)
+{
+  return attrs::PosType(attrtypes::PointType<double>(x, y));
+}
+
+attrtypes::Point2D<double> point_of(const Graph& graph, Graph::NodeId node)
+{
+  const auto pos = graph.get_entity_attr<attrs::Pos>(node);
+  return attrtypes::Point2D<double>(
+    std::get<attrtypes::PointType<double>>(*pos->get_value()));
+}
+
+}  // namespace
+
+TEST_CASE("[passes::GeometryBuffer]")
+{
+  Graph graph;
+
+  auto node_a = graph.create_node();
+  auto node_b = graph.create_node();
+  auto unplaced = graph.create_node();
+  graph.set_entity_attr<attrs::Pos>(node_a, point_at(0., 0.));
+  graph.set_entity_attr<attrs::Pos>(
+    node_b, attrs::PosType(attrtypes::PointType<double>(100., 0., 7.)));
+
+  attrtypes::Spline<> spline{};
+  spline.set_point(attrtypes::spline_point_type(0., 10.));
+  spline.add_triples({ attrtypes::spline_point_type(30., 20.),
+                       attrtypes::spline_point_type(70., 20.),
+                       attrtypes::spline_point_type(100., 10.) });
+  spline.set_endp(attrtypes::spline_point_type(100., 5.));
+  attrtypes::SplineType<std::vector> splines{};
+  splines.add_spline(spline);
+
+  auto edge = graph.create_edge(node_a, node_b).value();
+  graph.set_entity_attr<attrs::Pos>(edge, attrs::PosType(splines));
+  graph.create_edge(node_b, unplaced);
+
+  auto buffer = passes::gather_geometry(graph);
+  using Buffer = decltype(buffer);
+
+  // nodes first, then the edge's point, triple and end.
+  REQUIRE(buffer.size() == 7);
+  REQUIRE(buffer.node_points() == 2);
+  REQUIRE(buffer.edges.size() == 1);
+  REQUIRE_FALSE(Buffer::find(buffer.nodes, unplaced));
+
+  const auto *span = Buffer::find(buffer.edges, edge);
+  REQUIRE(span);
+  REQUIRE(span->end - span->begin == 5);
+  REQUIRE(buffer.xs[span->begin + 2] == 70.);
+  REQUIRE(buffer.ys[span->end - 1] == 5.);
+  REQUIRE(buffer.zs.size() == buffer.size());
+  REQUIRE(buffer.zs[Buffer::find(buffer.nodes, node_b)->begin] == 7.);
+
+  const auto box = *buffer.extent();
+  REQUIRE(box.llx == 0.);
+  REQUIRE(box.lly == 0.);
+  REQUIRE(box.urx == 100.);
+  REQUIRE(box.ury == 20.);
+
+  buffer.apply(passes::Affine::translation(1., 2.));
+  passes::scatter_geometry(graph, buffer);
+
+  REQUIRE(point_of(graph, node_a).x == 1.);
+  const auto moved = graph.get_entity_attr<attrs::Pos>(node_b);
+  const auto at = attrtypes::Point3D<double>(
+    std::get<attrtypes::PointType<double>>(*moved->get_value()));
+  REQUIRE(at.x == 101.);
+  REQUIRE(at.y == 2.);
+  REQUIRE(at.z == 7.);
+
+  const auto curve = std::get<attrtypes::SplineType<std::vector>>(
+    *graph.get_entity_attr<attrs::Pos>(edge)->get_value());
+  const auto endp = attrtypes::Point2D<double>(*curve.splines[0].endp);
+  REQUIRE(endp.x == 101.);
+  REQUIRE(endp.y == 7.);
+
+  SECTION("kernels agree with the map one point at a time")
+  {
+    std::mt19937 random(7);
+    std::uniform_real_distribution<double> coord(-1000., 1000.);
+
+    passes::GeometryBuffer<Graph::entity_type> many{};
+    for (std::size_t i = 0; i < 1003; ++i) {
+      many.xs.push_back(coord(random));
+      many.ys.push_back(coord(random));
+    }
+    const auto map = passes::Affine::rotation(33.)
+                       .then(passes::Affine::scaling(2., .5))
+                       .then(passes::Affine::translation(-5., 9.));
+    const auto xs = many.xs;
+    const auto ys = many.ys;
+
+    const auto mapped = *many.extent(map);
+    many.apply(map, 1);
+
+    layout::Box expected = passes::detail::no_box;
+    for (std::size_t i = 0; i < xs.size(); ++i) {
+      const auto [x, y] = map(xs[i], ys[i]);
+      REQUIRE(many.xs[i] == Approx(x));
+      REQUIRE(many.ys[i] == Approx(y));
+      passes::detail::add_box(expected, layout::Box{ x, y, x, y });
+    }
+    REQUIRE(mapped.llx == Approx(expected.llx));
+    REQUIRE(mapped.ury == Approx(expected.ury));
+  }
+}
+
+TEST_CASE("[passes::transform_layout]")
+{
+  Graph graph;
+
+  // a square, nodes being 54 by 36 points by default.
+  auto node_a = graph.create_node();
+  auto node_b = graph.create_node();
+  auto node_c = graph.create_node();
+  graph.set_entity_attr<attrs::Pos>(node_a, point_at(0., 0.));
+  graph.set_entity_attr<attrs::Pos>(node_b, point_at(100., 100.));
+  graph.set_entity_attr<attrs::Pos>(node_c, point_at(0., 100.));
+  graph.create_edge(node_a, node_b);
+
+  passes::TransformOptions options{};
+  options.pad = 0.;
+
+  SECTION("moved off the origin by pad and margin")
+  {
+    options.pad = 1.;
+    options.margin = attrs::MarginType(attrtypes::PointType<double>(0., .5));
+    passes::transform_layout(graph, options);
+
+    REQUIRE(point_of(graph, node_a).x == Approx(72. + 27.));
+    REQUIRE(point_of(graph, node_a).y == Approx(108. + 18.));
+  }
+
+  SECTION("first edge turned by normalize")
+  {
+    options.normalize = true;
+    passes::transform_layout(graph, options);
+
+    const auto a = point_of(graph, node_a);
+    const auto b = point_of(graph, node_b);
+    REQUIRE(b.y == Approx(a.y));
+    REQUIRE(b.x - a.x == Approx(100. * std::sqrt(2.)));
+  }
+
+  SECTION("scaled up to ratio")
+  {
+    // the box, of 154 by 136 points, is made twice as high as wide.
+    options.ratio = attrs::RatioType(2.);
+    const auto map = passes::transform_layout(graph, options);
+
+    REQUIRE(map.xx == Approx(1.));
+    REQUIRE(map.yy == Approx(2. * 154. / 136.));
+  }
+
+  SECTION("scaled down to size")
+  {
+    options.size = attrs::SizeType(1.);
+    const auto map = passes::transform_layout(graph, options);
+
+    REQUIRE(map.xx == Approx(72. / 154.));
+    REQUIRE(map.yy == map.xx);
+  }
+
+  SECTION("turned by landscape")
+  {
+    options.landscape = true;
+    passes::transform_layout(graph, options);
+
+    // a lies right of c, at the bottom.
+    const auto a = point_of(graph, node_a);
+    const auto c = point_of(graph, node_c);
+    REQUIRE(a.x - c.x == Approx(100.));
+    REQUIRE(a.y == Approx(c.y));
+    REQUIRE(c.x == Approx(27.));
+  }
+}
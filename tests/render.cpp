@@ -0,0 +1,392 @@
+#include <cstddef>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+#include <gvizard/graph/graph.hpp>
+#include <gvizard/registry/entt_registry.hpp>
+#include <gvizard/render/geometry.hpp>
+#include <gvizard/render/image.hpp>
+#include <gvizard/render/raster.hpp>
+#include <gvizard/render/svg.hpp>
+#include <gvizard/render/visuals.hpp>
+
+#include <gvizard/attrs/fillcolor.hpp>
+#include <gvizard/attrs/label_related.hpp>
+#include <gvizard/attrs/pos.hpp>
+#include <gvizard/attrs/shape.hpp>
+#include <gvizard/attrs/style.hpp>
+
+using namespace gviz;
+
+namespace {
+
+using Graph = graph::Graph<registry::EnTTRegistry, graph::GraphDir::directed>;
+
+using attrtypes::ShapeType;
+
+std::size_t count_of(const std::string& str, const std::string& what)
+{
+  std::size_t count = 0;
+  for (auto pos = str.find(what); pos != std::string::npos;
+       pos = str.find(what, pos + what.size()))
+    ++count;
+  return count;
+}
+
+attrs::PosType point_pos(double x, double y)
+{
+  return attrtypes::PointType<double>(x, y);
+}
+
+}  // namespace
+
+TEST_CASE("[render::geometry]")
+{
+  using render::Box;
+  using render::Point;
+
+  SECTION("boxes")
+  {
+    Box box{};
+    REQUIRE(box.empty());
+
+    box.expand(Point{ 1., 2. }).expand(Point{ -1., 5. });
+    REQUIRE(box == Box{ -1., 2., 1., 5. });
+    REQUIRE(box.width() == 2.);
+
+    REQUIRE(box.intersects(Box{ 1., 5., 2., 6. }));
+    REQUIRE_FALSE(box.intersects(Box{ 1.5, 0., 2., 6. }));
+    REQUIRE_FALSE(box.intersects(Box{}));
+  }
+
+  SECTION("outlines")
+  {
+    for (auto shape : { ShapeType::box, ShapeType::pentagon,
+                        ShapeType::hexagon, ShapeType::star,
+                        ShapeType::invhouse }) {
+      const auto outline = render::outline_of(shape);
+      REQUIRE(outline.kind == render::OutlineKind::polygon);
+
+      Box box{};
+      for (std::size_t i = 0; i < outline.count; ++i)
+        box.expand(outline.vertices[i]);
+
+      REQUIRE(box.llx == Approx(-1.));
+      REQUIRE(box.ury == Approx(1.));
+    }
+
+    REQUIRE(render::outline_of(ShapeType::doublecircle).peripheries == 2);
+    REQUIRE(render::outline_of(ShapeType::plaintext).kind
+            == render::OutlineKind::none);
+  }
+
+  SECTION("arrows")
+  {
+    using attrtypes::ArrowPrimaryShape;
+    using attrtypes::ArrowSide;
+
+    std::vector<render::ArrowPart> parts{};
+    const auto collect = [&](const render::ArrowPart& part) {
+      parts.push_back(part);
+    };
+
+    render::for_each_arrow_part(
+        attrtypes::ArrowType{ ArrowPrimaryShape::normal },
+        Point{ 20., 0. }, Point{ 0., 0. }, 1., collect);
+
+    REQUIRE(parts.size() == 1);
+    REQUIRE(parts[0].count == 3);
+    REQUIRE(parts[0].points[0] == Point{ 0., 0. });
+    REQUIRE(parts[0].points[1].x == Approx(render::arrow_length));
+
+    // stacked shapes, of which only the left half of the second.
+    parts.clear();
+    render::for_each_arrow_part(
+        attrtypes::ArrowType{
+          ArrowPrimaryShape::dot,
+          attrtypes::ArrowShape{ ArrowPrimaryShape::inv, ArrowSide::left } },
+        Point{ 0., 30. }, Point{ 0., 0. }, 1., collect);
+
+    REQUIRE(parts.size() == 2);
+    REQUIRE(parts[0].kind == render::PartKind::ellipse);
+    REQUIRE(parts[1].points[0].y == Approx(2. * render::arrow_length));
+    for (std::size_t i = 0; i < parts[1].count; ++i)
+      REQUIRE(parts[1].points[i].x <= 0.);
+  }
+}
+
+TEST_CASE("[render::SvgWriter]")
+{
+  SECTION("numbers")
+  {
+    std::ostringstream out{};
+    {
+      render::detail::SvgBuffer buffer(out, 2, 64);
+      for (double value : { 1.5, -0.004, 2., 3.14159, -12.345, 1e6 }) {
+        buffer.put_number(value);
+        buffer.put(' ');
+      }
+      buffer.put_fixed(2. / 3., 3);
+      buffer.flush();
+    }
+
+    REQUIRE(out.str() == "1.5 0 2 3.14 -12.35 1000000 0.667");
+  }
+
+  Graph graph;
+
+  const auto node_a = graph.create_node();
+  const auto node_b = graph.create_node();
+  graph.set_node_name(node_a, "a&b");
+  graph.set_node_name(node_b, "b");
+
+  graph.set_entity_attr<attrs::Pos>(node_a, point_pos(0., 0.));
+  graph.set_entity_attr<attrs::Pos>(node_b, point_pos(200., 100.));
+
+  graph.set_entity_attr<attrs::Shape>(node_b, ShapeType::box);
+  graph.set_entity_attr<attrs::Style>(
+      node_b, attrtypes::Style(attrtypes::NodeStyleOnly::filled));
+  graph.set_entity_attr<attrs::FillColor>(
+      node_b, attrs::FillColorType(attrtypes::ColorList<colors::Color>{
+        { colors::X11ColorEnum::red, 0. },
+        { colors::RGB{ 0, 0, 255 }, 0. } }));
+  graph.set_entity_attr<attrs::Label>(
+      node_b, attrs::Label(attrtypes::Label<>("one\\ltwo")));
+
+  const auto edge = graph.create_edge(node_a, node_b).value();
+
+  attrtypes::Spline<> spline{};
+  spline.set_point({ 20., 10. })
+        .add_triples({ { 60., 30. }, { 120., 60. }, { 160., 80. } })
+        .set_endp({ 170., 85. });
+  graph.set_entity_attr<attrs::Pos>(
+      edge, attrs::PosType(attrtypes::SplineType<>{}.add_spline(spline)));
+
+  SECTION("graph")
+  {
+    std::ostringstream out{};
+    render::write_svg(out, graph);
+    const auto svg = out.str();
+
+    REQUIRE(svg.rfind("<?xml", 0) == 0);
+    REQUIRE(svg.find("viewBox=\"-31.5 -122.5 263 145\"")
+            != std::string::npos);
+    REQUIRE(count_of(svg, "<g class=\"node\">") == 2);
+    REQUIRE(count_of(svg, "<g class=\"edge\">") == 1);
+
+    REQUIRE(svg.find("<ellipse fill=\"none\" stroke=\"#000000\" cx=\"0\" "
+                     "cy=\"0\" rx=\"27\" ry=\"18\"/>") != std::string::npos);
+    REQUIRE(svg.find(">a&amp;b</text>") != std::string::npos);
+
+    REQUIRE(svg.find("<linearGradient id=\"g0\"><stop offset=\"0\" "
+                     "stop-color=\"#ff0000\"/>") != std::string::npos);
+    REQUIRE(svg.find("<polygon fill=\"url(#g0)\"") != std::string::npos);
+    REQUIRE(svg.find("text-anchor=\"start\"") != std::string::npos);
+    REQUIRE(svg.find(">two</text>") != std::string::npos);
+
+    REQUIRE(svg.find("d=\"M20,-10C60,-30 120,-60 160,-80\"")
+            != std::string::npos);
+    REQUIRE(count_of(svg, "<polygon fill=\"#000000\"") == 1);
+    REQUIRE(svg.rfind("</svg>\n") == svg.size() - 7);
+  }
+
+  SECTION("viewport culling")
+  {
+    render::SvgOptions options{};
+    options.viewport =
+      attrtypes::ViewPortXY{ { 100., 100. }, 2., { 0., 0. } };
+
+    std::ostringstream out{};
+    render::write_svg(out, graph, options);
+    const auto svg = out.str();
+
+    REQUIRE(svg.find("width=\"100pt\" height=\"100pt\" "
+                     "viewBox=\"-25 -25 50 50\"") != std::string::npos);
+    REQUIRE(count_of(svg, "<g class=\"node\">") == 1);
+    REQUIRE(count_of(svg, "<g class=\"edge\">") == 1);
+
+    // centered on a node by its name.
+    options.viewport = attrtypes::ViewPortS{ { 100., 100. }, 1., "b" };
+
+    out.str({});
+    render::write_svg(out, graph, options);
+
+    REQUIRE(out.str().find("viewBox=\"150 -150 100 100\"")
+            != std::string::npos);
+    REQUIRE(count_of(out.str(), "<g class=\"node\">") == 1);
+  }
+}
+
+TEST_CASE("[render::RasterCanvas]")
+{
+  using render::Box;
+  using render::Point;
+
+  const colors::RGBA white{ 255, 255, 255, 255 };
+  const colors::RGBA red{ 255, 0, 0, 255 };
+
+  // a 100 x 50 point drawing, a pixel per point.
+  render::NodeVisual node{};
+  node.center  = Point{ 50., 25. };
+  node.width   = 40.;
+  node.height  = 20.;
+  node.outline = render::outline_of(ShapeType::box);
+  node.fill.emplace_back(red, 0.);
+
+  const auto draw = [&](bool antialias, std::size_t tile, unsigned threads) {
+    render::RasterCanvas canvas(Box{ 0., 0., 100., 50. }, 100, 50,
+                                antialias);
+    canvas.draw_node(node);
+
+    render::Image image(100, 50);
+    canvas.render(image, tile, threads);
+    return image;
+  };
+
+  SECTION("fills and outlines")
+  {
+    const auto image = draw(false, 64, 1);
+
+    REQUIRE(image.at(50, 25) == red);
+    REQUIRE(image.at(0, 0) == white);
+    REQUIRE(image.at(95, 25) == white);
+
+    // the outline is black, a pixel wide around the box's border.
+    REQUIRE(image.at(29, 25) == colors::RGBA{ 0, 0, 0, 255 });
+    REQUIRE(image.at(30, 25) == red);
+    REQUIRE(image.at(28, 25) == white);
+  }
+
+  SECTION("anti-aliasing")
+  {
+    node.center.x    = 50.5;
+    node.outline     = render::outline_of(ShapeType::ellipse);
+    node.peripheries = 0;
+
+    const auto image = draw(true, 64, 1);
+
+    REQUIRE(image.at(50, 25) == red);
+
+    // a pixel on the ellipse's right, about half of it inside.
+    const auto border = image.at(70, 25);
+    REQUIRE(border.r == 255);
+    REQUIRE(border.g > 64);
+    REQUIRE(border.g < 192);
+  }
+
+  SECTION("tiles and threads don't change the image")
+  {
+    node.fill.emplace_back(colors::RGBA{ 0, 0, 255, 128 }, 0.);
+    node.radial = true;
+
+    const auto single = draw(true, 512, 1);
+    const auto tiled  = draw(true, 8, 4);
+
+    REQUIRE(std::equal(single.data(), single.data() + 100 * 50,
+                       tiled.data()));
+
+    // radial gradient from red at its center outwards.
+    REQUIRE(single.at(50, 25).b < 32);
+    REQUIRE(single.at(68, 25).b > 192);
+  }
+
+  SECTION("size must match")
+  {
+    render::RasterCanvas canvas(Box{ 0., 0., 100., 50. }, 100, 50);
+    render::Image image(10, 10);
+    REQUIRE_THROWS_AS(canvas.render(image), std::invalid_argument);
+  }
+}
+
+TEST_CASE("[render::rasterize]")
+{
+  Graph graph;
+
+  const auto node_a = graph.create_node();
+  const auto node_b = graph.create_node();
+
+  graph.set_entity_attr<attrs::Pos>(node_a, point_pos(0., 0.));
+  graph.set_entity_attr<attrs::Pos>(node_b, point_pos(0., 100.));
+  graph.set_entity_attr<attrs::Style>(
+      node_b, attrtypes::Style(attrtypes::NodeStyleOnly::filled));
+
+  const auto edge = graph.create_edge(node_a, node_b).value();
+
+  attrtypes::Spline<> spline{};
+  spline.set_point({ 0., 18. })
+        .add_triples({ { 0., 40. }, { 0., 60. }, { 0., 72. } })
+        .set_endp({ 0., 82. });
+  graph.set_entity_attr<attrs::Pos>(
+      edge, attrs::PosType(attrtypes::SplineType<>{}.add_spline(spline)));
+
+  render::RasterOptions options{};
+  options.dpi       = 72.;
+  options.antialias = false;
+
+  const auto image = render::rasterize(graph, options);
+
+  // node boxes padded by half a pen and 4 points, left at -31.5 and top
+  // at 122.5.
+  REQUIRE(image.width() == 63);
+  REQUIRE(image.height() == 145);
+
+  const auto at = [&](double x, double y) {
+    return image.at(std::size_t(x + 31.5), std::size_t(122.5 - y));
+  };
+
+  const colors::RGBA white{ 255, 255, 255, 255 };
+  const colors::RGBA black{ 0, 0, 0, 255 };
+
+  REQUIRE(at(0., 0.) == white);
+  REQUIRE(at(0., 50.) == black);      // the edge
+  REQUIRE(at(0., 78.) == black);      // its arrowhead
+  REQUIRE(at(1., 76.) == black);
+  REQUIRE(at(3., 76.) == white);
+  REQUIRE(at(10., 50.) == white);
+
+  // filled by default with light gray.
+  REQUIRE(at(0., 100.) == colors::RGBA{ 211, 211, 211, 255 });
+
+  options.max_height = 29;
+  const auto thumbnail = render::rasterize(graph, options);
+  REQUIRE(thumbnail.height() == 29);
+  REQUIRE(thumbnail.width() == 13);
+}
+
+TEST_CASE("[render::Image]")
+{
+  render::Image image(2, 1);
+  image.row(0)[1] = colors::RGBA{ 255, 0, 0, 128 }.to_binary();
+
+  SECTION("ppm")
+  {
+    std::ostringstream out{};
+    render::write_ppm(out, image);
+
+    // transparent pixels are blended over white.
+    REQUIRE(out.str() == std::string("P6\n2 1\n255\n"
+                                     "\xff\xff\xff\xff\x7f\x7f", 17));
+  }
+
+  SECTION("png")
+  {
+    std::ostringstream out{};
+    render::write_png(out, image, 0);
+    const auto png = out.str();
+
+    REQUIRE(png.rfind("\x89PNG\r\n\x1a\n", 0) == 0);
+    REQUIRE(png.substr(12, 4) == "IHDR");
+
+    // stored uncompressed: 19 bytes of zlib around 9 of pixels.
+    REQUIRE(png.size() == 8 + 25 + 12 + 20 + 12);
+    REQUIRE(png.substr(png.size() - 8)
+            == std::string("IEND\xae\x42\x60\x82", 8));
+
+    std::ostringstream empty{};
+    REQUIRE_THROWS_AS(render::write_png(empty, render::Image{}),
+                      std::invalid_argument);
+  }
+}
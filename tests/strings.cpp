@@ -0,0 +1,130 @@
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+#include <gvizard/gvizgraph.hpp>
+#include <gvizard/strings/hash.hpp>
+#include <gvizard/strings/name_map.hpp>
+#include <gvizard/strings/string_pool.hpp>
+
+using namespace gviz;
+
+TEST_CASE("[strings::fnv1a]")
+{
+  static_assert(strings::fnv1a("") == strings::fnv1a_offset_basis);
+  static_assert(strings::fnv1a("a") != strings::fnv1a("b"));
+  static_assert(strings::fnv1a("a", 1) != strings::fnv1a("a", 2));
+  static_assert(strings::fnv1a_icase("LightBlue")
+                == strings::fnv1a("lightblue"));
+
+  REQUIRE(strings::StringHash{}(std::string("abc"))
+          == strings::StringHash{}(std::string_view("abc")));
+}
+
+TEST_CASE("[strings::StringArena]")
+{
+  strings::StringArena arena{64};
+
+  const auto small = arena.store("small");
+  const auto large = arena.store(std::string(100, 'x'));
+  const auto empty = arena.store("");
+
+  REQUIRE(small == "small");
+  REQUIRE(large == std::string(100, 'x'));
+  REQUIRE(empty.empty());
+  REQUIRE(arena.used() == 105);
+
+  std::vector<std::string_view> views{};
+  for (int i = 0; i < 1000; ++i)
+    views.push_back(arena.store(std::to_string(i)));
+
+  // moving the arena doesn't move its blocks.
+  strings::StringArena moved = std::move(arena);
+
+  REQUIRE(small == "small");
+  for (int i = 0; i < 1000; ++i)
+    REQUIRE(views[i] == std::to_string(i));
+
+  REQUIRE(moved.reserved() >= moved.used());
+}
+
+TEST_CASE("[strings::StringPool]")
+{
+  strings::StringPool pool{};
+
+  const auto a = pool.intern("node_a");
+  const auto b = pool.intern(std::string("node_b"));
+  const auto a_again = pool.intern(std::string("node_") + "a");
+
+  REQUIRE(a == "node_a");
+  REQUIRE(b == "node_b");
+  REQUIRE(a.data() == a_again.data());
+  REQUIRE(pool.size() == 2);
+
+  REQUIRE(pool.find("node_b").data() == b.data());
+  REQUIRE(pool.find("node_c").empty());
+  REQUIRE_FALSE(pool.contains("node_c"));
+  REQUIRE(pool.intern("").empty());
+
+  SECTION("views stay valid while pool grows")
+  {
+    std::vector<std::string_view> views{};
+    for (int i = 0; i < 100000; ++i)
+      views.push_back(pool.intern("v" + std::to_string(i)));
+
+    REQUIRE(pool.size() == 100002);
+    REQUIRE(a == "node_a");
+
+    for (int i = 0; i < 100000; i += 113) {
+      REQUIRE(views[i] == "v" + std::to_string(i));
+      REQUIRE(pool.find(views[i]).data() == views[i].data());
+    }
+  }
+}
+
+TEST_CASE("[strings::NameMap]")
+{
+  strings::NameMap<int> map{};
+
+  REQUIRE_FALSE(map.insert("", 1));
+  REQUIRE(map.insert("a", 1));
+  REQUIRE_FALSE(map.insert("a", 2));
+  REQUIRE(map.find("a") == 1);
+  REQUIRE_FALSE(map.find("b").has_value());
+
+  REQUIRE(map.erase("a"));
+  REQUIRE_FALSE(map.erase("a"));
+  REQUIRE(map.empty());
+
+  // erase/insert cycles reuse tombstones instead of growing forever.
+  for (int i = 0; i < 1000; ++i) {
+    REQUIRE(map.insert("a", i));
+    REQUIRE(map.find("a") == i);
+    REQUIRE(map.erase("a"));
+  }
+}
+
+TEST_CASE("[strings::StringPool::graph]")
+{
+  GvizGraph<> gviz{};
+
+  auto node_a = gviz.graph.create_node();
+  auto node_b = gviz.graph.create_node();
+
+  gviz.set_node_label_view(node_a, "shared \\N");
+  gviz.set_node_label_view(node_b, std::string("shared \\N"));
+
+  const auto label_a = gviz.get_node_label_view(node_a);
+  const auto label_b = gviz.get_node_label_view(node_b);
+
+  REQUIRE(label_a);
+  REQUIRE(label_b);
+  REQUIRE(label_a->get_value().get_format() == "shared \\N");
+  REQUIRE(label_a->get_value().get_format().data()
+          == label_b->get_value().get_format().data());
+  REQUIRE(label_a->get_value().get_occurences().node == 1);
+
+  REQUIRE(gviz.graph.get_string_pool().size() == 1);
+}